@@ -15,6 +15,11 @@
  */
 
 #include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <algorithm>
+#include <memory>
+#include <arpa/inet.h>
 #include "logger.h"
 #include "producerstatetable.h"
 #include "macaddress.h"
@@ -352,165 +357,188 @@ bool NatMgr::warmBootingInProgress(void)
     return false;
 }
 
-/* To flush all NAT entries */
-void NatMgr::flushAllNatEntries(void)
+/* To get the IPv4 address in network order used by the conntrack requests */
+static uint32_t conntrackIp(const string &ip)
 {
-    std::string res;
-    const std::string cmds = std::string("") + CONNTRACK_CMD + FLUSH;
-    int ret = swss::exec(cmds, res);
+    struct in_addr addr;
 
-    if (ret)
+    if (inet_pton(AF_INET, ip.c_str(), &addr) != 1)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("Invalid conntrack IP address %s", ip.c_str());
+        return 0;
     }
-    else
+    return addr.s_addr;
+}
+
+static uint16_t conntrackPort(const string &port)
+{
+    return static_cast<uint16_t>(strtoul(port.c_str(), NULL, 10));
+}
+
+static uint8_t conntrackProtocol(const string &prototype)
+{
+    if (prototype == IP_PROTOCOL_TCP)
+    {
+        return IPPROTO_TCP;
+    }
+    else if (prototype == IP_PROTOCOL_UDP)
     {
-        SWSS_LOG_INFO("Cleared the All NAT Entries");
+        return IPPROTO_UDP;
     }
+    return 0;
 }
 
-/* To Update a conntrack entry for the Dynamic Single NAT entry in the kernel */
-void NatMgr::updateDynamicSingleNatConnTrackTimeout(string key, int timeout)
+/* To apply the kernel updates queued by the last task or notifications.
+ * Iptables rules go first, so that no new connection uses a rule that is
+ * removed after its conntrack entries are. */
+void NatMgr::commitKernelUpdates()
 {
-    std::string res;
-    std::string cmds = std::string("") + CONNTRACK_CMD;
-    IpAddress   ip_address = IpAddress(key);
+    SWSS_LOG_ENTER();
 
-    cmds += (" -U -s " + ip_address.to_string() + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    /* Failed commands are logged with the rules they set */
+    vector<string> failed = commitIptablesCmds();
 
-    if (ret)
+    if (!failed.empty())
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+        SWSS_LOG_ERROR("%zu iptables updates failed", failed.size());
     }
-    else
+
+    if (m_conntrack.pending())
+    {
+        /* Failed requests are logged by the executor */
+        vector<ConntrackExecutor::Error> errors;
+
+        if (!m_conntrack.flush(errors))
+        {
+            SWSS_LOG_ERROR("%zu conntrack requests failed", errors.size());
+        }
+    }
+}
+
+/* To flush all NAT entries */
+void NatMgr::flushAllNatEntries(void)
+{
+    SWSS_LOG_INFO("Clear all the NAT conntrack entries");
+
+    m_conntrack.flushTable();
+}
+
+/* To Update a conntrack entry for the Dynamic Single NAT entry in the kernel */
+void NatMgr::updateDynamicSingleNatConnTrackTimeout(string key, int timeout)
+{
+    ConntrackExecutor::Filter filter;
+
+    filter.src = conntrackIp(key);
+    if (!filter.src)
     {
-        SWSS_LOG_INFO("Updated the active NAT conntrack entry with src-ip %s, timeout %u",
-                      ip_address.to_string().c_str(), timeout);
+        return;
     }
+
+    m_conntrack.updateMatching(filter, timeout);
+
+    SWSS_LOG_INFO("Update the active NAT conntrack entry with src-ip %s, timeout %u",
+                  key.c_str(), timeout);
 }
 
 /* To Update a conntrack entry for the Dynamic Single NAPT entry in the kernel */
 void NatMgr::updateDynamicSingleNaptConnTrackTimeout(string key, int timeout)
 {
-    std::string     res;
     vector<string>  keys = tokenize(key, ':');
-    IpAddress       ip_address = IpAddress(keys[1]);
-    int             l4_port = stoi(keys[2]);
     string          prototype = ((keys[0] == string("TCP")) ? "tcp" : "udp");
-    std::string     cmds = std::string("") + CONNTRACK_CMD;
-    
-    cmds += (" -U -s " + ip_address.to_string() + " -p " + prototype + " --orig-port-src " + to_string(l4_port) + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    ConntrackExecutor::Filter filter;
 
-    if (ret)
+    filter.protocol = conntrackProtocol(prototype);
+    filter.src      = conntrackIp(keys[1]);
+    filter.sport    = conntrackPort(keys[2]);
+    if (!filter.src)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Updated active NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, timeout %u",
-                      prototype.c_str(), ip_address.to_string().c_str(), l4_port, timeout);
+        return;
     }
+
+    m_conntrack.updateMatching(filter, timeout);
+
+    SWSS_LOG_INFO("Update active NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, timeout %u",
+                  prototype.c_str(), keys[1].c_str(), keys[2].c_str(), timeout);
 }
 
 /* To Update a conntrack entry for the Dynamic Twice NAT entry in the kernel */
 void NatMgr::updateDynamicTwiceNatConnTrackTimeout(string key, int timeout)
 {
-    std::string     res;
-    std::string     cmd = std::string("") + CONNTRACK_CMD;
     vector<string>  keys = tokenize(key, ':');
-    IpAddress       src_ip = IpAddress(keys[1]);
-    IpAddress       dst_ip = IpAddress(keys[1]);
+    ConntrackExecutor::Filter filter;
 
-    cmd += (" -U -s " + src_ip.to_string() + " -d " + dst_ip.to_string() + " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
+    /* Key is "src-ip:dst-ip" */
+    filter.src = conntrackIp(keys[0]);
+    filter.dst = conntrackIp(keys[1]);
+    if (!filter.src || !filter.dst)
+    {
+        return;
+    }
 
-    swss::exec(cmd, res);
+    m_conntrack.updateMatching(filter, timeout);
 
-    SWSS_LOG_INFO("Updated active Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
-                  src_ip.to_string().c_str(), dst_ip.to_string().c_str(), timeout);
+    SWSS_LOG_INFO("Update active Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
+                  keys[0].c_str(), keys[1].c_str(), timeout);
 }
 
 /* To Update a conntrack entry for the Dynamic Twice NAPT entry in the kernel */
 void NatMgr::updateDynamicTwiceNaptConnTrackTimeout(string key, int timeout)
 {
-    std::string     res;
-    std::string     cmd = std::string("") + CONNTRACK_CMD;
     vector<string>  keys = tokenize(key, ':');
-    IpAddress       src_ip      = IpAddress(keys[1]);
-    int             src_l4_port = stoi(keys[2]);
-    IpAddress       dst_ip      = IpAddress(keys[3]);
-    int             dst_l4_port = stoi(keys[4]);
     string          prototype = ((keys[0] == string("TCP")) ? "tcp" : "udp");
+    ConntrackExecutor::Filter filter;
 
-    cmd += (" -U -s " + src_ip.to_string() + " -p " + prototype + " --orig-port-src " + to_string(src_l4_port) +
-            " -d " + dst_ip.to_string() + " --orig-port-dst " + std::to_string(dst_l4_port) +
-            " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
+    filter.protocol = conntrackProtocol(prototype);
+    filter.src      = conntrackIp(keys[1]);
+    filter.sport    = conntrackPort(keys[2]);
+    filter.dst      = conntrackIp(keys[3]);
+    filter.dport    = conntrackPort(keys[4]);
+    if (!filter.src || !filter.dst)
+    {
+        return;
+    }
 
-    swss::exec(cmd, res);
+    m_conntrack.updateMatching(filter, timeout);
 
-    SWSS_LOG_INFO("Updated active Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, dst-ip %s, dst-port %d, timeout %u",
-                  prototype.c_str(), src_ip.to_string().c_str(), src_l4_port, dst_ip.to_string().c_str(), dst_l4_port, timeout);
+    SWSS_LOG_INFO("Update active Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, dst-ip %s, dst-port %s, timeout %u",
+                  prototype.c_str(), keys[1].c_str(), keys[2].c_str(), keys[3].c_str(), keys[4].c_str(), timeout);
 }
 
 /* To Add a dummy conntrack entry for the Static Single NAT entry in the kernel */
 void NatMgr::addConntrackStaticSingleNatEntry(const string &key)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD; 
     int timeout = NAT_TIMEOUT_MAX;
+    const ConntrackExecutor::Endpoint loopback = { conntrackIp("127.0.0.1"), 127 };
 
     if (m_staticNatEntry[key].nat_type == DNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Add static NAT conntrack entry with src-ip %s, timeout %d",
                       m_staticNatEntry[key].local_ip.c_str(), timeout);
 
-        cmds += (" -I -n " + key + ":1 -g 127.0.0.1:127" + " -p udp -t " + to_string(timeout) +
-                 " --src " + m_staticNatEntry[key].local_ip + " --sport 1 --dst 127.0.0.1 --dport 127 -u ASSURED " + REDIRECT_TO_DEV_NULL);
+        m_conntrack.create(IPPROTO_UDP, { conntrackIp(m_staticNatEntry[key].local_ip), 1 }, loopback,
+                           { conntrackIp(key), 1 }, loopback, timeout);
     }
     else if (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Add static NAT conntrack entry with src-ip %s, timeout %d",
                       key.c_str(), timeout);
 
-        cmds += (" -I -n " + m_staticNatEntry[key].local_ip + ":1 -g 127.0.0.1:127" + " -p udp -t " + to_string(timeout) +
-                 " --src " + key + " --sport 1 --dst 127.0.0.1 --dport 127 -u ASSURED " + REDIRECT_TO_DEV_NULL);
-    }
-
-    int ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added the static NAT conntrack entry");
+        m_conntrack.create(IPPROTO_UDP, { conntrackIp(key), 1 }, loopback,
+                           { conntrackIp(m_staticNatEntry[key].local_ip), 1 }, loopback, timeout);
     }
 }
 
 /* To Add a dummy conntrack entry for the Static Twice NAT entry in the kernel */
 void NatMgr::addConntrackStaticTwiceNatEntry(const string &snatKey, const string &dnatKey)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
     int timeout = NAT_TIMEOUT_MAX;
 
     SWSS_LOG_INFO("Add static Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
                   snatKey.c_str(), dnatKey.c_str(), timeout);
 
-    cmds += (" -I -n " + m_staticNatEntry[snatKey].local_ip + ":1" + " -g " + m_staticNatEntry[dnatKey].local_ip + ":1"
-             +  " -p udp" + " -t " + to_string(timeout) + " --src " + snatKey + " --sport 1" + " --dst " + dnatKey
-             +  " --dport 1" + " -u ASSURED " + REDIRECT_TO_DEV_NULL);
-
-    int ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added the static Twice NAT conntrack entry");
-    }
+    m_conntrack.create(IPPROTO_UDP, { conntrackIp(snatKey), 1 }, { conntrackIp(dnatKey), 1 },
+                       { conntrackIp(m_staticNatEntry[snatKey].local_ip), 1 },
+                       { conntrackIp(m_staticNatEntry[dnatKey].local_ip), 1 }, timeout);
 }
 
 /* To Add a dummy conntrack entry for the Static NAPT entry in the kernel,
@@ -518,18 +546,17 @@ void NatMgr::addConntrackStaticTwiceNatEntry(const string &snatKey, const string
 void NatMgr::addConntrackStaticSingleNaptEntry(const string &key)
 {
     int timeout = NAT_TIMEOUT_MAX;
-    std::string res, prototype, state, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> keys = tokenize(key, config_db_key_delimiter);
+    const ConntrackExecutor::Endpoint loopback = { conntrackIp("127.0.0.1"), 127 };
 
     if (keys[1] == to_upper(IP_PROTOCOL_UDP))
     {
         prototype = IP_PROTOCOL_UDP;
-        state = "";
     }
     else if (keys[1] == to_upper(IP_PROTOCOL_TCP))
     {
         prototype = IP_PROTOCOL_TCP;
-        state = " --state ESTABLISHED ";
     }
 
     if (m_staticNaptEntry[key].nat_type == DNAT_NAT_TYPE)
@@ -538,28 +565,18 @@ void NatMgr::addConntrackStaticSingleNaptEntry(const string &key)
         SWSS_LOG_INFO("Add static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, timeout %d",
                       prototype.c_str(), m_staticNaptEntry[key].local_ip.c_str(), m_staticNaptEntry[key].local_port.c_str(), timeout);
 
-        cmds += (" -I -n " + keys[0] + ":" + keys[2] + " -g 127.0.0.1:127" + " -p " + prototype + " -t " + to_string(timeout) +
-                 " --src " + m_staticNaptEntry[key].local_ip + " --sport " + m_staticNaptEntry[key].local_port + " --dst 127.0.0.1 --dport 127 -u ASSURED " 
-                 + state + REDIRECT_TO_DEV_NULL);
+        m_conntrack.create(conntrackProtocol(prototype),
+                           { conntrackIp(m_staticNaptEntry[key].local_ip), conntrackPort(m_staticNaptEntry[key].local_port) }, loopback,
+                           { conntrackIp(keys[0]), conntrackPort(keys[2]) }, loopback, timeout, true);
     }
     else if (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Add static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, timeout %d",
                       prototype.c_str(), keys[0].c_str(), keys[2].c_str(), timeout);
 
-        cmds += (" -I -n " + m_staticNaptEntry[key].local_ip + ":" + m_staticNaptEntry[key].local_port + " -g 127.0.0.1:127" + " -p " + prototype + " -t " + to_string(timeout) +
-                 " --src " + keys[0] + " --sport " + keys[2] + " --dst 127.0.0.1 --dport 127 -u ASSURED " +  state + REDIRECT_TO_DEV_NULL);
-    }
-
-    int ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added the static NAPT conntrack entry");
+        m_conntrack.create(conntrackProtocol(prototype), { conntrackIp(keys[0]), conntrackPort(keys[2]) }, loopback,
+                           { conntrackIp(m_staticNaptEntry[key].local_ip), conntrackPort(m_staticNaptEntry[key].local_port) },
+                           loopback, timeout, true);
     }
 }
 
@@ -567,85 +584,85 @@ void NatMgr::addConntrackStaticSingleNaptEntry(const string &key)
 void NatMgr::addConntrackStaticTwiceNaptEntry(const string &snatKey, const string &dnatKey)
 {
     int timeout = NAT_TIMEOUT_MAX;
-    std::string res, prototype, state, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> snatKeys = tokenize(snatKey, config_db_key_delimiter);
     vector<string> dnatKeys = tokenize(dnatKey, config_db_key_delimiter);
 
     if (snatKeys[1] == to_upper(IP_PROTOCOL_UDP))
     {
         prototype = IP_PROTOCOL_UDP;
-        state = "";
     }
     else if (snatKeys[1] == to_upper(IP_PROTOCOL_TCP))
     {
         prototype = IP_PROTOCOL_TCP;
-        state = " --state ESTABLISHED ";
     }
 
     SWSS_LOG_DEBUG("Add static Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, dst-ip %s, dst-port %s, timeout %u",
                    prototype.c_str(), snatKeys[0].c_str(), snatKeys[2].c_str(), dnatKeys[0].c_str(), dnatKeys[2].c_str(), timeout);
 
-    cmds += (" -I -n " + m_staticNaptEntry[snatKey].local_ip + ":" + m_staticNaptEntry[snatKey].local_port + " -g " + m_staticNaptEntry[dnatKey].local_ip + ":"
-             + m_staticNaptEntry[dnatKey].local_port +  " -p " + prototype + " -t " + to_string(timeout)
-             + " --src " + snatKeys[0] + " --sport " + snatKeys[2] + " --dst " + dnatKeys[0] + " --dport " + dnatKeys[2] + " -u ASSURED " 
-             +  state + REDIRECT_TO_DEV_NULL);
-
-    int ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added the static Twice NAPT conntrack entry");
-    }
+    m_conntrack.create(conntrackProtocol(prototype),
+                       { conntrackIp(snatKeys[0]), conntrackPort(snatKeys[2]) },
+                       { conntrackIp(dnatKeys[0]), conntrackPort(dnatKeys[2]) },
+                       { conntrackIp(m_staticNaptEntry[snatKey].local_ip), conntrackPort(m_staticNaptEntry[snatKey].local_port) },
+                       { conntrackIp(m_staticNaptEntry[dnatKey].local_ip), conntrackPort(m_staticNaptEntry[dnatKey].local_port) },
+                       timeout, true);
 }
 
 /* To Update a dummy conntrack entry for the Static Single NAT entry in the kernel */
 void NatMgr::updateConntrackStaticSingleNatEntry(const string &key)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
     int timeout = NAT_TIMEOUT_MAX;
+    ConntrackExecutor::Filter filter;
+
+    filter.protocol = IPPROTO_UDP;
 
     if (m_staticNatEntry[key].nat_type == DNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Update static NAT conntrack entry with src-ip %s, timeout %d",
                       m_staticNatEntry[key].local_ip.c_str(), timeout);
 
-        cmds += (" -U --src " + m_staticNatEntry[key].local_ip + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+        filter.src = conntrackIp(m_staticNatEntry[key].local_ip);
     }
     else if (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Update static NAT conntrack entry with src-ip %s, timeout %d",
                       key.c_str(), timeout);
 
-        cmds += (" -U --src " + key + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+        filter.src = conntrackIp(key);
     }
 
-    swss::exec(cmds, res);
+    if (filter.src)
+    {
+        m_conntrack.updateMatching(filter, timeout);
+    }
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAT entry in the kernel */
 void NatMgr::updateConntrackStaticTwiceNatEntry(const string &snatKey, const string &dnatKey)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
     int timeout = NAT_TIMEOUT_MAX;
+    ConntrackExecutor::Filter filter;
 
     SWSS_LOG_INFO("Update static Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
                   snatKey.c_str(), dnatKey.c_str(), timeout);
-   
-    cmds += (" -U --src " + snatKey + " -p udp -t " + to_string(timeout) + " --dst " + dnatKey + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmds, res);
+    filter.protocol = IPPROTO_UDP;
+    filter.src      = conntrackIp(snatKey);
+    filter.dst      = conntrackIp(dnatKey);
+
+    if (filter.src)
+    {
+        m_conntrack.updateMatching(filter, timeout);
+    }
 }
 
 /* To update a dummy conntrack entry for the Static NAPT entry in the kernel */
 void NatMgr::updateConntrackStaticSingleNaptEntry(const string &key)
 {
     int timeout = NAT_TIMEOUT_MAX;
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> keys = tokenize(key, config_db_key_delimiter);
+    ConntrackExecutor::Filter filter;
 
     if (keys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -656,33 +673,40 @@ void NatMgr::updateConntrackStaticSingleNaptEntry(const string &key)
         prototype = IP_PROTOCOL_TCP;
     }
 
+    filter.protocol = conntrackProtocol(prototype);
+
     if (m_staticNaptEntry[key].nat_type == DNAT_NAT_TYPE)
     {
 
         SWSS_LOG_INFO("Update static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, timeout %d",
                       prototype.c_str(), m_staticNaptEntry[key].local_ip.c_str(), m_staticNaptEntry[key].local_port.c_str(), timeout);
- 
-        cmds += (" -U --src " + m_staticNaptEntry[key].local_ip + " -p " + prototype + " --sport " + m_staticNaptEntry[key].local_port + " -t " 
-                 + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+
+        filter.src   = conntrackIp(m_staticNaptEntry[key].local_ip);
+        filter.sport = conntrackPort(m_staticNaptEntry[key].local_port);
     }
     else if (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Update static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, timeout %d",
                       prototype.c_str(), keys[0].c_str(), keys[2].c_str(), timeout);
 
-        cmds += (" -U --src " + keys[0] + " -p " + prototype + " --sport " + keys[2] + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+        filter.src   = conntrackIp(keys[0]);
+        filter.sport = conntrackPort(keys[2]);
     }
 
-    swss::exec(cmds, res);
+    if (filter.src)
+    {
+        m_conntrack.updateMatching(filter, timeout);
+    }
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAPT entry in the kernel */
 void NatMgr::updateConntrackStaticTwiceNaptEntry(const string &snatKey, const string &dnatKey)
 {
     int timeout = NAT_TIMEOUT_MAX;
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> snatKeys = tokenize(snatKey, config_db_key_delimiter);
     vector<string> dnatKeys = tokenize(dnatKey, config_db_key_delimiter);
+    ConntrackExecutor::Filter filter;
 
     if (snatKeys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -696,68 +720,66 @@ void NatMgr::updateConntrackStaticTwiceNaptEntry(const string &snatKey, const st
     SWSS_LOG_DEBUG("Update static Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, dst-ip %s, dst-port %s, timeout %u",
                    prototype.c_str(), snatKeys[0].c_str(), snatKeys[2].c_str(), dnatKeys[0].c_str(), dnatKeys[2].c_str(), timeout);
 
-    cmds += (" -U --src " + snatKeys[0] + " --dst " + dnatKeys[0] + " -p udp " + " --sport " + snatKeys[2] + " --dport " + dnatKeys[2]
-             + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
+    filter.protocol = conntrackProtocol(prototype);
+    filter.src      = conntrackIp(snatKeys[0]);
+    filter.sport    = conntrackPort(snatKeys[2]);
+    filter.dst      = conntrackIp(dnatKeys[0]);
+    filter.dport    = conntrackPort(dnatKeys[2]);
 
-    swss::exec(cmds, res);
+    if (filter.src)
+    {
+        m_conntrack.updateMatching(filter, timeout);
+    }
 }
 
 /* To Delete conntrack entry for Static Single NAT entry */
 void NatMgr::deleteConntrackStaticSingleNatEntry(const string &key)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
+    ConntrackExecutor::Filter filter;
+
+    filter.protocol = IPPROTO_UDP;
 
     if (m_staticNatEntry[key].nat_type == DNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAT conntrack entry with src-ip %s", m_staticNatEntry[key].local_ip.c_str());
 
-        cmds += (" -D -s " + m_staticNatEntry[key].local_ip + " -p udp" + REDIRECT_TO_DEV_NULL);
+        filter.src = conntrackIp(m_staticNatEntry[key].local_ip);
     }
     else if (m_staticNatEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAT conntrack entry with src-ip %s", key.c_str());
 
-        cmds += (" -D -s " + key + " -p udp" + REDIRECT_TO_DEV_NULL);
+        filter.src = conntrackIp(key);
     }
 
-    int ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
+    if (filter.src)
     {
-        SWSS_LOG_INFO("Deleted the Static NAT conntrack entry");
+        m_conntrack.deleteMatching(filter);
     }
 }
 
 /* To Delete conntrack entry for Static Twice NAT entry */
 void NatMgr::deleteConntrackStaticTwiceNatEntry(const string &snatKey, const string &dnatKey)
 {
-    std::string res, cmds = std::string("") + CONNTRACK_CMD;
+    ConntrackExecutor::Filter filter;
 
     SWSS_LOG_INFO("Delete static Twice NAT conntrack entry with src-ip %s and dst-ip %s", snatKey.c_str(), dnatKey.c_str());
 
-    cmds += (" -D -s " + snatKey + " -d " + dnatKey + REDIRECT_TO_DEV_NULL);
+    filter.src = conntrackIp(snatKey);
+    filter.dst = conntrackIp(dnatKey);
 
-    int ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
+    if (filter.src)
     {
-        SWSS_LOG_INFO("Deleted the Static Twice NAT conntrack entry");
+        m_conntrack.deleteMatching(filter);
     }
 }
 
 /* To Delete conntrack entry for Static Single NAPT entry */
 void NatMgr::deleteConntrackStaticSingleNaptEntry(const string &key)
 {
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> keys = tokenize(key, config_db_key_delimiter);
+    ConntrackExecutor::Filter filter;
 
     if (keys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -768,39 +790,38 @@ void NatMgr::deleteConntrackStaticSingleNaptEntry(const string &key)
         prototype = IP_PROTOCOL_TCP;
     }
 
+    filter.protocol = conntrackProtocol(prototype);
+
     if (m_staticNaptEntry[key].nat_type == DNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s",
                       prototype.c_str(), m_staticNaptEntry[key].local_ip.c_str(), m_staticNaptEntry[key].local_port.c_str());
 
-        cmds += (" -D -s " + m_staticNaptEntry[key].local_ip + " -p " + prototype + " --sport " + m_staticNaptEntry[key].local_port + REDIRECT_TO_DEV_NULL);
+        filter.src   = conntrackIp(m_staticNaptEntry[key].local_ip);
+        filter.sport = conntrackPort(m_staticNaptEntry[key].local_port);
     }
     else if (m_staticNaptEntry[key].nat_type == SNAT_NAT_TYPE)
     {
         SWSS_LOG_INFO("Delete static NAPT conntrack entry with protocol %s, src-ip %s, src-port %s",
                       prototype.c_str(), keys[0].c_str(), keys[2].c_str());
 
-        cmds += (" -D -s " + keys[0] + " -p " + prototype + " --sport " + keys[2] + REDIRECT_TO_DEV_NULL);
+        filter.src   = conntrackIp(keys[0]);
+        filter.sport = conntrackPort(keys[2]);
     }
 
-    int ret = swss::exec(cmds, res);
-
-    if (ret)
+    if (filter.src)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Deleted the Static NAPT conntrack entry");
+        m_conntrack.deleteMatching(filter);
     }
 }
 
 /* To Delete conntrack entry for Static Twice NAPT entry */
 void NatMgr::deleteConntrackStaticTwiceNaptEntry(const string &snatKey, const string &dnatKey)
 {
-    std::string res, prototype, cmds = std::string("") + CONNTRACK_CMD;
+    std::string prototype;
     vector<string> snatKeys = tokenize(snatKey, config_db_key_delimiter);
     vector<string> dnatKeys = tokenize(dnatKey, config_db_key_delimiter);
+    ConntrackExecutor::Filter filter;
 
     if (snatKeys[1] == to_upper(IP_PROTOCOL_UDP))
     {
@@ -814,27 +835,23 @@ void NatMgr::deleteConntrackStaticTwiceNaptEntry(const string &snatKey, const st
     SWSS_LOG_INFO("Delete static Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %s, dst-ip %s, dst-port %s",
                   prototype.c_str(), snatKeys[0].c_str(), snatKeys[2].c_str(), dnatKeys[0].c_str(), dnatKeys[2].c_str());
 
-    cmds += (" -D -s " + snatKeys[0] + " -p " + prototype + " --orig-port-src " + snatKeys[2] + " -d " + dnatKeys[0] + " --orig-port-dst " + dnatKeys[2] + REDIRECT_TO_DEV_NULL);
-
-    int ret = swss::exec(cmds, res);
+    filter.protocol = conntrackProtocol(prototype);
+    filter.src      = conntrackIp(snatKeys[0]);
+    filter.sport    = conntrackPort(snatKeys[2]);
+    filter.dst      = conntrackIp(dnatKeys[0]);
+    filter.dport    = conntrackPort(dnatKeys[2]);
 
-    if (ret)
+    if (filter.src)
     {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Deleted the Static Twice NAPT conntrack entry");
+        m_conntrack.deleteMatching(filter);
     }
 }
 
 /* To Delete conntrack entries for matching Pool ip address */
 void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
 {
-    std::string res, cmds;
-
-    uint32_t ipv4_addr_low, ipv4_addr_high, ip, setIp;
-    char ipAddr[INET_ADDRSTRLEN];
+    uint32_t ipv4_addr_low, ipv4_addr_high, ip;
+    ConntrackExecutor::Filter filter;
 
     vector<string> nat_ip = tokenize(ip_range, range_specifier);
 
@@ -858,27 +875,151 @@ void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
         ipv4_addr_low = ntohl(ipv4_addr_low);
     }
 
+    SWSS_LOG_INFO("Delete dynamic conntrack entries with translated-src-ip in %s", ip_range.c_str());
+
+    /* All the pool addresses are matched against the same conntrack table dump */
     for (ip = ipv4_addr_low; ip <= ipv4_addr_high; ip++)
     {
-        setIp = htonl(ip);
-        inet_ntop(AF_INET, &setIp, ipAddr, INET_ADDRSTRLEN);
-        std::string ipAddrString(ipAddr);
+        filter.reply_dst = htonl(ip);
+        m_conntrack.deleteMatching(filter);
+    }
+}
+
+/* To queue a chain of iptables commands, "iptables -t <table> <rule> && ...",
+ * that is applied with the other rules of its table in commitIptablesCmds().
+ * on_success runs once the commands are applied. */
+void NatMgr::queueIptablesCmds(const string &cmds, const string &opCmd, const string &desc,
+                               std::function<void()> on_success)
+{
+    const string table_opt = " -t ";
+    size_t pos;
+
+    if (cmds.empty())
+    {
+        return;
+    }
+
+    pos = cmds.find(table_opt);
+    if (pos == string::npos)
+    {
+        SWSS_LOG_ERROR("No table in iptables command '%s'", cmds.c_str());
+        return;
+    }
+    pos += table_opt.size();
+
+    m_iptablesCmds[cmds.substr(pos, cmds.find(' ', pos) - pos)].push_back({cmds, opCmd == DELETE, desc, std::move(on_success)});
+}
 
-        SWSS_LOG_INFO("Delete dynamic conntrack entry with translated-src-ip %s", ipAddr);
+/* To apply the queued iptables commands with one iptables-restore per table.
+ * The restore is all or nothing, if it fails the commands are run one by one
+ * so that the valid ones still take effect. Returns the rules that failed.
+ * The bookkeeping of the applied commands may queue more of them, they are
+ * applied in turn. */
+vector<string> NatMgr::commitIptablesCmds(void)
+{
+    vector<string> failed;
 
-        cmds = (std::string("") + CONNTRACK_CMD + " -D -q " + ipAddrString + REDIRECT_TO_DEV_NULL);
+    while (!m_iptablesCmds.empty())
+    {
+        auto iptablesCmds = std::move(m_iptablesCmds);
+        vector<IptablesCmds *> applied;
 
-        int ret = swss::exec(cmds, res);
+        m_iptablesCmds.clear();
 
-        if (ret)
+        for (auto &it : iptablesCmds)
         {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
+            const string &table = it.first;
+            const string cmd_prefix = string(IPTABLES_CMD) + " -t " + table + " ";
+            string rules = "*" + table + "\n";
+            string res;
+            int ret = -1;
+
+            for (auto &entry : it.second)
+            {
+                for (auto &cmd : tokenize(entry.cmds, '&'))
+                {
+                    string rule = cmd;
+
+                    /* The chains are joined with " && ", skip the empty token in between */
+                    if (rule.find_first_not_of(' ') == string::npos)
+                    {
+                        continue;
+                    }
+                    rule = rule.substr(rule.find_first_not_of(' '));
+                    rule = rule.substr(0, rule.find_last_not_of(' ') + 1);
+
+                    if (rule.compare(0, cmd_prefix.size(), cmd_prefix) != 0)
+                    {
+                        SWSS_LOG_ERROR("Unexpected iptables command '%s'", rule.c_str());
+                        rules.clear();
+                        break;
+                    }
+                    rules += rule.substr(cmd_prefix.size()) + "\n";
+                }
+                if (rules.empty())
+                {
+                    break;
+                }
+            }
+
+            if (!rules.empty())
+            {
+                char path[] = "/tmp/natmgrd-iptables.XXXXXX";
+                int fd = mkstemp(path);
+
+                rules += "COMMIT\n";
+                if (fd < 0)
+                {
+                    SWSS_LOG_ERROR("Failed to create the iptables-restore input: %s", strerror(errno));
+                }
+                else
+                {
+                    if (write(fd, rules.c_str(), rules.size()) == (ssize_t)rules.size())
+                    {
+                        ret = swss::exec(std::string(IPTABLES_RESTORE_CMD) + " --noflush " + path, res);
+                    }
+                    close(fd);
+                    unlink(path);
+                }
+            }
+
+            if (ret)
+            {
+                SWSS_LOG_WARN("Restoring %zu iptables %s commands failed with rc %d, running them one by one",
+                              it.second.size(), table.c_str(), ret);
+            }
+            else
+            {
+                SWSS_LOG_INFO("Restored %zu iptables %s commands", it.second.size(), table.c_str());
+            }
+
+            for (auto &entry : it.second)
+            {
+                int rc = ret ? swss::exec(entry.cmds, res) : 0;
+
+                if (rc)
+                {
+                    SWSS_LOG_ERROR("Failed to %s %s, command '%s' failed with rc %d", entry.del ? "delete" : "add",
+                                   entry.desc.c_str(), entry.cmds.c_str(), rc);
+                    failed.push_back(entry.desc);
+                    continue;
+                }
+
+                SWSS_LOG_INFO("%s %s", entry.del ? "Deleted" : "Added", entry.desc.c_str());
+                applied.push_back(&entry);
+            }
         }
-        else
+
+        for (auto entry : applied)
         {
-            SWSS_LOG_INFO("Deleted the dynamic conntrack entry");
+            if (entry->on_success)
+            {
+                entry->on_success();
+            }
         }
     }
+
+    return failed;
 }
 
 /* Iptable rules are added in the mangles table, to support use of Loopback IP as NAT Public IP which is a typical use-case in DC scenarios. The way it works is that:
@@ -891,7 +1032,7 @@ void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
  * *	So matching against the zone value is done while allocating NAT IPs.
  * *
  * * */
-bool NatMgr::setMangleIptablesRules(const string &opCmd, const string &interface, const string &nat_zone)
+void NatMgr::setMangleIptablesRules(const string &opCmd, const string &interface, const string &nat_zone)
 {
     SWSS_LOG_ENTER();
 
@@ -899,56 +1040,35 @@ bool NatMgr::setMangleIptablesRules(const string &opCmd, const string &interface
      * iptables -t mangle -opCmd PREROUTING -i port -j MARK --set-mark nat_zone
      * iptables -t mangle -opCmd POSTROUTING -o port -j MARK --set-mark nat_zone
      */
-    std::string res;
-    int ret;
-
     if (nat_zone.empty())
     {
         SWSS_LOG_INFO("Nat zone is empty");
-        return false;
+        return;
     }
 
     const std::string cmds = std::string("")
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " PREROUTING -i " + interface + " -j MARK --set-mark " + nat_zone + " && "
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " POSTROUTING -o " + interface + " -j MARK --set-mark " + nat_zone ;
 
-    ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-        return false;
-    }
-
-    return true;
+    queueIptablesCmds(cmds, opCmd, "mangle iptables rules for " + interface);
 }
 
 /* To Add arbitrary value for DNAT rule incase of fullcone */
-bool NatMgr::setFullConeDnatIptablesRule(const string &opCmd)
+void NatMgr::setFullConeDnatIptablesRule(const string &opCmd)
 {
     /* This rule in the PREROUTING chain should be the default rule at the end of the list
      * iptables -t nat -[A/D] PREROUTING -j DNAT --fullcone
      */
-    std::string res;
-    int ret;
-
     /* In case of fullcone, the --to-destination is ignored by the stack, giving an aribitrary value so that 
      * iptables doesn't fail for PREROUTING/DNAT rule */
     const std::string cmds = std::string("")
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + " -j DNAT --to-destination 1.1.1.1 --fullcone";
         
-    ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-        return false;
-    }
-    return true;
+    queueIptablesCmds(cmds, opCmd, "fullcone DNAT iptables rule");
 }
 
 /* To Add or Delete the Iptables rules for Static NAT entry */
-bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interface, const string &external_ip, const string &internal_ip, const string &nat_type)
+void NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interface, const string &external_ip, const string &internal_ip, const string &nat_type, const string &desc)
 {
     SWSS_LOG_ENTER();
 
@@ -956,9 +1076,7 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
      * iptables -t nat -opCmd PREROUTING -m mark --mark zone-value -j DNAT -d external_ip --to-destination internal_ip
      * iptables -t nat -opCmd POSTROUTING -m mark --mark zone-value -j SNAT -s internal_ip --to-source external_ip
      */
-    std::string res;
     std::string markStr = std::string("");
-    int ret;
 
     markStr = " -m mark --mark " + m_natZoneInterfaceInfo[interface];
 
@@ -968,13 +1086,7 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + markStr + " -j DNAT -d " + external_ip + " --to-destination " + internal_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + internal_ip + " --to-source " + external_ip ;
         
-        ret = swss::exec(cmds, res);
-
-        if (ret)
-        {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-            return false;
-        }
+        queueIptablesCmds(cmds, opCmd, desc);
     }
     else
     {
@@ -982,21 +1094,13 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING" + " -j DNAT -d " + internal_ip + " --to-destination " + external_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -j SNAT -s " + external_ip + " --to-source " + internal_ip ;
 
-        ret = swss::exec(cmds, res);
-
-        if (ret)
-        {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-            return false;
-        }
+        queueIptablesCmds(cmds, opCmd, desc);
     }
-
-    return true;
 }
 
 /* To Add or Delete the Iptables rules for Static NAPT entry */
-bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &interface, const string &prototype, const string &external_ip, 
-                                        const string &external_port, const string &internal_ip, const string &internal_port, const string &nat_type)
+void NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &interface, const string &prototype, const string &external_ip, 
+                                        const string &external_port, const string &internal_ip, const string &internal_port, const string &nat_type, const string &desc)
 {
     SWSS_LOG_ENTER();
 
@@ -1004,9 +1108,7 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
      * iptables -t nat -opCmd PREROUTING -m mark --mark zone-value -p prototype -j DNAT -d external_ip --dport external_port --to-destination internal_ip:internal_port
      * iptables -t nat -opCmd POSTROUTING -m mark --mark zone-value -p prototype -j SNAT -s internal_ip --sport internal_port --to-source external_ip:external_port
      */
-    std::string res;
     std::string markStr = std::string("");
-    int ret;
 
     markStr = " -m mark --mark " + m_natZoneInterfaceInfo[interface];
 
@@ -1018,13 +1120,7 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + internal_ip + " --sport " + internal_port + " --to-source " 
           + external_ip + ":" + external_port;
 
-        ret = swss::exec(cmds, res);
-
-        if (ret)
-        {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-            return false;
-        }
+        queueIptablesCmds(cmds, opCmd, desc);
     }
     else
     {
@@ -1034,21 +1130,13 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -p " + prototype + " -j SNAT -s " + external_ip + " --sport " + external_port + " --to-source "
           + internal_ip + ":" + internal_port;
 
-        ret = swss::exec(cmds, res);
-
-        if (ret)
-        {
-            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-            return false;
-        }
+        queueIptablesCmds(cmds, opCmd, desc);
     }
-
-    return true;
 }
 
 /* To Add or Delete the Iptables rules for Static Twice NAT entry */
-bool NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &interface, const string &src_ip, const string &translated_src_ip,
-                                            const string &dest_ip, const string &translated_dest_ip)
+void NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &interface, const string &src_ip, const string &translated_src_ip,
+                                            const string &dest_ip, const string &translated_dest_ip, const string &desc)
 {
     SWSS_LOG_ENTER();
 
@@ -1060,9 +1148,7 @@ bool NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &i
      * iptables -t nat -opCmd POSTROUTING -m mark --mark zone-value -j SNAT -s translated_dst --to-source dst -d src 
      */
 
-    std::string res;
     std::string markStr = std::string("");
-    int ret;
 
     markStr = " -m mark --mark " + m_natZoneInterfaceInfo[interface];
 
@@ -1076,21 +1162,13 @@ bool NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &i
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + translated_dest_ip
           + " --to-source " + dest_ip + " -d " + src_ip;
 
-    ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-        return false;
-    }
-
-    return true;
+    queueIptablesCmds(cmds, opCmd, desc);
 }
 
 /* To Add or Delete the Iptables rules for Static Twice NAPT entry */
-bool NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &interface, const string &prototype, const string &src_ip, const string &src_port,
+void NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &interface, const string &prototype, const string &src_ip, const string &src_port,
                                              const string &translated_src_ip, const string &translated_src_port, const string &dest_ip, const string &dest_port,
-                                             const string &translated_dest_ip, const string &translated_dest_port)
+                                             const string &translated_dest_ip, const string &translated_dest_port, const string &desc)
 {
     SWSS_LOG_ENTER();
 
@@ -1106,9 +1184,7 @@ bool NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &
      * -d src --dport src_l4_port
      */
 
-    std::string res;
     std::string markStr = std::string("");
-    int ret;
 
     markStr = " -m mark --mark " + m_natZoneInterfaceInfo[interface];
 
@@ -1122,20 +1198,12 @@ bool NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + translated_dest_ip + " --sport " + translated_dest_port
           + " --to-source " + dest_ip + ":" + dest_port + " -d " + src_ip + " --dport " +src_port;
 
-    ret = swss::exec(cmds, res);
-
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-        return false;
-    }
-
-    return true;
+    queueIptablesCmds(cmds, opCmd, desc);
 }
 
 /* To Add or Delete the Iptables rules for Dynamic NAT/NAPT without ACLs */
-bool NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const string &interface, const string &external_ip,
-                                                  const string &external_port_range, const string &key)
+void NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const string &interface, const string &external_ip,
+                                                  const string &external_port_range, const string &key, const string &desc)
 {
     SWSS_LOG_ENTER();
 
@@ -1145,7 +1213,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const str
      * iptables -t nat -opCmd POSTROUTING -p udp -j SNAT -m mark --mark zone-value --to-source external_ip:external_port_range --fullcone
      * iptables -t nat -opCmd POSTROUTING -p icmp -j SNAT -m mark --mark zone-value --to-source external_ip:external_port_range --fullcone
      */
-    std::string res, cmd;
+    std::string cmd;
     std::string externalString = EMPTY_STRING;
     std::string fullcone = EMPTY_STRING;
     std::string prototype = EMPTY_STRING;
@@ -1219,20 +1287,13 @@ bool NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const str
         }
     }
 
-    int ret = swss::exec(cmds, res);
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-        return false;
-    }
-
-    return true;
+    queueIptablesCmds(cmds, opCmd, desc);
 }
 
 /* To Add or Delete the Iptables rules for Dynamic NAT/NAPT with ACLs */
-bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string &interface, const string &external_ip,
+void NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string &interface, const string &external_ip,
                                                const string &external_port_range, natAclRule_t &natAclRuleId,
-                                               const string &key)
+                                               const string &key, const string &desc, std::function<void()> on_success)
 {
     SWSS_LOG_ENTER();
 
@@ -1247,7 +1308,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
      * iptables -t nat -opCmd POSTROUTING -p icmp srcIpAddressString -j SNAT -m mark --mark zone-value --to-source external_ip:external_port_range --fullcone
      */
 
-    std::string res, cmd;
+    std::string cmd;
     std::string srcIpAddressString = EMPTY_STRING, dstIpAddressString = EMPTY_STRING;
     std::string srcPortString = EMPTY_STRING, dstPortString = EMPTY_STRING;
     std::string externalString = EMPTY_STRING, fullcone = EMPTY_STRING;
@@ -1295,7 +1356,11 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
         if (!dstIpAddressString.empty() or !dstPortString.empty())
         {
             SWSS_LOG_WARN("Destination IP/Port is not valid for Twice NAT, skipped adding the ACL Rule");
-            return true;
+            if (on_success)
+            {
+                on_success();
+            }
+            return;
         }
 
         keys = tokenize(key, config_db_key_delimiter);
@@ -1305,7 +1370,11 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
             if ((natAclRuleId.ip_protocol != "None") and (natAclRuleId.ip_protocol != keys[1]))
             {
                 SWSS_LOG_WARN("Rule protocol %s is not matching with Static entry, skipped adding the ACL Rule", natAclRuleId.ip_protocol.c_str());
-                return true;
+                if (on_success)
+                {
+                    on_success();
+                }
+                return;
             }
 
             if (keys[1] == to_upper(IP_PROTOCOL_UDP))
@@ -1448,14 +1517,7 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
         }
     }
 
-    int ret = swss::exec(cmds, res);
-    if (ret)
-    {
-        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
-        return false;
-    }
-
-    return true;
+    queueIptablesCmds(cmds, opCmd, desc, std::move(on_success));
 }
 
 /* To add/remove a DNAT Pool entry from Nat Pool */
@@ -2058,14 +2120,8 @@ void NatMgr::addStaticSingleNatEntry(const string &key)
     addConntrackStaticSingleNatEntry(key);
 
     /* Add Static NAT iptables rule */
-    if (!setStaticNatIptablesRules(INSERT, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to add Static NAT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added Static NAT iptables rules for %s", key.c_str());
-    }
+    setStaticNatIptablesRules(INSERT, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type,
+                              "Static NAT iptables rules for " + key);
 }
 
 /* To add Static Twice NAT entry based on Static Key if all valid conditions are met */
@@ -2185,15 +2241,9 @@ void NatMgr::addStaticTwiceNatEntry(const string &key)
         }
 
         /* Add Static NAT iptables rule */
-        if (!setStaticTwiceNatIptablesRules(INSERT, interface, src, translated_src, dest, translated_dest))
-        {
-            SWSS_LOG_ERROR("Failed to add Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            isEntryAdded = true;
-            SWSS_LOG_INFO("Added Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
+        setStaticTwiceNatIptablesRules(INSERT, interface, src, translated_src, dest, translated_dest,
+                                       "Static Twice NAT iptables rules for " + key + " and " + (*it).first);
+        isEntryAdded = true;
         break;
     }
 
@@ -2374,16 +2424,10 @@ void NatMgr::addStaticSingleNaptEntry(const string &key)
     addConntrackStaticSingleNaptEntry(key);
 
     /* Add Static NAPT iptables rule */
-    if (!setStaticNaptIptablesRules(INSERT, interface, prototype, keys[0], keys[2],
-                                    m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
-                                    m_staticNaptEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to add Static NAPT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added Static NAPT iptables rules for %s", key.c_str());
-    }
+    setStaticNaptIptablesRules(INSERT, interface, prototype, keys[0], keys[2],
+                               m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
+                               m_staticNaptEntry[key].nat_type,
+                               "Static NAPT iptables rules for " + key);
 }
 
 /* To add Static Twice NAPT entry based on Static Key if all valid conditions are met */
@@ -2545,16 +2589,10 @@ void NatMgr::addStaticTwiceNaptEntry(const string &key)
         }
 
         /* Add Static NAPT iptables rule */
-        if (!setStaticTwiceNaptIptablesRules(INSERT, interface, prototype, src, src_port, translated_src, translated_src_port,
-            dest, dest_port, translated_dest, translated_dest_port))
-        {
-            SWSS_LOG_ERROR("Failed to add Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            isEntryAdded = true;
-            SWSS_LOG_INFO("Added Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
+        setStaticTwiceNaptIptablesRules(INSERT, interface, prototype, src, src_port, translated_src, translated_src_port,
+                                        dest, dest_port, translated_dest, translated_dest_port,
+                                        "Static Twice NAT iptables rules for " + key + " and " + (*it).first);
+        isEntryAdded = true;
         break;
     }
 
@@ -2706,14 +2744,8 @@ void NatMgr::removeStaticSingleNatEntry(const string &key)
     SWSS_LOG_INFO("Deleted Static NAT %s from APPL_DB", key.c_str());
 
     /* Remove Static NAT iptables rule */
-    if (!setStaticNatIptablesRules(DELETE, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to delete Static NAT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Deleted Static NAT iptables rules for %s", key.c_str());
-    }
+    setStaticNatIptablesRules(DELETE, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type,
+                              "Static NAT iptables rules for " + key);
 
     m_staticNatEntry[key].interface = NONE_STRING;
 
@@ -2835,15 +2867,9 @@ void NatMgr::removeStaticTwiceNatEntry(const string &key)
         SWSS_LOG_INFO("Deleted Static Twice NAT for %s and %s from APPL_DB", key.c_str(), (*it).first.c_str());
 
         /* Delete Static NAT iptables rule */
-        if (!setStaticTwiceNatIptablesRules(DELETE, interface, src, translated_src, dest, translated_dest))
-        {
-            SWSS_LOG_ERROR("Failed to delete Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            SWSS_LOG_INFO("Deleted Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-            isEntryDeleted = true;
-        }
+        setStaticTwiceNatIptablesRules(DELETE, interface, src, translated_src, dest, translated_dest,
+                                       "Static Twice NAT iptables rules for " + key + " and " + (*it).first);
+        isEntryDeleted = true;
 
         m_staticNatEntry[key].interface = NONE_STRING;
 
@@ -3016,16 +3042,10 @@ void NatMgr::removeStaticSingleNaptEntry(const string &key)
     SWSS_LOG_INFO("Deleted Static NAPT %s from APPL_DB", key.c_str());
 
     /* Remove Static NAPT iptables rule */
-    if (!setStaticNaptIptablesRules(DELETE, interface, prototype, keys[0], keys[2],
-                                    m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
-                                    m_staticNaptEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to delete Static NAPT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Deleted Static NAPT iptables rules for %s", key.c_str());
-    }
+    setStaticNaptIptablesRules(DELETE, interface, prototype, keys[0], keys[2],
+                               m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
+                               m_staticNaptEntry[key].nat_type,
+                               "Static NAPT iptables rules for " + key);
 
     m_staticNaptEntry[key].interface = NONE_STRING;
 
@@ -3173,16 +3193,10 @@ void NatMgr::removeStaticTwiceNaptEntry(const string &key)
         SWSS_LOG_INFO("Deleted Static Twice NAPT for %s and %s from APPL_DB", key.c_str(), (*it).first.c_str());
 
         /* Delete Static NAPT iptables rule */
-        if (!setStaticTwiceNaptIptablesRules(DELETE, interface, prototype, src, src_port, translated_src, translated_src_port,
-                                             dest, dest_port, translated_dest, translated_dest_port))
-        {
-            SWSS_LOG_ERROR("Failed to delete Static Twice NAPT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            SWSS_LOG_INFO("Deleted Static Twice NAPT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-            isEntryDeleted = true;
-        }
+        setStaticTwiceNaptIptablesRules(DELETE, interface, prototype, src, src_port, translated_src, translated_src_port,
+                                        dest, dest_port, translated_dest, translated_dest_port,
+                                        "Static Twice NAPT iptables rules for " + key + " and " + (*it).first);
+        isEntryDeleted = true;
 
         m_staticNaptEntry[key].interface = NONE_STRING;
 
@@ -3346,14 +3360,8 @@ void NatMgr::addStaticSingleNatIptables(const string &key)
     }
 
     /* Add Static NAT iptables rule */
-    if (!setStaticNatIptablesRules(INSERT, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to add Static NAT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added Static NAT iptables rules for %s", key.c_str());
-    }
+    setStaticNatIptablesRules(INSERT, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type,
+                              "Static NAT iptables rules for " + key);
 }
 
 /* To add Static Twice NAT Iptables based on Static Key if all valid conditions are met */
@@ -3422,15 +3430,9 @@ void NatMgr::addStaticTwiceNatIptables(const string &key)
         }
 
         /* Add Static NAT iptables rule */
-        if (!setStaticTwiceNatIptablesRules(INSERT, interface, src, translated_src, dest, translated_dest))
-        {
-            SWSS_LOG_ERROR("Failed to add Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            isRulesAdded = true;
-            SWSS_LOG_INFO("Added Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
+        setStaticTwiceNatIptablesRules(INSERT, interface, src, translated_src, dest, translated_dest,
+                                       "Static Twice NAT iptables rules for " + key + " and " + (*it).first);
+        isRulesAdded = true;
         break;
     }
 
@@ -3576,16 +3578,10 @@ void NatMgr::addStaticSingleNaptIptables(const string &key)
     }
 
     /* Add Static NAPT iptables rule */
-    if (!setStaticNaptIptablesRules(INSERT, interface, prototype, keys[0], keys[2],
-                                    m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
-                                    m_staticNaptEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to add Static NAPT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Added Static NAPT iptables rules for %s", key.c_str());
-    }
+    setStaticNaptIptablesRules(INSERT, interface, prototype, keys[0], keys[2],
+                               m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
+                               m_staticNaptEntry[key].nat_type,
+                               "Static NAPT iptables rules for " + key);
 }
 
 /* To add Static Twice NAPT Iptables based on Static Key if all valid conditions are met */
@@ -3680,16 +3676,10 @@ void NatMgr::addStaticTwiceNaptIptables(const string &key)
         }
 
         /* Add Static NAPT iptables rule */
-        if (!setStaticTwiceNaptIptablesRules(INSERT, interface, prototype, src, src_port, translated_src, translated_src_port,
-            dest, dest_port, translated_dest, translated_dest_port))
-        {
-            SWSS_LOG_ERROR("Failed to add Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            isRulesAdded = true;
-            SWSS_LOG_INFO("Added Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
+        setStaticTwiceNaptIptablesRules(INSERT, interface, prototype, src, src_port, translated_src, translated_src_port,
+                                        dest, dest_port, translated_dest, translated_dest_port,
+                                        "Static Twice NAT iptables rules for " + key + " and " + (*it).first);
+        isRulesAdded = true;
         break;
     }
 
@@ -3829,14 +3819,8 @@ void NatMgr::removeStaticSingleNatIptables(const string &key)
     }
     
     /* Remove Static NAT iptables rule */
-    if (!setStaticNatIptablesRules(DELETE, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to delete Static NAT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Deleted Static NAT iptables rules for %s", key.c_str());
-    }
+    setStaticNatIptablesRules(DELETE, interface, key, m_staticNatEntry[key].local_ip, m_staticNatEntry[key].nat_type,
+                              "Static NAT iptables rules for " + key);
 }
 
 /* To delete Static Twice NAT Iptables based on Static Key if all valid conditions are met */
@@ -3904,15 +3888,9 @@ void NatMgr::removeStaticTwiceNatIptables(const string &key)
         }
 
         /* Delete Static NAT iptables rule */
-        if (!setStaticTwiceNatIptablesRules(DELETE, interface, src, translated_src, dest, translated_dest))
-        {
-            SWSS_LOG_ERROR("Failed to delete Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            isRulesDeleted = true;
-            SWSS_LOG_INFO("Deleted Static Twice NAT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
+        setStaticTwiceNatIptablesRules(DELETE, interface, src, translated_src, dest, translated_dest,
+                                       "Static Twice NAT iptables rules for " + key + " and " + (*it).first);
+        isRulesDeleted = true;
         break;
     }
 
@@ -4071,16 +4049,10 @@ void NatMgr::removeStaticSingleNaptIptables(const string &key)
     interface = m_staticNaptEntry[key].interface;
 
     /* Remove Static NAPT iptables rule */
-    if (!setStaticNaptIptablesRules(DELETE, interface, prototype, keys[0], keys[2],
-                                    m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
-                                    m_staticNaptEntry[key].nat_type))
-    {
-        SWSS_LOG_ERROR("Failed to delete Static NAPT iptables rules for %s", key.c_str());
-    }
-    else
-    {
-        SWSS_LOG_INFO("Deleted Static NAPT iptables rules for %s", key.c_str());
-    }
+    setStaticNaptIptablesRules(DELETE, interface, prototype, keys[0], keys[2],
+                               m_staticNaptEntry[key].local_ip, m_staticNaptEntry[key].local_port,
+                               m_staticNaptEntry[key].nat_type,
+                               "Static NAPT iptables rules for " + key);
 }
 
 /* To delete Static Twice NAPT Iptables based on Static Key if all valid conditions are met */
@@ -4175,16 +4147,10 @@ void NatMgr::removeStaticTwiceNaptIptables(const string &key)
         }
 
         /* Delete Static NAPT iptables rule */
-        if (!setStaticTwiceNaptIptablesRules(DELETE, interface, prototype, src, src_port, translated_src, translated_src_port,
-                                             dest, dest_port, translated_dest, translated_dest_port))
-        {
-            SWSS_LOG_ERROR("Failed to delete Static Twice NAPT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
-        else
-        {
-            isRulesDeleted = true;
-            SWSS_LOG_INFO("Deleted Static Twice NAPT iptables rules for %s and %s", key.c_str(), (*it).first.c_str());
-        }
+        setStaticTwiceNaptIptablesRules(DELETE, interface, prototype, src, src_port, translated_src, translated_src_port,
+                                        dest, dest_port, translated_dest, translated_dest_port,
+                                        "Static Twice NAPT iptables rules for " + key + " and " + (*it).first);
+        isRulesDeleted = true;
         break;
     }
 
@@ -4544,7 +4510,33 @@ void NatMgr::setDynamicAllForwardOrAclbasedRules(const string &opCmd, const stri
 
             SWSS_LOG_INFO("Acl-id %s is enabled", aclId.c_str());
 
-            bool isRuleSet = false;
+            /* Once a rule of the ACL is applied, save the port in the binding cache */
+            auto isRuleSet = std::make_shared<bool>(false);
+            string aclInterface = m_natAclTableInfo[aclId];
+            std::function<void()> saveAclInterface = [this, isRuleSet, dynamicKey, aclInterface]()
+            {
+                auto binding = m_natBindingInfo.find(dynamicKey);
+
+                if ((*isRuleSet) or (binding == m_natBindingInfo.end()))
+                {
+                    return;
+                }
+                *isRuleSet = true;
+
+                if (binding->second.acl_interface == NONE_STRING)
+                {
+                    binding->second.acl_interface = aclInterface;
+                }
+                else
+                {
+                    vector<string> interfaces = tokenize(binding->second.acl_interface, comma);
+
+                    if (std::find(interfaces.begin(), interfaces.end(), aclInterface) == interfaces.end())
+                    {
+                        binding->second.acl_interface += (comma + aclInterface);
+                    }
+                }
+            };
 
             /* Get all ACL Rule Info */
             for (auto it = m_natAclRuleInfo.begin(); it != m_natAclRuleInfo.end(); it++)
@@ -4563,33 +4555,12 @@ void NatMgr::setDynamicAllForwardOrAclbasedRules(const string &opCmd, const stri
                 setNaptPoolIpTable(opCmd, ip_range, port_range);
 
                 /* Set dynamic iptables rule with acls*/
-                if (!setDynamicNatIptablesRulesWithAcl(opCmd, pool_interface, ip_range, port_range, (*it).second, m_natBindingInfo[dynamicKey].static_key))
-                {
-                    SWSS_LOG_ERROR("Failed to %s dynamic iptables acl rules for Rule id %s for Table %s", opCmd == ADD ? "add" : "delete",
-                                   aclRuleKeys[1].c_str(), aclId.c_str());
-                }
-                else
-                {
-                    isRuleSet = true;
-                    SWSS_LOG_INFO("%s dynamic iptables acl rules for Rule id %s for Table %s", opCmd == ADD ? "Added" : "Deleted",
-                                  aclRuleKeys[1].c_str(), aclId.c_str());
-                }
+                setDynamicNatIptablesRulesWithAcl(opCmd, pool_interface, ip_range, port_range, (*it).second, m_natBindingInfo[dynamicKey].static_key,
+                                                  "dynamic iptables acl rules for Rule id " + aclRuleKeys[1] + " for Table " + aclId,
+                                                  (opCmd == ADD) ? saveAclInterface : nullptr);
 
                 setAllForwardRules = false;
             }
-
-            /* If rule is set, save the port in the binding cache */
-            if (isRuleSet and (opCmd == ADD))
-            {
-                if (m_natBindingInfo[dynamicKey].acl_interface == NONE_STRING)
-                {
-                    m_natBindingInfo[dynamicKey].acl_interface = m_natAclTableInfo[aclId];
-                }
-                else
-                {
-                    m_natBindingInfo[dynamicKey].acl_interface += (comma + m_natAclTableInfo[aclId]);
-                }
-            }
         }
       
         /* After deletion, set acl_interface to None */  
@@ -4606,14 +4577,8 @@ void NatMgr::setDynamicAllForwardOrAclbasedRules(const string &opCmd, const stri
         setNaptPoolIpTable(opCmd, ip_range, port_range);
 
         /* Set dynamic iptables rule without acls*/
-        if (!setDynamicNatIptablesRulesWithoutAcl(opCmd, pool_interface, ip_range, port_range, m_natBindingInfo[dynamicKey].static_key))
-        {
-            SWSS_LOG_ERROR("Failed to %s dynamic iptables rules for %s", opCmd == ADD ? "add" : "delete", dynamicKey.c_str());
-        }
-        else
-        {
-            SWSS_LOG_INFO("%s dynamic iptables rules for %s", opCmd == ADD ? "Added" : "Deleted", dynamicKey.c_str());
-        }
+        setDynamicNatIptablesRulesWithoutAcl(opCmd, pool_interface, ip_range, port_range, m_natBindingInfo[dynamicKey].static_key,
+                                             "dynamic iptables rules for " + dynamicKey);
     }
 }
 
@@ -4777,7 +4742,6 @@ void NatMgr::addDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
         string acls_name = (*it).second.acl_name;
         string poolInterface, aclInterface;
         string port_range, ip_range;
-        bool isRuleSet = false;
 
         /* Check the pool is present in cache, otherwise continue */
         if (m_natPoolInfo.find(pool_name) == m_natPoolInfo.end())
@@ -4849,14 +4813,8 @@ void NatMgr::addDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
                     setDnatPoolfromNatPool(DELETE, ip_range);
 
                     /* Set dynamic iptables rule without acl */
-                    if (!setDynamicNatIptablesRulesWithoutAcl(DELETE, poolInterface, ip_range, port_range, (*it).second.static_key))
-                    {
-                        SWSS_LOG_ERROR("Failed to remove dynamic iptables rules for %s", aclKey.c_str());
-                    }
-                    else
-                    {
-                        SWSS_LOG_INFO("Deleted dynamic iptables rules for %s", aclKey.c_str());
-                    }
+                    setDynamicNatIptablesRulesWithoutAcl(DELETE, poolInterface, ip_range, port_range, (*it).second.static_key,
+                                                         "dynamic iptables rules for " + aclKey);
 
                     (*it).second.acl_interface = m_natAclTableInfo[aclTableId];                    
                 }
@@ -4873,18 +4831,42 @@ void NatMgr::addDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
                 setDnatPoolfromNatPool(ADD, ip_range);
 
                 /* Set dynamic iptables rule with acls*/
-                if (!setDynamicNatIptablesRulesWithAcl(ADD, poolInterface, ip_range, port_range, m_natAclRuleInfo[aclKey], (*it).second.static_key))
-                {
-                    SWSS_LOG_ERROR("Failed to add dynamic iptables acl rules for Rule id %s for Table %s", aclRuleId.c_str(), aclTableId.c_str());
-                }
-                else
-                {
-                    SWSS_LOG_INFO("Added dynamic iptables acl rules for Rule id %s for Table %s", aclRuleId.c_str(), aclTableId.c_str());
-                }
+                setDynamicNatIptablesRulesWithAcl(ADD, poolInterface, ip_range, port_range, m_natAclRuleInfo[aclKey], (*it).second.static_key,
+                                                  "dynamic iptables acl rules for Rule id " + aclRuleId + " for Table " + aclTableId);
                 return;
             }
             else
             {
+                /* aclInterface is None means have to delete the All forward rules, once an ACL rule is applied */
+                auto isRuleSet = std::make_shared<bool>(false);
+                string bindingKey = (*it).first;
+                string staticKey = (*it).second.static_key;
+                string tableInterface = m_natAclTableInfo[aclTableId];
+                std::function<void()> deleteAllForwardRules = [this, isRuleSet, bindingKey, staticKey, tableInterface,
+                                                               poolInterface, ip_range, port_range, aclKey]()
+                {
+                    auto binding = m_natBindingInfo.find(bindingKey);
+
+                    if ((*isRuleSet) or (binding == m_natBindingInfo.end()))
+                    {
+                        return;
+                    }
+                    *isRuleSet = true;
+
+                    /* Set pool ip to APPL_DB */
+                    setNaptPoolIpTable(DELETE, ip_range, port_range);
+
+                    /* Delete DnatPool entry from APPL_DB*/
+                    SWSS_LOG_INFO("Deleting dnat pool entry for %s", ip_range.c_str());
+                    setDnatPoolfromNatPool(DELETE, ip_range);
+
+                    /* Delete dynamic iptables rule without acl */
+                    setDynamicNatIptablesRulesWithoutAcl(DELETE, poolInterface, ip_range, port_range, staticKey,
+                                                         "dynamic iptables rules for " + aclKey);
+
+                    binding->second.acl_interface = tableInterface;
+                };
+
                 /* Get all AclRule Info */
                 for (auto it2 = m_natAclRuleInfo.begin(); it2 != m_natAclRuleInfo.end(); it2++)
                 {
@@ -4906,38 +4888,9 @@ void NatMgr::addDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
                     setDnatPoolfromNatPool(ADD, ip_range);
 
                     /* Add dynamic iptables rule with acls */
-                    if (!setDynamicNatIptablesRulesWithAcl(ADD, poolInterface, ip_range, port_range, (*it2).second, (*it).second.static_key))
-                    {
-                        SWSS_LOG_ERROR("Failed to add dynamic iptables acl rules for Rule id %s for Table %s", aclRuleKeys[1].c_str(), aclTableId.c_str());
-                    }
-                    else
-                    {
-                        isRuleSet = true;
-                        SWSS_LOG_INFO("Added dynamic iptables acl rules for Rule id %s for Table %s", aclRuleKeys[1].c_str(), aclTableId.c_str());
-                    }
-                }
-      
-                /* aclInterface is None means have to delete the All forward rules */
-                if ((aclInterface == NONE_STRING) and (isRuleSet == true))
-                {
-                    /* Set pool ip to APPL_DB */
-                    setNaptPoolIpTable(DELETE, ip_range, port_range);
-
-                    /* Delete DnatPool entry from APPL_DB*/
-                    SWSS_LOG_INFO("Deleting dnat pool entry for %s", ip_range.c_str());
-                    setDnatPoolfromNatPool(DELETE, ip_range);
-
-                    /* Delete dynamic iptables rule without acl */
-                    if (!setDynamicNatIptablesRulesWithoutAcl(DELETE, poolInterface, ip_range, port_range, (*it).second.static_key))
-                    {
-                        SWSS_LOG_ERROR("Failed to remove dynamic iptables rules for %s", aclKey.c_str());
-                    }
-                    else
-                    {
-                        SWSS_LOG_INFO("Deleted dynamic iptables rules for %s", aclKey.c_str());
-                    }
-                    
-                    (*it).second.acl_interface = m_natAclTableInfo[aclTableId];
+                    setDynamicNatIptablesRulesWithAcl(ADD, poolInterface, ip_range, port_range, (*it2).second, (*it).second.static_key,
+                                                      "dynamic iptables acl rules for Rule id " + aclRuleKeys[1] + " for Table " + aclTableId,
+                                                      (aclInterface == NONE_STRING) ? deleteAllForwardRules : nullptr);
                 }
                 return;
             }
@@ -4980,7 +4933,7 @@ void NatMgr::removeDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
         string acls_name = (*it).second.acl_name;
         string poolInterface, aclInterface;
         string port_range, ip_range;
-        bool isRuleSet = false, isRulePresent = false;
+        bool isRulePresent = false;
 
         /* Check the pool is present in cache, otherwise continue */
         if (m_natPoolInfo.find(pool_name) == m_natPoolInfo.end())
@@ -5049,14 +5002,8 @@ void NatMgr::removeDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
                 setDnatPoolfromNatPool(DELETE, ip_range);
 
                 /* Delete dynamic iptables rule with acls*/
-                if (!setDynamicNatIptablesRulesWithAcl(DELETE, poolInterface, ip_range, port_range, m_natAclRuleInfo[aclKey], (*it).second.static_key))
-                {
-                    SWSS_LOG_ERROR("Failed to delete dynamic iptables acl rules for Rule id %s for Table %s", aclRuleId.c_str(), aclTableId.c_str());
-                }
-                else
-                {
-                    SWSS_LOG_INFO("Deleted dynamic iptables acl rules for Rule id %s for Table %s", aclRuleId.c_str(), aclTableId.c_str());
-                }
+                setDynamicNatIptablesRulesWithAcl(DELETE, poolInterface, ip_range, port_range, m_natAclRuleInfo[aclKey], (*it).second.static_key,
+                                                  "dynamic iptables acl rules for Rule id " + aclRuleId + " for Table " + aclTableId);
 
                 /* Check any other rule matching in same Table-Id */
                 for (auto it = m_natAclRuleInfo.begin(); it != m_natAclRuleInfo.end(); it++)
@@ -5087,14 +5034,8 @@ void NatMgr::removeDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
                     setDnatPoolfromNatPool(ADD, ip_range);
 
                     /* Set dynamic iptables rule without acl */
-                    if (!setDynamicNatIptablesRulesWithoutAcl(ADD, poolInterface, ip_range, port_range, (*it).second.static_key))
-                    {
-                        SWSS_LOG_ERROR("Failed to add dynamic iptables rules for %s", aclKey.c_str());
-                    }
-                    else
-                    {
-                        SWSS_LOG_INFO("Added dynamic iptables rules for %s", aclKey.c_str());
-                    }
+                    setDynamicNatIptablesRulesWithoutAcl(ADD, poolInterface, ip_range, port_range, (*it).second.static_key,
+                                                         "dynamic iptables rules for " + aclKey);
 
                     (*it).second.acl_interface = NONE_STRING;
                 }
@@ -5102,6 +5043,35 @@ void NatMgr::removeDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
             }
             else
             {
+                /* If aclInterface is not None, add dynamic all forward rules once an ACL rule is removed */
+                auto isRuleSet = std::make_shared<bool>(false);
+                string bindingKey = (*it).first;
+                string staticKey = (*it).second.static_key;
+                std::function<void()> addAllForwardRules = [this, isRuleSet, bindingKey, staticKey,
+                                                            poolInterface, ip_range, port_range, aclKey]()
+                {
+                    auto binding = m_natBindingInfo.find(bindingKey);
+
+                    if ((*isRuleSet) or (binding == m_natBindingInfo.end()))
+                    {
+                        return;
+                    }
+                    *isRuleSet = true;
+
+                    /* Set pool ip to APPL_DB */
+                    setNaptPoolIpTable(ADD, ip_range, port_range);
+
+                    /* Add DnatPool entry to APPL_DB*/
+                    SWSS_LOG_INFO("Adding dnat pool entry for %s", ip_range.c_str());
+                    setDnatPoolfromNatPool(ADD, ip_range);
+
+                    /* Add dynamic iptables rule without acl */
+                    setDynamicNatIptablesRulesWithoutAcl(ADD, poolInterface, ip_range, port_range, staticKey,
+                                                         "dynamic iptables rules for " + aclKey);
+
+                    binding->second.acl_interface = NONE_STRING;
+                };
+
                 /* Get all AclRule Info */
                 for (auto it2 = m_natAclRuleInfo.begin(); it2 != m_natAclRuleInfo.end(); it2++)
                 {
@@ -5123,38 +5093,9 @@ void NatMgr::removeDynamicNatRuleByAcl(const string &aclKey, bool isRuleId)
                     setDnatPoolfromNatPool(DELETE, ip_range);
 
                     /* Delete dynamic iptables rule with acls */
-                    if (!setDynamicNatIptablesRulesWithAcl(DELETE, poolInterface, ip_range, port_range, (*it2).second, (*it).second.static_key))
-                    {
-                        SWSS_LOG_ERROR("Failed to delete dynamic iptables acl rules for Rule id %s for Table %s", aclRuleKeys[1].c_str(), aclTableId.c_str());
-                    }
-                    else
-                    {
-                        isRuleSet = true;
-                        SWSS_LOG_INFO("Deleted dynamic iptables acl rules for Rule id %s for Table %s", aclRuleKeys[1].c_str(), aclTableId.c_str());
-                    }
-                }
-
-                /* If aclInterface is not None, add dynamic all forward rules */
-                if ((aclInterface != NONE_STRING) and (isRuleSet == true))
-                {
-                    /* Set pool ip to APPL_DB */
-                    setNaptPoolIpTable(ADD, ip_range, port_range);
-
-                    /* Add DnatPool entry to APPL_DB*/
-                    SWSS_LOG_INFO("Adding dnat pool entry for %s", ip_range.c_str());
-                    setDnatPoolfromNatPool(ADD, ip_range);
-
-                    /* Add dynamic iptables rule without acl */
-                    if (!setDynamicNatIptablesRulesWithoutAcl(ADD, poolInterface, ip_range, port_range, (*it).second.static_key))
-                    {
-                        SWSS_LOG_ERROR("Failed to add dynamic iptables rules for %s", aclKey.c_str());
-                    }
-                    else
-                    {
-                        SWSS_LOG_INFO("Added dynamic iptables rules for %s", aclKey.c_str());
-                    }
-
-                    (*it).second.acl_interface = NONE_STRING;
+                    setDynamicNatIptablesRulesWithAcl(DELETE, poolInterface, ip_range, port_range, (*it2).second, (*it).second.static_key,
+                                                      "dynamic iptables acl rules for Rule id " + aclRuleKeys[1] + " for Table " + aclTableId,
+                                                      (aclInterface != NONE_STRING) ? addAllForwardRules : nullptr);
                 }
                 return;
             }
@@ -5807,6 +5748,8 @@ void NatMgr::doTask(SelectableTimer &timer)
     {
         SWSS_LOG_INFO("Received unknown selectable timer");
     }
+
+    commitKernelUpdates();
 }
 
 /* To parse the received Static NAT Table and save it to cache */
@@ -8196,6 +8139,8 @@ void NatMgr::doTask(Consumer &consumer)
         SWSS_LOG_ERROR("Unknown config table %s ", table_name.c_str());
         throw runtime_error("NatMgr doTask failure.");
     }
+
+    commitKernelUpdates();
 }
 
 /* To parse the timeout notifications */
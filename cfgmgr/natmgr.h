@@ -23,10 +23,13 @@
 #include "orch.h"
 #include "notificationproducer.h"
 #include "timer.h"
+#include "conntrackexec.h"
 #include <unistd.h>
+#include <functional>
 #include <set>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace swss {
 
@@ -252,6 +255,9 @@ public:
     void removeStaticNaptIptables(const std::string port = NONE_STRING);
     void removeDynamicNatRules(const std::string port = NONE_STRING, const std::string ipPrefix = NONE_STRING);
 
+    /* Applies the queued iptables rules and conntrack requests to the kernel */
+    void commitKernelUpdates();
+
 private:
     /* Declare APPL_DB, CFG_DB and STATE_DB tables */
     ProducerStateTable m_appNatTableProducer, m_appNaptTableProducer, m_appNatGlobalTableProducer;
@@ -276,6 +282,19 @@ private:
     natDnatPool_map_t        m_natDnatPoolInfo;
     SelectableTimer          *m_natRefreshTimer;
 
+    /* A chain of iptables commands queued until commitIptablesCmds() */
+    struct IptablesCmds
+    {
+        std::string cmds;
+        bool del;                           /* Deletes rules, for the logs */
+        std::string desc;                   /* Rules set by the commands, for the logs */
+        std::function<void()> on_success;   /* Bookkeeping once the commands are applied */
+    };
+
+    /* Kernel updates are queued while handling tasks and notifications */
+    ConntrackExecutor                                  m_conntrack;
+    std::map<std::string, std::vector<IptablesCmds>>   m_iptablesCmds;
+
     /* Declare doTask related functions */
     void doTask(Consumer &consumer);
     void doTask(SelectableTimer &timer);
@@ -366,20 +385,26 @@ private:
     bool isGlobalIpMatching(const std::string &intf_keys, const std::string &global_ip);
     bool getIpEnabledIntf(const std::string &global_ip, std::string &interface);
     void setNaptPoolIpTable(const std::string &opCmd, const std::string &nat_ip, const std::string &nat_port);
-    bool setFullConeDnatIptablesRule(const std::string &opCmd);
-    bool setMangleIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &nat_zone);
-    bool setStaticNatIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &external_ip, const std::string &internal_ip, const std::string &nat_type);
-    bool setStaticNaptIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &prototype, const std::string &external_ip, 
-                                    const std::string &external_port, const std::string &internal_ip, const std::string &internal_port, const std::string &nat_type);
-    bool setStaticTwiceNatIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &src_ip, const std::string &translated_src_ip,
-                                        const std::string &dest_ip, const std::string &translated_dest_ip);
-    bool setStaticTwiceNaptIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &prototype, const std::string &src_ip, const std::string &src_port,
+    void queueIptablesCmds(const std::string &cmds, const std::string &opCmd, const std::string &desc,
+                           std::function<void()> on_success = nullptr);
+    std::vector<std::string> commitIptablesCmds(void);
+    void setFullConeDnatIptablesRule(const std::string &opCmd);
+    void setMangleIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &nat_zone);
+    void setStaticNatIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &external_ip, const std::string &internal_ip, const std::string &nat_type,
+                                   const std::string &desc);
+    void setStaticNaptIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &prototype, const std::string &external_ip, 
+                                    const std::string &external_port, const std::string &internal_ip, const std::string &internal_port, const std::string &nat_type,
+                                    const std::string &desc);
+    void setStaticTwiceNatIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &src_ip, const std::string &translated_src_ip,
+                                        const std::string &dest_ip, const std::string &translated_dest_ip, const std::string &desc);
+    void setStaticTwiceNaptIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &prototype, const std::string &src_ip, const std::string &src_port,
                                          const std::string &translated_src_ip, const std::string &translated_src_port, const std::string &dest_ip, const std::string &dest_port,
-                                         const std::string &translated_dest_ip, const std::string &translated_dest_port);
-    bool setDynamicNatIptablesRulesWithAcl(const std::string &opCmd, const std::string &interface, const std::string &external_ip,
-                                           const std::string &external_port_range, natAclRule_t &natAclRuleId, const std::string &static_key);
-    bool setDynamicNatIptablesRulesWithoutAcl(const std::string &opCmd, const std::string &interface, const std::string &external_ip,
-                                              const std::string &external_port_range, const std::string &static_key);
+                                         const std::string &translated_dest_ip, const std::string &translated_dest_port, const std::string &desc);
+    void setDynamicNatIptablesRulesWithAcl(const std::string &opCmd, const std::string &interface, const std::string &external_ip,
+                                           const std::string &external_port_range, natAclRule_t &natAclRuleId, const std::string &static_key,
+                                           const std::string &desc, std::function<void()> on_success = nullptr);
+    void setDynamicNatIptablesRulesWithoutAcl(const std::string &opCmd, const std::string &interface, const std::string &external_ip,
+                                              const std::string &external_port_range, const std::string &static_key, const std::string &desc);
 
 };
 
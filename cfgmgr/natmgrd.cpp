@@ -94,6 +94,8 @@ void cleanup()
 
         natmgr->cleanupMangleIpTables();
         natmgr->cleanupPoolIpTable();
+
+        natmgr->commitKernelUpdates();
     }
 }
 
@@ -167,23 +169,29 @@ int main(int argc, char **argv)
 
             if (sel == timeoutNotificationsConsumer)
             {
-               std::string op;
-               std::string data;
-               std::vector<swss::FieldValueTuple> values;
-
-               timeoutNotificationsConsumer->pop(op, data, values);
-               natmgr->timeoutNotifications(op, data);
+               std::deque<KeyOpFieldsValuesTuple> entries;
+
+               /* Handle all the pending notifications, then apply their kernel updates at once */
+               timeoutNotificationsConsumer->pops(entries);
+               for (auto &entry : entries)
+               {
+                   natmgr->timeoutNotifications(kfvOp(entry), kfvKey(entry));
+               }
+               natmgr->commitKernelUpdates();
                continue;
             }
 
             if (sel == flushNotificationsConsumer)
             {
-               std::string op;
-               std::string data;
-               std::vector<swss::FieldValueTuple> values;
-
-               flushNotificationsConsumer->pop(op, data, values);
-               natmgr->flushNotifications(op, data);
+               std::deque<KeyOpFieldsValuesTuple> entries;
+
+               /* Handle all the pending notifications, then apply their kernel updates at once */
+               flushNotificationsConsumer->pops(entries);
+               for (auto &entry : entries)
+               {
+                   natmgr->flushNotifications(kfvOp(entry), kfvKey(entry));
+               }
+               natmgr->commitKernelUpdates();
                continue;
             }
 
@@ -12,12 +12,15 @@
 #include <fstream>
 #include <sstream>
 #include <thread>
+#include <atomic>
 
 #include <net/if.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
 #include <sys/types.h>
+#include <sys/syscall.h>
+#include <poll.h>
 #include <signal.h>
 #include <netlink/route/link.h>
 
@@ -25,6 +28,9 @@
 using namespace std;
 using namespace swss;
 
+// teamd processes started at the same time
+#define MAX_PARALLEL_TEAMD_LAUNCHES 8
+
 
 TeamMgr::TeamMgr(DBConnector *confDb, DBConnector *applDb, DBConnector *statDb,
         const vector<TableConnector> &tables) :
@@ -37,7 +43,8 @@ TeamMgr::TeamMgr(DBConnector *confDb, DBConnector *applDb, DBConnector *statDb,
     m_appLagTable(applDb, APP_LAG_TABLE_NAME),
     m_statePortTable(statDb, STATE_PORT_TABLE_NAME),
     m_stateLagTable(statDb, STATE_LAG_TABLE_NAME),
-    m_stateMACsecIngressSATable(statDb, STATE_MACSEC_INGRESS_SA_TABLE_NAME)
+    m_stateMACsecIngressSATable(statDb, STATE_MACSEC_INGRESS_SA_TABLE_NAME),
+    m_stateLagBringupTable(statDb, STATE_LAG_BRINGUP_TABLE_NAME)
 {
     SWSS_LOG_ENTER();
 
@@ -50,6 +57,14 @@ TeamMgr::TeamMgr(DBConnector *confDb, DBConnector *applDb, DBConnector *statDb,
         m_stateLagTable.del(alias);
     }
 
+    keys.clear();
+    m_stateLagBringupTable.getKeys(keys);
+
+    for (auto alias : keys)
+    {
+        m_stateLagBringupTable.del(alias);
+    }
+
     // Get the MAC address from configuration database
     vector<FieldValueTuple> fvs;
     m_cfgMetadataTable.get("localhost", fvs);
@@ -223,9 +238,29 @@ void TeamMgr::cleanTeamProcesses()
 
         SWSS_LOG_NOTICE("Waiting for port channel %s pid %d to stop...", alias.c_str(), pid);
 
+        // A pidfd becomes readable when the process exits, poll the pid
+        // only on kernels without pidfd support
+        int pidfd = -1;
+#ifdef SYS_pidfd_open
+        pidfd = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#endif
+
         while (!kill(pid, 0))
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            if (pidfd >= 0)
+            {
+                struct pollfd pfd = { pidfd, POLLIN, 0 };
+                poll(&pfd, 1, 1000);
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+
+        if (pidfd >= 0)
+        {
+            close(pidfd);
         }
     }
 
@@ -235,6 +270,42 @@ void TeamMgr::cleanTeamProcesses()
 void TeamMgr::doLagTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
+
+    // Start the teamd of all the new port channels in this batch together,
+    // they are configured one by one below once their teamd is ready
+    map<string, LagLaunch> launches;
+    for (const auto &entry : consumer.m_toSync)
+    {
+        const KeyOpFieldsValuesTuple &t = entry.second;
+        const string &alias = kfvKey(t);
+
+        if (kfvOp(t) != SET_COMMAND || m_lagList.find(alias) != m_lagList.end() ||
+            launches.find(alias) != launches.end())
+        {
+            continue;
+        }
+
+        LagLaunch launch = { alias, 0, false, false, task_need_retry, {}, {} };
+        for (const auto &i : kfvFieldsValues(t))
+        {
+            if (fvField(i) == "min_links")
+            {
+                launch.min_links = stoi(fvValue(i));
+            }
+            else if (fvField(i) == "fallback")
+            {
+                launch.fallback = fvValue(i) == "true";
+            }
+            else if (fvField(i) == "fast_rate")
+            {
+                launch.fast_rate = fvValue(i) == "true";
+            }
+        }
+        launches[alias] = launch;
+    }
+
+    addLags(launches);
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -304,9 +375,26 @@ void TeamMgr::doLagTask(Consumer &consumer)
                 }
             }
 
+            bool launched = false;
+            LagLaunch launch = {};
             if (m_lagList.find(alias) == m_lagList.end())
             {
-                if (addLag(alias, min_links, fallback, fast_rate) == task_need_retry)
+                // A port channel removed and added again in this batch is started on its own
+                task_process_status status;
+                auto lit = launches.find(alias);
+                if (lit != launches.end())
+                {
+                    launch = lit->second;
+                    launches.erase(lit);
+                    launched = true;
+                    status = launch.status;
+                }
+                else
+                {
+                    status = addLag(alias, min_links, fallback, fast_rate);
+                }
+
+                if (status == task_need_retry)
                 {
                     // If LAG creation fails, we need to clean up any potentially orphaned teamd processes
                     removeLag(alias);
@@ -340,6 +428,11 @@ void TeamMgr::doLagTask(Consumer &consumer)
                     SWSS_LOG_ERROR("Failed to configure %s sys_mac to %s", alias.c_str(), sys_mac.c_str());
                 }
             }
+
+            if (launched)
+            {
+                setLagBringupTime(launch);
+            }
         }
         else if (op == DEL_COMMAND)
         {
@@ -347,6 +440,7 @@ void TeamMgr::doLagTask(Consumer &consumer)
             {
                 removeLag(alias);
                 m_lagList.erase(alias);
+                m_stateLagBringupTable.del(alias);
             }
         }
 
@@ -358,6 +452,8 @@ void TeamMgr::doLagMemberTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    map<string, vector<string>> members;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -381,11 +477,11 @@ void TeamMgr::doLagMemberTask(Consumer &consumer)
                 it++;
                 continue;
             }
-            if (addLagMember(lag, member) == task_need_retry)
-            {
-                it++;
-                continue;
-            }
+
+            // Enslaved below together with the other ready members of the port channel
+            members[lag].push_back(member);
+            it++;
+            continue;
         }
         else if (op == DEL_COMMAND)
         {
@@ -394,6 +490,33 @@ void TeamMgr::doLagMemberTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    // Results are keyed by LAG_MEMBER key, a port may be pending for another port channel
+    map<string, task_process_status> status;
+    for (const auto &lag : members)
+    {
+        map<string, task_process_status> lagStatus;
+        addLagMembers(lag.first, lag.second, lagStatus);
+
+        for (const auto &member : lagStatus)
+        {
+            status[lag.first + config_db_key_delimiter + member.first] = member.second;
+        }
+    }
+
+    it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
+    {
+        auto added = status.find(kfvKey(it->second));
+
+        if (added == status.end() || added->second == task_need_retry)
+        {
+            it++;
+            continue;
+        }
+
+        it = consumer.m_toSync.erase(it);
+    }
 }
 
 bool TeamMgr::checkPortIffUp(const string &port)
@@ -460,6 +583,8 @@ void TeamMgr::doPortUpdateTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    map<string, vector<string>> members;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -482,11 +607,9 @@ void TeamMgr::doPortUpdateTask(Consumer &consumer)
                     continue;
                 }
 
-                if (addLagMember(lag, alias) == task_need_retry)
-                {
-                    it++;
-                    continue;
-                }
+                members[lag].push_back(alias);
+                it++;
+                continue;
             }
         }
         else if (op == DEL_COMMAND)
@@ -496,6 +619,26 @@ void TeamMgr::doPortUpdateTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    map<string, task_process_status> status;
+    for (const auto &lag : members)
+    {
+        addLagMembers(lag.first, lag.second, status);
+    }
+
+    it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
+    {
+        auto added = status.find(kfvKey(it->second));
+
+        if (added == status.end() || added->second == task_need_retry)
+        {
+            it++;
+            continue;
+        }
+
+        it = consumer.m_toSync.erase(it);
+    }
 }
 
 bool TeamMgr::setLagAdminStatus(const string &alias, const string &admin_status)
@@ -768,6 +911,76 @@ task_process_status TeamMgr::addLag(const string &alias, int min_links, bool fal
     return task_success;
 }
 
+// Starts the teamd of several port channels, at most MAX_PARALLEL_TEAMD_LAUNCHES
+// at a time. teamd -d only returns once the daemon is ready, so each launch
+// completes when its port channel can be configured.
+void TeamMgr::addLags(map<string, LagLaunch> &lags)
+{
+    SWSS_LOG_ENTER();
+
+    vector<LagLaunch *> queue;
+    for (auto &lag : lags)
+    {
+        queue.push_back(&lag.second);
+    }
+
+    atomic<size_t> next(0);
+    auto launch = [this, &queue, &next]() {
+        for (size_t i = next++; i < queue.size(); i = next++)
+        {
+            LagLaunch &lag = *queue[i];
+
+            lag.start = chrono::steady_clock::now();
+            try
+            {
+                lag.status = addLag(lag.alias, lag.min_links, lag.fallback, lag.fast_rate);
+            }
+            catch (const exception &e)
+            {
+                SWSS_LOG_ERROR("Failed to start port channel %s: %s", lag.alias.c_str(), e.what());
+                lag.status = task_need_retry;
+            }
+            lag.ready = chrono::steady_clock::now();
+        }
+    };
+
+    size_t workers = min(queue.size(), static_cast<size_t>(MAX_PARALLEL_TEAMD_LAUNCHES));
+    if (workers <= 1)
+    {
+        launch();
+        return;
+    }
+
+    SWSS_LOG_NOTICE("Start %zu port channels with %zu workers", queue.size(), workers);
+
+    vector<thread> pool;
+    for (size_t i = 0; i < workers; i++)
+    {
+        pool.emplace_back(launch);
+    }
+    for (auto &worker : pool)
+    {
+        worker.join();
+    }
+}
+
+// Records how long the port channel took to come up: until its teamd was
+// ready and until it was configured
+void TeamMgr::setLagBringupTime(const LagLaunch &lag)
+{
+    auto now = chrono::steady_clock::now();
+    auto teamd_ms = chrono::duration_cast<chrono::milliseconds>(lag.ready - lag.start).count();
+    auto bringup_ms = chrono::duration_cast<chrono::milliseconds>(now - lag.start).count();
+
+    vector<FieldValueTuple> fvs;
+    fvs.emplace_back("teamd_ready_ms", to_string(teamd_ms));
+    fvs.emplace_back("bringup_ms", to_string(bringup_ms));
+    m_stateLagBringupTable.set(lag.alias, fvs);
+
+    SWSS_LOG_INFO("Port channel %s is up in %lld ms, teamd ready in %lld ms",
+            lag.alias.c_str(), static_cast<long long>(bringup_ms), static_cast<long long>(teamd_ms));
+}
+
 bool TeamMgr::removeLag(const string &alias)
 {
     SWSS_LOG_ENTER();
@@ -848,83 +1061,83 @@ uint16_t TeamMgr::generateLacpKey(const string& lag)
 // Once a port is enslaved into a port channel, the port's MTU will
 // be inherited from the master's MTU while the port's admin status
 // will still be controlled separately.
-task_process_status TeamMgr::addLagMember(const string &lag, const string &member)
+//
+// The members of a port channel are enslaved with one shell command, the
+// result of each one is returned in status.
+void TeamMgr::addLagMembers(const string &lag, const vector<string> &members,
+                            map<string, task_process_status> &status)
 {
     SWSS_LOG_ENTER();
 
     stringstream cmd;
     string res;
+    vector<string> enslaving;
 
-    // If port was already deleted, ignore this operation
-    cmd << IP_CMD << " link show " << shellquote(member);
-    if (exec(cmd.str(), res) != 0)
+    for (const auto &member : members)
     {
-	SWSS_LOG_WARN("Unable to find port %s", member.c_str());
-	return task_ignore;
+        // If port was already deleted, ignore this operation
+        if (!if_nametoindex(member.c_str()))
+        {
+            SWSS_LOG_WARN("Unable to find port %s", member.c_str());
+            status[member] = task_ignore;
+            continue;
+        }
+
+        // If port is already enslaved, ignore this operation
+        // TODO: check the current master if it is the same as to be configured
+        if (isPortEnslaved(member))
+        {
+            status[member] = task_ignore;
+            continue;
+        }
+
+        enslaving.push_back(member);
     }
 
-    // If port is already enslaved, ignore this operation
-    // TODO: check the current master if it is the same as to be configured
-    if (isPortEnslaved(member))
+    if (enslaving.empty())
     {
-        return task_ignore;
+        return;
     }
 
     uint16_t keyId = generateLacpKey(lag);
-    cmd.str("");
-    cmd.clear();
 
-    // Set admin down LAG member (required by teamd) and enslave it
+    // Set admin down LAG member (required by teamd) and enslave it, the
+    // members that fail to be added are printed
     // ip link set dev <member> down;
     // teamdctl <port_channel_name> port config update <member> { "lacp_key": <lacp_key>, "link_watch": { "name": "ethtool" } };
-    // teamdctl <port_channel_name> port add <member>;
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " down; ";
-    cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port config update " << shellquote(member)
-        << " '{\"lacp_key\":"
-        << keyId
-        << ",\"link_watch\": {\"name\": \"ethtool\"} }'; ";
-    cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port add " << shellquote(member);
+    // teamdctl <port_channel_name> port add <member> || echo <member>;
+    for (const auto &member : enslaving)
+    {
+        cmd << IP_CMD << " link set dev " << shellquote(member) << " down; ";
+        cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port config update " << shellquote(member)
+            << " '{\"lacp_key\":"
+            << keyId
+            << ",\"link_watch\": {\"name\": \"ethtool\"} }'; ";
+        cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port add " << shellquote(member)
+            << " || " << ECHO_CMD << " " << shellquote(member) << "; ";
+    }
 
+    set<string> failed;
     if (exec(cmd.str(), res) != 0)
     {
-        // teamdctl port add command will fail when the member port is not
-        // set to admin status down; it is possible that some other processes
-        // or users (e.g. portmgrd) are executing the command to bring up the
-        // member port while adding this port into the port channel. This piece
-        // of code will check if the port is set to admin status up. If yes,
-        // it will retry to add the port into the port channel.
-        if (checkPortIffUp(member))
-        {
-            SWSS_LOG_INFO("Failed to add %s to port channel %s, retry...",
-                    member.c_str(), lag.c_str());
-            return task_need_retry;
-        }
-        else
-        {
-            SWSS_LOG_ERROR("Failed to add %s to port channel %s",
-                    member.c_str(), lag.c_str());
-            return task_failed;
-        }
+        failed.insert(enslaving.begin(), enslaving.end());
     }
-
-    vector<FieldValueTuple> fvs;
-    m_cfgPortTable.get(member, fvs);
-
-    // Get the member admin status
-    auto it = find_if(fvs.begin(), fvs.end(), [](const FieldValueTuple &fv) {
-            return fv.first == "admin_status";
-            });
-
-    string admin_status = DEFAULT_ADMIN_STATUS_STR;
-    if (it != fvs.end())
+    else
     {
-        admin_status = it->second;
+        for (const auto &member : tokenize(res, '\n'))
+        {
+            if (!member.empty())
+            {
+                failed.insert(member);
+            }
+        }
     }
 
     // Get the LAG MTU (by default 9100)
     // Member port will inherit master's MTU attribute
+    vector<FieldValueTuple> fvs;
     m_cfgLagTable.get(lag, fvs);
-    it = find_if(fvs.begin(), fvs.end(), [](const FieldValueTuple &fv) {
+    auto it = find_if(fvs.begin(), fvs.end(), [](const FieldValueTuple &fv) {
             return fv.first == "mtu";
             });
 
@@ -934,19 +1147,97 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
         mtu = it->second;
     }
 
-    // ip link set dev <member> [up|down]
     cmd.str(string());
-    cmd << IP_CMD << " link set dev " << shellquote(member) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    cmd.clear();
+    vector<string> added;
+
+    for (const auto &member : enslaving)
+    {
+        if (failed.find(member) != failed.end())
+        {
+            // teamdctl port add command will fail when the member port is not
+            // set to admin status down; it is possible that some other processes
+            // or users (e.g. portmgrd) are executing the command to bring up the
+            // member port while adding this port into the port channel. This piece
+            // of code will check if the port is set to admin status up. If yes,
+            // it will retry to add the port into the port channel.
+            if (checkPortIffUp(member))
+            {
+                SWSS_LOG_INFO("Failed to add %s to port channel %s, retry...",
+                        member.c_str(), lag.c_str());
+                status[member] = task_need_retry;
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Failed to add %s to port channel %s",
+                        member.c_str(), lag.c_str());
+                status[member] = task_failed;
+            }
+            continue;
+        }
+
+        m_cfgPortTable.get(member, fvs);
+
+        // Get the member admin status
+        it = find_if(fvs.begin(), fvs.end(), [](const FieldValueTuple &fv) {
+                return fv.first == "admin_status";
+                });
+
+        string admin_status = DEFAULT_ADMIN_STATUS_STR;
+        if (it != fvs.end())
+        {
+            admin_status = it->second;
+        }
+
+        // ip link set dev <member> [up|down] || echo <member>;
+        cmd << IP_CMD << " link set dev " << shellquote(member) << " " << shellquote(admin_status)
+            << " || " << ECHO_CMD << " " << shellquote(member) << "; ";
+        added.push_back(member);
+    }
+
+    if (added.empty())
+    {
+        return;
+    }
+
+    failed.clear();
+    res.clear();
+    if (exec(cmd.str(), res) != 0)
+    {
+        failed.insert(added.begin(), added.end());
+    }
+    else
+    {
+        for (const auto &member : tokenize(res, '\n'))
+        {
+            if (!member.empty())
+            {
+                failed.insert(member);
+            }
+        }
+    }
 
     fvs.clear();
     FieldValueTuple fv("mtu", mtu);
     fvs.push_back(fv);
-    m_appPortTable.set(member, fvs);
 
-    SWSS_LOG_NOTICE("Add %s to port channel %s", member.c_str(), lag.c_str());
+    for (const auto &member : added)
+    {
+        // The member is enslaved and inherits the port channel MTU either way
+        m_appPortTable.set(member, fvs);
 
-    return task_success;
+        if (failed.find(member) != failed.end())
+        {
+            SWSS_LOG_ERROR("Failed to set admin status of %s in port channel %s",
+                    member.c_str(), lag.c_str());
+            status[member] = task_failed;
+            continue;
+        }
+
+        status[member] = task_success;
+
+        SWSS_LOG_NOTICE("Add %s to port channel %s", member.c_str(), lag.c_str());
+    }
 }
 
 // Once a port is removed from from the master, both the admin status and the
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "dbconnector.h"
 #include "netmsg.h"
@@ -9,6 +12,10 @@
 #include "producerstatetable.h"
 #include <sys/types.h>
 
+// Per port channel bring-up latency, kept apart from STATE_LAG_TABLE whose
+// entries tell the other daemons that the port channel is ready
+#define STATE_LAG_BRINGUP_TABLE_NAME "LAG_BRINGUP_TABLE"
+
 namespace swss {
 
 class TeamMgr : public Orch
@@ -29,6 +36,7 @@ private:
     Table m_statePortTable;
     Table m_stateLagTable;
     Table m_stateMACsecIngressSATable;
+    Table m_stateLagBringupTable;
 
     ProducerStateTable m_appPortTable;
     ProducerStateTable m_appLagTable;
@@ -37,14 +45,28 @@ private:
 
     MacAddress m_mac;
 
+    struct LagLaunch
+    {
+        std::string alias;
+        int min_links;
+        bool fallback;
+        bool fast_rate;
+        task_process_status status;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point ready;
+    };
+
     void doTask(Consumer &consumer);
     void doLagTask(Consumer &consumer);
     void doLagMemberTask(Consumer &consumer);
     void doPortUpdateTask(Consumer &consumer);
 
     task_process_status addLag(const std::string &alias, int min_links, bool fall_back, bool fast_rate);
+    void addLags(std::map<std::string, LagLaunch> &lags);
+    void setLagBringupTime(const LagLaunch &lag);
     bool removeLag(const std::string &alias);
-    task_process_status addLagMember(const std::string &lag, const std::string &member);
+    void addLagMembers(const std::string &lag, const std::vector<std::string> &members,
+                       std::map<std::string, task_process_status> &status);
     bool removeLagMember(const std::string &lag, const std::string &member);
 
     bool setLagAdminStatus(const std::string &alias, const std::string &admin_status);
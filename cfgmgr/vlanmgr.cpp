@@ -1,4 +1,7 @@
+#include <errno.h>
 #include <string.h>
+#include <algorithm>
+#include <fstream>
 #include "logger.h"
 #include "producerstatetable.h"
 #include "macaddress.h"
@@ -115,161 +118,99 @@ VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
     EXEC_WITH_ERROR_THROW(no_ll_learn_cmd, res);
 }
 
-bool VlanMgr::addHostVlan(int vlan_id)
+static void disableArpEvictNoCarrier(const string &vlan_name)
 {
-    SWSS_LOG_ENTER();
-
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
-    //               /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + BRIDGE_CMD + " vlan add vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self && "
-      + IP_CMD + " link add link " + DOT1Q_BRIDGE_NAME
-               + " up"
-               + " name " + VLAN_PREFIX + std::to_string(vlan_id)
-               + " address " + gMacAddress.to_string()
-               + " type vlan id " + std::to_string(vlan_id) + "\"";
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
-
-    res.clear();
-    const std::string echo_cmd = std::string("")
-      + ECHO_CMD + " 0 > /proc/sys/net/ipv4/conf/" + VLAN_PREFIX + std::to_string(vlan_id) + "/arp_evict_nocarrier";
-    swss::exec(echo_cmd, res);
-
-    return true;
+    std::ofstream arp_evict_nocarrier("/proc/sys/net/ipv4/conf/" + vlan_name + "/arp_evict_nocarrier");
+    arp_evict_nocarrier << "0" << std::endl;
 }
 
-bool VlanMgr::removeHostVlan(int vlan_id)
+/*
+ * The addHostVlan*, removeHostVlan and setHostVlan* helpers only queue the
+ * host changes on m_netlink, completeHostTasks() sends them.
+ */
+void VlanMgr::addHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/ip link del Vlan{{vlan_id}} &&
-    //               /sbin/bridge vlan del vid {{vlan_id}} dev Bridge self"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + IP_CMD + " link del " + VLAN_PREFIX + std::to_string(vlan_id) + " && "
-      + BRIDGE_CMD + " vlan del vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self\"";
+    // Equivalent of:
+    // /sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
+    // /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}
+    const std::string vlan_name = VLAN_PREFIX + std::to_string(vlan_id);
+    m_netlink.addBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), false, false, true);
+    m_netlink.addVlanLink(vlan_name, DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), gMacAddress, true);
+}
 
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
+void VlanMgr::removeHostVlan(int vlan_id)
+{
+    SWSS_LOG_ENTER();
 
-    return true;
+    // Equivalent of:
+    // /sbin/ip link del Vlan{{vlan_id}} &&
+    // /sbin/bridge vlan del vid {{vlan_id}} dev Bridge self
+    m_netlink.delLink(VLAN_PREFIX + std::to_string(vlan_id));
+    m_netlink.delBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), true);
 }
 
-bool VlanMgr::setHostVlanAdminState(int vlan_id, const string &admin_status)
+void VlanMgr::setHostVlanAdminState(int vlan_id, const string &admin_status)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
+    // Equivalent of:
     // /sbin/ip link set Vlan{{vlan_id}} {{admin_status}}
-    ostringstream cmds;
-    cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " " << shellquote(admin_status);
-
-    std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    if (admin_status != "up" && admin_status != "down")
+    {
+        throw runtime_error("Invalid admin status " + admin_status + " for " VLAN_PREFIX + std::to_string(vlan_id));
+    }
 
-    return true;
+    m_netlink.setLinkAdminState(VLAN_PREFIX + std::to_string(vlan_id), admin_status == "up");
 }
 
-bool VlanMgr::setHostVlanMtu(int vlan_id, uint32_t mtu)
+void VlanMgr::setHostVlanMtu(int vlan_id, uint32_t mtu)
 {
     SWSS_LOG_ENTER();
 
-    // The command should be generated as:
+    // Equivalent of:
     // /sbin/ip link set Vlan{{vlan_id}} mtu {{mtu}}
-    const std::string cmds = std::string("")
-      + IP_CMD + " link set " + VLAN_PREFIX + std::to_string(vlan_id) + " mtu " + std::to_string(mtu);
-
-    std::string res;
-    int ret = swss::exec(cmds, res);
-    if (ret == 0)
-    {
-        return true;
-    }
-
     /* VLAN mtu should not be larger than member mtu */
-    return false;
+    m_netlink.setLinkMtu(VLAN_PREFIX + std::to_string(vlan_id), mtu);
 }
 
-bool VlanMgr::setHostVlanMac(int vlan_id, const string &mac)
+void VlanMgr::setHostVlanMac(int vlan_id, const string &mac)
 {
     SWSS_LOG_ENTER();
 
-    std::string res;
+    MacAddress mac_address(mac);
 
     /*
      * Bring down the bridge before changing MAC addresses of the bridge and the VLAN interface.
      * This is done so that the IPv6 link-local addresses of the bridge and the VLAN interface
-     * are updated after MAC change.
+     * are updated after MAC change, then start up the bridge again.
+     *
+     * Equivalent of:
      * /sbin/ip link set Bridge down
-     */
-    string bridge_down(IP_CMD " link set " DOT1Q_BRIDGE_NAME " down");
-    EXEC_WITH_ERROR_THROW(bridge_down, res);
-
-    // The command should be generated as:
-    // /sbin/ip link set Vlan{{vlan_id}} address {{mac}} &&
-    // /sbin/ip link set Bridge address {{mac}}
-    ostringstream cmds;
-    cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " address " << shellquote(mac) << " && "
-            IP_CMD " link set " DOT1Q_BRIDGE_NAME " address " << shellquote(mac);
-    res.clear();
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
-
-    /*
-     * Start up the bridge again.
+     * /sbin/ip link set Vlan{{vlan_id}} address {{mac}} &&
+     * /sbin/ip link set Bridge address {{mac}}
      * /sbin/ip link set Bridge up
      */
-    string bridge_up(IP_CMD " link set " DOT1Q_BRIDGE_NAME " up");
-    res.clear();
-    EXEC_WITH_ERROR_THROW(bridge_up, res);
-
-    return true;
+    m_netlink.setLinkAdminState(DOT1Q_BRIDGE_NAME, false);
+    m_netlink.setLinkAddress(VLAN_PREFIX + std::to_string(vlan_id), mac_address);
+    m_netlink.setLinkAddress(DOT1Q_BRIDGE_NAME, mac_address);
+    m_netlink.setLinkAdminState(DOT1Q_BRIDGE_NAME, true);
 }
 
-bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const string& tagging_mode)
+void VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const string& tagging_mode)
 {
     SWSS_LOG_ENTER();
 
-    std::string tagging_cmd;
-    if (tagging_mode == "untagged" || tagging_mode == "priority_tagged")
-    {
-        tagging_cmd = "pvid untagged";
-    }
-
-    // The command should be generated as:
-    // /bin/bash -c "/sbin/ip link set {{port_alias}} master Bridge &&
-    //               /sbin/bridge vlan del vid 1 dev {{ port_alias }} &&
-    //               /sbin/bridge vlan add vid {{vlan_id}} dev {{port_alias}} {{tagging_mode}}"
-    ostringstream cmds, inner;
-    inner << IP_CMD " link set " << shellquote(port_alias) << " master " DOT1Q_BRIDGE_NAME " && "
-      BRIDGE_CMD " vlan del vid " DEFAULT_VLAN_ID " dev " << shellquote(port_alias) << " && "
-      BRIDGE_CMD " vlan add vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " " + tagging_cmd;
-    cmds << BASH_CMD " -c " << shellquote(inner.str());
-
-    std::string res;
-    try
-    {
-        EXEC_WITH_ERROR_THROW(cmds.str(), res);
-    }
-    catch (const std::runtime_error& e)
-    {
-        // Race conidtion can happen with portchannel removal might happen
-	// but state db is not updated yet so we can do retry instead of sending exception
-	if (!port_alias.compare(0, strlen(LAG_PREFIX), LAG_PREFIX))
-	{
-            return false;
-	}
-        else
-	{
-            EXEC_WITH_ERROR_THROW(cmds.str(), res);
-	}
-    }
+    bool untagged = tagging_mode == "untagged" || tagging_mode == "priority_tagged";
 
-    return true;
+    // Equivalent of:
+    // /sbin/ip link set {{port_alias}} master Bridge &&
+    // /sbin/bridge vlan del vid 1 dev {{ port_alias }} &&
+    // /sbin/bridge vlan add vid {{vlan_id}} dev {{port_alias}} {{tagging_mode}}
+    m_netlink.setLinkMaster(port_alias, DOT1Q_BRIDGE_NAME);
+    m_netlink.delBridgeVlan(port_alias, 1);
+    m_netlink.addBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id), untagged, untagged);
 }
 
 bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
@@ -303,7 +244,11 @@ bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
     cmds << BASH_CMD " -c " << shellquote(inner.str());
 
     std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    int ret = m_netlink.exec(cmds.str(), res);
+    if (ret != 0)
+    {
+        throw runtime_error(cmds.str() + " : " + res);
+    }
 
     return true;
 }
@@ -313,6 +258,59 @@ bool VlanMgr::isVlanMacOk()
     return !!gMacAddress;
 }
 
+bool VlanMgr::hasHostTask(const vector<HostTask> &tasks, const string &key)
+{
+    return any_of(tasks.begin(), tasks.end(),
+                  [&key](const HostTask &task) { return kfvKey(task.it->second) == key; });
+}
+
+bool VlanMgr::flushHostChanges()
+{
+    vector<NetlinkExecutor::Error> errors;
+    return m_netlink.flush(errors);
+}
+
+void VlanMgr::completeHostTasks(Consumer &consumer, vector<HostTask> &tasks)
+{
+    SWSS_LOG_ENTER();
+
+    vector<NetlinkExecutor::Error> errors;
+    m_netlink.flush(errors);
+    m_netlink.setContext("");
+
+    for (auto &task : tasks)
+    {
+        const auto &t = task.it->second;
+
+        /*
+         * An entry is retried when one of its requests failed. The retry of a
+         * partly applied entry finds the links it already added or removed,
+         * which is not a failure.
+         */
+        const int done_error = kfvOp(t) == DEL_COMMAND ? ENODEV : EEXIST;
+        bool failed = false;
+        for (const auto &error : errors)
+        {
+            if (error.context == kfvKey(t) && error.error != done_error)
+            {
+                failed = true;
+            }
+        }
+
+        if (failed)
+        {
+            SWSS_LOG_INFO("%s not applied to the host, retrying", kfvKey(t).c_str());
+            continue;
+        }
+
+        auto done = std::move(task.done);
+        consumer.m_toSync.erase(task.it);
+        done();
+    }
+
+    tasks.clear();
+}
+
 void VlanMgr::doVlanTask(Consumer &consumer)
 {
     if (!isVlanMacOk())
@@ -320,6 +318,9 @@ void VlanMgr::doVlanTask(Consumer &consumer)
         SWSS_LOG_DEBUG("VLAN mac not ready, delaying VLAN task");
         return;
     }
+
+    /* The host changes of all the entries are sent with one netlink batch */
+    vector<HostTask> tasks;
     auto it = consumer.m_toSync.begin();
 
     while (it != consumer.m_toSync.end())
@@ -328,6 +329,12 @@ void VlanMgr::doVlanTask(Consumer &consumer)
 
         string key = kfvKey(t);
 
+        /* Entries of the same key are applied in order */
+        if (hasHostTask(tasks, key))
+        {
+            completeHostTasks(consumer, tasks);
+        }
+
         /* Ensure the key starts with "Vlan" otherwise ignore */
         if (strncmp(key.c_str(), VLAN_PREFIX, 4))
         {
@@ -377,12 +384,14 @@ void VlanMgr::doVlanTask(Consumer &consumer)
                 continue;
             }
 
+            m_netlink.setContext(key);
+
             /* Add host VLAN when it has not been created. */
-            if (m_vlans.find(key) == m_vlans.end())
+            bool add_vlan = m_vlans.find(key) == m_vlans.end();
+            if (add_vlan)
             {
                 addHostVlan(vlan_id);
             }
-            m_vlanReplay.erase(kfvKey(t));
 
             /* set up host env .... */
             for (auto i : kfvFieldsValues(t))
@@ -434,33 +443,45 @@ void VlanMgr::doVlanTask(Consumer &consumer)
             FieldValueTuple hostif_name_fvt("host_ifname", hostif_name);
             fvVector.push_back(hostif_name_fvt);
 
-            m_appVlanTableProducer.set(key, fvVector);
-            m_vlans.insert(key);
-
-            fvVector.clear();
-            FieldValueTuple s("state", "ok");
-            fvVector.push_back(s);
-            m_stateVlanTable.set(key, fvVector);
+            tasks.push_back({it, [this, key, vlan_id, add_vlan, fvVector, members]() {
+                if (add_vlan)
+                {
+                    disableArpEvictNoCarrier(VLAN_PREFIX + std::to_string(vlan_id));
+                }
+                m_vlanReplay.erase(key);
 
-            it = consumer.m_toSync.erase(it);
+                m_appVlanTableProducer.set(key, fvVector);
+                m_vlans.insert(key);
 
-            /*
-             * Members configured together with VLAN in untagged mode.
-             * This is to be compatible with access VLAN configuration from minigraph.
-             */
-            if (!members.empty())
-            {
-                processUntaggedVlanMembers(key, members);
-            }
+                vector<FieldValueTuple> stateFvVector;
+                FieldValueTuple s("state", "ok");
+                stateFvVector.push_back(s);
+                m_stateVlanTable.set(key, stateFvVector);
+
+                /*
+                 * Members configured together with VLAN in untagged mode.
+                 * This is to be compatible with access VLAN configuration from minigraph.
+                 */
+                if (!members.empty())
+                {
+                    processUntaggedVlanMembers(key, members);
+                }
+            }});
+            it++;
         }
         else if (op == DEL_COMMAND)
         {
             if (m_vlans.find(key) != m_vlans.end())
             {
+                m_netlink.setContext(key);
                 removeHostVlan(vlan_id);
-                m_vlans.erase(key);
-                m_appVlanTableProducer.del(key);
-                m_stateVlanTable.del(key);
+                tasks.push_back({it, [this, key]() {
+                    m_vlans.erase(key);
+                    m_appVlanTableProducer.del(key);
+                    m_stateVlanTable.del(key);
+                }});
+                it++;
+                continue;
             }
             else
             {
@@ -476,6 +497,8 @@ void VlanMgr::doVlanTask(Consumer &consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+    completeHostTasks(consumer, tasks);
+
     if (!replayDone && m_vlanReplay.empty() &&
         m_vlanMemberReplay.empty() &&
         WarmStart::isWarmStart())
@@ -592,6 +615,8 @@ void VlanMgr::processUntaggedVlanMembers(string vlan, const string &members)
 
 void VlanMgr::doVlanMemberTask(Consumer &consumer)
 {
+    /* The host changes of all the members are sent with one netlink batch */
+    vector<HostTask> tasks;
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -599,6 +624,12 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
 
         string key = kfvKey(t);
 
+        /* Entries of the same key are applied in order */
+        if (hasHostTask(tasks, key))
+        {
+            completeHostTasks(consumer, tasks);
+        }
+
         /* Ensure the key starts with "Vlan" otherwise ignore */
         if (strncmp(key.c_str(), VLAN_PREFIX, 4))
         {
@@ -664,9 +695,14 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
                 continue;
             }
 
-            if (addHostVlanMember(vlan_id, port_alias, tagging_mode))
-            {
-                key = VLAN_PREFIX + to_string(vlan_id);
+            /*
+             * A failure is retried, race condition can happen with portchannel
+             * removal but state db is not updated yet.
+             */
+            m_netlink.setContext(kfvKey(t));
+            addHostVlanMember(vlan_id, port_alias, tagging_mode);
+            tasks.push_back({it, [this, t, vlan_id, vlan_alias, port_alias, tagging_mode]() {
+                string key = VLAN_PREFIX + to_string(vlan_id);
                 key += DEFAULT_KEY_SEPARATOR;
                 key += port_alias;
                 m_appVlanMemberTableProducer.set(key, kfvFieldsValues(t));
@@ -678,13 +714,9 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
 
                 m_vlanMemberReplay.erase(kfvKey(t));
                 m_PortVlanMember[port_alias][vlan_alias] = tagging_mode;
-            }
-            else
-            {
-                SWSS_LOG_INFO("Netdevice for  %s not ready, delaying", kfvKey(t).c_str());
-                it++;
-                continue;
-            }
+            }});
+            it++;
+            continue;
         }
         else if (op == DEL_COMMAND)
         {
@@ -708,9 +740,11 @@ void VlanMgr::doVlanMemberTask(Consumer &consumer)
         {
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
-        /* Other than the case of member port/lag is not ready, no retry will be performed */
+        /* Other than the cases of member port/lag not ready and failed host changes, no retry will be performed */
         it = consumer.m_toSync.erase(it);
     }
+    completeHostTasks(consumer, tasks);
+
     if (!replayDone && m_vlanMemberReplay.empty() &&
         WarmStart::isWarmStart())
     {
@@ -878,7 +912,8 @@ void VlanMgr::doVlanPacVlanMemberTask(Consumer &consumer)
                 removePortFromVlan(port_alias, vlan_alias);
             }
             SWSS_LOG_NOTICE("Add Vlan Member key: %s", kfvKey(t).c_str());
-            if (addHostVlanMember(vlan_id, port_alias, tagging_mode))
+            addHostVlanMember(vlan_id, port_alias, tagging_mode);
+            if (flushHostChanges())
             {
                 key = VLAN_PREFIX + to_string(vlan_id);
                 key += DEFAULT_KEY_SEPARATOR;
@@ -928,7 +963,8 @@ void VlanMgr::addPortToVlan(const std::string& membername, const std::string& vl
     SWSS_LOG_NOTICE("member %s vlan %s tagging_mode %s",
         membername.c_str(), vlan_alias.c_str(), tagging_mode.c_str());
     int vlan_id = stoi(vlan_alias.substr(4));
-    if (addHostVlanMember(vlan_id, membername, tagging_mode))
+    addHostVlanMember(vlan_id, membername, tagging_mode);
+    if (flushHostChanges())
     {
         std::string key = VLAN_PREFIX + to_string(vlan_id);
         key += DEFAULT_KEY_SEPARATOR;
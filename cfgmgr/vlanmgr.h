@@ -4,10 +4,13 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkexec.h"
 
+#include <functional>
 #include <set>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace swss {
 
@@ -29,19 +32,30 @@ private:
     std::set<std::string> m_vlanMemberReplay;
     bool replayDone;
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_PortVlanMember;
+    NetlinkExecutor m_netlink;
     
+    /* Entry of m_toSync applied by done once its queued host changes succeed */
+    struct HostTask
+    {
+        SyncMap::iterator it;
+        std::function<void()> done;
+    };
+
     void doTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
     void doVlanMemberTask(Consumer &consumer);
     void processUntaggedVlanMembers(std::string vlan, const std::string &members);
 
-    bool addHostVlan(int vlan_id);
-    bool removeHostVlan(int vlan_id);
-    bool setHostVlanAdminState(int vlan_id, const std::string &admin_status);
-    bool setHostVlanMtu(int vlan_id, uint32_t mtu);
-    bool setHostVlanMac(int vlan_id, const std::string &mac);
-    bool addHostVlanMember(int vlan_id, const std::string &port_alias, const std::string& tagging_mode);
+    void addHostVlan(int vlan_id);
+    void removeHostVlan(int vlan_id);
+    void setHostVlanAdminState(int vlan_id, const std::string &admin_status);
+    void setHostVlanMtu(int vlan_id, uint32_t mtu);
+    void setHostVlanMac(int vlan_id, const std::string &mac);
+    void addHostVlanMember(int vlan_id, const std::string &port_alias, const std::string& tagging_mode);
     bool removeHostVlanMember(int vlan_id, const std::string &port_alias);
+    bool flushHostChanges();
+    bool hasHostTask(const std::vector<HostTask> &tasks, const std::string &key);
+    void completeHostTasks(Consumer &consumer, std::vector<HostTask> &tasks);
     bool isMemberStateOk(const std::string &alias);
     bool isVlanStateOk(const std::string &alias);
     bool isVlanMacOk();
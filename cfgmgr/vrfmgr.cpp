@@ -79,20 +79,23 @@ VrfMgr::VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
                     }
 
                     SWSS_LOG_NOTICE("Remove vrf device %s", vrfName.c_str());
-                    cmd.str("");
-                    cmd.clear();
-                    cmd << IP_CMD << " link del " << vrfName;
-                    int ret = swss::exec(cmd.str(), res);
-                    if (ret)
-                    {
-                        SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
-                    }
+                    m_netlink.delLink(vrfName);
                 }
                 rowType = LINK_ROW;
                 break;
         }
     }
 
+    /* The stale vrf devices are removed with one netlink batch */
+    vector<NetlinkExecutor::Error> errors;
+    if (!m_netlink.flush(errors))
+    {
+        for (const auto &error : errors)
+        {
+            SWSS_LOG_ERROR("Failed to remove vrf device: %s", error.to_string().c_str());
+        }
+    }
+
     cmd.str("");
     cmd.clear();
     cmd << IP_CMD << " rule | grep '^0:'";
@@ -137,9 +140,6 @@ bool VrfMgr::delLink(const string& vrfName)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
-
     if (m_vrfTableMap.find(vrfName) == m_vrfTableMap.end())
     {
         return false;
@@ -152,8 +152,10 @@ bool VrfMgr::delLink(const string& vrfName)
         return true;
     }
 
-    cmd << IP_CMD << " link del " << shellquote(vrfName);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    // Equivalent of:
+    // /sbin/ip link del {{vrfName}}
+    m_netlink.delLink(vrfName);
+    m_netlink.flushOrThrow();
 
     recycleTable(m_vrfTableMap[vrfName]);
     m_vrfTableMap.erase(vrfName);
@@ -165,9 +167,6 @@ bool VrfMgr::setLink(const string& vrfName)
 {
     SWSS_LOG_ENTER();
 
-    stringstream cmd;
-    string res;
-
     if (m_vrfTableMap.find(vrfName) != m_vrfTableMap.end())
     {
         return true;
@@ -188,16 +187,13 @@ bool VrfMgr::setLink(const string& vrfName)
         return false;
     }
 
-    cmd << IP_CMD << " link add " << shellquote(vrfName) << " type vrf table " << table;
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    // Equivalent of:
+    // /sbin/ip link add {{vrfName}} up type vrf table {{table}}
+    m_netlink.addVrf(vrfName, table, true);
+    m_netlink.flushOrThrow();
 
     m_vrfTableMap.emplace(vrfName, table);
 
-    cmd.str("");
-    cmd.clear();
-    cmd << IP_CMD << " link set " << shellquote(vrfName) << " up";
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
-
     return true;
 }
 
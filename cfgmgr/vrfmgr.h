@@ -7,6 +7,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkexec.h"
 
 using namespace std;
 
@@ -44,6 +45,7 @@ private:
 
     Table m_stateVrfTable, m_stateVrfObjectTable;
     ProducerStateTable m_appVrfTableProducer, m_appVnetTableProducer, m_appVxlanVrfTableProducer;
+    NetlinkExecutor m_netlink;
 };
 
 }
@@ -1111,6 +1111,14 @@ void FdbSync::onMsgLink(int nlmsg_type, struct nl_object *obj)
         return;
     }
 
+    if (nlmsg_type == RTM_DELLINK)
+    {
+        /* Keep the vxlan index incremental, a re-created device gets a new ifindex */
+        SWSS_LOG_INFO("Op:%d VxLAN dev %s index:%d removed", nlmsg_type, ifname? ifname: nil, ifindex);
+        m_intf_info.erase(ifindex);
+        return;
+    }
+
     if (rtnl_link_vxlan_get_id(link, &vni) != 0)
     {
         SWSS_LOG_INFO("Op:%d VxLAN dev:%s index:%d vni:%d. Not found", nlmsg_type, ifname? ifname: nil, ifindex, vni);
@@ -1127,7 +1135,7 @@ void FdbSync::onMsgLink(int nlmsg_type, struct nl_object *obj)
 
 void FdbSync::onMsg(int nlmsg_type, struct nl_object *obj)
 {
-    if (nlmsg_type != RTM_NEWLINK)
+    if (nlmsg_type != RTM_NEWLINK && nlmsg_type != RTM_DELLINK)
     {
         SWSS_LOG_DEBUG("netlink: unhandled event: %d", nlmsg_type);
         return;
@@ -0,0 +1,488 @@
+#include <errno.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include <netlink/attr.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netfilter/nfnetlink_conntrack.h>
+#include <linux/netfilter/nf_conntrack_common.h>
+#include <linux/netfilter/nf_conntrack_tcp.h>
+
+#include "logger.h"
+#include "conntrackexec.h"
+
+using namespace std;
+using namespace swss;
+
+#define CONNTRACK_EXEC_BUF_SIZE   (4 * 1024 * 1024)
+
+static string ipStr(uint32_t ip)
+{
+    char buf[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &ip, buf, sizeof(buf));
+    return buf;
+}
+
+static string protoStr(uint8_t protocol)
+{
+    switch (protocol)
+    {
+        case IPPROTO_TCP:
+            return "tcp";
+        case IPPROTO_UDP:
+            return "udp";
+        case IPPROTO_ICMP:
+            return "icmp";
+        default:
+            return std::to_string(protocol);
+    }
+}
+
+static string tupleStr(uint8_t protocol, const ConntrackExecutor::Endpoint &src, const ConntrackExecutor::Endpoint &dst)
+{
+    return " -p " + protoStr(protocol) + " -s " + ipStr(src.ip) + " --sport " + std::to_string(src.port)
+           + " -d " + ipStr(dst.ip) + " --dport " + std::to_string(dst.port);
+}
+
+string ConntrackExecutor::Filter::to_string() const
+{
+    string str;
+    if (protocol)
+    {
+        str += " -p " + protoStr(protocol);
+    }
+    if (src)
+    {
+        str += " -s " + ipStr(src);
+    }
+    if (sport)
+    {
+        str += " --sport " + std::to_string(sport);
+    }
+    if (dst)
+    {
+        str += " -d " + ipStr(dst);
+    }
+    if (dport)
+    {
+        str += " --dport " + std::to_string(dport);
+    }
+    if (reply_dst)
+    {
+        str += " -q " + ipStr(reply_dst);
+    }
+    return str;
+}
+
+ConntrackExecutor::ConntrackExecutor() :
+    m_batch(NETLINK_NETFILTER, CONNTRACK_EXEC_BUF_SIZE, "Conntrack")
+{
+}
+
+ConntrackExecutor::~ConntrackExecutor()
+{
+    for (auto &op : m_ops)
+    {
+        if (op.msg)
+        {
+            nlmsg_free(op.msg);
+        }
+    }
+}
+
+struct nl_msg *ConntrackExecutor::ctMsg(int type, int flags)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple((NFNL_SUBSYS_CTNETLINK << 8) | type, NLM_F_REQUEST | flags);
+    if (!msg)
+    {
+        SWSS_LOG_THROW("Netlink message alloc failed");
+    }
+
+    struct nfgenmsg nfg;
+    memset(&nfg, 0, sizeof(nfg));
+    nfg.nfgen_family = AF_INET;
+    nfg.version = NFNETLINK_V0;
+    nlmsg_append(msg, &nfg, sizeof(nfg), NLMSG_ALIGNTO);
+
+    return msg;
+}
+
+static void putTuple(struct nl_msg *msg, int type, uint8_t protocol,
+                     const ConntrackExecutor::Endpoint &src, const ConntrackExecutor::Endpoint &dst)
+{
+    struct nlattr *tuple = nla_nest_start(msg, type);
+
+    struct nlattr *ip = nla_nest_start(msg, CTA_TUPLE_IP);
+    nla_put_u32(msg, CTA_IP_V4_SRC, src.ip);
+    nla_put_u32(msg, CTA_IP_V4_DST, dst.ip);
+    nla_nest_end(msg, ip);
+
+    struct nlattr *proto = nla_nest_start(msg, CTA_TUPLE_PROTO);
+    nla_put_u8(msg, CTA_PROTO_NUM, protocol);
+    nla_put_u16(msg, CTA_PROTO_SRC_PORT, htons(src.port));
+    nla_put_u16(msg, CTA_PROTO_DST_PORT, htons(dst.port));
+    nla_nest_end(msg, proto);
+
+    nla_nest_end(msg, tuple);
+}
+
+static void putNat(struct nl_msg *msg, int type, const ConntrackExecutor::Endpoint &nat)
+{
+    struct nlattr *range = nla_nest_start(msg, type);
+    nla_put_u32(msg, CTA_NAT_V4_MINIP, nat.ip);
+    nla_put_u32(msg, CTA_NAT_V4_MAXIP, nat.ip);
+    if (nat.port)
+    {
+        struct nlattr *proto = nla_nest_start(msg, CTA_NAT_PROTO);
+        nla_put_u16(msg, CTA_PROTONAT_PORT_MIN, htons(nat.port));
+        nla_put_u16(msg, CTA_PROTONAT_PORT_MAX, htons(nat.port));
+        nla_nest_end(msg, proto);
+    }
+    nla_nest_end(msg, range);
+}
+
+void ConntrackExecutor::queue(const string &desc, struct nl_msg *msg)
+{
+    SWSS_LOG_INFO("Queue conntrack request: %s", desc.c_str());
+
+    m_ops.push_back({desc, msg, Filter(), false, 0});
+}
+
+void ConntrackExecutor::queueFilter(const string &desc, const Filter &filter, bool del, uint32_t timeout)
+{
+    SWSS_LOG_INFO("Queue conntrack request: %s", desc.c_str());
+
+    m_ops.push_back({desc, nullptr, filter, del, timeout});
+}
+
+void ConntrackExecutor::create(uint8_t protocol, const Endpoint &src, const Endpoint &dst,
+                               const Endpoint &snat, const Endpoint &dnat, uint32_t timeout, bool established)
+{
+    SWSS_LOG_ENTER();
+
+    string desc = "conntrack -I" + tupleStr(protocol, src, dst);
+
+    auto *msg = ctMsg(IPCTNL_MSG_CT_NEW, NLM_F_ACK | NLM_F_CREATE | NLM_F_EXCL);
+    putTuple(msg, CTA_TUPLE_ORIG, protocol, src, dst);
+
+    /* The reply tuple is the inverted original one, the kernel applies the NAT bindings to it */
+    putTuple(msg, CTA_TUPLE_REPLY, protocol, dst, src);
+
+    if (snat.ip)
+    {
+        putNat(msg, CTA_NAT_SRC, snat);
+        desc += " -n " + ipStr(snat.ip) + ":" + std::to_string(snat.port);
+    }
+    if (dnat.ip)
+    {
+        putNat(msg, CTA_NAT_DST, dnat);
+        desc += " -g " + ipStr(dnat.ip) + ":" + std::to_string(dnat.port);
+    }
+
+    /* The kernel confirms the entry before applying the status, which must keep that bit */
+    nla_put_u32(msg, CTA_TIMEOUT, htonl(timeout));
+    nla_put_u32(msg, CTA_STATUS, htonl(IPS_ASSURED | IPS_CONFIRMED));
+    desc += " -t " + std::to_string(timeout) + " -u ASSURED";
+
+    if (established && protocol == IPPROTO_TCP)
+    {
+        struct nlattr *protoinfo = nla_nest_start(msg, CTA_PROTOINFO);
+        struct nlattr *tcp = nla_nest_start(msg, CTA_PROTOINFO_TCP);
+        nla_put_u8(msg, CTA_PROTOINFO_TCP_STATE, TCP_CONNTRACK_ESTABLISHED);
+        nla_nest_end(msg, tcp);
+        nla_nest_end(msg, protoinfo);
+        desc += " --state ESTABLISHED";
+    }
+
+    queue(desc, msg);
+}
+
+void ConntrackExecutor::update(uint8_t protocol, const Endpoint &src, const Endpoint &dst, uint32_t timeout, uint32_t status)
+{
+    SWSS_LOG_ENTER();
+
+    auto *msg = ctMsg(IPCTNL_MSG_CT_NEW, NLM_F_ACK);
+    putTuple(msg, CTA_TUPLE_ORIG, protocol, src, dst);
+    nla_put_u32(msg, CTA_TIMEOUT, htonl(timeout));
+    nla_put_u32(msg, CTA_STATUS, htonl(status | IPS_CONFIRMED));
+
+    queue("conntrack -U" + tupleStr(protocol, src, dst) + " -t " + std::to_string(timeout), msg);
+}
+
+void ConntrackExecutor::updateMatching(const Filter &filter, uint32_t timeout)
+{
+    SWSS_LOG_ENTER();
+
+    queueFilter("conntrack -U" + filter.to_string() + " -t " + std::to_string(timeout), filter, false, timeout);
+}
+
+void ConntrackExecutor::deleteMatching(const Filter &filter)
+{
+    SWSS_LOG_ENTER();
+
+    queueFilter("conntrack -D" + filter.to_string(), filter, true, 0);
+}
+
+void ConntrackExecutor::flushTable()
+{
+    SWSS_LOG_ENTER();
+
+    /* A delete without tuple flushes the table of the message family */
+    queue("conntrack -F", ctMsg(IPCTNL_MSG_CT_DELETE, NLM_F_ACK));
+}
+
+static bool parseTuple(struct nlattr *attr, uint8_t &protocol, uint32_t &src, uint16_t &sport,
+                       uint32_t &dst, uint16_t &dport)
+{
+    struct nlattr *tb[CTA_TUPLE_MAX + 1];
+    struct nlattr *ip[CTA_IP_MAX + 1];
+    struct nlattr *proto[CTA_PROTO_MAX + 1];
+
+    if (nla_parse_nested(tb, CTA_TUPLE_MAX, attr, nullptr) < 0 || !tb[CTA_TUPLE_IP] || !tb[CTA_TUPLE_PROTO] ||
+        nla_parse_nested(ip, CTA_IP_MAX, tb[CTA_TUPLE_IP], nullptr) < 0 ||
+        nla_parse_nested(proto, CTA_PROTO_MAX, tb[CTA_TUPLE_PROTO], nullptr) < 0 ||
+        !ip[CTA_IP_V4_SRC] || !ip[CTA_IP_V4_DST] || !proto[CTA_PROTO_NUM])
+    {
+        return false;
+    }
+
+    protocol = nla_get_u8(proto[CTA_PROTO_NUM]);
+    src = nla_get_u32(ip[CTA_IP_V4_SRC]);
+    dst = nla_get_u32(ip[CTA_IP_V4_DST]);
+    sport = proto[CTA_PROTO_SRC_PORT] ? ntohs(nla_get_u16(proto[CTA_PROTO_SRC_PORT])) : 0;
+    dport = proto[CTA_PROTO_DST_PORT] ? ntohs(nla_get_u16(proto[CTA_PROTO_DST_PORT])) : 0;
+    return true;
+}
+
+bool ConntrackExecutor::dump(DumpTable &table)
+{
+    SWSS_LOG_ENTER();
+
+    table.entries.clear();
+    table.bySrc.clear();
+    table.byReplyDst.clear();
+
+    struct nl_msg *msg = ctMsg(IPCTNL_MSG_CT_GET, NLM_F_DUMP);
+    struct nlmsghdr *req = nlmsg_hdr(msg);
+    uint32_t seq = m_batch.nextSeq();
+    req->nlmsg_seq = seq;
+    req->nlmsg_pid = 0;
+
+    int err = nl_sendto(m_batch.sock(), req, req->nlmsg_len);
+    nlmsg_free(msg);
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Conntrack table dump request failed, error '%s'", nl_geterror(err));
+        return false;
+    }
+
+    bool done = false;
+    while (!done)
+    {
+        struct sockaddr_nl nla;
+        unsigned char *reply = nullptr;
+        int len = nl_recv(m_batch.sock(), &nla, &reply, nullptr);
+        if (len <= 0)
+        {
+            SWSS_LOG_ERROR("Conntrack table dump failed, error '%s'", nl_geterror(len));
+            free(reply);
+            return false;
+        }
+
+        struct nlmsghdr *hdr = reinterpret_cast<struct nlmsghdr *>(reply);
+        for (; nlmsg_ok(hdr, len); hdr = nlmsg_next(hdr, &len))
+        {
+            if (hdr->nlmsg_seq != seq)
+            {
+                continue;
+            }
+            if (hdr->nlmsg_type == NLMSG_DONE)
+            {
+                done = true;
+                break;
+            }
+            if (hdr->nlmsg_type == NLMSG_ERROR)
+            {
+                auto *nlerr = static_cast<struct nlmsgerr *>(nlmsg_data(hdr));
+                SWSS_LOG_ERROR("Conntrack table dump failed: %s", strerror(-nlerr->error));
+                free(reply);
+                return false;
+            }
+
+            struct nlattr *tb[CTA_MAX + 1];
+            if (nlmsg_parse(hdr, sizeof(struct nfgenmsg), tb, CTA_MAX, nullptr) < 0 || !tb[CTA_TUPLE_ORIG])
+            {
+                continue;
+            }
+
+            DumpEntry entry = {};
+            uint8_t reply_proto;
+            uint32_t reply_src;
+            uint16_t reply_sport, reply_dport;
+            if (!parseTuple(tb[CTA_TUPLE_ORIG], entry.protocol, entry.src, entry.sport, entry.dst, entry.dport))
+            {
+                continue;
+            }
+            if (tb[CTA_TUPLE_REPLY])
+            {
+                parseTuple(tb[CTA_TUPLE_REPLY], reply_proto, reply_src, reply_sport, entry.reply_dst, reply_dport);
+            }
+            if (tb[CTA_ID])
+            {
+                entry.id = nla_get_u32(tb[CTA_ID]);
+            }
+
+            auto *tuple = static_cast<const char *>(nla_data(tb[CTA_TUPLE_ORIG]));
+            entry.tuple.assign(tuple, tuple + nla_len(tb[CTA_TUPLE_ORIG]));
+            if (tb[CTA_ZONE])
+            {
+                auto *zone = static_cast<const char *>(nla_data(tb[CTA_ZONE]));
+                entry.zone.assign(zone, zone + nla_len(tb[CTA_ZONE]));
+            }
+
+            table.bySrc.emplace(entry.src, table.entries.size());
+            table.byReplyDst.emplace(entry.reply_dst, table.entries.size());
+            table.entries.push_back(std::move(entry));
+        }
+
+        free(reply);
+    }
+
+    SWSS_LOG_INFO("Dumped %zu conntrack entries", table.entries.size());
+    return true;
+}
+
+static bool matches(const ConntrackExecutor::Filter &filter, uint8_t protocol, uint32_t src, uint16_t sport,
+                    uint32_t dst, uint16_t dport, uint32_t reply_dst)
+{
+    return (!filter.protocol || filter.protocol == protocol) &&
+           (!filter.src || filter.src == src) &&
+           (!filter.sport || filter.sport == sport) &&
+           (!filter.dst || filter.dst == dst) &&
+           (!filter.dport || filter.dport == dport) &&
+           (!filter.reply_dst || filter.reply_dst == reply_dst);
+}
+
+void ConntrackExecutor::expand(const Op &op, DumpTable &table, vector<NetlinkBatch::Request> &batch)
+{
+    size_t count = 0;
+
+    auto visit = [&](DumpEntry &entry) {
+        if (entry.deleted ||
+            !matches(op.filter, entry.protocol, entry.src, entry.sport, entry.dst, entry.dport, entry.reply_dst))
+        {
+            return;
+        }
+
+        auto *msg = ctMsg(op.del ? IPCTNL_MSG_CT_DELETE : IPCTNL_MSG_CT_NEW, NLM_F_ACK);
+        nla_put(msg, CTA_TUPLE_ORIG | NLA_F_NESTED, static_cast<int>(entry.tuple.size()), entry.tuple.data());
+        if (!entry.zone.empty())
+        {
+            nla_put(msg, CTA_ZONE, static_cast<int>(entry.zone.size()), entry.zone.data());
+        }
+
+        if (op.del)
+        {
+            /* Do not remove a newer entry that took over the tuple */
+            if (entry.id)
+            {
+                nla_put_u32(msg, CTA_ID, entry.id);
+            }
+            entry.deleted = true;
+        }
+        else
+        {
+            nla_put_u32(msg, CTA_TIMEOUT, htonl(op.timeout));
+        }
+
+        batch.push_back({op.desc, msg, ""});
+        count++;
+
+        if (batch.size() >= MAX_BATCH_SIZE)
+        {
+            m_batch.send(batch, m_errors);
+        }
+    };
+
+    if (op.filter.src)
+    {
+        auto range = table.bySrc.equal_range(op.filter.src);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            visit(table.entries[it->second]);
+        }
+    }
+    else if (op.filter.reply_dst)
+    {
+        auto range = table.byReplyDst.equal_range(op.filter.reply_dst);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            visit(table.entries[it->second]);
+        }
+    }
+    else
+    {
+        for (auto &entry : table.entries)
+        {
+            visit(entry);
+        }
+    }
+
+    SWSS_LOG_INFO("%s matched %zu conntrack entries", op.desc.c_str(), count);
+}
+
+void ConntrackExecutor::sendQueued()
+{
+    SWSS_LOG_ENTER();
+
+    vector<Op> ops;
+    ops.swap(m_ops);
+
+    vector<NetlinkBatch::Request> batch;
+    DumpTable table;
+    bool dumped = false;
+
+    for (auto &op : ops)
+    {
+        if (op.msg)
+        {
+            /* The table may change, the next filter needs a new dump */
+            batch.push_back({op.desc, op.msg, ""});
+            dumped = false;
+
+            if (batch.size() >= MAX_BATCH_SIZE)
+            {
+                m_batch.send(batch, m_errors);
+            }
+            continue;
+        }
+
+        if (!dumped)
+        {
+            m_batch.send(batch, m_errors);
+            if (!dump(table))
+            {
+                m_errors.push_back({op.desc, EIO, "conntrack table dump failed"});
+                continue;
+            }
+            dumped = true;
+        }
+
+        expand(op, table, batch);
+    }
+
+    m_batch.send(batch, m_errors);
+}
+
+bool ConntrackExecutor::flush(vector<Error> &errors)
+{
+    SWSS_LOG_ENTER();
+
+    sendQueued();
+
+    errors = std::move(m_errors);
+    m_errors.clear();
+    return errors.empty();
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "netlinkbatch.h"
+
+struct nl_msg;
+
+namespace swss {
+
+/*
+ * Batching ctnetlink executor for the NAT daemons.
+ *
+ * Replaces the per entry `conntrack -I/-U/-D/-F` commands. Requests are
+ * encoded as ctnetlink messages and queued; flush() sends them with one
+ * sendmsg per batch and collects one ACK per request.
+ *
+ * Updates and deletes selected by a filter, like `conntrack -U -s <ip>`, are
+ * resolved against one dump of the IPv4 conntrack table, taken when the first
+ * of them is sent, and expand to one request per matching entry. The table is
+ * dumped again only if requests queued in between may have changed it.
+ *
+ * IPv4 addresses are given in network byte order, L4 ports in host order.
+ */
+class ConntrackExecutor
+{
+public:
+    /* op is the equivalent conntrack command */
+    typedef NetlinkError Error;
+
+    struct Endpoint
+    {
+        uint32_t ip;
+        uint16_t port;
+    };
+
+    /* Matches like the conntrack command line filters, zero fields match any */
+    struct Filter
+    {
+        uint8_t protocol = 0;   /* -p */
+        uint32_t src = 0;       /* -s, original source */
+        uint16_t sport = 0;     /* --sport */
+        uint32_t dst = 0;       /* -d, original destination */
+        uint16_t dport = 0;     /* --dport */
+        uint32_t reply_dst = 0; /* -q, reply destination */
+
+        std::string to_string() const;
+    };
+
+    /* Requests sent with one sendmsg at most */
+    static const size_t MAX_BATCH_SIZE = 256;
+
+    ConntrackExecutor();
+    ~ConntrackExecutor();
+
+    ConntrackExecutor(const ConntrackExecutor&) = delete;
+    ConntrackExecutor& operator=(const ConntrackExecutor&) = delete;
+
+    /*
+     * conntrack -I -p <protocol> -s <src> --sport <port> -d <dst> --dport <port>
+     *           [-n <snat>] [-g <dnat>] -t <timeout> -u ASSURED [--state ESTABLISHED]
+     * A NAT binding is left out if its ip is 0.
+     */
+    void create(uint8_t protocol, const Endpoint &src, const Endpoint &dst,
+                const Endpoint &snat, const Endpoint &dnat, uint32_t timeout, bool established = false);
+    /* Sets timeout and status of the entry with the given original tuple */
+    void update(uint8_t protocol, const Endpoint &src, const Endpoint &dst, uint32_t timeout, uint32_t status);
+
+    /* conntrack -U <filter> -t <timeout> */
+    void updateMatching(const Filter &filter, uint32_t timeout);
+    /* conntrack -D <filter> */
+    void deleteMatching(const Filter &filter);
+    /* conntrack -F */
+    void flushTable();
+
+    /* Sends the queued requests, returns false and fills errors if any failed */
+    bool flush(std::vector<Error> &errors);
+
+    size_t pending() const
+    {
+        return m_ops.size();
+    }
+
+private:
+    struct Op
+    {
+        std::string desc;
+        struct nl_msg *msg;     /* Null for the filter based requests */
+        Filter filter;
+        bool del;
+        uint32_t timeout;
+    };
+
+    /* Entry of a table dump, the original tuple is kept as received to address the entry */
+    struct DumpEntry
+    {
+        uint8_t protocol;
+        uint32_t src;
+        uint16_t sport;
+        uint32_t dst;
+        uint16_t dport;
+        uint32_t reply_dst;
+        uint32_t id;
+        std::vector<char> tuple;
+        std::vector<char> zone;
+        bool deleted;
+    };
+
+    /* Dumped entries, indexed by the fields the NAT filters mostly select on */
+    struct DumpTable
+    {
+        std::vector<DumpEntry> entries;
+        std::unordered_multimap<uint32_t, size_t> bySrc;
+        std::unordered_multimap<uint32_t, size_t> byReplyDst;
+    };
+
+    struct nl_msg *ctMsg(int type, int flags);
+    void queue(const std::string &desc, struct nl_msg *msg);
+    void queueFilter(const std::string &desc, const Filter &filter, bool del, uint32_t timeout);
+    bool dump(DumpTable &table);
+    void expand(const Op &op, DumpTable &table, std::vector<NetlinkBatch::Request> &batch);
+    void sendQueued();
+
+    NetlinkBatch m_batch;
+    std::vector<Op> m_ops;
+    std::vector<Error> m_errors;   /* Failures not yet returned by flush() */
+};
+
+}
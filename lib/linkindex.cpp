@@ -0,0 +1,257 @@
+#include <net/if.h>
+#include <netlink/route/link.h>
+#include <netlink/route/link/vxlan.h>
+#include <linux/rtnetlink.h>
+
+#include "logger.h"
+#include "linkindex.h"
+
+using namespace std;
+using namespace swss;
+
+void LinkIndex::populate()
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_sock *sock = nl_socket_alloc();
+    if (!sock)
+    {
+        SWSS_LOG_THROW("Failed to allocate netlink socket");
+    }
+
+    if (nl_connect(sock, NETLINK_ROUTE) < 0)
+    {
+        nl_socket_free(sock);
+        SWSS_LOG_THROW("Failed to connect to netlink socket");
+    }
+
+    struct nl_cache *cache = NULL;
+    if (rtnl_link_alloc_cache(sock, AF_UNSPEC, &cache) < 0 || !cache)
+    {
+        nl_close(sock);
+        nl_socket_free(sock);
+        SWSS_LOG_THROW("Failed to allocate link cache");
+    }
+
+    clear();
+    nl_cache_foreach(cache, [](struct nl_object *obj, void *arg) {
+        static_cast<LinkIndex *>(arg)->update((struct rtnl_link *)obj);
+    }, this);
+
+    nl_cache_free(cache);
+    nl_close(sock);
+    nl_socket_free(sock);
+
+    SWSS_LOG_NOTICE("Link index populated with %zu links", m_count);
+}
+
+void LinkIndex::onMsg(int nlmsg_type, struct nl_object *obj)
+{
+    struct rtnl_link *link = (struct rtnl_link *)obj;
+
+    if (nlmsg_type == RTM_NEWLINK)
+    {
+        update(link);
+    }
+    else if (nlmsg_type == RTM_DELLINK)
+    {
+        remove(rtnl_link_get_ifindex(link));
+    }
+}
+
+LinkIndex::LinkInfo *LinkIndex::slot(int ifindex)
+{
+    if (ifindex < MAX_DENSE_IFINDEX)
+    {
+        if (static_cast<size_t>(ifindex) >= m_dense.size())
+        {
+            m_dense.resize(ifindex + 1);
+        }
+        return &m_dense[ifindex];
+    }
+
+    return &m_sparse[ifindex];
+}
+
+void LinkIndex::setMaster(int ifindex, int old_master, int master)
+{
+    if (old_master == master)
+    {
+        return;
+    }
+
+    if (old_master)
+    {
+        auto it = m_slaves.find(old_master);
+        if (it != m_slaves.end())
+        {
+            it->second.erase(ifindex);
+            if (it->second.empty())
+            {
+                m_slaves.erase(it);
+            }
+        }
+    }
+
+    if (master)
+    {
+        m_slaves[master].insert(ifindex);
+    }
+}
+
+void LinkIndex::update(struct rtnl_link *link)
+{
+    int ifindex = rtnl_link_get_ifindex(link);
+    const char *name = rtnl_link_get_name(link);
+
+    if (ifindex <= 0 || !name)
+    {
+        return;
+    }
+
+    LinkInfo *info = slot(ifindex);
+    int old_master = info->valid ? info->master : 0;
+    if (info->valid)
+    {
+        if (info->name != name)
+        {
+            /* Interface was renamed */
+            m_nameToIndex.erase(info->name);
+        }
+    }
+    else
+    {
+        m_count++;
+    }
+
+    const char *kind = rtnl_link_get_type(link);
+
+    info->name = name;
+    info->kind = kind ? kind : "";
+    info->master = rtnl_link_get_master(link);
+    setMaster(ifindex, old_master, info->master);
+    info->flags = rtnl_link_get_flags(link);
+    info->vni = 0;
+    info->valid = true;
+
+    if (rtnl_link_is_vxlan(link))
+    {
+        uint32_t vni;
+        if (rtnl_link_vxlan_get_id(link, &vni) == 0)
+        {
+            info->vni = vni;
+        }
+    }
+
+    m_nameToIndex[info->name] = ifindex;
+}
+
+void LinkIndex::remove(int ifindex)
+{
+    if (ifindex <= 0)
+    {
+        return;
+    }
+
+    if (ifindex < MAX_DENSE_IFINDEX)
+    {
+        if (static_cast<size_t>(ifindex) >= m_dense.size() || !m_dense[ifindex].valid)
+        {
+            return;
+        }
+
+        m_nameToIndex.erase(m_dense[ifindex].name);
+        setMaster(ifindex, m_dense[ifindex].master, 0);
+        m_dense[ifindex] = LinkInfo();
+    }
+    else
+    {
+        auto it = m_sparse.find(ifindex);
+        if (it == m_sparse.end())
+        {
+            return;
+        }
+
+        m_nameToIndex.erase(it->second.name);
+        setMaster(ifindex, it->second.master, 0);
+        m_sparse.erase(it);
+    }
+
+    m_count--;
+}
+
+void LinkIndex::clear()
+{
+    m_dense.clear();
+    m_sparse.clear();
+    m_nameToIndex.clear();
+    m_slaves.clear();
+    m_count = 0;
+}
+
+const LinkIndex::LinkInfo *LinkIndex::get(int ifindex) const
+{
+    if (ifindex <= 0)
+    {
+        return nullptr;
+    }
+
+    if (ifindex < MAX_DENSE_IFINDEX)
+    {
+        if (static_cast<size_t>(ifindex) < m_dense.size() && m_dense[ifindex].valid)
+        {
+            return &m_dense[ifindex];
+        }
+        return nullptr;
+    }
+
+    auto it = m_sparse.find(ifindex);
+    return it == m_sparse.end() ? nullptr : &it->second;
+}
+
+bool LinkIndex::getName(int ifindex, string &name) const
+{
+    const LinkInfo *info = get(ifindex);
+    if (!info)
+    {
+        return false;
+    }
+
+    name = info->name;
+    return true;
+}
+
+int LinkIndex::getIfindex(const string &name) const
+{
+    auto it = m_nameToIndex.find(name);
+    return it == m_nameToIndex.end() ? 0 : it->second;
+}
+
+int LinkIndex::getMaster(int ifindex) const
+{
+    const LinkInfo *info = get(ifindex);
+    return info ? info->master : 0;
+}
+
+bool LinkIndex::getMasterName(int ifindex, string &name) const
+{
+    int master = getMaster(ifindex);
+    return master ? getName(master, name) : false;
+}
+
+bool LinkIndex::isVrf(int ifindex) const
+{
+    const LinkInfo *info = get(ifindex);
+    return info && info->kind == "vrf";
+}
+
+vector<int> LinkIndex::getSlaves(int master) const
+{
+    auto it = m_slaves.find(master);
+    if (it == m_slaves.end())
+    {
+        return vector<int>();
+    }
+
+    return vector<int>(it->second.begin(), it->second.end());
+}
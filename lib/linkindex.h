@@ -0,0 +1,73 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <netlink/route/link.h>
+
+#include "netmsg.h"
+
+namespace swss {
+
+/*
+ * Event driven ifindex -> link attribute index shared by the netlink sync
+ * daemons. It is loaded once with a single RTM_GETLINK dump and then kept
+ * up to date from RTM_NEWLINK/RTM_DELLINK messages, so lookups on the
+ * per-message path never have to refill a libnl link cache.
+ *
+ * fdbsyncd keeps its own vxlan-only map: membership in it is what marks a
+ * neighbor as learnt on a vxlan device, which a full link index would not.
+ */
+class LinkIndex : public NetMsg
+{
+public:
+    /* ifindexes below this value are stored in a dense array */
+    static const int MAX_DENSE_IFINDEX = 65536;
+
+    struct LinkInfo
+    {
+        std::string name;
+        std::string kind;
+        int master = 0;
+        unsigned int flags = 0;
+        unsigned int vni = 0;       /* Only set for vxlan links */
+        bool valid = false;
+    };
+
+    LinkIndex() = default;
+
+    /* Reload the whole index from one kernel link dump */
+    void populate();
+
+    virtual void onMsg(int nlmsg_type, struct nl_object *obj) override;
+
+    void update(struct rtnl_link *link);
+    void remove(int ifindex);
+    void clear();
+
+    const LinkInfo *get(int ifindex) const;
+    bool getName(int ifindex, std::string &name) const;
+    int getIfindex(const std::string &name) const;
+    int getMaster(int ifindex) const;
+    bool getMasterName(int ifindex, std::string &name) const;
+    bool isVrf(int ifindex) const;
+    std::vector<int> getSlaves(int master) const;
+
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    LinkInfo *slot(int ifindex);
+    void setMaster(int ifindex, int old_master, int master);
+
+    std::vector<LinkInfo> m_dense;
+    std::unordered_map<int, LinkInfo> m_sparse;
+    std::unordered_map<std::string, int> m_nameToIndex;
+    std::unordered_map<int, std::set<int>> m_slaves;
+    size_t m_count = 0;
+};
+
+}
@@ -0,0 +1,165 @@
+#include <errno.h>
+#include <string.h>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include <netlink/attr.h>
+
+#include "logger.h"
+#include "netlinkbatch.h"
+
+using namespace std;
+using namespace swss;
+
+string NetlinkError::to_string() const
+{
+    string str = op + " : " + strerror(error);
+    if (!message.empty())
+    {
+        str += " (" + message + ")";
+    }
+    return str;
+}
+
+NetlinkBatch::NetlinkBatch(int protocol, size_t buf_size, const string &name) :
+    m_name(name)
+{
+    SWSS_LOG_ENTER();
+
+    m_sock = nl_socket_alloc();
+    int err = m_sock ? nl_connect(m_sock, protocol) : -NLE_NOMEM;
+    if (err < 0)
+    {
+        if (m_sock)
+        {
+            nl_socket_free(m_sock);
+            m_sock = nullptr;
+        }
+        SWSS_LOG_THROW("%s socket connect failed, error '%s'", m_name.c_str(), nl_geterror(err));
+    }
+
+    nl_socket_enable_msg_peek(m_sock);
+    nl_socket_set_buffer_size(m_sock, static_cast<int>(buf_size), static_cast<int>(buf_size));
+
+    /* Only get the request header back in errors, plus the kernel message if any */
+    int one = 1;
+    setsockopt(nl_socket_get_fd(m_sock), SOL_NETLINK, NETLINK_CAP_ACK, &one, sizeof(one));
+    setsockopt(nl_socket_get_fd(m_sock), SOL_NETLINK, NETLINK_EXT_ACK, &one, sizeof(one));
+}
+
+NetlinkBatch::~NetlinkBatch()
+{
+    if (m_sock)
+    {
+        nl_close(m_sock);
+        nl_socket_free(m_sock);
+    }
+}
+
+void NetlinkBatch::send(vector<Request> &requests, vector<NetlinkError> &errors)
+{
+    SWSS_LOG_ENTER();
+
+    if (requests.empty())
+    {
+        return;
+    }
+
+    uint32_t first_seq = m_seq + 1;
+    vector<char> buf;
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        struct nlmsghdr *hdr = nlmsg_hdr(requests[i].msg);
+        hdr->nlmsg_seq = ++m_seq;
+        hdr->nlmsg_pid = 0;
+
+        const char *data = reinterpret_cast<const char *>(hdr);
+        buf.insert(buf.end(), data, data + NLMSG_ALIGN(hdr->nlmsg_len));
+    }
+
+    size_t count = requests.size();
+    vector<bool> acked(count, false);
+    size_t outstanding = count;
+
+    int err = nl_sendto(m_sock, buf.data(), buf.size());
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("%s send of %zu requests failed, error '%s'", m_name.c_str(), count, nl_geterror(err));
+        outstanding = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            errors.push_back({requests[i].desc, EIO, nl_geterror(err), requests[i].context});
+        }
+    }
+
+    while (outstanding > 0)
+    {
+        struct sockaddr_nl nla;
+        unsigned char *reply = nullptr;
+        int len = nl_recv(m_sock, &nla, &reply, nullptr);
+        if (len <= 0)
+        {
+            SWSS_LOG_ERROR("%s receive failed, %zu requests not acknowledged", m_name.c_str(), outstanding);
+            free(reply);
+            break;
+        }
+
+        struct nlmsghdr *hdr = reinterpret_cast<struct nlmsghdr *>(reply);
+        for (; nlmsg_ok(hdr, len); hdr = nlmsg_next(hdr, &len))
+        {
+            if (hdr->nlmsg_type != NLMSG_ERROR)
+            {
+                continue;
+            }
+
+            auto *nlerr = static_cast<struct nlmsgerr *>(nlmsg_data(hdr));
+            uint32_t idx = nlerr->msg.nlmsg_seq - first_seq;
+            if (idx >= count || acked[idx])
+            {
+                continue;
+            }
+            acked[idx] = true;
+            outstanding--;
+
+            if (nlerr->error == 0)
+            {
+                continue;
+            }
+
+            NetlinkError error = {requests[idx].desc, -nlerr->error, "", requests[idx].context};
+#ifdef NLM_F_ACK_TLVS
+            if (hdr->nlmsg_flags & NLM_F_ACK_TLVS)
+            {
+                int offset = static_cast<int>(sizeof(*nlerr));
+                if (!(hdr->nlmsg_flags & NLM_F_CAPPED))
+                {
+                    offset += static_cast<int>(nlerr->msg.nlmsg_len - NLMSG_HDRLEN);
+                }
+
+                struct nlattr *tb[NLMSGERR_ATTR_MAX + 1];
+                if (nlmsg_datalen(hdr) > offset &&
+                    nla_parse(tb, NLMSGERR_ATTR_MAX, reinterpret_cast<struct nlattr *>(reinterpret_cast<char *>(nlerr) + offset),
+                              nlmsg_datalen(hdr) - offset, nullptr) == 0 &&
+                    tb[NLMSGERR_ATTR_MSG])
+                {
+                    error.message = nla_get_string(tb[NLMSGERR_ATTR_MSG]);
+                }
+            }
+#endif
+            SWSS_LOG_ERROR("%s request failed: %s", m_name.c_str(), error.to_string().c_str());
+            errors.push_back(error);
+        }
+
+        free(reply);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!acked[i] && err >= 0)
+        {
+            errors.push_back({requests[i].desc, EIO, "not acknowledged", requests[i].context});
+        }
+        nlmsg_free(requests[i].msg);
+    }
+
+    requests.clear();
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct nl_sock;
+struct nl_msg;
+
+namespace swss {
+
+/* Failed request of a netlink batch */
+struct NetlinkError
+{
+    std::string op;         /* Equivalent command */
+    int error;              /* errno reported by the kernel */
+    std::string message;    /* Extended ACK message, if any */
+    std::string context;    /* Context the request was queued in, if any */
+
+    std::string to_string() const;
+};
+
+/*
+ * Netlink socket sending requests in batches, shared by the rtnetlink and
+ * ctnetlink executors.
+ *
+ * send() writes the requests with one sendmsg and collects one ACK per
+ * request, matched by sequence number. Errors only carry the request header
+ * back (NETLINK_CAP_ACK), plus the extended ACK message if the kernel sets
+ * one.
+ */
+class NetlinkBatch
+{
+public:
+    struct Request
+    {
+        std::string desc;       /* Equivalent command, reported on failure */
+        struct nl_msg *msg;
+        std::string context;
+    };
+
+    /*
+     * Connects a socket of the given netlink protocol in the current network
+     * namespace, name prefixes the logs. Throws if the socket cannot connect.
+     */
+    NetlinkBatch(int protocol, size_t buf_size, const std::string &name);
+    ~NetlinkBatch();
+
+    NetlinkBatch(const NetlinkBatch&) = delete;
+    NetlinkBatch& operator=(const NetlinkBatch&) = delete;
+
+    /* Sends the requests and frees their messages, the failed ones are appended to errors */
+    void send(std::vector<Request> &requests, std::vector<NetlinkError> &errors);
+
+    /* Sequence number for a request sent outside of a batch, like a dump */
+    uint32_t nextSeq()
+    {
+        return ++m_seq;
+    }
+
+    struct nl_sock *sock() const
+    {
+        return m_sock;
+    }
+
+private:
+    std::string m_name;
+    struct nl_sock *m_sock = nullptr;
+    uint32_t m_seq = 0;
+};
+
+}
@@ -0,0 +1,402 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdexcept>
+#include <net/if.h>
+#include <net/ethernet.h>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include <netlink/attr.h>
+#include <netlink/route/link.h>
+#include <linux/if_link.h>
+#include <linux/if_bridge.h>
+#include <linux/rtnetlink.h>
+
+#include "logger.h"
+#include "exec.h"
+#include "netlinkexec.h"
+
+using namespace std;
+using namespace swss;
+
+#define NETNS_RUN_DIR           "/var/run/netns/"
+#define NETLINK_EXEC_BUF_SIZE   (1024 * 1024)
+
+NetlinkExecutor::NetlinkExecutor(const string &netns) :
+    m_netns(netns)
+{
+    SWSS_LOG_ENTER();
+
+    int own_ns = -1;
+    if (!m_netns.empty())
+    {
+        int ns = open((NETNS_RUN_DIR + m_netns).c_str(), O_RDONLY | O_CLOEXEC);
+        own_ns = open("/proc/self/ns/net", O_RDONLY | O_CLOEXEC);
+        if (ns < 0 || own_ns < 0 || setns(ns, CLONE_NEWNET) < 0)
+        {
+            int err = errno;
+            if (ns >= 0)
+            {
+                close(ns);
+            }
+            if (own_ns >= 0)
+            {
+                close(own_ns);
+            }
+            SWSS_LOG_THROW("Failed to enter network namespace %s: %s", m_netns.c_str(), strerror(err));
+        }
+        close(ns);
+    }
+
+    /* The socket stays bound to the namespace it is created in */
+    string error;
+    try
+    {
+        m_batch.reset(new NetlinkBatch(NETLINK_ROUTE, NETLINK_EXEC_BUF_SIZE, "Netlink"));
+    }
+    catch (const exception &e)
+    {
+        error = e.what();
+    }
+
+    if (own_ns >= 0)
+    {
+        if (setns(own_ns, CLONE_NEWNET) < 0)
+        {
+            SWSS_LOG_ERROR("Failed to restore network namespace: %s", strerror(errno));
+        }
+        close(own_ns);
+    }
+
+    if (!error.empty())
+    {
+        throw runtime_error(error);
+    }
+}
+
+NetlinkExecutor::~NetlinkExecutor()
+{
+    for (auto &op : m_ops)
+    {
+        nlmsg_free(op.msg);
+    }
+}
+
+struct nl_msg *NetlinkExecutor::linkMsg(int type, int flags, int family, int ifindex, const string &name)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple(type, NLM_F_REQUEST | NLM_F_ACK | flags);
+    if (!msg)
+    {
+        SWSS_LOG_THROW("Netlink message alloc failed");
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = static_cast<unsigned char>(family);
+    ifi.ifi_index = ifindex;
+    nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO);
+
+    if (!name.empty())
+    {
+        nla_put_string(msg, IFLA_IFNAME, name.c_str());
+    }
+
+    return msg;
+}
+
+static void setAdminState(struct nl_msg *msg, bool up)
+{
+    auto *ifi = static_cast<struct ifinfomsg *>(nlmsg_data(nlmsg_hdr(msg)));
+    ifi->ifi_change |= IFF_UP;
+    ifi->ifi_flags = up ? (ifi->ifi_flags | IFF_UP) : (ifi->ifi_flags & ~IFF_UP);
+}
+
+void NetlinkExecutor::queue(const string &desc, struct nl_msg *msg)
+{
+    SWSS_LOG_INFO("Queue netlink request: %s", desc.c_str());
+
+    m_ops.push_back({desc, msg, m_context});
+    if (m_ops.size() >= MAX_BATCH_SIZE)
+    {
+        sendQueued();
+    }
+}
+
+void NetlinkExecutor::queueLink(const string &desc, const string &name, struct nl_msg *msg)
+{
+    m_ifindexes.erase(name);
+    m_pendingLinks.insert(name);
+    queue(desc, msg);
+}
+
+void NetlinkExecutor::queueError(const string &desc, int error)
+{
+    SWSS_LOG_ERROR("Failed to queue netlink request %s: %s", desc.c_str(), strerror(error));
+    m_errors.push_back({desc, error, "", m_context});
+}
+
+int NetlinkExecutor::resolve(const string &name)
+{
+    /* The link is added or deleted by the pending requests */
+    if (m_pendingLinks.count(name))
+    {
+        sendQueued();
+    }
+
+    auto it = m_ifindexes.find(name);
+    if (it != m_ifindexes.end())
+    {
+        return it->second;
+    }
+
+    struct rtnl_link *link = nullptr;
+    if (rtnl_link_get_kernel(m_batch->sock(), 0, name.c_str(), &link) < 0 || !link)
+    {
+        return 0;
+    }
+
+    int ifindex = rtnl_link_get_ifindex(link);
+    rtnl_link_put(link);
+    m_ifindexes[name] = ifindex;
+    return ifindex;
+}
+
+void NetlinkExecutor::addLink(const string &name, const string &kind, bool up)
+{
+    SWSS_LOG_ENTER();
+
+    auto *msg = linkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, name);
+    if (up)
+    {
+        setAdminState(msg, true);
+    }
+
+    struct nlattr *linkinfo = nla_nest_start(msg, IFLA_LINKINFO);
+    nla_put_string(msg, IFLA_INFO_KIND, kind.c_str());
+    nla_nest_end(msg, linkinfo);
+
+    queueLink("ip link add " + name + (up ? " up" : "") + " type " + kind, name, msg);
+}
+
+void NetlinkExecutor::addVrf(const string &name, uint32_t table, bool up)
+{
+    SWSS_LOG_ENTER();
+
+    auto *msg = linkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, name);
+    if (up)
+    {
+        setAdminState(msg, true);
+    }
+
+    struct nlattr *linkinfo = nla_nest_start(msg, IFLA_LINKINFO);
+    nla_put_string(msg, IFLA_INFO_KIND, "vrf");
+    struct nlattr *data = nla_nest_start(msg, IFLA_INFO_DATA);
+    nla_put_u32(msg, IFLA_VRF_TABLE, table);
+    nla_nest_end(msg, data);
+    nla_nest_end(msg, linkinfo);
+
+    queueLink("ip link add " + name + (up ? " up" : "") + " type vrf table " + std::to_string(table), name, msg);
+}
+
+void NetlinkExecutor::addVlanLink(const string &name, const string &parent, uint16_t vlan_id,
+                                  const MacAddress &mac, bool up)
+{
+    SWSS_LOG_ENTER();
+
+    string desc = "ip link add link " + parent + (up ? " up" : "") + " name " + name
+                  + (mac ? " address " + mac.to_string() : "") + " type vlan id " + std::to_string(vlan_id);
+
+    int parent_index = resolve(parent);
+    if (!parent_index)
+    {
+        queueError(desc, ENODEV);
+        return;
+    }
+
+    auto *msg = linkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, name);
+    if (up)
+    {
+        setAdminState(msg, true);
+    }
+
+    nla_put_u32(msg, IFLA_LINK, parent_index);
+    if (mac)
+    {
+        nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac());
+    }
+
+    struct nlattr *linkinfo = nla_nest_start(msg, IFLA_LINKINFO);
+    nla_put_string(msg, IFLA_INFO_KIND, "vlan");
+    struct nlattr *data = nla_nest_start(msg, IFLA_INFO_DATA);
+    nla_put_u16(msg, IFLA_VLAN_ID, vlan_id);
+    nla_nest_end(msg, data);
+    nla_nest_end(msg, linkinfo);
+
+    queueLink(desc, name, msg);
+}
+
+void NetlinkExecutor::delLink(const string &name)
+{
+    SWSS_LOG_ENTER();
+
+    queueLink("ip link del " + name, name, linkMsg(RTM_DELLINK, 0, AF_UNSPEC, 0, name));
+}
+
+void NetlinkExecutor::setLinkAdminState(const string &name, bool up)
+{
+    SWSS_LOG_ENTER();
+
+    auto *msg = linkMsg(RTM_SETLINK, 0, AF_UNSPEC, 0, name);
+    setAdminState(msg, up);
+
+    queue("ip link set " + name + (up ? " up" : " down"), msg);
+}
+
+void NetlinkExecutor::setLinkMtu(const string &name, uint32_t mtu)
+{
+    SWSS_LOG_ENTER();
+
+    auto *msg = linkMsg(RTM_SETLINK, 0, AF_UNSPEC, 0, name);
+    nla_put_u32(msg, IFLA_MTU, mtu);
+
+    queue("ip link set " + name + " mtu " + std::to_string(mtu), msg);
+}
+
+void NetlinkExecutor::setLinkAddress(const string &name, const MacAddress &mac)
+{
+    SWSS_LOG_ENTER();
+
+    auto *msg = linkMsg(RTM_SETLINK, 0, AF_UNSPEC, 0, name);
+    nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac());
+
+    queue("ip link set " + name + " address " + mac.to_string(), msg);
+}
+
+void NetlinkExecutor::setLinkMaster(const string &name, const string &master)
+{
+    SWSS_LOG_ENTER();
+
+    string desc = "ip link set " + name + (master.empty() ? " nomaster" : " master " + master);
+
+    int master_index = 0;
+    if (!master.empty() && !(master_index = resolve(master)))
+    {
+        queueError(desc, ENODEV);
+        return;
+    }
+
+    auto *msg = linkMsg(RTM_SETLINK, 0, AF_UNSPEC, 0, name);
+    nla_put_u32(msg, IFLA_MASTER, master_index);
+
+    queue(desc, msg);
+}
+
+void NetlinkExecutor::bridgeVlan(int type, const string &desc, const string &dev,
+                                 uint16_t vid, uint16_t flags, bool self)
+{
+    int ifindex = resolve(dev);
+    if (!ifindex)
+    {
+        queueError(desc, ENODEV);
+        return;
+    }
+
+    auto *msg = linkMsg(type, 0, AF_BRIDGE, ifindex, "");
+
+    struct nlattr *afspec = nla_nest_start(msg, IFLA_AF_SPEC);
+    if (self)
+    {
+        nla_put_u16(msg, IFLA_BRIDGE_FLAGS, BRIDGE_FLAGS_SELF);
+    }
+
+    struct bridge_vlan_info vinfo;
+    memset(&vinfo, 0, sizeof(vinfo));
+    vinfo.flags = flags;
+    vinfo.vid = vid;
+    nla_put(msg, IFLA_BRIDGE_VLAN_INFO, sizeof(vinfo), &vinfo);
+    nla_nest_end(msg, afspec);
+
+    queue(desc, msg);
+}
+
+void NetlinkExecutor::addBridgeVlan(const string &dev, uint16_t vid, bool pvid, bool untagged, bool self)
+{
+    SWSS_LOG_ENTER();
+
+    string desc = "bridge vlan add vid " + std::to_string(vid) + " dev " + dev
+                  + (pvid ? " pvid" : "") + (untagged ? " untagged" : "") + (self ? " self" : "");
+
+    uint16_t flags = 0;
+    flags = static_cast<uint16_t>(flags | (pvid ? BRIDGE_VLAN_INFO_PVID : 0));
+    flags = static_cast<uint16_t>(flags | (untagged ? BRIDGE_VLAN_INFO_UNTAGGED : 0));
+
+    bridgeVlan(RTM_SETLINK, desc, dev, vid, flags, self);
+}
+
+void NetlinkExecutor::delBridgeVlan(const string &dev, uint16_t vid, bool self)
+{
+    SWSS_LOG_ENTER();
+
+    string desc = "bridge vlan del vid " + std::to_string(vid) + " dev " + dev + (self ? " self" : "");
+
+    bridgeVlan(RTM_DELLINK, desc, dev, vid, 0, self);
+}
+
+int NetlinkExecutor::exec(const string &cmd, string &stdout)
+{
+    SWSS_LOG_ENTER();
+
+    sendQueued();
+
+    /* The command may add or delete links */
+    m_ifindexes.clear();
+
+    if (m_netns.empty())
+    {
+        return swss::exec(cmd, stdout);
+    }
+
+    return swss::exec("/sbin/ip netns exec " + m_netns + " " + cmd, stdout);
+}
+
+void NetlinkExecutor::sendQueued()
+{
+    SWSS_LOG_ENTER();
+
+    size_t failed = m_errors.size();
+    m_batch->send(m_ops, m_errors);
+
+    for (size_t i = failed; i < m_errors.size(); i++)
+    {
+        if (m_errors[i].error == ENODEV)
+        {
+            /* A cached ifindex may be stale */
+            m_ifindexes.clear();
+            break;
+        }
+    }
+
+    m_pendingLinks.clear();
+}
+
+bool NetlinkExecutor::flush(vector<Error> &errors)
+{
+    SWSS_LOG_ENTER();
+
+    sendQueued();
+
+    errors = std::move(m_errors);
+    m_errors.clear();
+    return errors.empty();
+}
+
+void NetlinkExecutor::flushOrThrow()
+{
+    vector<Error> errors;
+    if (!flush(errors))
+    {
+        throw runtime_error(errors.front().to_string());
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "macaddress.h"
+#include "netlinkbatch.h"
+
+struct nl_msg;
+
+namespace swss {
+
+/*
+ * Typed rtnetlink executor for the cfgmgr daemons.
+ *
+ * Operations are encoded as rtnetlink requests and queued; flush() sends the
+ * whole queue with one sendmsg and collects one ACK per request, so a batch
+ * of link and bridge VLAN changes costs a single round trip instead
+ * of one forked `ip`/`bridge` command each. The kernel processes the requests
+ * in order and keeps going after a failure, every failed request is reported
+ * with the command it stands for.
+ *
+ * Links are addressed by name. Operations that need an ifindex (bridge VLANs,
+ * masters, VLAN parents) resolve it when queued and keep it across batches.
+ * The queue is flushed first if a pending request adds or deletes that link.
+ * The cached indexes are dropped when a shell command runs or a request
+ * fails with ENODEV, as the link may have been removed behind our back.
+ *
+ * Each request is tagged with the current context, see setContext(), so the
+ * caller can map the failures of a batch back to its own entries.
+ *
+ * Operations without a typed equivalent go through exec(), which flushes the
+ * queue to keep the ordering and runs the shell command.
+ */
+class NetlinkExecutor
+{
+public:
+    /* op is the equivalent ip/bridge command */
+    typedef NetlinkError Error;
+
+    /* Requests sent with one sendmsg at most */
+    static const size_t MAX_BATCH_SIZE = 256;
+
+    /*
+     * Opens an rtnetlink socket in the current network namespace, or in the
+     * named one (/var/run/netns/<netns>) if not empty.
+     */
+    NetlinkExecutor(const std::string &netns = "");
+    ~NetlinkExecutor();
+
+    NetlinkExecutor(const NetlinkExecutor&) = delete;
+    NetlinkExecutor& operator=(const NetlinkExecutor&) = delete;
+
+    /* ip link add <name> [up] type <kind> */
+    void addLink(const std::string &name, const std::string &kind, bool up = false);
+    /* ip link add <name> [up] type vrf table <table> */
+    void addVrf(const std::string &name, uint32_t table, bool up = false);
+    /* ip link add link <parent> [up] name <name> [address <mac>] type vlan id <vlan_id> */
+    void addVlanLink(const std::string &name, const std::string &parent, uint16_t vlan_id,
+                     const MacAddress &mac = MacAddress(), bool up = false);
+    /* ip link del <name> */
+    void delLink(const std::string &name);
+
+    /* ip link set <name> up|down */
+    void setLinkAdminState(const std::string &name, bool up);
+    /* ip link set <name> mtu <mtu> */
+    void setLinkMtu(const std::string &name, uint32_t mtu);
+    /* ip link set <name> address <mac> */
+    void setLinkAddress(const std::string &name, const MacAddress &mac);
+    /* ip link set <name> master <master>, or nomaster if master is empty */
+    void setLinkMaster(const std::string &name, const std::string &master);
+
+    /* bridge vlan add vid <vid> dev <dev> [pvid] [untagged] [self] */
+    void addBridgeVlan(const std::string &dev, uint16_t vid, bool pvid = false, bool untagged = false, bool self = false);
+    /* bridge vlan del vid <vid> dev <dev> [self] */
+    void delBridgeVlan(const std::string &dev, uint16_t vid, bool self = false);
+
+    /* Requests queued from now on report their failures with this context */
+    void setContext(const std::string &context)
+    {
+        m_context = context;
+    }
+
+    /* Shell fallback, runs after all the queued operations */
+    int exec(const std::string &cmd, std::string &stdout);
+
+    /* Sends the queued operations, returns false and fills errors if any failed */
+    bool flush(std::vector<Error> &errors);
+    /* Same as flush(), throws runtime_error with the first failure */
+    void flushOrThrow();
+
+    size_t pending() const
+    {
+        return m_ops.size();
+    }
+
+private:
+    struct nl_msg *linkMsg(int type, int flags, int family, int ifindex, const std::string &name);
+    void queue(const std::string &desc, struct nl_msg *msg);
+    void queueLink(const std::string &desc, const std::string &name, struct nl_msg *msg);
+    void queueError(const std::string &desc, int error);
+    int resolve(const std::string &name);
+    void bridgeVlan(int type, const std::string &desc, const std::string &dev,
+                    uint16_t vid, uint16_t flags, bool self);
+    void sendQueued();
+
+    std::string m_netns;
+    std::unique_ptr<NetlinkBatch> m_batch;
+    std::vector<NetlinkBatch::Request> m_ops;
+    std::vector<Error> m_errors;   /* Failures not yet returned by flush() */
+    std::string m_context;
+
+    std::unordered_map<std::string, int> m_ifindexes;
+    /* Links added or deleted by the queued requests */
+    std::unordered_set<std::string> m_pendingLinks;
+};
+
+}
@@ -61,58 +61,6 @@ void MclagLink::delVlanMbr(std::string vlan, std::string mbr_port)
 }
 
 
-void MclagLink::getOidToPortNameMap(std::unordered_map<std::string, std:: string> & port_map)
-{
-    auto hash = p_counters_db->hgetall("COUNTERS_PORT_NAME_MAP");
-
-    for (auto it = hash.begin(); it != hash.end(); ++it)
-        port_map.insert(pair<string, string>(it->second, it->first));
-
-    return;
-}
-
-void MclagLink::getBridgePortIdToAttrPortIdMap(std::map<std::string, std:: string> *oid_map)
-{
-    std::string bridge_port_id;
-    size_t pos1 = 0;
-
-    auto keys = p_asic_db->keys("ASIC_STATE:SAI_OBJECT_TYPE_BRIDGE_PORT:*");
-
-    for (auto& key : keys)
-    {
-        pos1 = key.find("oid:", 0);
-        bridge_port_id = key.substr(pos1);
-
-        auto hash = p_asic_db->hgetall(key);
-        auto attr_port_id = hash.find("SAI_BRIDGE_PORT_ATTR_PORT_ID");
-        if (attr_port_id == hash.end())
-        {
-            attr_port_id = hash.find("SAI_BRIDGE_PORT_ATTR_TUNNEL_ID");
-            if (attr_port_id == hash.end())
-                continue;
-        }
-
-        oid_map->insert(pair<string, string>(bridge_port_id, attr_port_id->second));
-    }
-
-    return;
-}
-
-void MclagLink::getVidByBvid(std::string &bvid, std::string &vlanid)
-{
-    std::string pre = "ASIC_STATE:SAI_OBJECT_TYPE_VLAN:";
-    std::string key = pre + bvid;
-
-    auto hash = p_asic_db->hgetall(key.c_str());
-
-    auto attr_vlan_id = hash.find("SAI_VLAN_ATTR_VLAN_ID");
-    if (attr_vlan_id == hash.end())
-        return;
-
-    vlanid = attr_vlan_id->second;
-    return;
-}
-
 void MclagLink::mclagsyncdFetchSystemMacFromConfigdb()
 {
     vector<FieldValueTuple> fvs; 
@@ -1794,8 +1742,6 @@ MclagLink::MclagLink(Select *select, int port) :
     p_state_db    = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     p_appl_db     = unique_ptr<DBConnector>(new DBConnector("APPL_DB", 0));
     p_config_db   = unique_ptr<DBConnector>(new DBConnector("CONFIG_DB", 0));
-    p_asic_db     = unique_ptr<DBConnector>(new DBConnector("ASIC_DB", 0));
-    p_counters_db = unique_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
     p_notificationsDb = unique_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
 
     p_device_metadata_tbl          = unique_ptr<Table>(new Table(p_config_db.get(), CFG_DEVICE_METADATA_TABLE_NAME));
@@ -218,8 +218,6 @@ namespace swss {
             unique_ptr<DBConnector> p_state_db;
             unique_ptr<DBConnector> p_appl_db;
             unique_ptr<DBConnector> p_config_db;
-            unique_ptr<DBConnector> p_asic_db;
-            unique_ptr<DBConnector> p_counters_db;
             unique_ptr<DBConnector> p_notificationsDb;
 
             unique_ptr<Table> p_mclag_tbl;
@@ -269,10 +267,6 @@ namespace swss {
 
             void delDomainCfgDependentSelectables();
 
-            void getOidToPortNameMap(std::unordered_map<std::string, std:: string> & port_map);
-            void getBridgePortIdToAttrPortIdMap(std::map<std::string, std:: string> *oid_map);
-            void getVidByBvid(std::string &bvid, std::string &vlanid);
-            void getFdbSet(std::set<mclag_fdb> *fdb_set);
             void setLocalIfPortIsolate(std::string mclag_if, bool is_enable);
             void deleteLocalIfPortIsolate(std::string mclag_if);
             void setPortIsolate(char *msg);
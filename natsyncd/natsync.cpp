@@ -38,16 +38,17 @@ using namespace swss;
 #define CT_UDP_EXPIRY_TIMEOUT   600 /* Max conntrack timeout in the user configurable range */
 
 NatSync::NatSync(RedisPipeline *pipelineAppDB, DBConnector *appDb, DBConnector *stateDb, NfNetlink *nfnl) :
-    m_natTable(appDb, APP_NAT_TABLE_NAME),
-    m_naptTable(appDb, APP_NAPT_TABLE_NAME),
-    m_natTwiceTable(appDb, APP_NAT_TWICE_TABLE_NAME),
-    m_naptTwiceTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
+    m_natTable(pipelineAppDB, APP_NAT_TABLE_NAME, true),
+    m_naptTable(pipelineAppDB, APP_NAPT_TABLE_NAME, true),
+    m_natTwiceTable(pipelineAppDB, APP_NAT_TWICE_TABLE_NAME, true),
+    m_naptTwiceTable(pipelineAppDB, APP_NAPT_TWICE_TABLE_NAME, true),
     m_natCheckTable(appDb, APP_NAT_TABLE_NAME),
     m_naptCheckTable(appDb, APP_NAPT_TABLE_NAME),
     m_twiceNatCheckTable(appDb, APP_NAT_TWICE_TABLE_NAME),
     m_twiceNaptCheckTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
     m_naptPoolCheckTable(appDb, APP_NAPT_POOL_IP_TABLE_NAME),
-    m_stateNatRestoreTable(stateDb, STATE_NAT_RESTORE_TABLE_NAME)
+    m_stateNatRestoreTable(stateDb, STATE_NAT_RESTORE_TABLE_NAME),
+    m_pipelineAppDB(pipelineAppDB)
 {
     nfsock = nfnl;
 
@@ -277,10 +278,7 @@ void NatSync::onMsg(int nlmsg_type, struct nl_object *obj)
                      */
                     napt.ct_status |= (IPS_SEEN_REPLY | IPS_ASSURED);
     
-                    nfnl_ct_set_status(ct, napt.ct_status);
-                    nfnl_ct_set_timeout(ct, CT_UDP_EXPIRY_TIMEOUT);
-    
-                    updateConnTrackEntry(ct);
+                    updateConnTrackEntry(napt);
                 }
             }
         }
@@ -982,17 +980,35 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
 }
 
 /* This function is called only for updating the UDP connection entries
- * so as not to timeout early in the kernel. */
-void NatSync::updateConnTrackEntry(struct nfnl_ct *ct)
+ * so as not to timeout early in the kernel. The update is queued and sent
+ * with the others of the same batch in flush(). */
+void NatSync::updateConnTrackEntry(const struct naptEntry &entry)
 {
     SWSS_LOG_ENTER();
 
     SWSS_LOG_INFO("Updating conntrack entry in the kernel");
 
-    if (nfsock)
+    m_conntrack.update(entry.protocol, { entry.orig_src_ip.getV4Addr(), entry.orig_src_l4_port },
+                       { entry.orig_dest_ip.getV4Addr(), entry.orig_dst_l4_port },
+                       CT_UDP_EXPIRY_TIMEOUT, entry.ct_status);
+}
+
+/*
+ * Called once all the messages read from the socket are handled: sends the
+ * queued conntrack updates as one batch and the APP_DB changes through one
+ * pipeline flush.
+ */
+void NatSync::flush()
+{
+    vector<ConntrackExecutor::Error> errors;
+
+    if (m_conntrack.pending() && !m_conntrack.flush(errors))
     {
-        nfsock->updateConnTrackEntry(ct);
+        SWSS_LOG_ERROR("%zu conntrack entry updates failed", errors.size());
     }
+
+    /* Also pushes out entries written by the warm restart reconcile */
+    m_pipelineAppDB->flush();
 }
 
 /* This function is called to delete conflicting NAT entries
@@ -24,6 +24,7 @@
 #include "warmRestartAssist.h"
 #include "ipaddress.h"
 #include "nfnetlink.h"
+#include "conntrackexec.h"
 #include <linux/netfilter/nfnetlink_conntrack.h>
 #include <linux/netfilter/nf_conntrack_common.h>
 #include <unistd.h>
@@ -48,6 +49,9 @@ public:
 
     virtual void onMsg(int nlmsg_type, struct nl_object *obj);
 
+    /* Writes the APP_DB changes and conntrack updates of the handled messages */
+    void flush();
+
     bool isNatRestoreDone();
     bool isPortInitDone(DBConnector *app_db);
 
@@ -58,7 +62,7 @@ public:
 
 private:
     static int  parseConnTrackMsg(const struct nfnl_ct *ct, struct naptEntry &entry);
-    void        updateConnTrackEntry(struct nfnl_ct *ct);
+    void        updateConnTrackEntry(const struct naptEntry &entry);
     void        deleteConnTrackEntry(struct nfnl_ct *ct);
 
     bool        matchingSnaptPoolExists(const IpAddress &natIp);
@@ -80,8 +84,11 @@ private:
     Table              m_twiceNaptCheckTable;
 
     Table              m_stateNatRestoreTable;
+    RedisPipeline     *m_pipelineAppDB;
     AppRestartAssist  *m_AppRestartAssist;
 
+    ConntrackExecutor  m_conntrack;
+
     NfNetlink          *nfsock;
 };
 
@@ -75,6 +75,17 @@ int main(int argc, char **argv)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                /*
+                 * All conntrack messages read from the socket in this
+                 * iteration have been handled, write out their changes
+                 * as one batch.
+                 */
+                if (temps == (Selectable *)&nfnl)
+                {
+                    sync.flush();
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -85,6 +96,7 @@ int main(int argc, char **argv)
                     {
                         sync.getRestartAssist()->stopReconcileTimer(s);
                         sync.getRestartAssist()->reconcile();
+                        sync.flush();
                     }
                 }
             }
@@ -3,14 +3,15 @@
 #include <netlink/route/link.h>
 #include <netlink/route/neighbour.h>
 #include <unistd.h>
+#include <net/if.h>
+#include <net/ethernet.h>
+#include <arpa/inet.h>
 
 #include "logger.h"
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "ipaddress.h"
 #include "netmsg.h"
-#include "linkcache.h"
-#include "macaddress.h"
 
 #include "neighsync.h"
 #include "warm_restart.h"
@@ -25,8 +26,8 @@ using namespace swss;
 #define MAX_ROUTE_DEL_RETRY     100
 
 NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *cfgDb, DBConnector *appDb) :
-    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
-    m_routeTable(pipelineAppDB, APP_ROUTE_TABLE_NAME, false),
+    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME, true),
+    m_routeTable(pipelineAppDB, APP_ROUTE_TABLE_NAME, true),
     m_routeCheckTable(appDb, APP_ROUTE_TABLE_NAME),
     m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
     m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
@@ -34,34 +35,14 @@ NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConne
     m_cfgVlanInterfaceTable(cfgDb, CFG_VLAN_INTF_TABLE_NAME),
     m_cfgPeerSwitchTable(cfgDb, CFG_PEER_SWITCH_TABLE_NAME),
     m_cfgEvpnNvoTable(cfgDb, CFG_VXLAN_EVPN_NVO_TABLE_NAME),
-    m_nl_sock(NULL), m_link_cache(NULL)
+    m_pipelineAppDB(pipelineAppDB),
+    m_AppRestartAssist(NULL)
 {
     m_AppRestartAssist = new AppRestartAssist(pipelineAppDB, "neighsyncd", "swss", DEFAULT_NEIGHSYNC_WARMSTART_TIMER);
     if (m_AppRestartAssist)
     {
         m_AppRestartAssist->registerAppTable(APP_NEIGH_TABLE_NAME, &m_neighTable);
     }
-
-    m_nl_sock = nl_socket_alloc();
-    if (!m_nl_sock)
-    {
-        SWSS_LOG_THROW("Failed to allocate netlink socket");
-    }
-
-    if (nl_connect(m_nl_sock, NETLINK_ROUTE) < 0)
-    {
-        nl_socket_free(m_nl_sock);
-        m_nl_sock = NULL;
-        SWSS_LOG_THROW("Failed to connect to netlink socket");
-    }
-
-    if (rtnl_link_alloc_cache(m_nl_sock, AF_UNSPEC, &m_link_cache) < 0 || !m_link_cache)
-    {
-        nl_close(m_nl_sock);
-        nl_socket_free(m_nl_sock);
-        m_nl_sock = NULL;
-        SWSS_LOG_THROW("Failed to allocate link cache");
-    }
 }
 
 NeighSync::~NeighSync()
@@ -70,17 +51,6 @@ NeighSync::~NeighSync()
     {
         delete m_AppRestartAssist;
     }
-
-    if (m_link_cache)
-    {
-        nl_cache_free(m_link_cache);
-    }
-
-    if (m_nl_sock)
-    {
-        nl_close(m_nl_sock);
-        nl_socket_free(m_nl_sock);
-    }
 }
 
 /*
@@ -100,17 +70,24 @@ bool NeighSync::getIfName(int if_index, char *if_name, size_t name_len)
 
     memset(if_name, 0, name_len);
 
-    /* Cannot get interface name. Possibly the interface gets re-created. */
-    if (!rtnl_link_i2name(m_link_cache, if_index, if_name, name_len))
+    string name;
+    if (m_linkIndex.getName(if_index, name))
     {
-        /* Trying to refill cache */
-        nl_cache_refill(m_nl_sock, m_link_cache);
-        if (!rtnl_link_i2name(m_link_cache, if_index, if_name, name_len))
-        {
-            return false;
-        }
+        strncpy(if_name, name.c_str(), name_len - 1);
+        return true;
     }
 
+    /*
+     * Link events for this ifindex have not been processed yet, resolve the
+     * single name from the kernel instead of dumping all links.
+     */
+    char buf[IF_NAMESIZE] = {0};
+    if (!if_indextoname(if_index, buf))
+    {
+        return false;
+    }
+
+    strncpy(if_name, buf, name_len - 1);
     return true;
 }
 
@@ -134,6 +111,131 @@ void NeighSync::processCfgEvpnNvo()
 }
 
 
+/*
+ * Format the neighbor IP address straight from the netlink binary address,
+ * avoiding the generic libnl string conversion on the per-message path.
+ */
+static bool formatNeighIp(struct nl_addr *addr, char *buf, size_t len)
+{
+    if (!addr || !inet_ntop(nl_addr_get_family(addr), nl_addr_get_binary_addr(addr), buf, (socklen_t)len))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/* Format the link layer address the same way nl_addr2str() does */
+static void formatNeighMac(struct nl_addr *addr, char *buf, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    unsigned int addr_len = addr ? nl_addr_get_len(addr) : 0;
+    if (addr_len == 0 || addr_len * 3 > len)
+    {
+        strncpy(buf, "none", len);
+        return;
+    }
+
+    const uint8_t *bin = (const uint8_t *)nl_addr_get_binary_addr(addr);
+    char *p = buf;
+    for (unsigned int i = 0; i < addr_len; i++)
+    {
+        if (i)
+        {
+            *p++ = ':';
+        }
+        *p++ = hex[bin[i] >> 4];
+        *p++ = hex[bin[i] & 0xf];
+    }
+    *p = '\0';
+}
+
+static bool isBroadcastMac(struct nl_addr *addr)
+{
+    if (!addr || nl_addr_get_len(addr) != ETHER_ADDR_LEN)
+    {
+        return false;
+    }
+
+    const uint8_t *bin = (const uint8_t *)nl_addr_get_binary_addr(addr);
+    for (int i = 0; i < ETHER_ADDR_LEN; i++)
+    {
+        if (bin[i] != 0xff)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool NeighSync::isDualTor()
+{
+    /* PEER_SWITCH is looked up once per netlink batch, not once per neighbor */
+    if (!m_isDualTorValid)
+    {
+        std::vector<std::string> peerSwitchKeys;
+        m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
+        m_isDualTor = peerSwitchKeys.size() > 0;
+        m_isDualTorValid = true;
+    }
+
+    return m_isDualTor;
+}
+
+/*
+ * Write all neighbor changes collected since the previous flush. Changes are
+ * deduplicated per "<ifname>:<ip>" key, only the latest state is written, and
+ * everything goes out through one pipeline flush.
+ */
+void NeighSync::flush()
+{
+    m_isDualTorValid = false;
+
+    SWSS_LOG_INFO("Flushing %zu neighbor and %zu host route updates",
+                  m_pendingOrder.size(), m_pendingHostRouteDels.size());
+
+    /* EVPN only: host routes are removed before the neighbors get added */
+    for (const auto &hostRoute : m_pendingHostRouteDels)
+    {
+        m_routeTable.del(hostRoute);
+    }
+
+    for (const auto &key : m_pendingOrder)
+    {
+        const auto &entry = m_pendingNeigh[key];
+        if (entry.del)
+        {
+            m_neighTable.del(key);
+        }
+        else
+        {
+            m_neighTable.set(key, entry.fvs);
+        }
+    }
+
+    /* Also pushes out entries written by the warm restart reconcile */
+    m_pipelineAppDB->flush();
+
+    m_pendingOrder.clear();
+    m_pendingNeigh.clear();
+    m_pendingHostRouteDels.clear();
+}
+
+void NeighSync::addPendingNeigh(const string &key, vector<FieldValueTuple> &&fvs, bool del)
+{
+    auto it = m_pendingNeigh.find(key);
+    if (it == m_pendingNeigh.end())
+    {
+        m_pendingOrder.push_back(key);
+        it = m_pendingNeigh.emplace(key, PendingNeigh()).first;
+    }
+
+    it->second.fvs = std::move(fvs);
+    it->second.del = del;
+}
+
 // Check if neighbor table is restored in kernel
 bool NeighSync::isNeighRestoreDone()
 {
@@ -156,14 +258,13 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
         return;
 
+    bool is_dualtor = isDualTor();
+
     if (rtnl_neigh_get_family(neigh) == AF_INET)
         family = IPV4_NAME;
     else if (rtnl_neigh_get_family(neigh) == AF_INET6)
@@ -171,50 +272,48 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     else
         return;
 
-    key+= LinkCache::getInstance().ifindexToName(rtnl_neigh_get_ifindex(neigh));
+    int ifindex = rtnl_neigh_get_ifindex(neigh);
+    char if_name[IFNAMSIZ] = {0};
+    if (getIfName(ifindex, if_name, IFNAMSIZ))
+    {
+        key+= if_name;
+    }
+    else
+    {
+        key+= to_string(ifindex);
+    }
     intfName = key;
     key+= ":";
 
     /* Get the vrf name (only needed for the EVPN host-route cleanup path) */
     char master_name[IFNAMSIZ] = {0};
-    if (m_isEvpnNvoExist)
+    if (m_isEvpnNvoExist && ifindex > 0)
     {
-        int ifindex = rtnl_neigh_get_ifindex(neigh);
-        if (ifindex > 0)
+        int master_index = m_linkIndex.getMaster(ifindex);
+        if (master_index)
         {
-            struct rtnl_link *link = rtnl_link_get(m_link_cache, ifindex);
-            if (!link)
-            {
-                /* Trying to refill cache */
-                nl_cache_refill(m_nl_sock, m_link_cache);
-                link = rtnl_link_get(m_link_cache, ifindex);
-            }
-
-            if (link)
-            {
-                int master_index = rtnl_link_get_master(link);
-                if (master_index)
-                {
-                    /* Get the name of the master device */
-                    getIfName(master_index, master_name, IFNAMSIZ);
-                }
-                rtnl_link_put(link);
-            }
+            /* Get the name of the master device */
+            getIfName(master_index, master_name, IFNAMSIZ);
         }
     }
 
-    nl_addr2str(rtnl_neigh_get_dst(neigh), ipStr, MAX_ADDR_SIZE);
+    struct nl_addr *dst = rtnl_neigh_get_dst(neigh);
+    if (!formatNeighIp(dst, ipStr, MAX_ADDR_SIZE))
+    {
+        SWSS_LOG_INFO("Failed to format neighbor address on %s", intfName.c_str());
+        return;
+    }
 
     /* Ignore IPv4 link-local addresses as neighbors if subtype is dualtor */
-    IpAddress ipAddress(ipStr);
-    if (family == IPV4_NAME && ipAddress.getAddrScope() == IpAddress::AddrScope::LINK_SCOPE && is_dualtor)
+    if (family == IPV4_NAME && is_dualtor &&
+        IpAddress(*(const uint32_t *)nl_addr_get_binary_addr(dst)).getAddrScope() == IpAddress::AddrScope::LINK_SCOPE)
     {
         SWSS_LOG_INFO("Link Local address received on dualtor, ignoring for %s", ipStr);
         return;
     }
 
     /* Ignore IPv6 link-local addresses as neighbors, if ipv6 link local mode is disabled */
-    if (family == IPV6_NAME && IN6_IS_ADDR_LINKLOCAL(nl_addr_get_binary_addr(rtnl_neigh_get_dst(neigh))))
+    if (family == IPV6_NAME && IN6_IS_ADDR_LINKLOCAL(nl_addr_get_binary_addr(dst)))
     {
         if ((isLinkLocalEnabled(intfName) == false) && (nlmsg_type != RTM_DELNEIGH))
         {
@@ -223,7 +322,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
         }
     }
     /* Ignore IPv6 multicast link-local addresses as neighbors */
-    if (family == IPV6_NAME && IN6_IS_ADDR_MC_LINKLOCAL(nl_addr_get_binary_addr(rtnl_neigh_get_dst(neigh))))
+    if (family == IPV6_NAME && IN6_IS_ADDR_MC_LINKLOCAL(nl_addr_get_binary_addr(dst)))
     {
         SWSS_LOG_INFO("Multicast LinkLocal address received, ignoring for %s", ipStr);
         return;
@@ -293,7 +392,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
     else
     {
-        nl_addr2str(rtnl_neigh_get_lladdr(neigh), macStr, MAX_ADDR_SIZE);
+        formatNeighMac(rtnl_neigh_get_lladdr(neigh), macStr, MAX_ADDR_SIZE);
     }
 
     if (!delete_key && !strncmp(macStr, "none", MAX_ADDR_SIZE))
@@ -303,7 +402,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
 
     /* Ignore neighbor entries with Broadcast Mac - Trigger for directed broadcast */
-    if (!delete_key && (MacAddress(macStr) == MacAddress("ff:ff:ff:ff:ff:ff")))
+    if (!delete_key && !use_zero_mac && isBroadcastMac(rtnl_neigh_get_lladdr(neigh)))
     {
         SWSS_LOG_INFO("Broadcast Mac received, ignoring for %s", ipStr);
         return;
@@ -324,7 +423,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     {
         if (delete_key == true)
         {
-            m_neighTable.del(key);
+            addPendingNeigh(key, std::move(fvVector), true);
             return;
         }
 
@@ -337,10 +436,10 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
             hostRoute += ipStr;
 
             SWSS_LOG_INFO("Remove host route before adding neighbor %s", hostRoute.c_str());
-            m_routeTable.del(hostRoute);
+            m_pendingHostRouteDels.insert(hostRoute);
         }
 
-        m_neighTable.set(key, fvVector);
+        addPendingNeigh(key, std::move(fvVector), false);
     }
 }
 
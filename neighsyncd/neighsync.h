@@ -1,11 +1,17 @@
 #ifndef __NEIGHSYNC__
 #define __NEIGHSYNC__
 
+#include <set>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "subscriberstatetable.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
+#include "linkindex.h"
 
 // The timeout value (in seconds) for neighsyncd reconcilation logic
 #define DEFAULT_NEIGHSYNC_WARMSTART_TIMER 5
@@ -31,6 +37,9 @@ public:
 
     bool isNeighRestoreDone();
 
+    /* Write the neighbor changes collected from the last netlink batch */
+    void flush();
+
     /* Get interface name based on interface index */
     bool getIfName(int if_index, char *if_name, size_t name_len);
 
@@ -39,6 +48,11 @@ public:
         return m_AppRestartAssist;
     }
 
+    LinkIndex *getLinkIndex()
+    {
+        return &m_linkIndex;
+    }
+
     SubscriberStateTable *getCfgEvpnNvoTable()
     {
         return &m_cfgEvpnNvoTable;
@@ -51,13 +65,26 @@ private:
     ProducerStateTable m_neighTable;
     ProducerStateTable m_routeTable;
     SubscriberStateTable m_cfgEvpnNvoTable;
-    struct nl_cache    *m_link_cache;
-    struct nl_sock     *m_nl_sock;
+    LinkIndex          m_linkIndex;
+    RedisPipeline     *m_pipelineAppDB;
     AppRestartAssist  *m_AppRestartAssist;
     Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
     bool m_isEvpnNvoExist = false;
+    bool m_isDualTor = false;
+    bool m_isDualTorValid = false;
+
+    struct PendingNeigh
+    {
+        std::vector<FieldValueTuple> fvs;
+        bool del = false;
+    };
+    std::vector<std::string> m_pendingOrder;
+    std::unordered_map<std::string, PendingNeigh> m_pendingNeigh;
+    std::set<std::string> m_pendingHostRouteDels;
 
     bool isLinkLocalEnabled(const std::string &port);
+    bool isDualTor();
+    void addPendingNeigh(const std::string &key, std::vector<FieldValueTuple> &&fvs, bool del);
 };
 
 }
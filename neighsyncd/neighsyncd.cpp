@@ -24,6 +24,8 @@ int main(int argc, char **argv)
 
     NetDispatcher::getInstance().registerMessageHandler(RTM_NEWNEIGH, &sync);
     NetDispatcher::getInstance().registerMessageHandler(RTM_DELNEIGH, &sync);
+    NetDispatcher::getInstance().registerMessageHandler(RTM_NEWLINK, sync.getLinkIndex());
+    NetDispatcher::getInstance().registerMessageHandler(RTM_DELLINK, sync.getLinkIndex());
 
     while (1)
     {
@@ -62,6 +64,14 @@ int main(int argc, char **argv)
                 sync.getRestartAssist()->startReconcileTimer(s);
             }
 
+            /*
+             * Subscribe to link events before loading the link index so
+             * that no link change between the dump and the subscription
+             * is lost. Link updates are applied incrementally afterwards.
+             */
+            netlink.registerGroup(RTNLGRP_LINK);
+            sync.getLinkIndex()->populate();
+
             netlink.registerGroup(RTNLGRP_NEIGH);
             cout << "Listens to neigh messages..." << endl;
             netlink.dumpRequest(RTM_GETNEIGH);
@@ -77,6 +87,17 @@ int main(int argc, char **argv)
                     sync.processCfgEvpnNvo();
                     continue;
                 }
+
+                /*
+                 * All neighbor messages read from the socket in this
+                 * iteration have been collected, write them out as one
+                 * deduplicated, pipelined batch.
+                 */
+                if (temps == (Selectable *)&netlink)
+                {
+                    sync.flush();
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -87,6 +108,7 @@ int main(int argc, char **argv)
                     {
                         sync.getRestartAssist()->stopReconcileTimer(s);
                         sync.getRestartAssist()->reconcile();
+                        sync.flush();
                     }
                 }
             }
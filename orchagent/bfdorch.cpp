@@ -2,6 +2,7 @@
 #include "intfsorch.h"
 #include "notificationconsumerstatsorch.h"
 #include "vrforch.h"
+#include "saioffloadsession.h"
 #include "converter.h"
 #include "swssnet.h"
 #include "notifier.h"
@@ -57,7 +58,8 @@ const map<sai_bfd_session_state_t, string> session_state_lookup =
 
 BfdOrch::BfdOrch(DBConnector *db, string tableName, TableConnector stateDbBfdSessionTable):
     Orch(db, tableName),
-    m_stateBfdSessionTable(stateDbBfdSessionTable.first, stateDbBfdSessionTable.second)
+    m_statePipeline(new RedisPipeline(stateDbBfdSessionTable.first)),
+    m_stateBfdSessionTable(m_statePipeline.get(), stateDbBfdSessionTable.second, true)
 {
     SWSS_LOG_ENTER();
 
@@ -82,6 +84,7 @@ BfdOrch::BfdOrch(DBConnector *db, string tableName, TableConnector stateDbBfdSes
     {
         m_stateBfdSessionTable.del(alias);
     }
+    m_stateBfdSessionTable.flush();
     // Clean up state database software BFD entries
     m_stateSoftBfdSessionTable->getKeys(keys);
     for (auto alias : keys)
@@ -220,56 +223,71 @@ void BfdOrch::doTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    m_stateBfdSessionTable.flush();
 }
 
 void BfdOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
-
-    consumer.pop(op, data, values);
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
 
     if (&consumer != m_bfdStateNotificationConsumer)
     {
         return;
     }
 
-    if (op == "bfd_session_state_change")
+    /* Only the last state of each session in the drained batch is handled */
+    SaiOffloadStateBatch<sai_bfd_api_t> batch;
+    for (auto& entry : entries)
     {
+        if (kfvOp(entry) != "bfd_session_state_change")
+        {
+            continue;
+        }
+
         uint32_t count;
         sai_bfd_session_state_notification_t *bfdSessionState = nullptr;
 
-        sai_deserialize_bfd_session_state_ntf(data, count, &bfdSessionState);
+        sai_deserialize_bfd_session_state_ntf(kfvKey(entry), count, &bfdSessionState);
+        batch.add(count, bfdSessionState);
+        sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
+    }
 
-        for (uint32_t i = 0; i < count; i++)
-        {
-            sai_object_id_t id = bfdSessionState[i].bfd_session_id;
-            sai_bfd_session_state_t state = bfdSessionState[i].session_state;
+    for (const auto& session_state : batch.states())
+    {
+        sai_object_id_t id = session_state.first;
+        sai_bfd_session_state_t state = session_state.second;
 
-            SWSS_LOG_INFO("Get BFD session state change notification id:%" PRIx64 " state: %s", id, session_state_lookup.at(state).c_str());
+        SWSS_LOG_INFO("Get BFD session state change notification id:%" PRIx64 " state: %s", id, session_state_lookup.at(state).c_str());
 
-            if (state != bfd_session_lookup[id].state)
-            {
-                auto key = bfd_session_lookup[id].peer;
-                m_stateBfdSessionTable.hset(key, "state", session_state_lookup.at(state));
+        auto lookup = bfd_session_lookup.find(id);
+        if (lookup == bfd_session_lookup.end())
+        {
+            SWSS_LOG_NOTICE("BFD session missing for state change notification id:%" PRIx64 " state: %s", id, session_state_lookup.at(state).c_str());
+            continue;
+        }
 
-                SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", key.c_str(),
-                            session_state_lookup.at(bfd_session_lookup[id].state).c_str(), session_state_lookup.at(state).c_str());
+        auto& session = lookup->second;
+        if (state != session.state)
+        {
+            m_stateBfdSessionTable.hset(session.peer, "state", session_state_lookup.at(state));
 
-                BfdUpdate update;
-                update.peer = key;
-                update.state = state;
-                notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+            SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", session.peer.c_str(),
+                        session_state_lookup.at(session.state).c_str(), session_state_lookup.at(state).c_str());
 
-                bfd_session_lookup[id].state = state;
-            }
-        }
+            session.state = state;
 
-        sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
+            BfdUpdate update;
+            update.peer = session.peer;
+            update.state = state;
+            notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+        }
     }
+
+    m_stateBfdSessionTable.flush();
 }
 
 bool BfdOrch::register_bfd_state_change_notification(void)
@@ -706,6 +724,8 @@ void BfdOrch::handleTsaStateChange(bool tsaState)
             }
         }
     }
+
+    m_stateBfdSessionTable.flush();
 }
 
 void BfdOrch::createSoftwareBfdSession(const string &key, const vector<swss::FieldValueTuple>& data)
@@ -41,9 +41,11 @@ private:
     sai_status_t retry_create_bfd_session(sai_object_id_t &bfd_session_id, vector<sai_attribute_t> attrs);
     std::string createStateDBKey(const std::string &input);
 
-    std::map<std::string, sai_object_id_t> bfd_session_map;
-    std::map<sai_object_id_t, BfdUpdate> bfd_session_lookup;
+    std::unordered_map<std::string, sai_object_id_t> bfd_session_map;
+    std::unordered_map<sai_object_id_t, BfdUpdate> bfd_session_lookup;
 
+    /* STATE_DB writes are buffered and flushed once per doTask run */
+    std::unique_ptr<swss::RedisPipeline> m_statePipeline;
     swss::Table m_stateBfdSessionTable;
 
     std::unique_ptr<swss::DBConnector> m_stateDbConnector;
@@ -103,6 +103,18 @@ static inline bool operator==(const sai_inseg_entry_t& a, const sai_inseg_entry_
         ;
 }
 
+static inline bool operator==(const sai_my_sid_entry_t& a, const sai_my_sid_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && a.vr_id == b.vr_id
+        && a.locator_block_len == b.locator_block_len
+        && a.locator_node_len == b.locator_node_len
+        && a.function_len == b.function_len
+        && a.args_len == b.args_len
+        && memcmp(a.sid, b.sid, sizeof(a.sid)) == 0
+        ;
+}
+
 static inline bool operator==(const sai_neighbor_entry_t& a, const sai_neighbor_entry_t& b)
 {
     return a.switch_id == b.switch_id
@@ -227,6 +239,23 @@ namespace std
         }
     };
 
+    template <>
+    struct hash<sai_my_sid_entry_t>
+    {
+        size_t operator()(const sai_my_sid_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.vr_id);
+            boost::hash_combine(seed, a.locator_block_len);
+            boost::hash_combine(seed, a.locator_node_len);
+            boost::hash_combine(seed, a.function_len);
+            boost::hash_combine(seed, a.args_len);
+            boost::hash_combine(seed, a.sid);
+            return seed;
+        }
+    };
+
     template <>
     struct hash<sai_neighbor_entry_t>
     {
@@ -397,6 +426,21 @@ struct SaiBulkerTraits<sai_mpls_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_set_inseg_entry_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_srv6_api_t>
+{
+    // MySID entries are bulked by EntityBulker and SID lists by ObjectBulker,
+    // which only uses the generic object bulk functions
+    using entry_t = sai_my_sid_entry_t;
+    using api_t = sai_srv6_api_t;
+    using create_entry_fn = sai_create_my_sid_entry_fn;
+    using remove_entry_fn = sai_remove_my_sid_entry_fn;
+    using set_entry_attribute_fn = sai_set_my_sid_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_create_my_sid_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_my_sid_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_my_sid_entry_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_neighbor_api_t>
 {
@@ -410,6 +454,19 @@ struct SaiBulkerTraits<sai_neighbor_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_set_neighbor_entry_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_tunnel_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_tunnel_api_t;
+    using create_entry_fn = sai_create_tunnel_fn;
+    using remove_entry_fn = sai_remove_tunnel_fn;
+    using set_entry_attribute_fn = sai_set_tunnel_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_meter_api_t>
 {
@@ -423,6 +480,19 @@ struct SaiBulkerTraits<sai_dash_meter_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_dash_acl_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_dash_acl_api_t;
+    using create_entry_fn = sai_create_dash_acl_rule_fn;
+    using remove_entry_fn = sai_remove_dash_acl_rule_fn;
+    using set_entry_attribute_fn = sai_set_dash_acl_rule_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_vnet_api_t>
 {
@@ -966,6 +1036,15 @@ inline EntityBulker<sai_mpls_api_t>::EntityBulker(sai_mpls_api_t *api, size_t ma
     set_entries_attribute = api->set_inseg_entries_attribute;
 }
 
+template <>
+inline EntityBulker<sai_srv6_api_t>::EntityBulker(sai_srv6_api_t *api, size_t max_bulk_size) :
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_my_sid_entries;
+    remove_entries = api->remove_my_sid_entries;
+    set_entries_attribute = api->set_my_sid_entries_attribute;
+}
+
 template <>
 inline EntityBulker<sai_neighbor_api_t>::EntityBulker(sai_neighbor_api_t *api, size_t max_bulk_size) :
     max_bulk_size(max_bulk_size)
@@ -1357,6 +1436,26 @@ inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_h
     set_entries_attribute = api->set_next_hops_attribute;
 }
 
+template <>
+inline ObjectBulker<sai_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_tunnel_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_tunnels;
+    remove_entries = api->remove_tunnels;
+    set_entries_attribute = api->set_tunnels_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_srv6_api_t>::ObjectBulker(SaiBulkerTraits<sai_srv6_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_srv6_sidlists;
+    remove_entries = api->remove_srv6_sidlists;
+    set_entries_attribute = nullptr;
+}
+
 template <>
 inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_vnet_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
@@ -1367,6 +1466,16 @@ inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_
     set_entries_attribute = nullptr;
 }
 
+template <>
+inline ObjectBulker<sai_dash_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_dash_acl_rules;
+    remove_entries = api->remove_dash_acl_rules;
+    set_entries_attribute = nullptr;
+}
+
 template <>
 inline ObjectBulker<sai_dash_meter_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_meter_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
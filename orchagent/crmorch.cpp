@@ -7,14 +7,18 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_EXHAUSTION_HORIZON "exhaustion_horizon"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
+#define CRM_EXHAUSTION_HORIZON_DEFAULT (60 * 60)
+#define CRM_EXHAUSTION_RATE_ALPHA 0.5
 #define CRM_THRESHOLD_TYPE_DEFAULT CrmThresholdType::CRM_PERCENTAGE
 #define CRM_THRESHOLD_LOW_DEFAULT 70
 #define CRM_THRESHOLD_HIGH_DEFAULT 85
 #define CRM_EXCEEDED_MSG_MAX 10
 #define CRM_ACL_RESOURCE_COUNT 256
+#define CRM_AVAILABLE_REFRESH_POLLS 12
 
 using namespace std;
 using namespace swss;
@@ -71,6 +75,21 @@ const map<CrmResourceType, string> crmResTypeNameMap =
     { CrmResourceType::CRM_TWAMP_ENTRY, "TWAMP_ENTRY" }
 };
 
+// Resources updated while processing APP_ROUTE_TABLE, which may run in the
+// ring thread. Their counters are registered upfront so that the ring thread
+// never inserts into the counters maps.
+const vector<CrmResourceType> crmRingThreadResources =
+{
+    CrmResourceType::CRM_IPV4_ROUTE,
+    CrmResourceType::CRM_IPV6_ROUTE,
+    CrmResourceType::CRM_IPV4_NEXTHOP,
+    CrmResourceType::CRM_IPV6_NEXTHOP,
+    CrmResourceType::CRM_IPV4_NEIGHBOR,
+    CrmResourceType::CRM_IPV6_NEIGHBOR,
+    CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER,
+    CrmResourceType::CRM_NEXTHOP_GROUP,
+};
+
 const map<CrmResourceType, uint32_t> crmResSaiAvailAttrMap =
 {
     { CrmResourceType::CRM_IPV4_ROUTE, SAI_SWITCH_ATTR_AVAILABLE_IPV4_ROUTE_ENTRY },
@@ -399,17 +418,25 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
     Orch(db, tableName),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
     m_countersCrmTable(new Table(m_countersDb.get(), COUNTERS_CRM_TABLE)),
+    m_countersPipeline(new RedisPipeline(m_countersDb.get())),
+    m_countersCrmPipelineTable(new Table(m_countersPipeline.get(), COUNTERS_CRM_TABLE, true)),
     m_timer(new SelectableTimer(timespec { .tv_sec = CRM_POLLING_INTERVAL_DEFAULT, .tv_nsec = 0 }))
 {
     SWSS_LOG_ENTER();
 
     m_pollingInterval = chrono::seconds(CRM_POLLING_INTERVAL_DEFAULT);
+    m_exhaustionHorizon = chrono::seconds(CRM_EXHAUSTION_HORIZON_DEFAULT);
 
     for (const auto &res : crmResTypeNameMap)
     {
         m_resourcesMap.emplace(res.first, CrmResourceEntry(res.second, CRM_THRESHOLD_TYPE_DEFAULT, CRM_THRESHOLD_LOW_DEFAULT, CRM_THRESHOLD_HIGH_DEFAULT));
     }
 
+    for (const auto &res : crmRingThreadResources)
+    {
+        getStatsSlot(res);
+    }
+
     // The CRM stats needs to be populated again
     m_countersCrmTable->del(CRM_COUNTERS_TABLE_KEY);
 
@@ -491,6 +518,10 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 m_timer->setInterval(interv);
                 m_timer->reset();
             }
+            else if (field == CRM_EXHAUSTION_HORIZON)
+            {
+                m_exhaustionHorizon = chrono::seconds(to_uint<uint32_t>(value));
+            }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
                 auto thresholdType = crmThreshTypeMap.at(value);
@@ -545,7 +576,7 @@ void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
+        getStatsSlot(resource).usedCounter.fetch_add(1, memory_order_relaxed);
     }
     catch (...)
     {
@@ -560,7 +591,7 @@ void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
+        getStatsSlot(resource).usedCounter.fetch_sub(1, memory_order_relaxed);
     }
     catch (...)
     {
@@ -575,7 +606,7 @@ void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter++;
+        getKeySlot(resource, getCrmAclSlotId(stage, point)).usedCounter.fetch_add(1, memory_order_relaxed);
     }
     catch (...)
     {
@@ -590,7 +621,7 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter--;
+        getKeySlot(resource, getCrmAclSlotId(stage, point)).usedCounter.fetch_sub(1, memory_order_relaxed);
 
         // remove acl_entry and acl_counter in this acl table
         if (resource == CrmResourceType::CRM_ACL_TABLE)
@@ -600,6 +631,8 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
                 if ((resourcesMap.first == (CrmResourceType::CRM_ACL_ENTRY))
                     || (resourcesMap.first == (CrmResourceType::CRM_ACL_COUNTER)))
                 {
+                    removeKeySlot(resourcesMap.first, oid);
+
                     auto &cntMap = resourcesMap.second.countersMap;
                     for (auto it = cntMap.begin(); it != cntMap.end(); ++it)
                     {
@@ -629,8 +662,7 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].id = tableId;
+        getKeySlot(resource, tableId).usedCounter.fetch_add(1, memory_order_relaxed);
     }
     catch (...)
     {
@@ -645,7 +677,7 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
+        getKeySlot(resource, tableId).usedCounter.fetch_sub(1, memory_order_relaxed);
     }
     catch (...)
     {
@@ -693,21 +725,19 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getKeySlot(CrmResourceType::CRM_DASH_IPV4_ACL_RULE, tableId);
             rule_cnt.usedCounter = 0;
-            rule_cnt.id = tableId;
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getKeySlot(CrmResourceType::CRM_DASH_IPV6_ACL_RULE, tableId);
             rule_cnt.usedCounter = 0;
-            rule_cnt.id = tableId;
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
-            ++rule_cnt.usedCounter;
+            auto &rule_cnt = getKeySlot(resource, tableId);
+            rule_cnt.usedCounter.fetch_add(1, memory_order_relaxed);
         }
     }
     catch (...)
@@ -726,19 +756,21 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
         {
             decCrmResUsedCounter(resource);
+            removeKeySlot(CrmResourceType::CRM_DASH_IPV4_ACL_RULE, tableId);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             decCrmResUsedCounter(resource);
+            removeKeySlot(CrmResourceType::CRM_DASH_IPV6_ACL_RULE, tableId);
             m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
-            --rule_cnt.usedCounter;
+            auto &rule_cnt = getKeySlot(resource, tableId);
+            rule_cnt.usedCounter.fetch_sub(1, memory_order_relaxed);
         }
     }
     catch (...)
@@ -748,13 +780,148 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
     }
 }
 
+CrmOrch::CrmResourceCounter &CrmOrch::getStatsSlot(CrmResourceType resource)
+{
+    auto &slot = m_statsSlots[static_cast<size_t>(resource)];
+    if (slot == nullptr)
+    {
+        slot = &m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY];
+    }
+
+    return *slot;
+}
+
+CrmOrch::CrmResourceCounter &CrmOrch::getKeySlot(CrmResourceType resource, uint64_t id)
+{
+    auto &slots = m_keySlots[static_cast<size_t>(resource)];
+    auto it = slots.find(id);
+    if (it != slots.end())
+    {
+        return *it->second;
+    }
+
+    auto &res = m_resourcesMap.at(resource);
+    CrmResourceCounter *cnt = nullptr;
+
+    switch (resource)
+    {
+        case CrmResourceType::CRM_ACL_TABLE:
+        case CrmResourceType::CRM_ACL_GROUP:
+            cnt = &res.countersMap[getCrmAclKey(static_cast<sai_acl_stage_t>(id >> 32),
+                                                static_cast<sai_acl_bind_point_type_t>(id & 0xffffffff))];
+            break;
+        case CrmResourceType::CRM_ACL_ENTRY:
+        case CrmResourceType::CRM_ACL_COUNTER:
+            cnt = &res.countersMap[getCrmAclTableKey(id)];
+            cnt->id = id;
+            break;
+        case CrmResourceType::CRM_DASH_IPV4_ACL_RULE:
+        case CrmResourceType::CRM_DASH_IPV6_ACL_RULE:
+            cnt = &res.countersMap[getCrmDashAclGroupKey(id)];
+            cnt->id = id;
+            break;
+        default:
+            throw runtime_error("CRM resource " + res.name + " has no per key counters");
+    }
+
+    slots.emplace(id, cnt);
+    return *cnt;
+}
+
+void CrmOrch::removeKeySlot(CrmResourceType resource, uint64_t id)
+{
+    m_keySlots[static_cast<size_t>(resource)].erase(id);
+}
+
+uint64_t CrmOrch::getCrmAclSlotId(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint)
+{
+    return (static_cast<uint64_t>(stage) << 32) | static_cast<uint32_t>(bindPoint);
+}
+
 void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    auto now = chrono::steady_clock::now();
+    double elapsed = m_polled ? chrono::duration<double>(now - m_lastPollTime).count() : 0;
+    m_lastPollTime = now;
+    m_polled = true;
+
     getResAvailableCounters();
     updateCrmCountersTable();
     checkCrmThresholds();
+    checkCrmExhaustion(elapsed);
+}
+
+bool CrmOrch::getObjectTypeAvailability(CrmResourceType type, sai_status_t &status, uint64_t &availCount)
+{
+    sai_attribute_t attr;
+
+    sai_object_type_t objType = crmResSaiObjAttrMap.at(type);
+
+    if (objType == SAI_OBJECT_TYPE_NULL)
+    {
+        return false;
+    }
+
+    uint32_t attrCount = 0;
+
+    switch (type)
+    {
+        case CrmResourceType::CRM_IPV4_ROUTE:
+        case CrmResourceType::CRM_IPV6_ROUTE:
+        case CrmResourceType::CRM_IPV4_NEIGHBOR:
+        case CrmResourceType::CRM_IPV6_NEIGHBOR:
+        case CrmResourceType::CRM_DASH_IPV4_ACL_GROUP:
+        case CrmResourceType::CRM_DASH_IPV6_ACL_GROUP:
+            attr.id = crmResAddrFamilyAttrMap.at(type);
+            attr.value.s32 = crmResAddrFamilyValMap.at(type);
+            attrCount = 1;
+            break;
+
+        case CrmResourceType::CRM_MPLS_NEXTHOP:
+            attr.id = SAI_NEXT_HOP_ATTR_TYPE;
+            attr.value.s32 = SAI_NEXT_HOP_TYPE_MPLS;
+            attrCount = 1;
+            break;
+
+        case CrmResourceType::CRM_SRV6_NEXTHOP:
+            attr.id = SAI_NEXT_HOP_ATTR_TYPE;
+            attr.value.s32 = SAI_NEXT_HOP_TYPE_SRV6_SIDLIST;
+            attrCount = 1;
+            break;
+
+        default:
+            break;
+    }
+
+    status = sai_object_type_get_availability(gSwitchId, objType, attrCount, &attr, &availCount);
+
+    return status == SAI_STATUS_SUCCESS;
+}
+
+bool CrmOrch::setSwitchAttrAvailability(CrmResourceType type, CrmResourceEntry &res, sai_status_t status, const sai_attribute_t &attr)
+{
+    if ((status == SAI_STATUS_NOT_SUPPORTED) ||
+        (status == SAI_STATUS_NOT_IMPLEMENTED) ||
+        SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
+        SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
+    {
+        // mark unsupported resources
+        res.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
+        SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(type).c_str());
+        return false;
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to get availability counter for %s CRM resource", crmResTypeNameMap.at(type).c_str());
+        return false;
+    }
+
+    res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = attr.value.u32;
+
+    return true;
 }
 
 bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
@@ -763,78 +930,102 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
     uint64_t availCount = 0;
     sai_status_t status = SAI_STATUS_SUCCESS;
 
-    sai_object_type_t objType = crmResSaiObjAttrMap.at(type);
+    if (getObjectTypeAvailability(type, status, availCount))
+    {
+        res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
+        return true;
+    }
 
-    if (objType != SAI_OBJECT_TYPE_NULL)
+    if (crmResSaiAvailAttrMap.find(type) != crmResSaiAvailAttrMap.end())
     {
-        uint32_t attrCount = 0;
+        attr.id = crmResSaiAvailAttrMap.at(type);
+        status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
+    }
 
-        switch (type)
-        {
-            case CrmResourceType::CRM_IPV4_ROUTE:
-            case CrmResourceType::CRM_IPV6_ROUTE:
-            case CrmResourceType::CRM_IPV4_NEIGHBOR:
-            case CrmResourceType::CRM_IPV6_NEIGHBOR:
-            case CrmResourceType::CRM_DASH_IPV4_ACL_GROUP:
-            case CrmResourceType::CRM_DASH_IPV6_ACL_GROUP:
-                attr.id = crmResAddrFamilyAttrMap.at(type);
-                attr.value.s32 = crmResAddrFamilyValMap.at(type);
-                attrCount = 1;
-                break;
-            
-            case CrmResourceType::CRM_MPLS_NEXTHOP:
-                attr.id = SAI_NEXT_HOP_ATTR_TYPE;
-                attr.value.s32 = SAI_NEXT_HOP_TYPE_MPLS;
-                attrCount = 1;
-                break;
-            
-            case CrmResourceType::CRM_SRV6_NEXTHOP:
-                attr.id = SAI_NEXT_HOP_ATTR_TYPE;
-                attr.value.s32 = SAI_NEXT_HOP_TYPE_SRV6_SIDLIST;
-                attrCount = 1;
-                break;
-            
-            default:
-                break;
-        }
+    return setSwitchAttrAvailability(type, res, status, attr);
+}
 
-        status = sai_object_type_get_availability(gSwitchId, objType, attrCount, &attr, &availCount);
-    }
+void CrmOrch::getSwitchResAvailability(const vector<CrmResourceType> &types)
+{
+    SWSS_LOG_ENTER();
 
-    if ((status != SAI_STATUS_SUCCESS) || (objType == SAI_OBJECT_TYPE_NULL))
+    // Resources read through sai_object_type_get_availability, one call
+    // each, the others are read through their switch attribute below
+    vector<CrmResourceType> attrTypes;
+    for (auto type : types)
     {
-        if (crmResSaiAvailAttrMap.find(type) != crmResSaiAvailAttrMap.end())
+        auto &res = m_resourcesMap.at(type);
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        uint64_t availCount = 0;
+
+        if (getObjectTypeAvailability(type, status, availCount))
         {
-            attr.id = crmResSaiAvailAttrMap.at(type);
-            status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
+            res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
+            continue;
         }
 
-        if ((status == SAI_STATUS_NOT_SUPPORTED) ||
-            (status == SAI_STATUS_NOT_IMPLEMENTED) ||
-            SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
-            SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
+        if (crmResSaiAvailAttrMap.find(type) == crmResSaiAvailAttrMap.end())
         {
-            // mark unsupported resources
-            res.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
-            SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(type).c_str());
-            return false;
+            sai_attribute_t attr = {};
+            setSwitchAttrAvailability(type, res, status, attr);
+            continue;
         }
 
-        if (status != SAI_STATUS_SUCCESS)
+        attrTypes.push_back(type);
+    }
+
+    if (attrTypes.empty())
+    {
+        return;
+    }
+
+    // All the switch attributes are read with one call. If it fails, they
+    // are read one by one to find out which ones are not supported, those
+    // are left out of the next polls.
+    vector<sai_attribute_t> attrs(attrTypes.size());
+    for (size_t i = 0; i < attrTypes.size(); i++)
+    {
+        attrs[i].id = crmResSaiAvailAttrMap.at(attrTypes[i]);
+    }
+
+    sai_status_t status = sai_switch_api->get_switch_attribute(gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        for (size_t i = 0; i < attrTypes.size(); i++)
         {
-            SWSS_LOG_ERROR("Failed to get availability counter for %s CRM resource", crmResTypeNameMap.at(type).c_str());
-            return false;
+            setSwitchAttrAvailability(attrTypes[i], m_resourcesMap.at(attrTypes[i]), status, attrs[i]);
         }
+        return;
+    }
 
-        availCount = attr.value.u32;
+    if (attrTypes.size() > 1)
+    {
+        SWSS_LOG_INFO("Failed to get %zu CRM availability attributes at once, rv:%d, reading them one by one", attrTypes.size(), status);
     }
 
-    res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
+    for (auto type : attrTypes)
+    {
+        sai_attribute_t attr;
+        attr.id = crmResSaiAvailAttrMap.at(type);
+        status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
+        setSwitchAttrAvailability(type, m_resourcesMap.at(type), status, attr);
+    }
+}
 
-    return true;
+bool CrmOrch::isAvailableCounterStale(const CrmResourceCounter &cnt, bool fullRefresh)
+{
+    return fullRefresh || !cnt.hasAvailableCounter ||
+           (cnt.availableUsedCounter != cnt.usedCounter.load(memory_order_relaxed));
+}
+
+void CrmOrch::setAvailableCounter(CrmResourceCounter &cnt, uint32_t availableCounter)
+{
+    cnt.availableCounter = availableCounter;
+    cnt.availableUsedCounter = cnt.usedCounter.load(memory_order_relaxed);
+    cnt.hasAvailableCounter = true;
 }
 
-bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res)
+bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res, bool fullRefresh)
 {
     if (gMySwitchType != "dpu")
     {
@@ -846,6 +1037,11 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
 
     for (auto &cnt : res.countersMap)
     { 
+        if (!isAvailableCounterStale(cnt.second, fullRefresh))
+        {
+            continue;
+        }
+
         sai_attribute_t attr;
         attr.id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
         attr.value.oid = cnt.second.id;
@@ -869,7 +1065,7 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
             break;
         }
 
-        cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+        setAvailableCounter(cnt.second, static_cast<uint32_t>(availCount));
     }
 
     return true;
@@ -879,6 +1075,14 @@ void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
 
+    // The per ACL table, DASH ACL group and EXT table counters are only read
+    // again when their "used" counter changed, and all of them every
+    // CRM_AVAILABLE_REFRESH_POLLS polls.
+    bool fullRefresh = (m_availabilityPolls++ % CRM_AVAILABLE_REFRESH_POLLS) == 0;
+
+    // Switch wide resources, read together once the loop is done
+    vector<CrmResourceType> switchResources;
+
     for (auto &res : m_resourcesMap)
     {
         // ignore unsupported resources
@@ -908,7 +1112,7 @@ void CrmOrch::getResAvailableCounters()
             case CrmResourceType::CRM_SRV6_NEXTHOP:
             case CrmResourceType::CRM_TWAMP_ENTRY:
             {
-                getResAvailability(res.first, res.second);
+                switchResources.push_back(res.first);
                 break;
             }
 
@@ -936,7 +1140,7 @@ void CrmOrch::getResAvailableCounters()
                     break;
                 }
 
-                getResAvailability(res.first, res.second);
+                switchResources.push_back(res.first);
                 break;
             }
 
@@ -996,6 +1200,11 @@ void CrmOrch::getResAvailableCounters()
 
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!isAvailableCounterStale(cnt.second, fullRefresh))
+                    {
+                        continue;
+                    }
+
                     sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
                     if ((status == SAI_STATUS_NOT_SUPPORTED) ||
                         (status == SAI_STATUS_NOT_IMPLEMENTED) ||
@@ -1013,7 +1222,7 @@ void CrmOrch::getResAvailableCounters()
                         break;
                     }
 
-                    cnt.second.availableCounter = attr.value.u32;
+                    setAvailableCounter(cnt.second, attr.value.u32);
                 }
 
                 break;
@@ -1023,6 +1232,11 @@ void CrmOrch::getResAvailableCounters()
             {
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!isAvailableCounterStale(cnt.second, fullRefresh))
+                    {
+                        continue;
+                    }
+
                     std::string table_name = cnt.first;
                     sai_object_type_t objType = crmResSaiObjAttrMap.at(res.first);
                     sai_attribute_t attr;
@@ -1041,7 +1255,7 @@ void CrmOrch::getResAvailableCounters()
                         break;
                     }
 
-                    cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+                    setAvailableCounter(cnt.second, static_cast<uint32_t>(availCount));
                 }
                 break;
             }
@@ -1049,21 +1263,27 @@ void CrmOrch::getResAvailableCounters()
             case CrmResourceType::CRM_DASH_IPV4_ACL_RULE:
             case CrmResourceType::CRM_DASH_IPV6_ACL_RULE:
             {
-                getDashAclGroupResAvailability(res.first, res.second);
+                getDashAclGroupResAvailability(res.first, res.second, fullRefresh);
                 break;
             }
 
             default:
                 SWSS_LOG_ERROR("Failed to get CRM resource type %u. Unknown resource type.\n", static_cast<uint32_t>(res.first));
-                return;
+                break;
         }
     }
+
+    getSwitchResAvailability(switchResources);
 }
 
 void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
+    // Collect the fields of every key first, so that each key is written
+    // once and all keys go to COUNTERS_DB in one pipelined batch
+    map<string, vector<FieldValueTuple>> rows;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
@@ -1077,9 +1297,7 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                rows[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter.load(memory_order_relaxed)));
             }
         }
         catch(const out_of_range &e)
@@ -1101,9 +1319,7 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                rows[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
             }
         }
         catch(const out_of_range &e)
@@ -1111,6 +1327,12 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    for (const auto &row : rows)
+    {
+        m_countersCrmPipelineTable->set(row.first, row.second);
+    }
+    m_countersCrmPipelineTable->flush();
 }
 
 void CrmOrch::checkCrmThresholds()
@@ -1129,21 +1351,22 @@ void CrmOrch::checkCrmThresholds()
         for (auto &j : i.second.countersMap)
         {
             auto &cnt = j.second;
+            uint32_t usedCounter = cnt.usedCounter.load(memory_order_relaxed);
             uint64_t utilization = 0;
             uint32_t percentageUtil = 0;
             string threshType = "";
 
-            if (cnt.usedCounter != 0)
+            if (usedCounter != 0)
             {
-                uint32_t dvsr = cnt.usedCounter + cnt.availableCounter;
+                uint32_t dvsr = usedCounter + cnt.availableCounter;
                 if (dvsr != 0)
                 {
-                    percentageUtil = (cnt.usedCounter * 100) / dvsr;
+                    percentageUtil = (usedCounter * 100) / dvsr;
                 }
                 else
                 {
                     SWSS_LOG_WARN("%s Exception occurred (div by Zero): Used count %u free count %u",
-                                  res.name.c_str(), cnt.usedCounter, cnt.availableCounter);
+                                  res.name.c_str(), usedCounter, cnt.availableCounter);
                 }
             }
 
@@ -1154,7 +1377,7 @@ void CrmOrch::checkCrmThresholds()
                     threshType = "TH_PERCENTAGE";
                     break;
                 case CrmThresholdType::CRM_USED:
-                    utilization = cnt.usedCounter;
+                    utilization = usedCounter;
                     threshType = "TH_USED";
                     break;
                 case CrmThresholdType::CRM_FREE:
@@ -1169,11 +1392,11 @@ void CrmOrch::checkCrmThresholds()
             {
                 event_params_t params = {
                     { "percent", to_string(percentageUtil) },
-                    { "used_cnt", to_string(cnt.usedCounter) },
+                    { "used_cnt", to_string(usedCounter) },
                     { "free_cnt", to_string(cnt.availableCounter) }};
 
                 SWSS_LOG_WARN("%s THRESHOLD_EXCEEDED for %s %u%% Used count %u free count %u",
-                              res.name.c_str(), threshType.c_str(), percentageUtil, cnt.usedCounter, cnt.availableCounter);
+                              res.name.c_str(), threshType.c_str(), percentageUtil, usedCounter, cnt.availableCounter);
 
                 event_publish(g_events_handle, "chk_crm_threshold", &params);
                 cnt.exceededLogCounter++;
@@ -1181,7 +1404,7 @@ void CrmOrch::checkCrmThresholds()
             else if ((utilization <= res.lowThreshold) && (cnt.exceededLogCounter > 0) && (res.highThreshold != res.lowThreshold))
             {
                 SWSS_LOG_WARN("%s THRESHOLD_CLEAR for %s %u%% Used count %u free count %u",
-                              res.name.c_str(), threshType.c_str(), percentageUtil, cnt.usedCounter, cnt.availableCounter);
+                              res.name.c_str(), threshType.c_str(), percentageUtil, usedCounter, cnt.availableCounter);
 
                 cnt.exceededLogCounter = 0;
             }
@@ -1189,6 +1412,80 @@ void CrmOrch::checkCrmThresholds()
     } // end of resources loop
 }
 
+bool CrmOrch::updateExhaustionEstimate(CrmResourceCounter &cnt, double elapsed, double &secondsLeft)
+{
+    uint32_t usedCounter = cnt.usedCounter.load(memory_order_relaxed);
+    uint32_t lastUsedCounter = cnt.lastUsedCounter;
+    bool hasLastUsedCounter = cnt.hasLastUsedCounter;
+
+    cnt.lastUsedCounter = usedCounter;
+    cnt.hasLastUsedCounter = true;
+
+    if (!hasLastUsedCounter || elapsed <= 0)
+    {
+        return false;
+    }
+
+    double rate = (static_cast<double>(usedCounter) - static_cast<double>(lastUsedCounter)) / elapsed;
+    if (cnt.hasUsedRate)
+    {
+        cnt.usedRate = CRM_EXHAUSTION_RATE_ALPHA * rate + (1 - CRM_EXHAUSTION_RATE_ALPHA) * cnt.usedRate;
+    }
+    else
+    {
+        cnt.usedRate = rate;
+        cnt.hasUsedRate = true;
+    }
+
+    if (cnt.usedRate <= 0)
+    {
+        return false;
+    }
+
+    secondsLeft = cnt.availableCounter / cnt.usedRate;
+    return true;
+}
+
+void CrmOrch::checkCrmExhaustion(double elapsed)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto &i : m_resourcesMap)
+    {
+        auto &res = i.second;
+
+        if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
+        {
+            continue;
+        }
+
+        for (auto &j : res.countersMap)
+        {
+            auto &cnt = j.second;
+            double secondsLeft = 0;
+
+            bool exhausting = updateExhaustionEstimate(cnt, elapsed, secondsLeft) &&
+                              (m_exhaustionHorizon.count() != 0) &&
+                              (secondsLeft < static_cast<double>(m_exhaustionHorizon.count()));
+
+            if (exhausting && (cnt.exhaustionLogCounter < CRM_EXCEEDED_MSG_MAX))
+            {
+                SWSS_LOG_WARN("%s EXHAUSTION_PROJECTED for %s in %.0f seconds, used count %u free count %u growth %.2f/s",
+                              res.name.c_str(), j.first.c_str(), secondsLeft, cnt.lastUsedCounter, cnt.availableCounter, cnt.usedRate);
+
+                cnt.exhaustionLogCounter++;
+            }
+            else if (!exhausting && (cnt.exhaustionLogCounter > 0))
+            {
+                SWSS_LOG_NOTICE("%s EXHAUSTION_CLEAR for %s, used count %u free count %u",
+                                res.name.c_str(), j.first.c_str(), cnt.lastUsedCounter, cnt.availableCounter);
+
+                cnt.exhaustionLogCounter = 0;
+            }
+        }
+    }
+}
+
 
 string CrmOrch::getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint)
 {
@@ -3,7 +3,11 @@
 #include <thread>
 #include <chrono>
 #include <map>
+#include <array>
+#include <atomic>
+#include <unordered_map>
 #include "orch.h"
+#include "redispipeline.h"
 #include "port.h"
 #include "events.h"
 
@@ -57,6 +61,9 @@ enum class CrmResourceType
     CRM_TWAMP_ENTRY
 };
 
+// Number of CRM resource types, CRM_TWAMP_ENTRY must stay the last one
+constexpr size_t CRM_RESOURCE_TYPE_COUNT = static_cast<size_t>(CrmResourceType::CRM_TWAMP_ENTRY) + 1;
+
 enum class CrmThresholdType
 {
     CRM_PERCENTAGE,
@@ -96,14 +103,29 @@ public:
 private:
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
     std::shared_ptr<swss::Table> m_countersCrmTable = nullptr;
+    std::unique_ptr<swss::RedisPipeline> m_countersPipeline = nullptr;
+    std::unique_ptr<swss::Table> m_countersCrmPipelineTable = nullptr;
     swss::SelectableTimer *m_timer = nullptr;
 
     struct CrmResourceCounter
     {
         sai_object_id_t id = 0;
         uint32_t availableCounter = 0;
-        uint32_t usedCounter = 0;
+        // Updated from the ring thread for the route resources, read by the polling timer
+        std::atomic<uint32_t> usedCounter{0};
         uint32_t exceededLogCounter = 0;
+
+        // "used" counter when availableCounter was read, per table counters
+        // are only read again when it changed
+        uint32_t availableUsedCounter = 0;
+        bool hasAvailableCounter = false;
+
+        // Growth of usedCounter between polls, used to project the exhaustion of the resource
+        uint32_t lastUsedCounter = 0;
+        bool hasLastUsedCounter = false;
+        double usedRate = 0;
+        bool hasUsedRate = false;
+        uint32_t exhaustionLogCounter = 0;
     };
 
     struct CrmResourceEntry
@@ -122,17 +144,41 @@ private:
     };
 
     std::chrono::seconds m_pollingInterval;
+    std::chrono::seconds m_exhaustionHorizon;
+    std::chrono::steady_clock::time_point m_lastPollTime;
+    bool m_polled = false;
+    uint32_t m_availabilityPolls = 0;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
+    // Counters of the STATS key, indexed by CrmResourceType, so that the
+    // hot paths do not look up m_resourcesMap. Created on first use, except
+    // for the resources updated from the ring thread which are registered
+    // when CrmOrch is created.
+    std::array<CrmResourceCounter *, CRM_RESOURCE_TYPE_COUNT> m_statsSlots{};
+    // Counters of the other keys, indexed by CrmResourceType and then by the
+    // ACL table/DASH ACL group OID or the ACL stage and bind point.
+    std::array<std::unordered_map<uint64_t, CrmResourceCounter *>, CRM_RESOURCE_TYPE_COUNT> m_keySlots;
+
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
-    bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
+    bool getObjectTypeAvailability(CrmResourceType type, sai_status_t &status, uint64_t &availCount);
+    bool setSwitchAttrAvailability(CrmResourceType type, CrmResourceEntry &res, sai_status_t status, const sai_attribute_t &attr);
+    void getSwitchResAvailability(const std::vector<CrmResourceType> &types);
+    bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res, bool fullRefresh = true);
+    static bool isAvailableCounterStale(const CrmResourceCounter &cnt, bool fullRefresh);
+    static void setAvailableCounter(CrmResourceCounter &cnt, uint32_t availableCounter);
     void getResAvailableCounters();
     void updateCrmCountersTable();
     void checkCrmThresholds();
+    void checkCrmExhaustion(double elapsed);
+    static bool updateExhaustionEstimate(CrmResourceCounter &cnt, double elapsed, double &secondsLeft);
+    CrmResourceCounter &getStatsSlot(CrmResourceType resource);
+    CrmResourceCounter &getKeySlot(CrmResourceType resource, uint64_t id);
+    void removeKeySlot(CrmResourceType resource, uint64_t id);
+    static uint64_t getCrmAclSlotId(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
     std::string getCrmAclTableKey(sai_object_id_t id);
     std::string getCrmP4rtTableKey(std::string table_name);
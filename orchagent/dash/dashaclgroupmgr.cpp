@@ -1,5 +1,6 @@
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <cinttypes>
 #include <map>
 
 #include "dashaclgroupmgr.h"
@@ -15,6 +16,7 @@ extern sai_dash_acl_api_t* sai_dash_acl_api;
 extern sai_dash_eni_api_t* sai_dash_eni_api;
 extern sai_object_id_t gSwitchId;
 extern CrmOrch *gCrmOrch;
+extern size_t gMaxBulkSize;
 
 using namespace std;
 using namespace swss;
@@ -27,6 +29,7 @@ using namespace dash::types;
 
 const static vector<uint8_t> all_protocols(boost::counting_iterator<int>(0), boost::counting_iterator<int>(UINT8_MAX + 1));
 const static vector<sai_u16_range_t> all_ports = {{numeric_limits<uint16_t>::min(), numeric_limits<uint16_t>::max()}};
+const static string eni_stats_table_name = "DASH_ACL_ENI_STATS";
 
 bool from_pb(const AclRule& data, DashAclRule& rule)
 {
@@ -134,6 +137,16 @@ DashAclRuleInfo::DashAclRuleInfo(const DashAclRule &rule) :
     SWSS_LOG_ENTER();
 }
 
+double DashAclEniStats::createRate() const
+{
+    if (m_create_time.count() == 0)
+    {
+        return 0;
+    }
+
+    return static_cast<double>(m_rules) * 1e6 / static_cast<double>(m_create_time.count());
+}
+
 bool DashAclRuleInfo::isTagUsed(const std::string &tag_id) const
 {
     return (m_src_tags.find(tag_id) != end(m_src_tags)) || (m_dst_tags.find(tag_id) != end(m_dst_tags));
@@ -142,7 +155,10 @@ bool DashAclRuleInfo::isTagUsed(const std::string &tag_id) const
 DashAclGroupMgr::DashAclGroupMgr(DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch) :
     m_dash_orch(dashorch),
     m_dash_acl_orch(aclorch),
-    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME))
+    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME)),
+    m_counters_db(new DBConnector("COUNTERS_DB", 0)),
+    m_eni_stats_table(new Table(m_counters_db.get(), eni_stats_table_name)),
+    m_rule_bulker(sai_dash_acl_api, gSwitchId, gMaxBulkSize)
 {
     SWSS_LOG_ENTER();
 }
@@ -237,10 +253,16 @@ task_process_status DashAclGroupMgr::remove(const string& group_id)
         return task_failed;
     }
 
+    vector<sai_object_id_t> rule_oids;
+    for (const auto& info : group.m_rule_infos)
+    {
+        rule_oids.push_back(info.second.m_dash_acl_rule_id);
+    }
+    removeRules(group, group.m_dash_acl_group_id, rule_oids);
     remove(group);
 
-    m_groups_table.erase(group_id);
     detachTags(group_id, group.m_tags);
+    m_groups_table.erase(group_id);
     SWSS_LOG_INFO("Removed ACL group %s", group_id.c_str());
 
     return task_success;
@@ -253,15 +275,14 @@ bool DashAclGroupMgr::exists(const string& group_id) const
     return m_groups_table.find(group_id) != m_groups_table.end();
 }
 
-DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& rule)
+void DashAclGroupMgr::getRuleAttrs(const DashAclGroup& group, sai_object_id_t group_oid, DashAclRuleBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
-    vector<sai_attribute_t> attrs;
-    vector<sai_ip_prefix_t> src_prefixes = {};
-    vector<sai_ip_prefix_t> dst_prefixes = {};
-
-    DashAclRuleInfo rule_info = rule;
+    const auto& rule = *ctxt.m_rule;
+    auto& attrs = ctxt.m_attrs;
+    auto& src_prefixes = ctxt.m_src_prefixes;
+    auto& dst_prefixes = ctxt.m_dst_prefixes;
 
     auto any_ip = [] (const auto& g)
     {
@@ -291,15 +312,14 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PROTOCOL;
 
-    vector<uint8_t> protocols;
     if (rule.m_protocols.size()) {
-        protocols = rule.m_protocols;
+        ctxt.m_protocols = rule.m_protocols;
     } else {
-        protocols = all_protocols;
+        ctxt.m_protocols = all_protocols;
     }
 
-    attrs.back().value.u8list.count = static_cast<uint32_t>(protocols.size());
-    attrs.back().value.u8list.list = protocols.data();
+    attrs.back().value.u8list.count = static_cast<uint32_t>(ctxt.m_protocols.size());
+    attrs.back().value.u8list.list = ctxt.m_protocols.data();
 
     if (!rule.m_src_prefixes.empty())
     {
@@ -318,7 +338,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
         const auto& prefixes = m_dash_acl_orch->getDashAclTagMgr().getPrefixes(tag);
         src_prefixes.insert(src_prefixes.end(),
             prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
     }
 
     for (const auto &tag : rule.m_dst_tags)
@@ -327,7 +346,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
 
         dst_prefixes.insert(dst_prefixes.end(),
             prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
     }
 
     if (src_prefixes.empty())
@@ -353,29 +371,76 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_SRC_PORT;
     attrs.back().value.u16rangelist.count = static_cast<uint32_t>(rule.m_src_ports.size());
-    attrs.back().value.u16rangelist.list = rule.m_src_ports.data();
+    attrs.back().value.u16rangelist.list = const_cast<sai_u16_range_t*>(rule.m_src_ports.data());
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DST_PORT;
     attrs.back().value.u16rangelist.count = static_cast<uint32_t>(rule.m_dst_ports.size());
-    attrs.back().value.u16rangelist.list = rule.m_dst_ports.data();
+    attrs.back().value.u16rangelist.list = const_cast<sai_u16_range_t*>(rule.m_dst_ports.data());
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
-    attrs.back().value.oid = group.m_dash_acl_group_id;
+    attrs.back().value.oid = group_oid;
+}
 
-    auto status = sai_dash_acl_api->create_dash_acl_rule(&rule_info.m_dash_acl_rule_id, gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
+size_t DashAclGroupMgr::createRules(const DashAclGroup& group, sai_object_id_t group_oid, deque<DashAclRuleBulkContext>& ctxts)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& ctxt : ctxts)
     {
-        SWSS_LOG_ERROR("Failed to create ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        getRuleAttrs(group, group_oid, ctxt);
+        m_rule_bulker.create_entry(&ctxt.m_oid, static_cast<uint32_t>(ctxt.m_attrs.size()), ctxt.m_attrs.data());
     }
 
-    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+    m_rule_bulker.flush();
+
+    CrmResourceType crm_rtype = group.isIpV4() ?
             CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
-    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 
-    return rule_info;
+    size_t created = 0;
+    for (const auto& ctxt : ctxts)
+    {
+        if (ctxt.m_oid == SAI_NULL_OBJECT_ID)
+        {
+            sai_status_t status = m_rule_bulker.create_status(ctxt.m_oid);
+            SWSS_LOG_ERROR("Failed to create ACL rule %s: %d, %s", ctxt.m_rule_id.c_str(), status, sai_serialize_status(status).c_str());
+            continue;
+        }
+
+        gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group_oid);
+        created++;
+    }
+
+    return created;
+}
+
+void DashAclGroupMgr::removeRules(const DashAclGroup& group, sai_object_id_t group_oid, const vector<sai_object_id_t>& rule_oids)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_status_t> statuses(rule_oids.size());
+    for (size_t i = 0; i < rule_oids.size(); i++)
+    {
+        m_rule_bulker.remove_entry(&statuses[i], rule_oids[i]);
+    }
+
+    m_rule_bulker.flush();
+
+    CrmResourceType crm_rtype = group.isIpV4() ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+    for (size_t i = 0; i < rule_oids.size(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule 0x%" PRIx64 ": %d, %s", rule_oids[i], statuses[i], sai_serialize_status(statuses[i]).c_str());
+            handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, statuses[i]);
+            continue;
+        }
+
+        gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group_oid);
+    }
 }
 
 task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule)
@@ -388,7 +453,6 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         SWSS_LOG_ERROR("ACL group %s doesn't exist, cannot create rule %s", group_id.c_str(), rule_id.c_str());
         return task_failed;
     }
-    auto& group = group_it->second;
 
     for (const auto& tag_id : rule.m_src_tags)
     {
@@ -408,16 +472,408 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         }
     }
 
-    auto rule_info = createRule(group, rule);
+    m_pending_rules[group_id][rule_id] = rule;
 
-    group.m_rule_count++;
-    attachTags(group_id, group.m_tags);
-
-    SWSS_LOG_INFO("Created ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+    SWSS_LOG_INFO("Queued ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
 
     return task_success;
 }
 
+void DashAclGroupMgr::refreshTag(const string& group_id, const string& tag_id)
+{
+    SWSS_LOG_ENTER();
+
+    m_pending_tags[group_id].insert(tag_id);
+}
+
+void DashAclGroupMgr::refreshTagRules()
+{
+    SWSS_LOG_ENTER();
+
+    struct RuleOwner
+    {
+        string m_group_id;
+        DashAclGroup *m_group;
+        sai_object_id_t m_old_oid;
+    };
+
+    deque<DashAclRuleBulkContext> ctxts;
+    vector<RuleOwner> owners;
+
+    for (const auto& pending : m_pending_tags)
+    {
+        const auto& group_id = pending.first;
+
+        auto group_it = m_groups_table.find(group_id);
+        if (group_it == m_groups_table.end())
+        {
+            continue;
+        }
+
+        auto& group = group_it->second;
+
+        // Rules of a bound group are not changed in place, the group is
+        // rebuilt with the new prefixes by swapRules()
+        if (isBound(group))
+        {
+            m_pending_rules[group_id];
+            continue;
+        }
+
+        auto pending_rules_it = m_pending_rules.find(group_id);
+
+        for (const auto& info : group.m_rule_infos)
+        {
+            // Queued rules are created with the new prefixes anyway
+            if (pending_rules_it != m_pending_rules.end() &&
+                pending_rules_it->second.find(info.first) != pending_rules_it->second.end())
+            {
+                continue;
+            }
+
+            bool used = false;
+            for (const auto& tag_id : pending.second)
+            {
+                if (info.second.isTagUsed(tag_id))
+                {
+                    used = true;
+                    break;
+                }
+            }
+
+            if (!used)
+            {
+                continue;
+            }
+
+            ctxts.emplace_back(info.first, group.m_rules.at(info.first));
+            getRuleAttrs(group, group.m_dash_acl_group_id, ctxts.back());
+            m_rule_bulker.create_entry(&ctxts.back().m_oid, static_cast<uint32_t>(ctxts.back().m_attrs.size()), ctxts.back().m_attrs.data());
+            owners.push_back({ group_id, &group, info.second.m_dash_acl_rule_id });
+        }
+    }
+
+    m_pending_tags.clear();
+
+    if (ctxts.empty())
+    {
+        return;
+    }
+
+    m_rule_bulker.flush();
+
+    size_t failed = 0;
+    vector<sai_status_t> statuses(ctxts.size(), SAI_STATUS_NOT_EXECUTED);
+    for (size_t i = 0; i < ctxts.size(); i++)
+    {
+        auto& ctxt = ctxts[i];
+        auto& owner = owners[i];
+        CrmResourceType crm_rtype = owner.m_group->isIpV4() ?
+                CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+        if (ctxt.m_oid == SAI_NULL_OBJECT_ID)
+        {
+            sai_status_t status = m_rule_bulker.create_status(ctxt.m_oid);
+            SWSS_LOG_ERROR("Failed to refresh ACL rule %s:%s, keeping the previous prefixes: %d, %s",
+                           owner.m_group_id.c_str(), ctxt.m_rule_id.c_str(), status, sai_serialize_status(status).c_str());
+            failed++;
+            continue;
+        }
+
+        gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, owner.m_group->m_dash_acl_group_id);
+        owner.m_group->m_rule_infos[ctxt.m_rule_id].m_dash_acl_rule_id = ctxt.m_oid;
+        m_rule_bulker.remove_entry(&statuses[i], owner.m_old_oid);
+    }
+
+    m_rule_bulker.flush();
+
+    for (size_t i = 0; i < ctxts.size(); i++)
+    {
+        auto& owner = owners[i];
+        if (statuses[i] == SAI_STATUS_NOT_EXECUTED)
+        {
+            continue;
+        }
+
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule 0x%" PRIx64 ": %d, %s", owner.m_old_oid, statuses[i], sai_serialize_status(statuses[i]).c_str());
+            handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, statuses[i]);
+            continue;
+        }
+
+        CrmResourceType crm_rtype = owner.m_group->isIpV4() ?
+                CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+        gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, owner.m_group->m_dash_acl_group_id);
+    }
+
+    SWSS_LOG_NOTICE("Refreshed %zu of %zu ACL rules using updated prefix tags", ctxts.size() - failed, ctxts.size());
+
+    if (failed)
+    {
+        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, SAI_STATUS_FAILURE);
+    }
+}
+
+void DashAclGroupMgr::flushRules()
+{
+    SWSS_LOG_ENTER();
+
+    refreshTagRules();
+
+    for (auto& pending : m_pending_rules)
+    {
+        const auto& group_id = pending.first;
+
+        auto group_it = m_groups_table.find(group_id);
+        if (group_it == m_groups_table.end())
+        {
+            SWSS_LOG_ERROR("ACL group %s doesn't exist, dropping %zu rules", group_id.c_str(), pending.second.size());
+            continue;
+        }
+
+        auto& group = group_it->second;
+        if (isBound(group))
+        {
+            swapRules(group_id, group, pending.second);
+        }
+        else
+        {
+            flushRules(group_id, group, pending.second);
+        }
+    }
+
+    m_pending_rules.clear();
+}
+
+void DashAclGroupMgr::flushRules(const string& group_id, DashAclGroup& group, map<string, DashAclRule>& rules)
+{
+    SWSS_LOG_ENTER();
+
+    // An updated rule replaces the one in the group, the group is not used
+    // by any ENI yet so it is removed first.
+    vector<sai_object_id_t> old_rule_oids;
+    for (const auto& rule : rules)
+    {
+        auto info_it = group.m_rule_infos.find(rule.first);
+        if (info_it == group.m_rule_infos.end())
+        {
+            continue;
+        }
+
+        old_rule_oids.push_back(info_it->second.m_dash_acl_rule_id);
+        group.m_rule_infos.erase(info_it);
+        group.m_rules.erase(rule.first);
+        group.m_rule_count--;
+    }
+
+    if (!old_rule_oids.empty())
+    {
+        removeRules(group, group.m_dash_acl_group_id, old_rule_oids);
+    }
+
+    deque<DashAclRuleBulkContext> ctxts;
+    for (const auto& rule : rules)
+    {
+        ctxts.emplace_back(rule.first, rule.second);
+    }
+
+    auto start = chrono::steady_clock::now();
+    size_t created = createRules(group, group.m_dash_acl_group_id, ctxts);
+    group.m_create_time = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+
+    for (const auto& ctxt : ctxts)
+    {
+        if (ctxt.m_oid == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        DashAclRuleInfo rule_info = *ctxt.m_rule;
+        rule_info.m_dash_acl_rule_id = ctxt.m_oid;
+        group.m_rule_infos[ctxt.m_rule_id] = rule_info;
+        group.m_rules[ctxt.m_rule_id] = *ctxt.m_rule;
+        group.m_rule_count++;
+
+        SWSS_LOG_INFO("Created ACL rule %s:%s", group_id.c_str(), ctxt.m_rule_id.c_str());
+    }
+
+    updateTags(group_id, group);
+
+    SWSS_LOG_NOTICE("Created %zu of %zu rules of ACL group %s in %" PRId64 " us",
+                    created, ctxts.size(), group_id.c_str(), static_cast<int64_t>(group.m_create_time.count()));
+
+    if (created != ctxts.size())
+    {
+        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, SAI_STATUS_FAILURE);
+    }
+}
+
+void DashAclGroupMgr::swapRules(const string& group_id, DashAclGroup& group, map<string, DashAclRule>& rules)
+{
+    SWSS_LOG_ENTER();
+
+    // The group is in use, build the updated group next to it and move the
+    // ENIs over once it is complete so that traffic never sees a partial
+    // rule set.
+    DashAclGroup shadow;
+    shadow.m_ip_version = group.m_ip_version;
+    shadow.m_rules = group.m_rules;
+    for (auto& rule : rules)
+    {
+        shadow.m_rules[rule.first] = move(rule.second);
+    }
+
+    create(shadow);
+    if (shadow.m_dash_acl_group_id == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Failed to create shadow group of ACL group %s", group_id.c_str());
+        return;
+    }
+
+    deque<DashAclRuleBulkContext> ctxts;
+    for (const auto& rule : shadow.m_rules)
+    {
+        ctxts.emplace_back(rule.first, rule.second);
+    }
+
+    auto start = chrono::steady_clock::now();
+    size_t created = createRules(shadow, shadow.m_dash_acl_group_id, ctxts);
+    shadow.m_create_time = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+
+    if (created != ctxts.size())
+    {
+        SWSS_LOG_ERROR("Created %zu of %zu rules of the shadow group of ACL group %s, keeping the current group",
+                       created, ctxts.size(), group_id.c_str());
+
+        vector<sai_object_id_t> rule_oids;
+        for (const auto& ctxt : ctxts)
+        {
+            if (ctxt.m_oid != SAI_NULL_OBJECT_ID)
+            {
+                rule_oids.push_back(ctxt.m_oid);
+            }
+        }
+        removeRules(shadow, shadow.m_dash_acl_group_id, rule_oids);
+        remove(shadow);
+
+        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, SAI_STATUS_FAILURE);
+        return;
+    }
+
+    for (const auto& ctxt : ctxts)
+    {
+        DashAclRuleInfo rule_info = *ctxt.m_rule;
+        rule_info.m_dash_acl_rule_id = ctxt.m_oid;
+        shadow.m_rule_infos[ctxt.m_rule_id] = rule_info;
+    }
+    shadow.m_rule_count = static_cast<int>(ctxts.size());
+    shadow.m_in_tables = group.m_in_tables;
+    shadow.m_out_tables = group.m_out_tables;
+
+    for (auto direction : { DashAclDirection::IN, DashAclDirection::OUT })
+    {
+        const auto& table = (direction == DashAclDirection::IN) ? shadow.m_in_tables : shadow.m_out_tables;
+        for (const auto& eni_stages : table)
+        {
+            auto eni = m_dash_orch->getEni(eni_stages.first);
+            if (!eni)
+            {
+                SWSS_LOG_WARN("ENI %s not found, cannot rebind ACL group %s", eni_stages.first.c_str(), group_id.c_str());
+                continue;
+            }
+
+            start = chrono::steady_clock::now();
+            for (auto stage : eni_stages.second)
+            {
+                bind(shadow, *eni, direction, stage);
+            }
+            updateEniStats(eni_stages.first, shadow,
+                           chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start));
+        }
+    }
+
+    vector<sai_object_id_t> old_rule_oids;
+    for (const auto& info : group.m_rule_infos)
+    {
+        old_rule_oids.push_back(info.second.m_dash_acl_rule_id);
+    }
+    removeRules(group, group.m_dash_acl_group_id, old_rule_oids);
+    remove(group);
+
+    group.m_dash_acl_group_id = shadow.m_dash_acl_group_id;
+    group.m_rules = move(shadow.m_rules);
+    group.m_rule_infos = move(shadow.m_rule_infos);
+    group.m_rule_count = shadow.m_rule_count;
+    group.m_create_time = shadow.m_create_time;
+
+    updateTags(group_id, group);
+
+    SWSS_LOG_NOTICE("Replaced ACL group %s with %d rules created in %" PRId64 " us",
+                    group_id.c_str(), group.m_rule_count, static_cast<int64_t>(group.m_create_time.count()));
+}
+
+void DashAclGroupMgr::updateTags(const string& group_id, DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    unordered_set<string> tags;
+    for (const auto& rule : group.m_rules)
+    {
+        tags.insert(rule.second.m_src_tags.begin(), rule.second.m_src_tags.end());
+        tags.insert(rule.second.m_dst_tags.begin(), rule.second.m_dst_tags.end());
+    }
+
+    unordered_set<string> unused_tags;
+    for (const auto& tag_id : group.m_tags)
+    {
+        if (tags.find(tag_id) == tags.end())
+        {
+            unused_tags.insert(tag_id);
+        }
+    }
+
+    detachTags(group_id, unused_tags);
+    attachTags(group_id, tags);
+    group.m_tags = move(tags);
+}
+
+void DashAclGroupMgr::updateEniStats(const string& eni_id, const DashAclGroup& group, chrono::microseconds bind_time)
+{
+    SWSS_LOG_ENTER();
+
+    auto& stats = m_eni_stats[eni_id];
+    stats.m_rules = static_cast<uint64_t>(group.m_rule_count);
+    stats.m_binds++;
+    stats.m_create_time = group.m_create_time;
+    stats.m_bind_time = bind_time;
+
+    m_eni_stats_table->set(eni_id, {
+        { "rules", to_string(stats.m_rules) },
+        { "binds", to_string(stats.m_binds) },
+        { "create_time_us", to_string(stats.m_create_time.count()) },
+        { "bind_time_us", to_string(stats.m_bind_time.count()) },
+        { "create_rate", to_string(static_cast<uint64_t>(stats.createRate())) },
+    });
+
+    SWSS_LOG_NOTICE("ENI %s: %" PRIu64 " ACL rules created in %" PRId64 " us (%.0f rules/s), bound in %" PRId64 " us",
+                    eni_id.c_str(), stats.m_rules, static_cast<int64_t>(stats.m_create_time.count()),
+                    stats.createRate(), static_cast<int64_t>(stats.m_bind_time.count()));
+}
+
+const DashAclEniStats* DashAclGroupMgr::getEniStats(const string& eni_id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_eni_stats.find(eni_id);
+    if (it == m_eni_stats.end())
+    {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
 void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
 {
     SWSS_LOG_ENTER();
@@ -461,7 +917,9 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
         return task_failed;
     }
 
+    auto start = chrono::steady_clock::now();
     bind(group, *eni, direction, stage);
+    updateEniStats(eni_id, group, chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start));
 
     auto& table = (direction == DashAclDirection::IN) ? group.m_in_tables : group.m_out_tables;
     auto& eni_stages = table[eni_id];
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <deque>
+#include <map>
 #include <unordered_map>
 #include <memory>
 
@@ -7,6 +10,7 @@
 #include <sai.h>
 #include <logger.h>
 
+#include "bulker.h"
 #include "dashorch.h"
 #include "dashtagmgr.h"
 #include "table.h"
@@ -71,6 +75,12 @@ struct DashAclGroup
     std::unordered_set<std::string> m_tags;
     int m_rule_count = 0;
 
+    // Rules of the group, kept to rebuild the group in a shadow group
+    std::unordered_map<std::string, DashAclRule> m_rules;
+    std::unordered_map<std::string, DashAclRuleInfo> m_rule_infos;
+    // Time spent creating the rules of the last programmed batch
+    std::chrono::microseconds m_create_time{0};
+
     sai_ip_addr_family_t m_ip_version;
     
     EniTable m_in_tables;
@@ -87,6 +97,20 @@ struct DashAclGroup
     }
 };
 
+// Programming metrics of the ACL groups bound to an ENI, updated on every
+// bind and on every shadow group swap. They are published to the
+// DASH_ACL_ENI_STATS table of COUNTERS_DB.
+struct DashAclEniStats
+{
+    uint64_t m_rules = 0;
+    uint64_t m_binds = 0;
+    std::chrono::microseconds m_create_time{0};
+    std::chrono::microseconds m_bind_time{0};
+
+    // Rules created per second for the last programmed group
+    double createRate() const;
+};
+
 bool from_pb(const dash::acl_rule::AclRule& data, DashAclRule& rule);
 bool from_pb(const dash::acl_group::AclGroup &data, DashAclGroup& group);
 
@@ -98,6 +122,8 @@ class DashAclGroupMgr
     DashAclOrch *m_dash_acl_orch;
     std::unordered_map<std::string, DashAclGroup> m_groups_table;
     std::unique_ptr<swss::Table> m_dash_acl_rules_table;
+    std::unique_ptr<swss::DBConnector> m_counters_db;
+    std::unique_ptr<swss::Table> m_eni_stats_table;
 
 public:
     DashAclGroupMgr(swss::DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch);
@@ -107,21 +133,62 @@ public:
     bool exists(const std::string& group_id) const;
     bool isBound(const std::string& group_id);
 
+    // Queues the rule, the queued rules are programmed by flushRules()
     task_process_status createRule(const std::string& group_id, const std::string& rule_id, DashAclRule& rule);
+    // Queues a refresh of the rules of the group using the prefix tag
+    void refreshTag(const std::string& group_id, const std::string& tag_id);
+    // Programs the queued rules in bulk. Rules of an unbound group are
+    // added to it, a bound group is rebuilt in a shadow group that replaces
+    // it on its ENIs once all of its rules are created. Rules of an unbound
+    // group using an updated tag are replaced one by one, the new rule is
+    // created before the old one is removed. A bound group using an updated
+    // tag is rebuilt in a shadow group.
+    void flushRules();
 
     task_process_status bind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
     task_process_status unbind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
 
+    const DashAclEniStats* getEniStats(const std::string& eni_id) const;
+
 private:
+    struct DashAclRuleBulkContext
+    {
+        std::string m_rule_id;
+        const DashAclRule *m_rule = nullptr;
+        sai_object_id_t m_oid = SAI_NULL_OBJECT_ID;
+        std::vector<uint8_t> m_protocols;
+        std::vector<sai_ip_prefix_t> m_src_prefixes;
+        std::vector<sai_ip_prefix_t> m_dst_prefixes;
+        std::vector<sai_attribute_t> m_attrs;
+
+        DashAclRuleBulkContext(const std::string& rule_id, const DashAclRule& rule) :
+            m_rule_id(rule_id),
+            m_rule(&rule)
+        {
+        }
+    };
+
     void init(DashAclGroup& group);
     void create(DashAclGroup& group);
     void remove(DashAclGroup& group);
 
-    DashAclRuleInfo createRule(DashAclGroup& group, DashAclRule& rule);
+    void getRuleAttrs(const DashAclGroup& group, sai_object_id_t group_oid, DashAclRuleBulkContext& ctxt);
+    size_t createRules(const DashAclGroup& group, sai_object_id_t group_oid, std::deque<DashAclRuleBulkContext>& ctxts);
+    void removeRules(const DashAclGroup& group, sai_object_id_t group_oid, const std::vector<sai_object_id_t>& rule_oids);
+    void flushRules(const std::string& group_id, DashAclGroup& group, std::map<std::string, DashAclRule>& rules);
+    void swapRules(const std::string& group_id, DashAclGroup& group, std::map<std::string, DashAclRule>& rules);
+    void refreshTagRules();
+    void updateTags(const std::string& group_id, DashAclGroup& group);
+    void updateEniStats(const std::string& eni_id, const DashAclGroup& group, std::chrono::microseconds bind_time);
 
     void bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     void unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     bool isBound(const DashAclGroup& group);
     void attachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
     void detachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
+
+    ObjectBulker<sai_dash_acl_api_t> m_rule_bulker;
+    std::map<std::string, std::map<std::string, DashAclRule>> m_pending_rules;
+    std::map<std::string, std::unordered_set<std::string>> m_pending_tags;
+    std::unordered_map<std::string, DashAclEniStats> m_eni_stats;
 };
@@ -169,6 +169,11 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
             itr = consumer.m_toSync.erase(itr);
         }
     }
+
+    if (table_name == APP_DASH_ACL_RULE_TABLE_NAME || table_name == APP_DASH_PREFIX_TAG_TABLE_NAME)
+    {
+        m_group_mgr.flushRules();
+    }
 }
 
 task_process_status DashAclOrch::taskUpdateDashAclIn(
@@ -280,12 +285,6 @@ task_process_status DashAclOrch::taskUpdateDashAclRule(
         return task_failed;
     }
 
-    if (m_group_mgr.isBound(group_id))
-    {
-        SWSS_LOG_INFO("Failed to set dash ACL rule %s:%s, ACL group is bound to the ENI", group_id.c_str(), rule_id.c_str());
-        return task_failed;
-    }
-
     return m_group_mgr.createRule(group_id, rule_id, rule);
 }
 
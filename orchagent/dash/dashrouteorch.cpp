@@ -88,22 +88,22 @@ bool DashRouteOrch::addOutboundRouting(const string& key, OutboundRoutingBulkCon
         return true;
     }
 
-    std::string routing_type_str = dash::route_type::RoutingType_Name(ctxt.metadata.routing_type());
-    if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET &&
-        ctxt.metadata.has_vnet() && gVnetNameToId.find(ctxt.metadata.vnet()) == gVnetNameToId.end())
+    std::string routing_type_str = dash::route_type::RoutingType_Name(ctxt.metadata->routing_type());
+    if (ctxt.metadata->routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET &&
+        ctxt.metadata->has_vnet() && gVnetNameToId.find(ctxt.metadata->vnet()) == gVnetNameToId.end())
     {
         SWSS_LOG_ERROR("VNET %s not found for outbound routing entry %s (routing type %s)",
-                       ctxt.metadata.vnet().c_str(),
+                       ctxt.metadata->vnet().c_str(),
                        key.c_str(),
                        routing_type_str.c_str());
         ctxt.pre_op_result = DASH_RESULT_FAILURE;
         return true;
     }
-    if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET_DIRECT &&
-        ctxt.metadata.has_vnet_direct() && gVnetNameToId.find(ctxt.metadata.vnet_direct().vnet()) == gVnetNameToId.end())
+    if (ctxt.metadata->routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET_DIRECT &&
+        ctxt.metadata->has_vnet_direct() && gVnetNameToId.find(ctxt.metadata->vnet_direct().vnet()) == gVnetNameToId.end())
     {
         SWSS_LOG_ERROR("VNET %s not found for outbound routing entry %s (routing type %s)",
-                       ctxt.metadata.vnet_direct().vnet().c_str(),
+                       ctxt.metadata->vnet_direct().vnet().c_str(),
                        key.c_str(),
                        routing_type_str.c_str());
         ctxt.pre_op_result = DASH_RESULT_FAILURE;
@@ -118,7 +118,7 @@ bool DashRouteOrch::addOutboundRouting(const string& key, OutboundRoutingBulkCon
     vector<sai_attribute_t> outbound_routing_attrs;
     auto& object_statuses = ctxt.object_statuses;
 
-    auto it = sOutboundAction.find(ctxt.metadata.routing_type());
+    auto it = sOutboundAction.find(ctxt.metadata->routing_type());
     if (it == sOutboundAction.end())
     {
         SWSS_LOG_ERROR("Routing type %s for outbound routing entry %s not allowed", routing_type_str.c_str(), key.c_str());
@@ -130,29 +130,29 @@ bool DashRouteOrch::addOutboundRouting(const string& key, OutboundRoutingBulkCon
     outbound_routing_attr.value.u32 = it->second;
     outbound_routing_attrs.push_back(outbound_routing_attr);
 
-    if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_DIRECT)
+    if (ctxt.metadata->routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_DIRECT)
     {
         // Intentional empty line, for direct routing, don't need set extra attributes
     }
-    else if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET
-        && ctxt.metadata.has_vnet()
-        && !ctxt.metadata.vnet().empty())
+    else if (ctxt.metadata->routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET
+        && ctxt.metadata->has_vnet()
+        && !ctxt.metadata->vnet().empty())
     {
         outbound_routing_attr.id = SAI_OUTBOUND_ROUTING_ENTRY_ATTR_DST_VNET_ID;
-        outbound_routing_attr.value.oid = gVnetNameToId[ctxt.metadata.vnet()];
+        outbound_routing_attr.value.oid = gVnetNameToId[ctxt.metadata->vnet()];
         outbound_routing_attrs.push_back(outbound_routing_attr);
     }
-    else if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET_DIRECT
-        && ctxt.metadata.has_vnet_direct()
-        && !ctxt.metadata.vnet_direct().vnet().empty()
-        && (ctxt.metadata.vnet_direct().overlay_ip().has_ipv4() || ctxt.metadata.vnet_direct().overlay_ip().has_ipv6()))
+    else if (ctxt.metadata->routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_VNET_DIRECT
+        && ctxt.metadata->has_vnet_direct()
+        && !ctxt.metadata->vnet_direct().vnet().empty()
+        && (ctxt.metadata->vnet_direct().overlay_ip().has_ipv4() || ctxt.metadata->vnet_direct().overlay_ip().has_ipv6()))
     {
         outbound_routing_attr.id = SAI_OUTBOUND_ROUTING_ENTRY_ATTR_DST_VNET_ID;
-        outbound_routing_attr.value.oid = gVnetNameToId[ctxt.metadata.vnet_direct().vnet()];
+        outbound_routing_attr.value.oid = gVnetNameToId[ctxt.metadata->vnet_direct().vnet()];
         outbound_routing_attrs.push_back(outbound_routing_attr);
 
         outbound_routing_attr.id = SAI_OUTBOUND_ROUTING_ENTRY_ATTR_OVERLAY_IP;
-        if (!to_sai(ctxt.metadata.vnet_direct().overlay_ip(), outbound_routing_attr.value.ipaddr))
+        if (!to_sai(ctxt.metadata->vnet_direct().overlay_ip(), outbound_routing_attr.value.ipaddr))
         {
             SWSS_LOG_ERROR("Failed to convert overlay IP for outbound routing entry %s", key.c_str());
             ctxt.pre_op_result = DASH_RESULT_FAILURE;
@@ -163,15 +163,15 @@ bool DashRouteOrch::addOutboundRouting(const string& key, OutboundRoutingBulkCon
     else
     {
         SWSS_LOG_ERROR("Routing type %s for outbound routing entry %s either invalid or missing required attributes",
-                       dash::route_type::RoutingType_Name(ctxt.metadata.routing_type()).c_str(), key.c_str());
+                       dash::route_type::RoutingType_Name(ctxt.metadata->routing_type()).c_str(), key.c_str());
         ctxt.pre_op_result = DASH_RESULT_FAILURE;
         return true;
     }
 
-    if (ctxt.metadata.has_underlay_sip() && ctxt.metadata.underlay_sip().has_ipv4())
+    if (ctxt.metadata->has_underlay_sip() && ctxt.metadata->underlay_sip().has_ipv4())
     {
         outbound_routing_attr.id = SAI_OUTBOUND_ROUTING_ENTRY_ATTR_UNDERLAY_SIP;
-        if (!to_sai(ctxt.metadata.underlay_sip(), outbound_routing_attr.value.ipaddr))
+        if (!to_sai(ctxt.metadata->underlay_sip(), outbound_routing_attr.value.ipaddr))
         {
             SWSS_LOG_ERROR("Failed to convert underlay SIP for outbound routing entry %s", key.c_str());
             ctxt.pre_op_result = DASH_RESULT_FAILURE;
@@ -180,25 +180,25 @@ bool DashRouteOrch::addOutboundRouting(const string& key, OutboundRoutingBulkCon
         outbound_routing_attrs.push_back(outbound_routing_attr);
     }
 
-    if (ctxt.metadata.has_metering_class_or()) {
+    if (ctxt.metadata->has_metering_class_or()) {
         outbound_routing_attr.id = SAI_OUTBOUND_ROUTING_ENTRY_ATTR_METER_CLASS_OR;
-        outbound_routing_attr.value.u32 = ctxt.metadata.metering_class_or();
+        outbound_routing_attr.value.u32 = ctxt.metadata->metering_class_or();
         outbound_routing_attrs.push_back(outbound_routing_attr);
     }
 
-    if (ctxt.metadata.has_metering_class_and()) {
+    if (ctxt.metadata->has_metering_class_and()) {
         outbound_routing_attr.id = SAI_OUTBOUND_ROUTING_ENTRY_ATTR_METER_CLASS_AND;
-        outbound_routing_attr.value.u32 = ctxt.metadata.metering_class_and();
+        outbound_routing_attr.value.u32 = ctxt.metadata->metering_class_and();
         outbound_routing_attrs.push_back(outbound_routing_attr);
     }
 
-    if (ctxt.metadata.has_tunnel())
+    if (ctxt.metadata->has_tunnel())
     {
         auto dash_tunnel_orch = gDirectory.get<DashTunnelOrch*>();
-        sai_object_id_t tunnel_oid = dash_tunnel_orch->getTunnelOid(ctxt.metadata.tunnel());
+        sai_object_id_t tunnel_oid = dash_tunnel_orch->getTunnelOid(ctxt.metadata->tunnel());
         if (tunnel_oid == SAI_NULL_OBJECT_ID)
         {
-            SWSS_LOG_ERROR("Tunnel %s not found for outbound routing entry %s", ctxt.metadata.tunnel().c_str(), key.c_str());
+            SWSS_LOG_ERROR("Tunnel %s not found for outbound routing entry %s", ctxt.metadata->tunnel().c_str(), key.c_str());
             ctxt.pre_op_result = DASH_RESULT_FAILURE;
             return true;
         }
@@ -317,13 +317,15 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
     uint32_t result;
     while (it != consumer.m_toSync.end())
     {
+        google::protobuf::Arena arena;
         std::map<std::pair<std::string, std::string>,
             OutboundRoutingBulkContext> toBulk;
 
         while (it != consumer.m_toSync.end())
         {
-            KeyOpFieldsValuesTuple tuple = it->second;
-            const string& key = kfvKey(tuple);
+            // The tuple is not copied, the key outlives its erasure
+            const KeyOpFieldsValuesTuple &tuple = it->second;
+            const string key = kfvKey(tuple);
             auto op = kfvOp(tuple);
 
             try
@@ -352,20 +354,21 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
 
                 if (op == SET_COMMAND)
                 {
-                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                    ctxt.metadata = parsePbMessage<dash::route::Route>(kfvFieldsValues(tuple), arena);
+                    if (!ctxt.metadata)
                     {
                         SWSS_LOG_ERROR("Requires protobuff at OutboundRouting :%s", key.c_str());
                         writeResultToDB(dash_route_result_table_, key, DASH_RESULT_FAILURE);
                         it = consumer.m_toSync.erase(it);
                         continue;
                     }
-                    if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_UNSPECIFIED)
+                    if (ctxt.metadata->routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_UNSPECIFIED)
                     {
                         // Route::action_type is deprecated in favor of Route::routing_type. For messages still using the old action_type field,
                         // copy it to the new routing_type field. All subsequent operations will use the new field.
                         #pragma GCC diagnostic push
                         #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-                        ctxt.metadata.set_routing_type(ctxt.metadata.action_type());
+                        ctxt.metadata->set_routing_type(ctxt.metadata->action_type());
                         #pragma GCC diagnostic pop
                     }
                     if (addOutboundRouting(key, ctxt))
@@ -409,9 +412,8 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
         auto it_prev = consumer.m_toSync.begin();
         while (it_prev != it)
         {
-            KeyOpFieldsValuesTuple t = it_prev->second;
-            string key = kfvKey(t);
-            string op = kfvOp(t);
+            string key = kfvKey(it_prev->second);
+            string op = kfvOp(it_prev->second);
 
             try
             {
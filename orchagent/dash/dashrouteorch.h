@@ -25,7 +25,8 @@ struct OutboundRoutingBulkContext
 {
     std::string route_group;
     swss::IpPrefix destination;
-    dash::route::Route metadata;
+    // Allocated on the arena of the consumer batch
+    dash::route::Route *metadata = nullptr;
     std::deque<sai_status_t> object_statuses;
     uint32_t pre_op_result = DASH_RESULT_SUCCESS;
     OutboundRoutingBulkContext() {}
@@ -1,3 +1,6 @@
+#include <string>
+#include <unordered_set>
+
 #include "dashtagmgr.h"
 
 #include "dashaclorch.h"
@@ -21,6 +24,58 @@ bool from_pb(const dash::tag::PrefixTag& data, DashTag& tag)
     return true;
 }
 
+static string prefixKey(const sai_ip_prefix_t& prefix)
+{
+    string key(1, static_cast<char>(prefix.addr_family));
+
+    if (prefix.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        key.append(reinterpret_cast<const char*>(&prefix.addr.ip4), sizeof(prefix.addr.ip4));
+        key.append(reinterpret_cast<const char*>(&prefix.mask.ip4), sizeof(prefix.mask.ip4));
+    }
+    else
+    {
+        key.append(reinterpret_cast<const char*>(prefix.addr.ip6), sizeof(prefix.addr.ip6));
+        key.append(reinterpret_cast<const char*>(prefix.mask.ip6), sizeof(prefix.mask.ip6));
+    }
+
+    return key;
+}
+
+void diffPrefixes(const vector<sai_ip_prefix_t>& old_prefixes,
+                  const vector<sai_ip_prefix_t>& new_prefixes,
+                  vector<sai_ip_prefix_t>& added,
+                  vector<sai_ip_prefix_t>& removed)
+{
+    unordered_set<string> old_keys;
+    unordered_set<string> new_keys;
+
+    for (const auto& prefix : old_prefixes)
+    {
+        old_keys.insert(prefixKey(prefix));
+    }
+
+    for (const auto& prefix : new_prefixes)
+    {
+        auto key = prefixKey(prefix);
+        if (old_keys.find(key) == old_keys.end() && new_keys.find(key) == new_keys.end())
+        {
+            added.push_back(prefix);
+        }
+        new_keys.insert(move(key));
+    }
+
+    unordered_set<string> removed_keys;
+    for (const auto& prefix : old_prefixes)
+    {
+        auto key = prefixKey(prefix);
+        if (new_keys.find(key) == new_keys.end() && removed_keys.insert(key).second)
+        {
+            removed.push_back(prefix);
+        }
+    }
+}
+
 DashTagMgr::DashTagMgr(DashAclOrch *aclorch) :
     m_dash_acl_orch(aclorch)
 {
@@ -64,9 +119,28 @@ task_process_status DashTagMgr::update(const string& tag_id, const DashTag& new_
         return task_failed;
     }
 
-    // Update tag prefixes
+    vector<sai_ip_prefix_t> added;
+    vector<sai_ip_prefix_t> removed;
+    diffPrefixes(tag.m_prefixes, new_tag.m_prefixes, added, removed);
+
+    if (added.empty() && removed.empty())
+    {
+        SWSS_LOG_INFO("Prefix tag %s is unchanged", tag_id.c_str());
+        return task_success;
+    }
+
     tag.m_prefixes = new_tag.m_prefixes;
 
+    // Only the rules using the tag are refreshed, in one batch for all the
+    // groups updated by this task run
+    for (const auto& group_id : tag.m_groups)
+    {
+        m_dash_acl_orch->getDashAclGroupMgr().refreshTag(group_id, tag_id);
+    }
+
+    SWSS_LOG_NOTICE("Updated prefix tag %s: %zu prefixes added, %zu removed, %zu ACL groups affected",
+                    tag_id.c_str(), added.size(), removed.size(), tag.m_groups.size());
+
     return task_success;
 }
 
@@ -20,6 +20,13 @@ struct DashTag {
 
 bool from_pb(const dash::tag::PrefixTag& data, DashTag& tag);
 
+// Computes the prefixes of new_prefixes missing from old_prefixes and the
+// ones of old_prefixes missing from new_prefixes.
+void diffPrefixes(const std::vector<sai_ip_prefix_t>& old_prefixes,
+                  const std::vector<sai_ip_prefix_t>& new_prefixes,
+                  std::vector<sai_ip_prefix_t>& added,
+                  std::vector<sai_ip_prefix_t>& removed);
+
 class DashAclOrch;
 
 class DashTagMgr
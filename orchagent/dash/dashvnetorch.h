@@ -54,7 +54,8 @@ struct VnetMapBulkContext
 {
     std::string vnet_name;
     swss::IpAddress dip;
-    dash::vnet_mapping::VnetMapping metadata;
+    // Allocated on the arena of the consumer batch
+    dash::vnet_mapping::VnetMapping *metadata = nullptr;
     std::deque<sai_status_t> outbound_ca_to_pa_object_statuses;
     std::deque<sai_status_t> pa_validation_object_statuses;
     uint32_t pre_op_result = DASH_RESULT_SUCCESS;
@@ -6,6 +6,7 @@
 #include <string>
 #include <tuple>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message.h>
 
 #include <swss/logger.h>
@@ -28,6 +29,20 @@ using TaskMap = std::map<TaskKey, TaskFunc>;
 
 #define PbIdentifier "pb"
 
+// Returns the protobuf field of a tuple, without copying it
+inline const std::string *getPbValue(const std::vector<swss::FieldValueTuple> &data)
+{
+    for (const auto &fv : data)
+    {
+        if (fvField(fv) == PbIdentifier)
+        {
+            return &fvValue(fv);
+        }
+    }
+
+    return nullptr;
+}
+
 template<typename MessageType>
 bool parsePbMessage(
     const std::vector<swss::FieldValueTuple> &data,
@@ -35,10 +50,10 @@ bool parsePbMessage(
 {
     SWSS_LOG_ENTER();
 
-    auto pb = swss::fvsGetValue(data, PbIdentifier);
+    auto pb = getPbValue(data);
     if (pb)
     {
-        if (msg.ParseFromString(*pb))
+        if (msg.ParseFromArray(pb->data(), static_cast<int>(pb->size())))
         {
             return true;
         }
@@ -55,6 +70,25 @@ bool parsePbMessage(
     return false;
 }
 
+// Parses the message into a new message allocated on the arena. The
+// messages of a consumer batch share one arena and are released with it
+// instead of one by one.
+template<typename MessageType>
+MessageType *parsePbMessage(
+    const std::vector<swss::FieldValueTuple> &data,
+    google::protobuf::Arena &arena)
+{
+    SWSS_LOG_ENTER();
+
+    auto msg = google::protobuf::Arena::CreateMessage<MessageType>(&arena);
+    if (!parsePbMessage(data, *msg))
+    {
+        return nullptr;
+    }
+
+    return msg;
+}
+
 template<typename MessageType>
 class PbWorker : public TaskWorker
 {
@@ -69,10 +103,11 @@ public:
     {
         SWSS_LOG_ENTER();
 
-        MessageType msg;
-        if (parsePbMessage(data, msg))
+        // The message is reused so that its buffers are kept across tasks
+        m_msg.Clear();
+        if (parsePbMessage(data, m_msg))
         {
-            return m_func(key, msg);
+            return m_func(key, m_msg);
         }
         else
         {
@@ -97,6 +132,7 @@ public:
 
 private:
      Task m_func;
+     MessageType m_msg;
 };
 
 class KeyOnlyWorker : public TaskWorker
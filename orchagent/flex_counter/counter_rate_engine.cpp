@@ -0,0 +1,637 @@
+#include "counter_rate_engine.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#include "logger.h"
+#include "sai_serialize.h"
+#include "table.h"
+
+#include <hiredis/hiredis.h>
+
+using namespace std;
+using namespace swss;
+
+#define RATES_TABLE                 "RATES"
+#define COUNTERS_TABLE_PREFIX       "COUNTERS:"
+#define RATES_TABLE_PREFIX          "RATES:"
+
+#define FEC_CORRECTED_BITS          "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS"
+#define FEC_NOT_CORRECTABLE_FRAMES  "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES"
+#define FEC_CODEWORD_ERRORS_PREFIX  "SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S"
+
+// Names of the FEC snapshots kept by port_rates.lua
+#define FEC_CORRECTED_BITS_LAST     "SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last"
+#define FEC_NOT_CORRECTABLE_LAST    "SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last"
+
+// Statistical average frame BER of RS-FEC used for the post FEC BER
+#define RS_AVERAGE_FRAME_BER        1e-8
+
+// Written bits of m_written
+#define WRITE_LAST                  0x1
+#define WRITE_RATES                 0x2
+#define WRITE_INIT_DONE             0x4
+#define WRITE_FEC                   0x8
+#define WRITE_FEC_MAX               0x10
+
+const CounterRateEngine::Profile CounterRateEngine::port_profile =
+{
+    "PORT",
+    { "SAI_PORT_STAT_IF_IN_OCTETS" },
+    { "SAI_PORT_STAT_IF_OUT_OCTETS" },
+    { "SAI_PORT_STAT_IF_IN_UCAST_PKTS", "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS" },
+    { "SAI_PORT_STAT_IF_OUT_UCAST_PKTS", "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS" },
+    true
+};
+
+const CounterRateEngine::Profile CounterRateEngine::rif_profile =
+{
+    "RIF",
+    { "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS" },
+    { "SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS" },
+    { "SAI_ROUTER_INTERFACE_STAT_IN_PACKETS" },
+    { "SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS" },
+    false
+};
+
+constexpr uint8_t CounterRateEngine::SAMPLE_RATES;
+constexpr uint8_t CounterRateEngine::SAMPLE_FEC;
+
+namespace
+{
+
+// Same number format as the Lua plugins (tostring)
+string formatNumber(double value)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.14g", value);
+    return buf;
+}
+
+}
+
+CounterRateEngine::CounterRateEngine(DBConnector *counters_db, const Profile &profile, uint32_t interval_ms) :
+    m_db(counters_db),
+    m_pipeline(counters_db),
+    m_profile(profile),
+    m_interval_ms(interval_ms)
+{
+    const vector<string> *quantities[QUANTITY_COUNT] =
+    {
+        &m_profile.rx_octets,
+        &m_profile.tx_octets,
+        &m_profile.rx_packets,
+        &m_profile.tx_packets
+    };
+
+    for (int q = 0; q < QUANTITY_COUNT; q++)
+    {
+        m_quantity_offset[q] = m_fields.size();
+        m_fields.insert(m_fields.end(), quantities[q]->begin(), quantities[q]->end());
+    }
+    m_quantity_offset[QUANTITY_COUNT] = m_fields.size();
+
+    if (m_profile.fec_ber)
+    {
+        m_fec_offset = m_fields.size();
+        m_fields.push_back(FEC_CORRECTED_BITS);
+        m_fields.push_back(FEC_NOT_CORRECTABLE_FRAMES);
+        for (int i = 0; i < FEC_CODEWORD_BINS; i++)
+        {
+            m_fields.push_back(FEC_CODEWORD_ERRORS_PREFIX + to_string(i));
+        }
+    }
+}
+
+void CounterRateEngine::resize(size_t count)
+{
+    m_oids.resize(count);
+    m_keys.resize(count);
+    m_state.resize(count, STATE_NONE);
+    m_written.resize(count, 0);
+    for (int q = 0; q < QUANTITY_COUNT; q++)
+    {
+        m_last[q].resize(count, 0);
+        m_rate[q].resize(count, 0);
+    }
+    m_lane_count.resize(count, 0);
+    m_serdes.resize(count, 0);
+    m_fec_state.resize(count, STATE_NONE);
+    m_ber_seeded.resize(count, 0);
+    m_last_fec_corrected.resize(count, 0);
+    m_last_fec_uncorrectable.resize(count, 0);
+    m_fec_corrected.resize(count, 0);
+    m_fec_uncorrectable.resize(count, 0);
+    m_pre_ber.resize(count, 0);
+    m_post_ber.resize(count, 0);
+    m_pre_ber_max.resize(count, 0);
+    m_max_t.resize(count, -1);
+}
+
+void CounterRateEngine::addObject(sai_object_id_t oid)
+{
+    if (m_index.find(oid) != m_index.end())
+    {
+        return;
+    }
+
+    size_t idx = m_oids.size();
+    resize(idx + 1);
+    m_oids[idx] = oid;
+    m_keys[idx] = sai_serialize_object_id(oid);
+    m_index[oid] = idx;
+}
+
+void CounterRateEngine::removeObject(sai_object_id_t oid)
+{
+    auto it = m_index.find(oid);
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    /* Move the last object in the freed slot to keep the arrays dense */
+    size_t idx = it->second;
+    size_t last = m_oids.size() - 1;
+    m_index.erase(it);
+
+    if (idx != last)
+    {
+        m_oids[idx] = m_oids[last];
+        m_keys[idx] = move(m_keys[last]);
+        m_state[idx] = m_state[last];
+        m_written[idx] = m_written[last];
+        for (int q = 0; q < QUANTITY_COUNT; q++)
+        {
+            m_last[q][idx] = m_last[q][last];
+            m_rate[q][idx] = m_rate[q][last];
+        }
+        m_lane_count[idx] = m_lane_count[last];
+        m_serdes[idx] = m_serdes[last];
+        m_fec_state[idx] = m_fec_state[last];
+        m_ber_seeded[idx] = m_ber_seeded[last];
+        m_last_fec_corrected[idx] = m_last_fec_corrected[last];
+        m_last_fec_uncorrectable[idx] = m_last_fec_uncorrectable[last];
+        m_fec_corrected[idx] = m_fec_corrected[last];
+        m_fec_uncorrectable[idx] = m_fec_uncorrectable[last];
+        m_pre_ber[idx] = m_pre_ber[last];
+        m_post_ber[idx] = m_post_ber[last];
+        m_pre_ber_max[idx] = m_pre_ber_max[last];
+        m_max_t[idx] = m_max_t[last];
+        m_index[m_oids[idx]] = idx;
+    }
+
+    resize(last);
+}
+
+bool CounterRateEngine::hasObject(sai_object_id_t oid) const
+{
+    return m_index.find(oid) != m_index.end();
+}
+
+void CounterRateEngine::setLanes(sai_object_id_t oid, uint32_t lane_count, uint32_t speed)
+{
+    auto it = m_index.find(oid);
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    m_lane_count[it->second] = lane_count;
+    m_serdes[it->second] = serdesSpeed(lane_count, speed);
+}
+
+double CounterRateEngine::serdesSpeed(uint32_t lane_count, uint32_t speed)
+{
+    if (lane_count == 0 || speed == 0 || speed % lane_count != 0)
+    {
+        return 0;
+    }
+
+    switch (speed / lane_count)
+    {
+        case 1000:
+            return 1.25e+9;
+        case 10000:
+            return 10.3125e+9;
+        case 25000:
+            return 25.78125e+9;
+        case 50000:
+            return 53.125e+9;
+        case 100000:
+            return 106.25e+9;
+        case 200000:
+            return 212.5e+9;
+        default:
+            return 0;
+    }
+}
+
+void CounterRateEngine::poll()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_oids.empty())
+    {
+        return;
+    }
+
+    auto now = chrono::steady_clock::now();
+    double delta_ms = m_polled ? chrono::duration<double, milli>(now - m_last_poll).count() : m_interval_ms;
+    m_last_poll = now;
+    m_polled = true;
+
+    double alpha = 0;
+    auto alpha_str = m_db->hget(RATES_TABLE_PREFIX + m_profile.type, m_profile.type + "_ALPHA");
+    if (alpha_str)
+    {
+        alpha = atof(alpha_str->c_str());
+    }
+
+    vector<uint64_t> samples;
+    vector<uint8_t> valid;
+    if (!readSamples(samples, valid))
+    {
+        return;
+    }
+
+    update(samples, valid, delta_ms, alpha_str != nullptr, alpha);
+    writeRates();
+}
+
+bool CounterRateEngine::readSamples(vector<uint64_t> &samples, vector<uint8_t> &valid)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_read_db)
+    {
+        m_read_db.reset(m_db->newConnector(0));
+    }
+
+    redisContext *ctx = m_read_db->getContext();
+    const size_t count = m_oids.size();
+    const size_t field_count = m_fields.size();
+
+    samples.assign(count * field_count, 0);
+    valid.assign(count, 0);
+
+    vector<const char *> argv(field_count + 2);
+    vector<size_t> argvlen(field_count + 2);
+    argv[0] = "HMGET";
+    argvlen[0] = 5;
+    for (size_t f = 0; f < field_count; f++)
+    {
+        argv[f + 2] = m_fields[f].c_str();
+        argvlen[f + 2] = m_fields[f].size();
+    }
+
+    /*
+     * Queue all the reads, then collect the replies: one round trip. On
+     * error the connection is dropped with whatever is still pending on it.
+     */
+    vector<string> keys(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        keys[i] = COUNTERS_TABLE_PREFIX + m_keys[i];
+        argv[1] = keys[i].c_str();
+        argvlen[1] = keys[i].size();
+        if (redisAppendCommandArgv(ctx, static_cast<int>(argv.size()), argv.data(), argvlen.data()) != REDIS_OK)
+        {
+            SWSS_LOG_ERROR("Failed to queue counters read of %s", keys[i].c_str());
+            m_read_db.reset();
+            return false;
+        }
+    }
+
+    /* Seed the BER maximum of new ports from the value left in the DB, once */
+    vector<size_t> seeded;
+    if (m_profile.fec_ber)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (m_ber_seeded[i])
+            {
+                continue;
+            }
+            string key = RATES_TABLE_PREFIX + m_keys[i];
+            const char *hget_argv[] = { "HGET", key.c_str(), "FEC_PRE_BER_MAX" };
+            size_t hget_argvlen[] = { 4, key.size(), 15 };
+            if (redisAppendCommandArgv(ctx, 3, hget_argv, hget_argvlen) != REDIS_OK)
+            {
+                SWSS_LOG_ERROR("Failed to queue BER read of %s", key.c_str());
+                m_read_db.reset();
+                return false;
+            }
+            seeded.push_back(i);
+        }
+    }
+
+    bool ok = true;
+    for (size_t i = 0; i < count; i++)
+    {
+        redisReply *reply = nullptr;
+        if (redisGetReply(ctx, reinterpret_cast<void **>(&reply)) != REDIS_OK || !reply)
+        {
+            SWSS_LOG_ERROR("Failed to read counters of %s", keys[i].c_str());
+            m_read_db.reset();
+            return false;
+        }
+
+        if (reply->type == REDIS_REPLY_ARRAY && reply->elements == field_count)
+        {
+            /*
+             * The rates need all the rated counters and the BER both FEC BER
+             * counters, missing codeword error bins read as 0
+             */
+            bool rates = true;
+            bool fec = m_profile.fec_ber;
+            for (size_t f = 0; f < field_count; f++)
+            {
+                const redisReply *element = reply->element[f];
+                if (element->type == REDIS_REPLY_STRING)
+                {
+                    samples[i * field_count + f] = strtoull(element->str, nullptr, 10);
+                }
+                else if (f < m_quantity_offset[QUANTITY_COUNT])
+                {
+                    rates = false;
+                }
+                else if (f < m_fec_offset + 2)
+                {
+                    fec = false;
+                }
+            }
+            valid[i] = static_cast<uint8_t>((rates ? SAMPLE_RATES : 0) | (fec ? SAMPLE_FEC : 0));
+        }
+        else
+        {
+            ok = false;
+        }
+
+        freeReplyObject(reply);
+    }
+
+    for (auto i : seeded)
+    {
+        redisReply *reply = nullptr;
+        if (redisGetReply(ctx, reinterpret_cast<void **>(&reply)) != REDIS_OK || !reply)
+        {
+            SWSS_LOG_ERROR("Failed to read BER of %s", m_keys[i].c_str());
+            m_read_db.reset();
+            return false;
+        }
+        if (reply->type == REDIS_REPLY_STRING)
+        {
+            m_pre_ber_max[i] = atof(reply->str);
+        }
+        m_ber_seeded[i] = 1;
+        freeReplyObject(reply);
+    }
+
+    if (!ok)
+    {
+        SWSS_LOG_WARN("Unexpected reply reading %s counters", m_profile.type.c_str());
+    }
+
+    return true;
+}
+
+void CounterRateEngine::update(const vector<uint64_t> &samples, const vector<uint8_t> &valid,
+                               double delta_ms, bool has_alpha, double alpha)
+{
+    const size_t count = m_oids.size();
+    const size_t field_count = m_fields.size();
+
+    if (samples.size() != count * field_count || valid.size() != count || delta_ms <= 0)
+    {
+        return;
+    }
+
+    fill(m_written.begin(), m_written.end(), 0);
+
+    if (has_alpha)
+    {
+        const double scale = 1000.0 / delta_ms;
+        const double one_minus_alpha = 1.0 - alpha;
+
+        /* One pass per quantity over contiguous arrays */
+        for (int q = 0; q < QUANTITY_COUNT; q++)
+        {
+            const size_t begin = m_quantity_offset[q];
+            const size_t end = m_quantity_offset[q + 1];
+            uint64_t *last = m_last[q].data();
+            double *rate = m_rate[q].data();
+            const uint8_t *state = m_state.data();
+
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!(valid[i] & SAMPLE_RATES))
+                {
+                    continue;
+                }
+
+                const uint64_t *row = &samples[i * field_count];
+                uint64_t current = 0;
+                for (size_t f = begin; f < end; f++)
+                {
+                    current += row[f];
+                }
+
+                /* A counter going backwards has been cleared, restart from it */
+                double rate_new = current >= last[i] ? static_cast<double>(current - last[i]) * scale : 0;
+                if (state[i] == STATE_DONE)
+                {
+                    rate[i] = alpha * rate_new + one_minus_alpha * rate[i];
+                }
+                else if (state[i] == STATE_COUNTERS_LAST)
+                {
+                    rate[i] = rate_new;
+                }
+                last[i] = current;
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!(valid[i] & SAMPLE_RATES))
+            {
+                continue;
+            }
+
+            m_written[i] |= WRITE_LAST;
+            if (m_state[i] == STATE_NONE)
+            {
+                m_state[i] = STATE_COUNTERS_LAST;
+                m_written[i] |= WRITE_INIT_DONE;
+            }
+            else
+            {
+                if (m_state[i] == STATE_COUNTERS_LAST)
+                {
+                    m_state[i] = STATE_DONE;
+                    m_written[i] |= WRITE_INIT_DONE;
+                }
+                m_written[i] |= WRITE_RATES;
+            }
+        }
+    }
+
+    if (!m_profile.fec_ber)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint64_t *row = &samples[i * field_count];
+        if (!(valid[i] & SAMPLE_FEC) || m_serdes[i] == 0)
+        {
+            continue;
+        }
+
+        const uint64_t corrected = row[m_fec_offset];
+        const uint64_t uncorrectable = row[m_fec_offset + 1];
+
+        /* The first sample only records the FEC counters */
+        if (m_fec_state[i] != STATE_NONE)
+        {
+            const double serdes_rate_total = m_lane_count[i] * m_serdes[i] * delta_ms / 1000;
+            m_pre_ber[i] = corrected >= m_last_fec_corrected[i] ?
+                static_cast<double>(corrected - m_last_fec_corrected[i]) / serdes_rate_total : 0;
+            m_post_ber[i] = uncorrectable >= m_last_fec_uncorrectable[i] ?
+                static_cast<double>(uncorrectable - m_last_fec_uncorrectable[i]) * RS_AVERAGE_FRAME_BER /
+                serdes_rate_total : 0;
+
+            m_max_t[i] = -1;
+            for (int bin = 0; bin < FEC_CODEWORD_BINS; bin++)
+            {
+                if (row[m_fec_offset + 2 + bin] > 0)
+                {
+                    m_max_t[i] = bin;
+                }
+            }
+
+            m_written[i] |= WRITE_FEC;
+            if (m_pre_ber[i] > m_pre_ber_max[i])
+            {
+                m_pre_ber_max[i] = m_pre_ber[i];
+                m_written[i] |= WRITE_FEC_MAX;
+            }
+        }
+
+        m_fec_state[i] = STATE_DONE;
+        m_last_fec_corrected[i] = corrected;
+        m_last_fec_uncorrectable[i] = uncorrectable;
+        m_fec_corrected[i] = corrected;
+        m_fec_uncorrectable[i] = uncorrectable;
+        m_written[i] |= WRITE_LAST;
+    }
+}
+
+void CounterRateEngine::writeRates()
+{
+    SWSS_LOG_ENTER();
+
+    Table rates(&m_pipeline, RATES_TABLE, true);
+    const string state_suffix = ":" + m_profile.type;
+
+    vector<FieldValueTuple> fvs;
+    for (size_t i = 0; i < m_oids.size(); i++)
+    {
+        const uint8_t written = m_written[i];
+        if (!written)
+        {
+            continue;
+        }
+
+        fvs.clear();
+        if (written & WRITE_RATES)
+        {
+            fvs.emplace_back("RX_BPS", formatNumber(m_rate[RX_OCTETS][i]));
+            fvs.emplace_back("RX_PPS", formatNumber(m_rate[RX_PACKETS][i]));
+            fvs.emplace_back("TX_BPS", formatNumber(m_rate[TX_OCTETS][i]));
+            fvs.emplace_back("TX_PPS", formatNumber(m_rate[TX_PACKETS][i]));
+        }
+        if (written & WRITE_FEC)
+        {
+            fvs.emplace_back("FEC_PRE_BER", formatNumber(m_pre_ber[i]));
+            fvs.emplace_back("FEC_POST_BER", formatNumber(m_post_ber[i]));
+            fvs.emplace_back("FEC_MAX_T", to_string(m_max_t[i]));
+        }
+        if (written & WRITE_FEC_MAX)
+        {
+            fvs.emplace_back("FEC_PRE_BER_MAX", formatNumber(m_pre_ber_max[i]));
+        }
+        if (written & WRITE_LAST)
+        {
+            /*
+             * Keep the snapshots of the Lua plugins up to date so that they
+             * can take over without a gap. Quantities summing several
+             * counters are stored as their first counter plus the others.
+             */
+            for (int q = 0; q < QUANTITY_COUNT; q++)
+            {
+                if (m_state[i] == STATE_NONE)
+                {
+                    break;
+                }
+                const size_t begin = m_quantity_offset[q];
+                const size_t end = m_quantity_offset[q + 1];
+                fvs.emplace_back(m_fields[begin] + "_last", to_string(m_last[q][i]));
+                for (size_t f = begin + 1; f < end; f++)
+                {
+                    fvs.emplace_back(m_fields[f] + "_last", "0");
+                }
+            }
+            if (m_profile.fec_ber && m_fec_state[i] != STATE_NONE)
+            {
+                fvs.emplace_back(FEC_CORRECTED_BITS_LAST, to_string(m_fec_corrected[i]));
+                fvs.emplace_back(FEC_NOT_CORRECTABLE_LAST, to_string(m_fec_uncorrectable[i]));
+            }
+        }
+
+        if (!fvs.empty())
+        {
+            rates.set(m_keys[i], fvs);
+        }
+
+        if (written & WRITE_INIT_DONE)
+        {
+            rates.hset(m_keys[i] + state_suffix, "INIT_DONE",
+                       m_state[i] == STATE_DONE ? "DONE" : "COUNTERS_LAST");
+        }
+    }
+
+    m_pipeline.flush();
+}
+
+bool CounterRateEngine::getRates(sai_object_id_t oid, double &rx_bps, double &tx_bps,
+                                 double &rx_pps, double &tx_pps) const
+{
+    auto it = m_index.find(oid);
+    if (it == m_index.end() || m_state[it->second] != STATE_DONE)
+    {
+        return false;
+    }
+
+    rx_bps = m_rate[RX_OCTETS][it->second];
+    tx_bps = m_rate[TX_OCTETS][it->second];
+    rx_pps = m_rate[RX_PACKETS][it->second];
+    tx_pps = m_rate[TX_PACKETS][it->second];
+    return true;
+}
+
+bool CounterRateEngine::getBer(sai_object_id_t oid, double &pre_ber, double &post_ber, int &max_t) const
+{
+    auto it = m_index.find(oid);
+    if (it == m_index.end() || !(m_written[it->second] & WRITE_FEC))
+    {
+        return false;
+    }
+
+    pre_ber = m_pre_ber[it->second];
+    post_ber = m_post_ber[it->second];
+    max_t = m_max_t[it->second];
+    return true;
+}
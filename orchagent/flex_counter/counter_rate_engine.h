@@ -0,0 +1,160 @@
+#ifndef ORCHAGENT_COUNTER_RATE_ENGINE_H
+#define ORCHAGENT_COUNTER_RATE_ENGINE_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dbconnector.h"
+#include "redispipeline.h"
+
+extern "C" {
+#include "sai.h"
+}
+
+// CounterRateEngine computes the RATES entries of a counter group in
+// orchagent. It is the native counterpart of the port_rates.lua and
+// rif_rates.lua flex counter plugins, which run inside Redis on every poll.
+//
+// On every poll the counters of all objects are read with one pipelined
+// batch of HMGET, the rates are computed over per-object arrays, and the
+// results are written back with one pipelined batch. The field names match
+// the ones of the Lua plugins, including the "_last" snapshots, so the
+// consumers of the RATES table are unchanged and the plugins can take over
+// again at any time.
+//
+// The reads are pipelined on a connection owned by the engine, which is
+// dropped and opened again after any error so that no stale reply is left
+// behind. The interval follows the poll interval of the flex counter group.
+//
+// Only the port and RIF plugins are replaced. drop_monitor.lua detects
+// persistent drops from the CONFIG_DB debug counter settings and is not a
+// rate plugin. tunnel_rates.lua and trap_rates.lua run over a handful of
+// VXLAN tunnels and trap groups, where the per poll cost of the plugin is
+// negligible, so they are kept as they are.
+class CounterRateEngine
+{
+    public:
+        struct Profile
+        {
+            // Object type, configuration is read from RATES:<type>
+            // <type>_ALPHA and the state is kept in RATES:<oid>:<type>.
+            std::string type;
+            // Counters summed into each of the rated quantities.
+            std::vector<std::string> rx_octets;
+            std::vector<std::string> tx_octets;
+            std::vector<std::string> rx_packets;
+            std::vector<std::string> tx_packets;
+            // Compute FEC pre and post BER, ports only.
+            bool fec_ber;
+        };
+
+        static const Profile port_profile;
+        static const Profile rif_profile;
+
+        CounterRateEngine(swss::DBConnector *counters_db, const Profile &profile, uint32_t interval_ms);
+
+        CounterRateEngine(const CounterRateEngine&) = delete;
+        CounterRateEngine& operator=(const CounterRateEngine&) = delete;
+
+        void addObject(sai_object_id_t oid);
+        void removeObject(sai_object_id_t oid);
+        bool hasObject(sai_object_id_t oid) const;
+        size_t size() const { return m_oids.size(); }
+
+        // Poll interval of the counter group, used as the delta of the
+        // first poll.
+        void setInterval(uint32_t interval_ms) { m_interval_ms = interval_ms; }
+
+        // Lane count and speed (Mbps) used to compute the serdes rate of a
+        // port for BER.
+        void setLanes(sai_object_id_t oid, uint32_t lane_count, uint32_t speed);
+
+        // Reads the counters of all objects, updates the rates and writes
+        // them to COUNTERS_DB.
+        void poll();
+
+        // Counter fields read for each object, in sample order.
+        const std::vector<std::string>& fields() const { return m_fields; }
+
+        // Counters present in a sample row, bits of the valid flags
+        static constexpr uint8_t SAMPLE_RATES = 0x1;    // All the rated counters
+        static constexpr uint8_t SAMPLE_FEC = 0x2;      // Both FEC BER counters
+
+        // Updates the rates from one sample row of fields().size() values per
+        // object, in object order. The valid flags of a row tell which of its
+        // counters were read: rates are only updated from SAMPLE_RATES rows
+        // and BER from SAMPLE_FEC rows, as port_rates.lua skips the ports
+        // without FEC counters. Exposed for poll() and for unit tests.
+        void update(const std::vector<uint64_t> &samples, const std::vector<uint8_t> &valid,
+                    double delta_ms, bool has_alpha, double alpha);
+
+        // Computed values, for unit tests.
+        bool getRates(sai_object_id_t oid, double &rx_bps, double &tx_bps, double &rx_pps, double &tx_pps) const;
+        bool getBer(sai_object_id_t oid, double &pre_ber, double &post_ber, int &max_t) const;
+
+        // Serdes rate in bits per second of one lane, 0 if unknown.
+        static double serdesSpeed(uint32_t lane_count, uint32_t speed);
+
+    private:
+        enum Quantity
+        {
+            RX_OCTETS,
+            TX_OCTETS,
+            RX_PACKETS,
+            TX_PACKETS,
+            QUANTITY_COUNT
+        };
+
+        enum State : uint8_t
+        {
+            STATE_NONE,             // No counters seen yet
+            STATE_COUNTERS_LAST,    // Counters seen once, no rate yet
+            STATE_DONE              // Rates available
+        };
+
+        static constexpr int FEC_CODEWORD_BINS = 16;
+
+        bool readSamples(std::vector<uint64_t> &samples, std::vector<uint8_t> &valid);
+        void writeRates();
+        void resize(size_t count);
+
+        swss::DBConnector *m_db;
+        std::unique_ptr<swss::DBConnector> m_read_db;
+        swss::RedisPipeline m_pipeline;
+        Profile m_profile;
+        uint32_t m_interval_ms;
+        std::chrono::steady_clock::time_point m_last_poll;
+        bool m_polled = false;
+
+        std::vector<std::string> m_fields;
+        size_t m_quantity_offset[QUANTITY_COUNT + 1];
+        size_t m_fec_offset = 0;
+
+        // Per object arrays, index i describes m_oids[i].
+        std::vector<sai_object_id_t> m_oids;
+        std::vector<std::string> m_keys;
+        std::unordered_map<sai_object_id_t, size_t> m_index;
+        std::vector<uint8_t> m_state;
+        std::vector<uint8_t> m_written;
+        std::vector<uint64_t> m_last[QUANTITY_COUNT];
+        std::vector<double> m_rate[QUANTITY_COUNT];
+
+        std::vector<uint32_t> m_lane_count;
+        std::vector<double> m_serdes;
+        std::vector<uint8_t> m_fec_state;
+        std::vector<uint8_t> m_ber_seeded;
+        std::vector<uint64_t> m_last_fec_corrected;
+        std::vector<uint64_t> m_last_fec_uncorrectable;
+        std::vector<uint64_t> m_fec_corrected;
+        std::vector<uint64_t> m_fec_uncorrectable;
+        std::vector<double> m_pre_ber;
+        std::vector<double> m_post_ber;
+        std::vector<double> m_pre_ber_max;
+        std::vector<int> m_max_t;
+};
+
+#endif // ORCHAGENT_COUNTER_RATE_ENGINE_H
@@ -1,5 +1,6 @@
 #include "flex_counter_manager.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "schema.h"
@@ -58,6 +59,9 @@ const unordered_map<CounterType, string> FlexCounterManager::counter_id_field_lo
     { CounterType::HA_SET,              HA_SET_COUNTER_ID_LIST },
 };
 
+unordered_map<string, uint32_t> FlexCounterManager::interned_stats_ids;
+vector<string> FlexCounterManager::interned_stats;
+
 FlexManagerDirectory g_FlexManagerDirectory;
 
 FlexCounterManager *FlexManagerDirectory::createFlexCounterManager(const string& group_name,
@@ -94,6 +98,71 @@ FlexCounterManager *FlexManagerDirectory::createFlexCounterManager(const string&
     return fc_manager;
 }
 
+void FlexManagerDirectory::holdRegistrations()
+{
+    SWSS_LOG_ENTER();
+
+    m_hold_count++;
+}
+
+size_t FlexManagerDirectory::releaseRegistrations()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_hold_count == 0 || --m_hold_count > 0)
+    {
+        return 0;
+    }
+
+    auto deferred = std::move(m_deferred);
+    m_deferred.clear();
+    m_deferred_set.clear();
+
+    for (auto manager : deferred)
+    {
+        manager->flush();
+    }
+
+    return deferred.size();
+}
+
+void FlexManagerDirectory::deferFlush(FlexCounterCachedManager *manager)
+{
+    if (m_deferred_set.insert(manager).second)
+    {
+        m_deferred.push_back(manager);
+    }
+}
+
+void FlexManagerDirectory::cancelFlush(FlexCounterCachedManager *manager)
+{
+    if (m_deferred_set.erase(manager))
+    {
+        m_deferred.erase(std::remove(m_deferred.begin(), m_deferred.end(), manager), m_deferred.end());
+    }
+}
+
+FlexCounterCachedManager::~FlexCounterCachedManager()
+{
+    g_FlexManagerDirectory.cancelFlush(this);
+}
+
+void FlexCounterCachedManager::flush(const string &group_name, struct CachedObjects &cached_objects)
+{
+    if (cached_objects.pending_objects_map.empty())
+    {
+        return;
+    }
+
+    if (g_FlexManagerDirectory.isHoldingRegistrations())
+    {
+        g_FlexManagerDirectory.deferFlush(this);
+        return;
+    }
+
+    cached_objects.flush(group_name);
+}
+
 FlexCounterManager::FlexCounterManager(
         const string& group_name,
         const StatsMode stats_mode,
@@ -289,3 +358,51 @@ string FlexCounterManager::serializeCounterStats(
 
     return stats_string;
 }
+
+uint32_t FlexCounterManager::internCounterStats(
+        const unordered_set<string>& counter_stats)
+{
+    // Sets with the same stats are usually built the same way and iterate in
+    // the same order, so the list is first looked up as is.
+    auto stats_string = serializeCounterStats(counter_stats);
+    auto it = interned_stats_ids.find(stats_string);
+    if (it != interned_stats_ids.end())
+    {
+        return it->second;
+    }
+
+    vector<string> sorted_stats(counter_stats.begin(), counter_stats.end());
+    std::sort(sorted_stats.begin(), sorted_stats.end());
+
+    string sorted_string;
+    for (const auto& stat : sorted_stats)
+    {
+        sorted_string.append(stat);
+        sorted_string.append(",");
+    }
+    if (!sorted_string.empty())
+    {
+        sorted_string.pop_back();
+    }
+
+    auto sorted_it = interned_stats_ids.find(sorted_string);
+    uint32_t stats_id;
+    if (sorted_it != interned_stats_ids.end())
+    {
+        stats_id = sorted_it->second;
+    }
+    else
+    {
+        stats_id = static_cast<uint32_t>(interned_stats.size());
+        interned_stats.push_back(sorted_string);
+        interned_stats_ids.emplace(sorted_string, stats_id);
+    }
+
+    interned_stats_ids.emplace(std::move(stats_string), stats_id);
+    return stats_id;
+}
+
+const string& FlexCounterManager::getInternedCounterStats(const uint32_t stats_id)
+{
+    return interned_stats.at(stats_id);
+}
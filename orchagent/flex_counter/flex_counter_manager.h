@@ -5,6 +5,7 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include "dbconnector.h"
 #include "producertable.h"
 #include "table.h"
@@ -136,21 +137,34 @@ class FlexCounterManager
         static std::string serializeCounterStats(
                 const std::unordered_set<std::string>& counter_stats);
 
+        // Stat id lists are interned so that the cached managers key their
+        // pending objects by a small id, and serialize each distinct list
+        // once, instead of hashing the stat names of every object.
+        static uint32_t internCounterStats(
+                const std::unordered_set<std::string>& counter_stats);
+        static const std::string& getInternedCounterStats(const uint32_t stats_id);
+
         static const std::unordered_map<StatsMode, std::string> stats_mode_lookup;
         static const std::unordered_map<bool, std::string> status_lookup;
         static const std::unordered_map<CounterType, std::string> counter_id_field_lookup;
+
+    private:
+        // Serialized stat id list, in any order, to its id.
+        static std::unordered_map<std::string, uint32_t> interned_stats_ids;
+        // Id to the sorted serialized stat id list.
+        static std::vector<std::string> interned_stats;
 };
 
 struct CachedObjects
 {
     struct PendingMapKey
     {
-        std::unordered_set<std::string> counter_stats;
+        uint32_t counter_stats_id;
         CounterType counter_type;
         sai_object_id_t switch_id;
 
         bool operator==(const PendingMapKey& other) const {
-            return counter_stats == other.counter_stats &&
+            return counter_stats_id == other.counter_stats_id &&
                    counter_type == other.counter_type &&
                    switch_id == other.switch_id;
         }
@@ -159,9 +173,7 @@ struct CachedObjects
     struct PendingMapHash {
         size_t operator()(const PendingMapKey& key) const {
             size_t seed = 0;
-            std::vector<std::string> sorted_stats(key.counter_stats.begin(), key.counter_stats.end());
-            std::sort(sorted_stats.begin(), sorted_stats.end());
-            boost::hash_combine(seed, boost::hash_range(sorted_stats.begin(), sorted_stats.end()));
+            boost::hash_combine(seed, key.counter_stats_id);
             boost::hash_combine(seed, key.counter_type);
             boost::hash_combine(seed, key.switch_id);
             return seed;
@@ -175,7 +187,7 @@ struct CachedObjects
                    const std::unordered_set<std::string>& counter_stats,
                    sai_object_id_t switch_id)
     {
-        PendingMapKey key{counter_stats, counter_type, switch_id};
+        PendingMapKey key{FlexCounterManager::internCounterStats(counter_stats), counter_type, switch_id};
         pending_objects_map[key].emplace(object_id);
     }
 
@@ -188,7 +200,7 @@ struct CachedObjects
 
         for (const auto& entry : pending_objects_map)
         {
-            const auto& counter_stats = entry.first.counter_stats;
+            const auto& counter_stats_id = entry.first.counter_stats_id;
             const auto& counter_type = entry.first.counter_type;
             const auto& switch_id = entry.first.switch_id;
             const auto& pending_sai_objects = entry.second;
@@ -198,7 +210,7 @@ struct CachedObjects
                 continue;
             }
 
-            auto counter_ids = FlexCounterManager::serializeCounterStats(counter_stats);
+            const auto& counter_ids = FlexCounterManager::getInternedCounterStats(counter_stats_id);
             auto counter_type_it = FlexCounterManager::counter_id_field_lookup.find(counter_type);
 
             auto counter_keys = group_name + ":";
@@ -229,15 +241,16 @@ class FlexCounterCachedManager : public FlexCounterManager
         {
         }
 
+        virtual ~FlexCounterCachedManager();
+
         virtual void flush()
         {
         }
 
     protected:
-        void flush(const std::string &group_name, struct CachedObjects &cached_objects)
-        {
-            cached_objects.flush(group_name);
-        }
+        // Sends the cached registrations, or defers them while
+        // FlexManagerDirectory holds registrations.
+        void flush(const std::string &group_name, struct CachedObjects &cached_objects);
 
         void setCounterIdList(
             struct CachedObjects &cached_objects,
@@ -384,8 +397,32 @@ class FlexManagerDirectory
         FlexCounterManager* createFlexCounterManager(const std::string& group_name, const StatsMode stats_mode,
                                                      const uint polling_interval, const bool enabled,
                                                      swss::FieldValueTuple fv_plugin = std::make_pair("",""));
+
+        // While registrations are held, the flushes of all cached managers
+        // are deferred. The last releaseRegistrations() then flushes every
+        // deferred manager once, so each group gets one bulk registration
+        // per stat id list for the whole held period, e.g. the orchagent
+        // init phase. Holds nest.
+        void holdRegistrations();
+        // Returns the number of managers flushed.
+        size_t releaseRegistrations();
+        bool isHoldingRegistrations() const
+        {
+            return m_hold_count > 0;
+        }
+
+        void deferFlush(FlexCounterCachedManager *manager);
+        void cancelFlush(FlexCounterCachedManager *manager);
+
     private:
         std::unordered_map<std::string, FlexCounterManager*>  m_managers;
+
+        uint32_t m_hold_count = 0;
+        // Deferred managers in the order they first asked to flush.
+        std::vector<FlexCounterCachedManager*> m_deferred;
+        std::unordered_set<FlexCounterCachedManager*> m_deferred_set;
 };
 
+extern FlexManagerDirectory g_FlexManagerDirectory;
+
 #endif // ORCHAGENT_FLEX_COUNTER_MANAGER_H
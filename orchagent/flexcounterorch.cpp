@@ -171,6 +171,9 @@ void FlexCounterOrch::doTask(Consumer &consumer)
         return;
     }
 
+    // Groups enabled together register their objects in one flush per group
+    g_FlexManagerDirectory.holdRegistrations();
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -208,6 +211,14 @@ void FlexCounterOrch::doTask(Consumer &consumer)
                             setFlexCounterGroupPollInterval(flexCounterGroupMap[key], value, true);
                         }
                     }
+                    if (gPortsOrch && key == PORT_KEY)
+                    {
+                        gPortsOrch->setPortRatePollInterval(value);
+                    }
+                    if (gIntfsOrch && key == RIF_KEY)
+                    {
+                        gIntfsOrch->setRifRatePollInterval(value);
+                    }
                     // PORT_PHY_ATTR_KEY and PORT_PHY_SERDES_ATTR_KEY share the 'counterpoll phy' knob
                     if (key == PORT_PHY_ATTR_KEY)
                     {
@@ -284,6 +295,14 @@ void FlexCounterOrch::doTask(Consumer &consumer)
                     {
                         gIntfsOrch->generateInterfaceMap();
                     }
+                    if (gPortsOrch && key == PORT_KEY)
+                    {
+                        gPortsOrch->setPortRatePollEnabled(value == "enable");
+                    }
+                    if (gIntfsOrch && key == RIF_KEY)
+                    {
+                        gIntfsOrch->setRifRatePollEnabled(value == "enable");
+                    }
                     if (gBufferOrch && (key == BUFFER_POOL_WATERMARK_KEY) && (value == "enable"))
                     {
                         gBufferOrch->generateBufferPoolWatermarkCounterIdList();
@@ -414,6 +433,8 @@ void FlexCounterOrch::doTask(Consumer &consumer)
 
         consumer.m_toSync.erase(it++);
     }
+
+    g_FlexManagerDirectory.releaseRegistrations();
 }
 
 void FlexCounterOrch::doTask(SelectableTimer&)
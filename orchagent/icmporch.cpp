@@ -38,7 +38,8 @@ const std::map<std::string, sai_icmp_echo_session_state_t> IcmpOrch::m_session_s
 
 IcmpOrch::IcmpOrch(DBConnector *db, string tableName, TableConnector stateDbIcmpSessionTable):
     Orch(db, tableName),
-    m_stateIcmpSessionTable(stateDbIcmpSessionTable.first, stateDbIcmpSessionTable.second),
+    m_statePipeline(new RedisPipeline(stateDbIcmpSessionTable.first)),
+    m_stateIcmpSessionTable(m_statePipeline.get(), stateDbIcmpSessionTable.second, true),
     m_register_state_change_notif{false}
 {
     SWSS_LOG_ENTER();
@@ -73,6 +74,7 @@ IcmpOrch::IcmpOrch(DBConnector *db, string tableName, TableConnector stateDbIcmp
     {
         m_stateIcmpSessionTable.del(alias);
     }
+    m_stateIcmpSessionTable.flush();
 
     auto icmpStateNotifier = new Notifier(m_icmpStateNotificationConsumer, this, "ICMP_STATE_NOTIFICATIONS");
     Orch::addExecutor(icmpStateNotifier);
@@ -181,64 +183,69 @@ void IcmpOrch::doTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    m_stateIcmpSessionTable.flush();
 }
 
 void IcmpOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
-
-    consumer.pop(op, data, values);
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
 
     if (&consumer != m_icmpStateNotificationConsumer)
     {
         return;
     }
 
-    if (op == "icmp_echo_session_state_change")
+    // Drain all the pending notifications and handle only the last state
+    // of each session, a flapping session updates STATE_DB once per run
+    SaiOffloadStateBatch<sai_icmp_echo_api_t> batch;
+    for (auto& entry : entries)
     {
+        if (kfvOp(entry) != "icmp_echo_session_state_change")
+        {
+            continue;
+        }
+
         uint32_t count = 0;
         sai_icmp_echo_session_state_notification_t *icmpSessionState = nullptr;
 
-        sai_deserialize_icmp_echo_session_state_ntf(data, count, &icmpSessionState);
-
-        for (uint32_t i = 0; i < count; i++)
-        {
-            sai_object_id_t id = icmpSessionState[i].icmp_echo_session_id;
-            sai_icmp_echo_session_state_t state = icmpSessionState[i].session_state;
-
-            SWSS_LOG_INFO("Got ICMP session state change notification id:%" PRIx64 " state: %s", id, m_session_state_lkup.at(state).c_str());
+        sai_deserialize_icmp_echo_session_state_ntf(kfvKey(entry), count, &icmpSessionState);
+        batch.add(count, icmpSessionState);
+        sai_deserialize_free_icmp_echo_session_state_ntf(count, icmpSessionState);
+    }
 
-            if (m_icmp_session_lookup.find(id) == m_icmp_session_lookup.end())
-            {
-                SWSS_LOG_NOTICE("ICMP session missing for state change notification id:%" PRIx64 " state: %s", id, m_session_state_lkup.at(state).c_str());
-                continue;
-            }
+    for (const auto& session_state : batch.states())
+    {
+        sai_object_id_t id = session_state.first;
+        sai_icmp_echo_session_state_t state = session_state.second;
 
-            // handle state update
-            if (state != m_icmp_session_lookup[id].state || m_icmp_session_lookup[id].init_state)
-            {
-                auto key = m_icmp_session_lookup[id].db_key;
-                vector<FieldValueTuple> fvVector;
-                m_stateIcmpSessionTable.get(key, fvVector);
+        SWSS_LOG_INFO("Got ICMP session state change notification id:%" PRIx64 " state: %s", id, m_session_state_lkup.at(state).c_str());
 
-                fvVector.push_back({IcmpSaiSessionHandler::m_state_fname, m_session_state_lkup.at(state)});
+        auto lookup = m_icmp_session_lookup.find(id);
+        if (lookup == m_icmp_session_lookup.end())
+        {
+            SWSS_LOG_NOTICE("ICMP session missing for state change notification id:%" PRIx64 " state: %s", id, m_session_state_lkup.at(state).c_str());
+            continue;
+        }
 
-                m_stateIcmpSessionTable.set(key, fvVector);
+        // handle state update
+        auto& update = lookup->second;
+        if (state != update.state || update.init_state)
+        {
+            m_stateIcmpSessionTable.hset(update.db_key, IcmpSaiSessionHandler::m_state_fname, m_session_state_lkup.at(state));
 
-                SWSS_LOG_NOTICE("ICMP session state for %s changed from %s to %s", key.c_str(),
-                            m_session_state_lkup.at(m_icmp_session_lookup[id].state).c_str(), m_session_state_lkup.at(state).c_str());
+            SWSS_LOG_NOTICE("ICMP session state for %s changed from %s to %s", update.db_key.c_str(),
+                        m_session_state_lkup.at(update.state).c_str(), m_session_state_lkup.at(state).c_str());
 
-                m_icmp_session_lookup[id].state = state;
-                m_icmp_session_lookup[id].init_state = false;
-            }
+            update.state = state;
+            update.init_state = false;
         }
-
-        sai_deserialize_free_icmp_echo_session_state_ntf(count, icmpSessionState);
     }
+
+    m_stateIcmpSessionTable.flush();
 }
 
 bool IcmpOrch::create_icmp_session(const string& key, const vector<FieldValueTuple>& data)
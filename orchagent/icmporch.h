@@ -160,10 +160,12 @@ private:
     bool update_icmp_session(const string& key, const vector<FieldValueTuple>& data);
 
     // map of session key to session data cache
-    std::map<std::string, IcmpSessionDataCache> m_icmp_session_map;
+    std::unordered_map<std::string, IcmpSessionDataCache> m_icmp_session_map;
     // map of session object id to update data for handling notification from asic db 
-    std::map<sai_object_id_t, IcmpUpdate> m_icmp_session_lookup;
+    std::unordered_map<sai_object_id_t, IcmpUpdate> m_icmp_session_lookup;
 
+    // pipeline of the state table, flushed once per doTask run
+    std::unique_ptr<swss::RedisPipeline> m_statePipeline;
     // Icmp session state table produced by IcmpOrch
     swss::Table m_stateIcmpSessionTable;
 
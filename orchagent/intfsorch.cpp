@@ -18,6 +18,7 @@
 #include "directory.h"
 #include "vnetorch.h"
 #include "subscriberstatetable.h"
+#include "converter.h"
 
 extern sai_object_id_t gVirtualRouterId;
 extern Directory<Orch*> gDirectory;
@@ -39,6 +40,7 @@ extern string gMySwitchType;
 extern int32_t gVoqMySwitchId;
 extern RouteOrch *gRouteOrch;
 extern bool gTraditionalFlexCounter;
+extern bool gNativeCounterRates;
 extern bool isChassisDbInUse();
 
 const int IntfsOrch::intfsorch_pri = 35;
@@ -84,14 +86,26 @@ IntfsOrch::IntfsOrch(DBConnector *db, vector<table_name_with_pri_t> tableNames,
     string rifRatePluginName = "rif_rates.lua";
     string rifRateSha;
 
-    try
+    if (gNativeCounterRates)
     {
-        string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
-        rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+        m_rifRateEngine = make_unique<CounterRateEngine>(m_counter_db.get(), CounterRateEngine::rif_profile,
+                                                         stoi(RIF_FLEX_STAT_COUNTER_POLL_MSECS));
+        auto rateInterval = timespec { .tv_sec = stoi(RIF_FLEX_STAT_COUNTER_POLL_MSECS) / 1000, .tv_nsec = 0 };
+        m_rifRateTimer = new SelectableTimer(rateInterval);
+        /* Started once the RIF flex counter group is enabled */
+        Orch::addExecutor(new ExecutableTimer(m_rifRateTimer, this, "RIF_RATE_POLLER"));
     }
-    catch (const runtime_error &e)
+    else
     {
-        SWSS_LOG_WARN("RIF flex counter group plugins was not set successfully: %s", e.what());
+        try
+        {
+            string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
+            rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+        }
+        catch (const runtime_error &e)
+        {
+            SWSS_LOG_WARN("RIF flex counter group plugins was not set successfully: %s", e.what());
+        }
     }
 
     setFlexCounterGroupParameter(RIF_STAT_COUNTER_FLEX_COUNTER_GROUP,
@@ -1743,6 +1757,13 @@ void IntfsOrch::addRifToFlexCounter(const string &id, const string &name, const
     /* check the state of intf, if registering the intf to FC will result in runtime error */
     startFlexCounterPolling(gSwitchId, key, counters_str.c_str(), RIF_COUNTER_ID_LIST);
 
+    if (m_rifRateEngine)
+    {
+        sai_object_id_t rif_id;
+        sai_deserialize_object_id(id, rif_id);
+        m_rifRateEngine->addObject(rif_id);
+    }
+
     SWSS_LOG_DEBUG("Registered interface %s to Flex counter", name.c_str());
 }
 
@@ -1758,6 +1779,13 @@ void IntfsOrch::removeRifFromFlexCounter(const string &id, const string &name)
 
     stopFlexCounterPolling(gSwitchId, key);
 
+    if (m_rifRateEngine)
+    {
+        sai_object_id_t rif_id;
+        sai_deserialize_object_id(id, rif_id);
+        m_rifRateEngine->removeObject(rif_id);
+    }
+
     SWSS_LOG_DEBUG("Unregistered interface %s from Flex counter", name.c_str());
 }
 
@@ -1788,10 +1816,68 @@ bool IntfsOrch::updateSyncdIntfPfx(const string &alias, const IpPrefix &ip_prefi
     return false;
 }
 
+void IntfsOrch::setRifRatePollInterval(const string &interval_ms)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_rifRateEngine)
+    {
+        return;
+    }
+
+    uint32_t interval;
+    try
+    {
+        interval = to_uint<uint32_t>(interval_ms);
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid RIF rate poll interval %s: %s", interval_ms.c_str(), e.what());
+        return;
+    }
+
+    /* Follow the poll interval of the RIF flex counter group, as rif_rates.lua does */
+    m_rifRateEngine->setInterval(interval);
+    auto intervT = timespec { .tv_sec = static_cast<time_t>(interval / 1000),
+                              .tv_nsec = static_cast<long>(interval % 1000) * 1000000 };
+    m_rifRateTimer->setInterval(intervT);
+    if (m_rifRatePollEnabled)
+    {
+        m_rifRateTimer->reset();
+    }
+}
+
+void IntfsOrch::setRifRatePollEnabled(bool enabled)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_rifRateEngine || enabled == m_rifRatePollEnabled)
+    {
+        return;
+    }
+
+    /* Rates are only computed while the RIF flex counter group is polled, as with rif_rates.lua */
+    m_rifRatePollEnabled = enabled;
+    if (enabled)
+    {
+        m_rifRateTimer->start();
+    }
+    else
+    {
+        m_rifRateTimer->stop();
+    }
+}
+
 void IntfsOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    if (&timer == m_rifRateTimer)
+    {
+        m_rifRateEngine->poll();
+        return;
+    }
+
     SWSS_LOG_DEBUG("Registering %" PRId64 " new intfs", m_rifsToAdd.size());
     string value;
     for (auto it = m_rifsToAdd.begin(); it != m_rifsToAdd.end(); )
@@ -5,6 +5,7 @@
 #include "portsorch.h"
 #include "vrforch.h"
 #include "timer.h"
+#include "counter_rate_engine.h"
 
 #include "ipaddresses.h"
 #include "ipprefix.h"
@@ -55,6 +56,8 @@ public:
     std::set<IpPrefix> getSubnetRoutes();
 
     void generateInterfaceMap();
+    void setRifRatePollInterval(const string &interval_ms);
+    void setRifRatePollEnabled(bool enabled);
     void addRifToFlexCounter(const string&, const string&, const string&);
     void removeRifFromFlexCounter(const string&, const string&);
 
@@ -82,6 +85,11 @@ private:
     SelectableTimer* m_updateMapsTimer = nullptr;
     std::vector<Port> m_rifsToAdd;
 
+    /* RIF rates computed in orchagent instead of rif_rates.lua */
+    std::unique_ptr<CounterRateEngine> m_rifRateEngine;
+    SelectableTimer* m_rifRateTimer = nullptr;
+    bool m_rifRatePollEnabled = false;
+
     VRFOrch *m_vrfOrch;
     IntfsTable m_syncdIntfses;
     map<string, string> m_vnetInfses;
@@ -76,6 +76,22 @@ MirrorEntry::MirrorEntry(const string& platform) :
     nexthopInfo.nexthop = NextHopKey("0.0.0.0", alias);
 }
 
+// Keys of the objects a mirror session depends on
+static string ipDependency(const IpAddress& ip)
+{
+    return "IP|" + ip.to_string();
+}
+
+static string portDependency(const string& alias)
+{
+    return "PORT|" + alias;
+}
+
+static string macDependency(const MacAddress& mac)
+{
+    return "MAC|" + mac.to_string();
+}
+
 MirrorOrch::MirrorOrch(TableConnector stateDbConnector, TableConnector confDbConnector,
         PortsOrch *portOrch, RouteOrch *routeOrch, NeighOrch *neighOrch, FdbOrch *fdbOrch, PolicerOrch *policerOrch, SwitchOrch *switchOrch) :
         Orch(confDbConnector.first, confDbConnector.second),
@@ -504,6 +520,7 @@ task_process_status MirrorOrch::createEntry(const string& key, const vector<Fiel
     }
 
     m_syncdMirrors.emplace(key, entry);
+    indexSession(key, entry);
     setSessionState(key, entry);
 
     if (entry.type == MIRROR_SESSION_SPAN && !entry.dst_port.empty())
@@ -563,6 +580,8 @@ task_process_status MirrorOrch::deleteEntry(const string& name)
     }
 
     removeSessionState(name);
+    unindexSession(name);
+    m_dirtySessions.erase(name);
 
     m_syncdMirrors.erase(sessionIter);
 
@@ -575,18 +594,45 @@ void MirrorOrch::setSessionState(const string& name, const MirrorEntry& session,
 {
     SWSS_LOG_ENTER();
 
+    // Written once per session by flushSessionStates()
+    m_pendingSessionStates[name].insert(attr);
+}
+
+void MirrorOrch::flushSessionStates()
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& pending : m_pendingSessionStates)
+    {
+        auto sessionIter = m_syncdMirrors.find(pending.first);
+        if (sessionIter == m_syncdMirrors.end())
+        {
+            continue;
+        }
+
+        writeSessionState(pending.first, sessionIter->second, pending.second);
+    }
+
+    m_pendingSessionStates.clear();
+}
+
+void MirrorOrch::writeSessionState(const string& name, const MirrorEntry& session, const set<string>& attrs)
+{
+    SWSS_LOG_ENTER();
+
     SWSS_LOG_INFO("Update mirroring sessions %s state", name.c_str());
 
     vector<FieldValueTuple> fvVector;
     string value;
+    bool all = attrs.count("") != 0;
 
-    if (attr.empty() || attr == MIRROR_SESSION_STATUS)
+    if (all || attrs.count(MIRROR_SESSION_STATUS))
     {
         value = session.status ? MIRROR_SESSION_STATUS_ACTIVE : MIRROR_SESSION_STATUS_INACTIVE;
         fvVector.emplace_back(MIRROR_SESSION_STATUS, value);
     }
 
-    if (attr.empty() || attr == MIRROR_SESSION_MONITOR_PORT)
+    if (all || attrs.count(MIRROR_SESSION_MONITOR_PORT))
     {
         Port port;
         if ((gMySwitchType == "voq") && (session.type == MIRROR_SESSION_ERSPAN))
@@ -604,7 +650,7 @@ void MirrorOrch::setSessionState(const string& name, const MirrorEntry& session,
         fvVector.emplace_back(MIRROR_SESSION_MONITOR_PORT, port.m_alias);
     }
 
-    if (attr.empty() || attr == MIRROR_SESSION_DST_MAC_ADDRESS)
+    if (all || attrs.count(MIRROR_SESSION_DST_MAC_ADDRESS))
     {
         if ((gMySwitchType == "voq") && (session.type == MIRROR_SESSION_ERSPAN))
         {
@@ -616,19 +662,19 @@ void MirrorOrch::setSessionState(const string& name, const MirrorEntry& session,
         fvVector.emplace_back(MIRROR_SESSION_DST_MAC_ADDRESS, value);
     }
 
-    if (attr.empty() || attr == MIRROR_SESSION_ROUTE_PREFIX)
+    if (all || attrs.count(MIRROR_SESSION_ROUTE_PREFIX))
     {
         value = session.nexthopInfo.prefix.to_string();
         fvVector.emplace_back(MIRROR_SESSION_ROUTE_PREFIX, value);
     }
 
-    if (attr.empty() || attr == MIRROR_SESSION_VLAN_ID)
+    if (all || attrs.count(MIRROR_SESSION_VLAN_ID))
     {
         value = to_string(session.neighborInfo.port.m_vlan_info.vlan_id);
         fvVector.emplace_back(MIRROR_SESSION_VLAN_ID, value);
     }
 
-    if (attr.empty() || attr == MIRROR_SESSION_NEXT_HOP_IP)
+    if (all || attrs.count(MIRROR_SESSION_NEXT_HOP_IP))
     {
      value = session.nexthopInfo.nexthop.to_string();
      fvVector.emplace_back(MIRROR_SESSION_NEXT_HOP_IP, value);
@@ -641,9 +687,104 @@ void MirrorOrch::removeSessionState(const string& name)
 {
 	SWSS_LOG_ENTER();
 
+	m_pendingSessionStates.erase(name);
 	m_mirrorTable.del(name);
 }
 
+void MirrorOrch::indexSession(const string& name, const MirrorEntry& session)
+{
+    SWSS_LOG_ENTER();
+
+    vector<string> dependencies = { ipDependency(session.dstIp) };
+
+    if (!session.nexthopInfo.nexthop.ip_address.isZero())
+    {
+        dependencies.push_back(ipDependency(session.nexthopInfo.nexthop.ip_address));
+    }
+    if (!session.neighborInfo.port.m_alias.empty())
+    {
+        dependencies.push_back(portDependency(session.neighborInfo.port.m_alias));
+        dependencies.push_back(macDependency(session.neighborInfo.mac));
+    }
+    if (!session.src_port.empty())
+    {
+        for (const auto& alias : tokenize(session.src_port, ','))
+        {
+            dependencies.push_back(portDependency(alias));
+        }
+    }
+
+    unindexSession(name);
+
+    for (const auto& dependency : dependencies)
+    {
+        m_dependentSessions[dependency].insert(name);
+    }
+    m_sessionDependencies[name] = move(dependencies);
+}
+
+void MirrorOrch::unindexSession(const string& name)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_sessionDependencies.find(name);
+    if (it == m_sessionDependencies.end())
+    {
+        return;
+    }
+
+    for (const auto& dependency : it->second)
+    {
+        auto sessions = m_dependentSessions.find(dependency);
+        if (sessions == m_dependentSessions.end())
+        {
+            continue;
+        }
+
+        sessions->second.erase(name);
+        if (sessions->second.empty())
+        {
+            m_dependentSessions.erase(sessions);
+        }
+    }
+
+    m_sessionDependencies.erase(it);
+}
+
+vector<string> MirrorOrch::getDependentSessions(const string& dependency) const
+{
+    // Returned by value since handling the sessions may reindex them
+    auto it = m_dependentSessions.find(dependency);
+    if (it == m_dependentSessions.end())
+    {
+        return {};
+    }
+
+    return vector<string>(it->second.begin(), it->second.end());
+}
+
+void MirrorOrch::resolveSessions()
+{
+    SWSS_LOG_ENTER();
+
+    // A session updated by several next hop or neighbor changes in the same
+    // run is resolved and programmed only once, with the latest information
+    set<string> dirtySessions;
+    dirtySessions.swap(m_dirtySessions);
+
+    for (const auto& name : dirtySessions)
+    {
+        auto sessionIter = m_syncdMirrors.find(name);
+        if (sessionIter == m_syncdMirrors.end())
+        {
+            continue;
+        }
+
+        updateSession(name, sessionIter->second);
+        indexSession(name, sessionIter->second);
+    }
+}
+
 bool MirrorOrch::getNeighborInfo(const string& name, MirrorEntry& session)
 {
     SWSS_LOG_ENTER();
@@ -1294,10 +1435,9 @@ void MirrorOrch::updateNextHop(const NextHopUpdate& update)
 {
     SWSS_LOG_ENTER();
 
-    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    for (const auto& name : getDependentSessions(ipDependency(update.destination)))
     {
-        const auto& name = it->first;
-        auto& session = it->second;
+        auto& session = m_syncdMirrors.at(name);
 
         // Check if mirror session's destination IP is the update's destination IP
         if (session.dstIp != update.destination)
@@ -1365,9 +1505,10 @@ void MirrorOrch::updateNextHop(const NextHopUpdate& update)
         SWSS_LOG_NOTICE("Updated mirror session state db %s nexthop to %s",
                         name.c_str(), session.nexthopInfo.nexthop.to_string().c_str());
 
+        indexSession(name, session);
 
-        // Resolve the neighbor of the new next hop
-        updateSession(name, session);
+        // Resolve the neighbor of the new next hop once the run is over
+        m_dirtySessions.insert(name);
     }
 }
 
@@ -1377,10 +1518,9 @@ void MirrorOrch::updateNeighbor(const NeighborUpdate& update)
 {
     SWSS_LOG_ENTER();
 
-    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    for (const auto& name : getDependentSessions(ipDependency(update.entry.ip_address)))
     {
-        const auto& name = it->first;
-        auto& session = it->second;
+        const auto& session = m_syncdMirrors.at(name);
 
         // Check if the session's destination IP matches the neighbor's update IP
         // or if the session's next hop IP matches the neighbor's update IP
@@ -1393,7 +1533,7 @@ void MirrorOrch::updateNeighbor(const NeighborUpdate& update)
         SWSS_LOG_NOTICE("Updating mirror session %s with neighbor %s",
                 name.c_str(), update.entry.alias.c_str());
 
-        updateSession(name, session);
+        m_dirtySessions.insert(name);
     }
 }
 
@@ -1405,10 +1545,9 @@ void MirrorOrch::updateFdb(const FdbUpdate& update)
 {
     SWSS_LOG_ENTER();
 
-    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    for (const auto& name : getDependentSessions(macDependency(update.entry.mac)))
     {
-        const auto& name = it->first;
-        auto& session = it->second;
+        auto& session = m_syncdMirrors.at(name);
 
         // Check the following three conditions:
         // 1) mirror session is pointing to a VLAN
@@ -1456,10 +1595,10 @@ void MirrorOrch::updateLagMember(const LagMemberUpdate& update)
 {
     SWSS_LOG_ENTER();
 
-    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    // Covers both the sessions mirroring the LAG and the ones monitored through it
+    for (const auto& name : getDependentSessions(portDependency(update.lag.m_alias)))
     {
-        const auto& name = it->first;
-        auto& session = it->second;
+        auto& session = m_syncdMirrors.at(name);
 
         // Check the following conditions:
         // 1) Session is active
@@ -1542,10 +1681,9 @@ void MirrorOrch::updateVlanMember(const VlanMemberUpdate& update)
         return;
     }
 
-    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    for (const auto& name : getDependentSessions(portDependency(update.vlan.m_alias)))
     {
-        const auto& name = it->first;
-        auto& session = it->second;
+        auto& session = m_syncdMirrors.at(name);
 
         // Check the following three conditions:
         // 1) mirror session is pointing to a VLAN
@@ -1606,6 +1744,21 @@ void MirrorOrch::doTask(Consumer& consumer)
         }
     }
 
+    resolveSessions();
+    flushSessionStates();
+
     // Clear any recovery state that might be leftover from warm reboot
     m_recoverySessionMap.clear();
 }
+
+void MirrorOrch::doTask()
+{
+    SWSS_LOG_ENTER();
+
+    Orch::doTask();
+
+    // Sessions marked by the updates other orchs sent during this loop
+    // iteration are resolved here, once
+    resolveSessions();
+    flushSessionStates();
+}
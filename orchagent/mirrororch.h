@@ -16,6 +16,7 @@
 #include "table.h"
 
 #include <map>
+#include <set>
 #include <inttypes.h>
 
 #define MIRROR_RX_DIRECTION      "RX"
@@ -88,6 +89,7 @@ public:
     bool decreaseRefCount(const string&);
 
     using Orch::doTask;  // Allow access to the basic doTask
+    void doTask() override;
 
 private:
     PortsOrch *m_portsOrch;
@@ -105,6 +107,17 @@ private:
     // session_name -> VLAN | monitor_port_alias | next_hop_ip
     map<string, string> m_recoverySessionMap;
 
+    // Objects a session depends on (destination and next hop IP, neighbor
+    // port and MAC, source ports) -> session names, used to find the sessions
+    // affected by an update without walking all the sessions
+    map<string, set<string>> m_dependentSessions;
+    // session_name -> objects the session is indexed under
+    map<string, vector<string>> m_sessionDependencies;
+    // Sessions to resolve again once the current run is over
+    set<string> m_dirtySessions;
+    // session_name -> StateDB fields to write, empty field for all fields
+    map<string, set<string>> m_pendingSessionStates;
+
     bool isHwResourcesAvailable();
 
     task_process_status createEntry(const string&, const vector<FieldValueTuple>&);
@@ -123,6 +136,15 @@ private:
      */
     void setSessionState(const std::string& name, const MirrorEntry& session, const std::string& attr = "");
     void removeSessionState(const std::string& name);
+    // Writes the pending session states, one StateDB write per session
+    void flushSessionStates();
+    void writeSessionState(const std::string& name, const MirrorEntry& session, const std::set<std::string>& attrs);
+
+    void indexSession(const string&, const MirrorEntry&);
+    void unindexSession(const string&);
+    vector<string> getDependentSessions(const string& dependency) const;
+    // Resolves the sessions marked dirty by the updates of the current run
+    void resolveSessions();
 
     bool getNeighborInfo(const string&, MirrorEntry&);
 
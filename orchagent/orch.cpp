@@ -17,6 +17,8 @@ using namespace swss;
 int gBatchSize = 0;
 
 std::shared_ptr<RingBuffer> Orch::gRingBuffer = nullptr;
+std::unordered_map<std::string, object_reference_list> Orch::m_objectReferenceLists;
+std::list<std::string> Orch::m_objectReferenceListsLru;
 std::shared_ptr<RingBuffer> Executor::gRingBuffer = nullptr;
 
 RingBuffer::RingBuffer(int size): buffer(size)
@@ -699,7 +701,7 @@ bool Orch::bake()
 - both type_name and object_name are cleared to empty strings as an
 - indication to the caller of the special case
 */
-bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &type_name, string &object_name)
+bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &type_name, string &object_name, referenced_object **object)
 {
     SWSS_LOG_ENTER();
 
@@ -727,7 +729,7 @@ bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &typ
         SWSS_LOG_ERROR("not recognized type:%s\n", type_name.c_str());
         return false;
     }
-    auto obj_map = type_maps[type_name];
+    auto &obj_map = type_it->second;
     auto obj_it = obj_map->find(ref_in);
     if (obj_it == obj_map->end())
     {
@@ -740,6 +742,10 @@ bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &typ
         return false;
     }
     object_name = ref_in;
+    if (object)
+    {
+        *object = &obj_it->second;
+    }
     SWSS_LOG_DEBUG("parsed: type_name:%s, object_name:%s", type_name.c_str(), object_name.c_str());
     return true;
 }
@@ -766,7 +772,8 @@ ref_resolve_status Orch::resolveFieldRefValue(
                 return ref_resolve_status::multiple_instances;
             }
             string object_name;
-            if (!parseReference(type_maps, fvValue(*i), ref_type_name, object_name))
+            referenced_object *object = nullptr;
+            if (!parseReference(type_maps, fvValue(*i), ref_type_name, object_name, &object))
             {
                 return ref_resolve_status::not_resolved;
             }
@@ -774,7 +781,7 @@ ref_resolve_status Orch::resolveFieldRefValue(
             {
                 return ref_resolve_status::empty;
             }
-            sai_object = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
+            sai_object = object->m_saiObjectId;
             referenced_object_name = ref_type_name + delimiter + object_name;
             hit = true;
         }
@@ -795,19 +802,19 @@ void Orch::removeMeFromObjsReferencedByMe(
     const string &old_referenced_obj_name,
     bool remove_field)
 {
-    vector<string> objects = tokenize(old_referenced_obj_name, list_item_delimiter);
-    for (auto &obj : objects)
+    for (auto &ref : getObjectReferences(old_referenced_obj_name))
     {
         // obj_name references token
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &ref_obj_name = tokens[1];
-        auto &old_referenced_obj = (*type_maps[referenced_table])[ref_obj_name];
-        old_referenced_obj.m_objsDependingOnMe.erase(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %s)",
+        auto old_referenced_obj = findReferencedObject(type_maps, ref);
+        if (old_referenced_obj == nullptr)
+        {
+            continue;
+        }
+        old_referenced_obj->m_objsDependingOnMe.erase(obj_name);
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
-                      referenced_table.c_str(), ref_obj_name.c_str(),
-                      to_string(old_referenced_obj.m_objsDependingOnMe.size()).c_str());
+                      ref.m_table.c_str(), ref.m_name.c_str(),
+                      old_referenced_obj->m_objsDependingOnMe.size());
     }
 
     if (remove_field)
@@ -833,19 +840,73 @@ void Orch::setObjectReference(
     obj.m_objsReferencingByMe[field] = referenced_obj;
 
     // Add the reference to the new object being referenced
-    vector<string> objs = tokenize(referenced_obj, list_item_delimiter);
-    for (auto &obj : objs)
+    for (auto &ref : getObjectReferences(referenced_obj))
     {
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &referenced_obj_name = tokens[1];
-        auto &new_obj_being_referenced = (*type_maps[referenced_table])[referenced_obj_name];
+        auto table_it = type_maps.find(ref.m_table);
+        if (table_it == type_maps.end() || !table_it->second)
+        {
+            SWSS_LOG_ERROR("Obj %s.%s Field %s: not recognized type %s",
+                           table.c_str(), obj_name.c_str(), field.c_str(), ref.m_table.c_str());
+            continue;
+        }
+        auto &new_obj_being_referenced = (*table_it->second)[ref.m_name];
         new_obj_being_referenced.m_objsDependingOnMe.insert(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %s)",
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
-                      referenced_table.c_str(), referenced_obj_name.c_str(),
-                      to_string(new_obj_being_referenced.m_objsDependingOnMe.size()).c_str());
+                      ref.m_table.c_str(), ref.m_name.c_str(),
+                      new_obj_being_referenced.m_objsDependingOnMe.size());
+    }
+}
+
+referenced_object *Orch::findReferencedObject(type_map &type_maps, const object_reference &ref)
+{
+    auto table_it = type_maps.find(ref.m_table);
+    if (table_it == type_maps.end() || !table_it->second)
+    {
+        return nullptr;
+    }
+
+    auto obj_it = table_it->second->find(ref.m_name);
+    if (obj_it == table_it->second->end())
+    {
+        return nullptr;
+    }
+
+    return &obj_it->second;
+}
+
+const vector<object_reference>& Orch::getObjectReferences(const string &references)
+{
+    auto list_it = m_objectReferenceLists.find(references);
+    if (list_it != m_objectReferenceLists.end())
+    {
+        m_objectReferenceListsLru.splice(m_objectReferenceListsLru.begin(),
+                                         m_objectReferenceListsLru, list_it->second.m_lru);
+        return list_it->second.m_refs;
+    }
+
+    if (m_objectReferenceLists.size() >= OBJECT_REFERENCE_LISTS_MAX)
+    {
+        m_objectReferenceLists.erase(m_objectReferenceListsLru.back());
+        m_objectReferenceListsLru.pop_back();
     }
+
+    vector<object_reference> refs;
+    for (auto &obj : tokenize(references, list_item_delimiter))
+    {
+        auto tokens = tokenize(obj, delimiter);
+        if (tokens.size() < 2)
+        {
+            SWSS_LOG_ERROR("malformed reference:%s", obj.c_str());
+            continue;
+        }
+
+        refs.push_back({tokens[0], tokens[1]});
+    }
+
+    m_objectReferenceListsLru.push_front(references);
+    object_reference_list list = {std::move(refs), m_objectReferenceListsLru.begin()};
+    return m_objectReferenceLists.emplace(references, std::move(list)).first->second.m_refs;
 }
 
 bool Orch::doesObjectExist(
@@ -898,7 +959,8 @@ bool Orch::isObjectBeingReferenced(
     const string &table,
     const string &obj_name)
 {
-    return !(*type_maps[table])[obj_name].m_objsDependingOnMe.empty();
+    auto obj = findReferencedObject(type_maps, {table, obj_name});
+    return obj != nullptr && !obj->m_objsDependingOnMe.empty();
 }
 
 string Orch::objectReferenceInfo(
@@ -1008,12 +1070,13 @@ ref_resolve_status Orch::resolveFieldRefArray(
             }
             for (size_t ind = 0; ind < list_items.size(); ind++)
             {
-                if (!parseReference(type_maps, list_items[ind], ref_type_name, object_name))
+                referenced_object *object = nullptr;
+                if (!parseReference(type_maps, list_items[ind], ref_type_name, object_name, &object))
                 {
                     SWSS_LOG_NOTICE("Failed to parse profile reference:%s\n", list_items[ind].c_str());
                     return ref_resolve_status::not_resolved;
                 }
-                sai_object_id_t sai_obj = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
+                sai_object_id_t sai_obj = object ? object->m_saiObjectId : SAI_NULL_OBJECT_ID;
                 SWSS_LOG_DEBUG("Resolved to sai_object:0x%" PRIx64 ", type:%s, name:%s", sai_obj, ref_type_name.c_str(), object_name.c_str());
                 sai_object_arr.push_back(sai_obj);
                 if (!object_name_list.empty())
@@ -3,8 +3,10 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <list>
 #include <map>
 #include <set>
+#include <vector>
 #include <memory>
 #include <utility>
 #include <condition_variable>
@@ -56,6 +58,9 @@ const char state_db_key_delimiter  = '|';
 #define RING_SIZE 30
 #define SLEEP_MSECONDS 500
 
+/* Distinct reference lists cached, the least recently used one is evicted beyond */
+#define OBJECT_REFERENCE_LISTS_MAX 65536
+
 const int default_orch_pri = 0;
 
 typedef enum
@@ -83,6 +88,21 @@ typedef struct
 typedef std::map<std::string, referenced_object> object_reference_map;
 typedef std::map<std::string, std::shared_ptr<object_reference_map>> type_map;
 
+// Object referenced by name with table name, "<table>:<name>", split once.
+typedef struct
+{
+    std::string m_table;
+    std::string m_name;
+} object_reference;
+
+// Parsed reference list, "<table>:<name>,...", with its position in the
+// least recently used order.
+typedef struct
+{
+    std::vector<object_reference> m_refs;
+    std::list<std::string>::iterator m_lru;
+} object_reference_list;
+
 typedef std::map<std::string, sai_object_id_t> object_map;
 typedef std::pair<std::string, sai_object_id_t> object_map_pair;
 
@@ -371,7 +391,7 @@ protected:
     unsigned long generateBitMapFromIdsStr(const std::string &idsStr);
     bool isItemIdsMapContinuous(unsigned long idsMap, sai_uint32_t maxId);
     bool parseIndexRange(const std::string &input, sai_uint32_t &range_low, sai_uint32_t &range_high);
-    bool parseReference(type_map &type_maps, std::string &ref, const std::string &table_name, std::string &object_name);
+    bool parseReference(type_map &type_maps, std::string &ref, const std::string &table_name, std::string &object_name, referenced_object **object = nullptr);
     ref_resolve_status resolveFieldRefArray(type_map&, const std::string&, const std::string&, swss::KeyOpFieldsValuesTuple&, std::vector<sai_object_id_t>&, std::string&);
     void setObjectReference(type_map&, const std::string&, const std::string&, const std::string&, const std::string&);
     bool doesObjectExist(type_map&, const std::string&, const std::string&, const std::string&, std::string&);
@@ -380,6 +400,14 @@ protected:
     std::string objectReferenceInfo(type_map&, const std::string&, const std::string&);
     void removeMeFromObjsReferencedByMe(type_map &type_maps, const std::string &table, const std::string &obj_name, const std::string &field, const std::string &old_referenced_obj_name, bool remove_field=true);
 
+    /*
+     * Reference lists, "<table>:<name>,...", are parsed once and cached, up to
+     * OBJECT_REFERENCE_LISTS_MAX lists. Setting and removing references then
+     * walks the parsed list instead of tokenizing the joined names on every
+     * call. The returned list stays valid until the next call.
+     */
+    static const std::vector<object_reference>& getObjectReferences(const std::string &references);
+
     /* Note: consumer will be owned by this class */
     void addExecutor(Executor* executor);
     Executor *getExecutor(std::string executorName);
@@ -387,6 +415,10 @@ protected:
     ResponsePublisher m_publisher{"APPL_STATE_DB"};
 private:
     void addConsumer(swss::DBConnector *db, std::string tableName, int pri = default_orch_pri);
+    static referenced_object *findReferencedObject(type_map &type_maps, const object_reference &ref);
+
+    static std::unordered_map<std::string, object_reference_list> m_objectReferenceLists;
+    static std::list<std::string> m_objectReferenceListsLru;
 };
 
 #include "request_parser.h"
@@ -23,6 +23,8 @@ using namespace swss;
 
 /* select() function timeout retry time */
 #define SELECT_TIMEOUT 1000
+#define FLEX_COUNTER_HOLD_MAX_SEC 300
+#define FLEX_COUNTER_REGISTRATION_TABLE "FLEX_COUNTER_REGISTRATION_TABLE"
 #define PFC_WD_POLL_MSECS 100
 
 #define APP_FABRIC_MONITOR_PORT_TABLE_NAME      "FABRIC_PORT_TABLE"
@@ -985,6 +987,10 @@ void OrchDaemon::start(long heartBeatInterval)
 
     auto tstart = std::chrono::high_resolution_clock::now();
 
+    g_FlexManagerDirectory.holdRegistrations();
+    m_flexCounterHeld = true;
+    m_flexCounterHoldTime = std::chrono::steady_clock::now();
+
     while (true)
     {
         Selectable *s;
@@ -1023,6 +1029,8 @@ void OrchDaemon::start(long heartBeatInterval)
                 SWSS_LOG_ERROR("%s", orchHealthError.c_str());
             }
 
+            checkFlexCounterRegistrations(false);
+
             flush();
         }
 
@@ -1039,6 +1047,8 @@ void OrchDaemon::start(long heartBeatInterval)
 
         if (ret == Select::TIMEOUT)
         {
+            checkFlexCounterRegistrations(true);
+
             /* Let sairedis to flush all SAI function call to ASIC DB.
              * Normally the redis pipeline will flush when enough request
              * accumulated. Still it is possible that small amount of
@@ -1119,6 +1129,7 @@ void OrchDaemon::start(long heartBeatInterval)
                     }
 
                     // Flush sairedis's redis pipeline
+                    releaseFlexCounterRegistrations();
                     flush();
 
                     SWSS_LOG_WARN("Orchagent is frozen for warm restart!");
@@ -1129,6 +1140,65 @@ void OrchDaemon::start(long heartBeatInterval)
     }
 }
 
+/*
+ * The flex counter registrations of the init phase are sent together once
+ * the ports are initialized and orchagent has nothing left to do, or after
+ * FLEX_COUNTER_HOLD_MAX_SEC if it never gets there.
+ */
+void OrchDaemon::checkFlexCounterRegistrations(bool idle)
+{
+    if (!m_flexCounterHeld)
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (!m_portInitDoneSeen && (!gPortsOrch || gPortsOrch->isInitDone()))
+    {
+        m_portInitDoneSeen = true;
+        m_portInitDoneTime = now;
+    }
+
+    if ((idle && m_portInitDoneSeen) ||
+        (now - m_flexCounterHoldTime >= std::chrono::seconds(FLEX_COUNTER_HOLD_MAX_SEC)))
+    {
+        releaseFlexCounterRegistrations();
+    }
+}
+
+void OrchDaemon::releaseFlexCounterRegistrations()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_flexCounterHeld)
+    {
+        return;
+    }
+
+    m_flexCounterHeld = false;
+    auto managers = g_FlexManagerDirectory.releaseRegistrations();
+
+    auto now = std::chrono::steady_clock::now();
+    auto since = m_portInitDoneSeen ? m_portInitDoneTime : m_flexCounterHoldTime;
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(now - since).count();
+
+    SWSS_LOG_NOTICE("Sent held flex counter registrations of %zu groups, %lld ms after port init",
+                    managers, static_cast<long long>(delay));
+
+    if (m_stateDb == nullptr)
+    {
+        return;
+    }
+
+    Table registrationTable(m_stateDb, FLEX_COUNTER_REGISTRATION_TABLE);
+    registrationTable.set("init", {
+        { "groups", std::to_string(managers) },
+        { "port_init_done", m_portInitDoneSeen ? "true" : "false" },
+        { "port_init_to_registration_ms", std::to_string(delay) }
+    });
+}
+
 /*
  * Try to perform orchagent state restore and dynamic states sync up if
  * warm start request is detected.
@@ -132,8 +132,18 @@ protected:
     Select *m_select;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHeartBeat;
 
+    // Flex counter registrations are held from start() until orchagent goes
+    // idle after port init, see releaseFlexCounterRegistrations()
+    bool m_flexCounterHeld = false;
+    std::chrono::steady_clock::time_point m_flexCounterHoldTime;
+    std::chrono::steady_clock::time_point m_portInitDoneTime;
+    bool m_portInitDoneSeen = false;
+
     void flush();
 
+    void checkFlexCounterRegistrations(bool idle);
+    void releaseFlexCounterRegistrations();
+
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent, long interval);
 
     void freezeAndHeartBeat(unsigned int duration, long interval);
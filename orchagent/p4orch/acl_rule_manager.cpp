@@ -583,41 +583,39 @@ ReturnCodeOr<P4AclRuleAppDbEntry> AclRuleManager::deserializeAclRuleAppDbEntry(
     app_db_entry.acl_table_name = acl_table_name;
     app_db_entry.db_key = concatTableNameAndRuleKey(acl_table_name, key);
     // Parse rule key : match fields and priority
-    try
+    const auto rule_key = P4KeyDecoder::decode(key);
+    if (rule_key == nullptr)
     {
-        const auto &rule_key_json = nlohmann::json::parse(key);
-        if (!rule_key_json.is_object())
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
+    }
+    for (const auto &rule_key_field : rule_key->fields())
+    {
+        if (rule_key_field.name == kPriority)
         {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid ACL rule key: should be a JSON object.";
+            uint64_t priority;
+            if (!rule_key->getUnsigned(kPriority, priority))
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Invalid ACL rule priority type: should be uint32_t";
+            }
+            app_db_entry.priority = static_cast<uint32_t>(priority);
+            continue;
         }
-        for (auto rule_key_it = rule_key_json.begin(); rule_key_it != rule_key_json.end(); ++rule_key_it)
+        else
         {
-            if (rule_key_it.key() == kPriority)
+            const auto &tokenized_match_field = tokenize(rule_key_field.name, kFieldDelimiter);
+            if (tokenized_match_field.size() <= 1 || tokenized_match_field[0] != kMatchPrefix)
             {
-                if (!rule_key_it.value().is_number_unsigned())
-                {
-                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                           << "Invalid ACL rule priority type: should be uint32_t";
-                }
-                app_db_entry.priority = rule_key_it.value();
-                continue;
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Unknown ACL match field string " << QuotedVar(rule_key_field.name);
             }
-            else
+            if (!rule_key_field.is_string)
             {
-                const auto &tokenized_match_field = tokenize(rule_key_it.key(), kFieldDelimiter);
-                if (tokenized_match_field.size() <= 1 || tokenized_match_field[0] != kMatchPrefix)
-                {
-                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                           << "Unknown ACL match field string " << QuotedVar(rule_key_it.key());
-                }
-                app_db_entry.match_fvs[tokenized_match_field[1]] = rule_key_it.value();
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
             }
+            app_db_entry.match_fvs[tokenized_match_field[1]] = rule_key_field.value;
         }
     }
-    catch (std::exception &e)
-    {
-        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
-    }
 
     for (const auto &it : attributes)
     {
@@ -1,7 +1,6 @@
 #include "p4orch/gre_tunnel_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -326,12 +325,8 @@ ReturnCodeOr<P4GreTunnelAppDbEntry> GreTunnelManager::deserializeP4GreTunnelAppD
     app_db_entry.encap_src_ip = swss::IpAddress("0.0.0.0");
     app_db_entry.encap_dst_ip = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.tunnel_id = j[prependMatchField(p4orch::kTunnelId)];
-    }
-    catch (std::exception &ex)
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr || !match_key->getMatchField(p4orch::kTunnelId, app_db_entry.tunnel_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize GRE tunnel id";
     }
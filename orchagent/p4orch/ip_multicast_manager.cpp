@@ -1,7 +1,6 @@
 #include "p4orch/ip_multicast_manager.h"
 
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -413,30 +412,28 @@ IpMulticastManager::deserializeIpMulticastEntry(
     const std::string& table_name) {
   SWSS_LOG_ENTER();
   P4IpMulticastEntry ip_multicast_entry = {};
-  try {
-    nlohmann::json j = nlohmann::json::parse(key);
-    ip_multicast_entry.vrf_id = j[prependMatchField(p4orch::kVrfId)];
+  const auto match_key = P4KeyDecoder::decode(key);
+  if (match_key == nullptr ||
+      !match_key->getMatchField(p4orch::kVrfId, ip_multicast_entry.vrf_id)) {
+    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+           << "Failed to deserialize IP multicast table key";
+  }
 
-    std::string ip_dst;
-    if (table_name == APP_P4RT_IPV4_MULTICAST_TABLE_NAME) {
-      if (j.find(prependMatchField(p4orch::kIpv4Dst)) != j.end()) {
-        ip_dst = j[prependMatchField(p4orch::kIpv4Dst)];
-      }
-    } else {
-      if (j.find(prependMatchField(p4orch::kIpv6Dst)) != j.end()) {
-        ip_dst = j[prependMatchField(p4orch::kIpv6Dst)];
-      }
-    }
-    try {
-      ip_multicast_entry.ip_dst = swss::IpAddress(ip_dst);
-    } catch (std::exception& ex) {
-      return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-             << "Invalid IP address " << QuotedVar(ip_dst);
-    }
-  } catch (std::exception& ex) {
+  std::string ip_dst;
+  const std::string dst_field =
+      (table_name == APP_P4RT_IPV4_MULTICAST_TABLE_NAME) ? p4orch::kIpv4Dst
+                                                         : p4orch::kIpv6Dst;
+  if (match_key->findMatchField(dst_field) != nullptr &&
+      !match_key->getMatchField(dst_field, ip_dst)) {
     return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
            << "Failed to deserialize IP multicast table key";
   }
+  try {
+    ip_multicast_entry.ip_dst = swss::IpAddress(ip_dst);
+  } catch (std::exception& ex) {
+    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+           << "Invalid IP address " << QuotedVar(ip_dst);
+  }
 
   ip_multicast_entry.ip_multicast_entry_key =
       KeyGenerator::generateIpMulticastKey(ip_multicast_entry.vrf_id,
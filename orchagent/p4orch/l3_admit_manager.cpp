@@ -1,7 +1,6 @@
 #include "p4orch/l3_admit_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -172,13 +171,22 @@ ReturnCodeOr<P4L3AdmitAppDbEntry> L3AdmitManager::deserializeP4L3AdmitAppDbEntry
 
     P4L3AdmitAppDbEntry app_db_entry = {};
 
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr)
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
+    }
+
     try
     {
-        nlohmann::json j = nlohmann::json::parse(key);
         // "match/dst_mac":"00:02:03:04:00:00&ff:ff:ff:ff:00:00"
-        if (j.find(prependMatchField(p4orch::kDstMac)) != j.end())
+        if (match_key->findMatchField(p4orch::kDstMac) != nullptr)
         {
-            std::string dst_mac_data_and_mask = j[prependMatchField(p4orch::kDstMac)];
+            std::string dst_mac_data_and_mask;
+            if (!match_key->getMatchField(p4orch::kDstMac, dst_mac_data_and_mask))
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
+            }
             const auto &data_and_mask = swss::tokenize(dst_mac_data_and_mask, p4orch::kDataMaskDelimiter);
             app_db_entry.mac_address_data = swss::MacAddress(trim(data_and_mask[0]));
             if (data_and_mask.size() > 1)
@@ -198,18 +206,22 @@ ReturnCodeOr<P4L3AdmitAppDbEntry> L3AdmitManager::deserializeP4L3AdmitAppDbEntry
         }
 
         // "priority":2030
-        auto priority_j = j[p4orch::kPriority];
-        if (!priority_j.is_number_unsigned())
+        uint64_t priority;
+        if (!match_key->getUnsigned(p4orch::kPriority, priority))
         {
             return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
                    << "Invalid l3 admit entry priority type: should be uint32_t";
         }
-        app_db_entry.priority = static_cast<uint32_t>(priority_j);
+        app_db_entry.priority = static_cast<uint32_t>(priority);
 
         // "match/in_port":"Ethernet0"
-        if (j.find(prependMatchField(p4orch::kInPort)) != j.end())
+        if (match_key->findMatchField(p4orch::kInPort) != nullptr)
 	{
-		std::string in_port = j[prependMatchField(p4orch::kInPort)];
+		std::string in_port;
+		if (!match_key->getMatchField(p4orch::kInPort, in_port)) {
+			return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+				<< "Failed to deserialize l3 admit key";
+		}
 		swss::Port port;
 		if (!gPortsOrch->getPort(in_port, port)) {
 			return ReturnCode(StatusCode::SWSS_RC_NOT_FOUND)
@@ -221,7 +233,7 @@ ReturnCodeOr<P4L3AdmitAppDbEntry> L3AdmitManager::deserializeP4L3AdmitAppDbEntry
 				<< " is not physical and is not supported for "
 				"L3 Admit entry.";
 		}
-		app_db_entry.port_name = j[prependMatchField(p4orch::kInPort)];
+		app_db_entry.port_name = in_port;
 	}
     }
     catch (std::exception &ex)
@@ -622,13 +622,14 @@ L3MulticastManager::deserializeMulticastRouterInterfaceEntry(
   SWSS_LOG_ENTER();
 
   P4MulticastRouterInterfaceEntry router_interface_entry = {};
-  try {
-    nlohmann::json j = nlohmann::json::parse(key);
-    router_interface_entry.multicast_replica_port =
-        j[prependMatchField(p4orch::kMulticastReplicaPort)];
-    router_interface_entry.multicast_replica_instance =
-        j[prependMatchField(p4orch::kMulticastReplicaInstance)];
-  } catch (std::exception& ex) {
+  const auto match_key = P4KeyDecoder::decode(key);
+  if (match_key == nullptr ||
+      !match_key->getMatchField(
+          p4orch::kMulticastReplicaPort,
+          router_interface_entry.multicast_replica_port) ||
+      !match_key->getMatchField(
+          p4orch::kMulticastReplicaInstance,
+          router_interface_entry.multicast_replica_instance)) {
     return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
            << "Failed to deserialize multicast router interface table key";
   }
@@ -1,7 +1,6 @@
 #include "p4orch/mirror_session_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 
 #include "SaiAttributeList.h"
 #include "dbconnector.h"
@@ -26,22 +25,22 @@ ReturnCode MirrorSessionManager::getSaiObject(const std::string &json_key, sai_o
 {
     std::string value;
 
-    try
+    const auto match_key = P4KeyDecoder::decode(json_key);
+    if (match_key == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kMirrorSessionId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kMirrorSessionId)).get<std::string>();
-            object_key = KeyGenerator::generateMirrorSessionKey(value);
-            object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+    }
+    else if (match_key->findMatchField(p4orch::kMirrorSessionId) == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
     }
-    catch (std::exception &ex)
+    else if (match_key->getMatchField(p4orch::kMirrorSessionId, value))
+    {
+        object_key = KeyGenerator::generateMirrorSessionKey(value);
+        object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
+        return ReturnCode();
+    }
+    else
     {
         SWSS_LOG_ERROR("json_key parse error");
     }
@@ -194,12 +193,8 @@ ReturnCodeOr<P4MirrorSessionAppDbEntry> MirrorSessionManager::deserializeP4Mirro
 
     P4MirrorSessionAppDbEntry app_db_entry = {};
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.mirror_session_id = j[prependMatchField(p4orch::kMirrorSessionId)];
-    }
-    catch (std::exception &ex)
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr || !match_key->getMatchField(p4orch::kMirrorSessionId, app_db_entry.mirror_session_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize mirror session id";
     }
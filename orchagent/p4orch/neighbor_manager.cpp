@@ -1,6 +1,5 @@
 #include "p4orch/neighbor_manager.h"
 
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -84,13 +83,10 @@ ReturnCodeOr<P4NeighborAppDbEntry> NeighborManager::deserializeNeighborEntry(
 
     P4NeighborAppDbEntry app_db_entry = {};
     std::string ip_address;
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_intf_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-        ip_address = j[prependMatchField(p4orch::kNeighborId)];
-    }
-    catch (std::exception &ex)
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr ||
+        !match_key->getMatchField(p4orch::kRouterInterfaceId, app_db_entry.router_intf_id) ||
+        !match_key->getMatchField(p4orch::kNeighborId, ip_address))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize key";
     }
@@ -408,35 +404,39 @@ ReturnCode NeighborManager::getSaiObject(const std::string &json_key, sai_object
     std::string router_intf_id, neighbor_id;
     swss::IpAddress neighbor;
 
-    try
+    const auto match_key = P4KeyDecoder::decode(json_key);
+    if (match_key == nullptr)
+    {
+        SWSS_LOG_ERROR("json_key parse error");
+    }
+    else if (match_key->findMatchField(p4orch::kRouterInterfaceId) == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
+                       p4orch::kRouterInterfaceId);
+    }
+    else if (match_key->findMatchField(p4orch::kNeighborId) == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNeighborId);
+    }
+    else if (!match_key->getMatchField(p4orch::kRouterInterfaceId, router_intf_id) ||
+             !match_key->getMatchField(p4orch::kNeighborId, neighbor_id))
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kRouterInterfaceId)) != j.end())
+        SWSS_LOG_ERROR("json_key parse error");
+    }
+    else
+    {
+        try
         {
-            router_intf_id = j.at(prependMatchField(p4orch::kRouterInterfaceId)).get<std::string>();
-            if (j.find(prependMatchField(p4orch::kNeighborId)) != j.end())
-            {
-                neighbor_id = j.at(prependMatchField(p4orch::kNeighborId)).get<std::string>();
-                neighbor = swss::IpAddress(neighbor_id);
-                object_key = KeyGenerator::generateNeighborKey(router_intf_id, neighbor);
-                object_type = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY;
-                return ReturnCode();
-            }
-            else
-            {
-                SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNeighborId);
-            }
+            neighbor = swss::IpAddress(neighbor_id);
+            object_key = KeyGenerator::generateNeighborKey(router_intf_id, neighbor);
+            object_type = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY;
+            return ReturnCode();
         }
-        else
+        catch (std::exception &ex)
         {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
-                           p4orch::kRouterInterfaceId);
+            SWSS_LOG_ERROR("json_key parse error");
         }
     }
-    catch (std::exception &ex)
-    {
-        SWSS_LOG_ERROR("json_key parse error");
-    }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
 }
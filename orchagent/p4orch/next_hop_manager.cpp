@@ -1,6 +1,5 @@
 #include "p4orch/next_hop_manager.h"
 
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -265,22 +264,22 @@ ReturnCode NextHopManager::getSaiObject(const std::string &json_key, sai_object_
 {
     std::string value;
 
-    try
+    const auto match_key = P4KeyDecoder::decode(json_key);
+    if (match_key == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kNexthopId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kNexthopId)).get<std::string>();
-            object_key = KeyGenerator::generateNextHopKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+    }
+    else if (match_key->findMatchField(p4orch::kNexthopId) == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
+    }
+    else if (match_key->getMatchField(p4orch::kNexthopId, value))
+    {
+        object_key = KeyGenerator::generateNextHopKey(value);
+        object_type = SAI_OBJECT_TYPE_NEXT_HOP;
+        return ReturnCode();
     }
-    catch (std::exception &ex)
+    else
     {
         SWSS_LOG_ERROR("json_key parse error");
     }
@@ -419,12 +418,8 @@ ReturnCodeOr<P4NextHopAppDbEntry> NextHopManager::deserializeP4NextHopAppDbEntry
     P4NextHopAppDbEntry app_db_entry = {};
     app_db_entry.neighbor_id = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.next_hop_id = j[prependMatchField(p4orch::kNexthopId)];
-    }
-    catch (std::exception &ex)
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr || !match_key->getMatchField(p4orch::kNexthopId, app_db_entry.next_hop_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize next hop id";
     }
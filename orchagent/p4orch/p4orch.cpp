@@ -1,6 +1,8 @@
 #include "p4orch.h"
 #include "../notificationconsumerstatsorch.h"
 
+#include <algorithm>
+#include <cassert>
 #include <map>
 #include <memory>
 #include <string>
@@ -19,6 +21,7 @@
 #include "p4orch/neighbor_manager.h"
 #include "p4orch/next_hop_manager.h"
 #include "p4orch/p4orch_util.h"
+#include "p4orch/response_sequencer.h"
 #include "p4orch/route_manager.h"
 #include "p4orch/router_interface_manager.h"
 #include "p4orch/tables_definition_manager.h"
@@ -40,28 +43,29 @@ P4Orch::P4Orch(swss::DBConnector* db, std::vector<std::string> tableNames,
               /*dbPersistence=*/false),
       m_zmqServer(zmqServer),
       m_publisher("APPL_DB", /*bool buffered=*/true,
-                  /*db_write_thread=*/true, zmqServer)
+                  /*db_write_thread=*/true, zmqServer),
+      m_responseSequencer(&m_publisher)
 {
     SWSS_LOG_ENTER();
 
-    m_tablesDefnManager = std::make_unique<TablesDefnManager>(&m_p4OidMapper, &m_publisher);
-    m_routerIntfManager = std::make_unique<RouterInterfaceManager>(&m_p4OidMapper, &m_publisher);
-    m_neighborManager = std::make_unique<NeighborManager>(&m_p4OidMapper, &m_publisher);
-    m_greTunnelManager = std::make_unique<GreTunnelManager>(&m_p4OidMapper, &m_publisher);
-    m_nextHopManager = std::make_unique<NextHopManager>(&m_p4OidMapper, &m_publisher);
+    m_tablesDefnManager = std::make_unique<TablesDefnManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_routerIntfManager = std::make_unique<RouterInterfaceManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_neighborManager = std::make_unique<NeighborManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_greTunnelManager = std::make_unique<GreTunnelManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_nextHopManager = std::make_unique<NextHopManager>(&m_p4OidMapper, &m_responseSequencer);
     m_l3MulticastManager = std::make_unique<p4orch::L3MulticastManager>(
-        &m_p4OidMapper, vrfOrch, &m_publisher);
+        &m_p4OidMapper, vrfOrch, &m_responseSequencer);
     m_ipMulticastManager = std::make_unique<p4orch::IpMulticastManager>(
-        &m_p4OidMapper, vrfOrch, &m_publisher);
-    m_routeManager = std::make_unique<RouteManager>(&m_p4OidMapper, vrfOrch, &m_publisher);
-    m_mirrorSessionManager = std::make_unique<p4orch::MirrorSessionManager>(&m_p4OidMapper, &m_publisher);
-    m_aclTableManager = std::make_unique<p4orch::AclTableManager>(&m_p4OidMapper, &m_publisher);
-    m_aclRuleManager = std::make_unique<p4orch::AclRuleManager>(&m_p4OidMapper, vrfOrch, coppOrch, &m_publisher);
-    m_wcmpManager = std::make_unique<p4orch::WcmpManager>(&m_p4OidMapper, &m_publisher);
-    m_l3AdmitManager = std::make_unique<L3AdmitManager>(&m_p4OidMapper, &m_publisher);
+        &m_p4OidMapper, vrfOrch, &m_responseSequencer);
+    m_routeManager = std::make_unique<RouteManager>(&m_p4OidMapper, vrfOrch, &m_responseSequencer);
+    m_mirrorSessionManager = std::make_unique<p4orch::MirrorSessionManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_aclTableManager = std::make_unique<p4orch::AclTableManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_aclRuleManager = std::make_unique<p4orch::AclRuleManager>(&m_p4OidMapper, vrfOrch, coppOrch, &m_responseSequencer);
+    m_wcmpManager = std::make_unique<p4orch::WcmpManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_l3AdmitManager = std::make_unique<L3AdmitManager>(&m_p4OidMapper, &m_responseSequencer);
     m_tunnelDecapGroupManager =
-        std::make_unique<TunnelDecapGroupManager>(&m_p4OidMapper, &m_publisher);
-    m_extTablesManager = std::make_unique<ExtTablesManager>(&m_p4OidMapper, vrfOrch, &m_publisher);
+        std::make_unique<TunnelDecapGroupManager>(&m_p4OidMapper, &m_responseSequencer);
+    m_extTablesManager = std::make_unique<ExtTablesManager>(&m_p4OidMapper, vrfOrch, &m_responseSequencer);
 
     m_p4TableToManagerMap[APP_P4RT_TABLES_DEFINITION_TABLE_NAME] = m_tablesDefnManager.get();
     m_p4TableToManagerMap[APP_P4RT_ROUTER_INTERFACE_TABLE_NAME] = m_routerIntfManager.get();
@@ -162,55 +166,57 @@ void P4Orch::doTask(ConsumerBase &consumer)
         return;
     }   
 
-    std::string prev_op = "";
-    ObjectManagerInterface* prev_manager = nullptr;
-    std::string p4rt_table_name;
-    ReturnCode status;
-    for (const auto& kco : zmq_consumer->m_queue) {
-        std::string op = kfvOp(kco);
-
-    ObjectManagerInterface* manager = findManager(kfvKey(kco), p4rt_table_name);
-    if (manager == nullptr) {
-      status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-               << "Failed to find P4Orch Manager for key " << kfvKey(kco);
-      SWSS_LOG_ERROR("%s", status.message().c_str());
-      m_publisher.publish(APP_P4RT_TABLE_NAME, kfvKey(kco),
-                          kfvFieldsValues(kco), status, /*replace=*/true);
-      continue;
-    }
-    if (!status.ok()) {
-      m_publisher.publish(
-          APP_P4RT_TABLE_NAME, kfvKey(kco), kfvFieldsValues(kco),
-          ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED), /*replace=*/true);
-      continue;
-    }
-    if (prev_op.empty()) {
-      prev_op = op;
-    }
-    if (prev_manager == nullptr) {
-      prev_manager = manager;
+  // Plan the batch: split it into runs of the same operation and, within a
+  // run, group the entries per manager. Each group is drained once, following
+  // the referential precedence of the managers (add precedence for SET, the
+  // reverse for DEL). Responses are released in request order.
+  m_responseSequencer.begin();
+  ReturnCode status;
+  std::vector<bool> touched(m_p4ManagerAddPrecedence.size(), false);
+  auto it = zmq_consumer->m_queue.begin();
+  while (it != zmq_consumer->m_queue.end()) {
+    const std::string op = kfvOp(*it);
+    std::fill(touched.begin(), touched.end(), false);
+    for (; it != zmq_consumer->m_queue.end() && kfvOp(*it) == op; ++it) {
+      const auto& kco = *it;
+      m_responseSequencer.expect(kfvKey(kco));
+      std::string p4rt_table_name;
+      ObjectManagerInterface* manager =
+          findManager(kfvKey(kco), p4rt_table_name);
+      if (manager == nullptr) {
+        ReturnCode invalid = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                             << "Failed to find P4Orch Manager for key "
+                             << kfvKey(kco);
+        SWSS_LOG_ERROR("%s", invalid.message().c_str());
+        m_responseSequencer.publish(APP_P4RT_TABLE_NAME, kfvKey(kco),
+                                    kfvFieldsValues(kco), invalid,
+                                    /*replace=*/true);
+        continue;
+      }
+      if (!status.ok()) {
+        m_responseSequencer.publish(
+            APP_P4RT_TABLE_NAME, kfvKey(kco), kfvFieldsValues(kco),
+            ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED), /*replace=*/true);
+        continue;
+      }
+      manager->enqueue(p4rt_table_name, kco);
+      touched[getManagerPrecedence(manager)] = true;
     }
 
-        // Call drain after grouping the same type of requests together.
-    if (op != prev_op || prev_manager != manager) {
-      status = prev_manager->drain();
-            prev_op = op; 
-      prev_manager = manager;
-        }
-
-        if (status.ok()) {
-      prev_manager->enqueue(p4rt_table_name, kco);
-        } else {
-           m_publisher.publish(APP_P4RT_TABLE_NAME, kfvKey(kco),
-                               kfvFieldsValues(kco),
-                               ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED),
-                               /*replace=*/true);
-      prev_manager = nullptr;
-        }
+    const size_t count = m_p4ManagerAddPrecedence.size();
+    for (size_t i = 0; i < count; i++) {
+      const size_t idx = (op == DEL_COMMAND) ? count - 1 - i : i;
+      if (!touched[idx]) {
+        continue;
+      }
+      if (status.ok()) {
+        status = m_p4ManagerAddPrecedence[idx]->drain();
+      } else {
+        m_p4ManagerAddPrecedence[idx]->drainWithNotExecuted();
+      }
     }
-  if (prev_manager != nullptr) {
-    prev_manager->drain();
-    }   
+  }
+  m_responseSequencer.end();
     m_publisher.flush();
     zmq_consumer->m_queue.clear();
 }
@@ -268,6 +274,13 @@ void P4Orch::enqueue(const swss::KeyOpFieldsValuesTuple& entry) {
   }
 }
 
+size_t P4Orch::getManagerPrecedence(ObjectManagerInterface* manager) const {
+  auto it = std::find(m_p4ManagerAddPrecedence.begin(),
+                      m_p4ManagerAddPrecedence.end(), manager);
+  assert(it != m_p4ManagerAddPrecedence.end());
+  return static_cast<size_t>(it - m_p4ManagerAddPrecedence.begin());
+}
+
 ReturnCode P4Orch::drain() {
   ReturnCode status;
   for (const auto& manager : m_p4ManagerAddPrecedence) {
@@ -22,6 +22,7 @@
 #include "p4orch/next_hop_manager.h"
 #include "p4orch/object_manager_interface.h"
 #include "p4orch/p4oidmapper.h"
+#include "p4orch/response_sequencer.h"
 #include "p4orch/route_manager.h"
 #include "p4orch/router_interface_manager.h"
 #include "p4orch/tables_definition_manager.h"
@@ -72,6 +73,8 @@ class P4Orch : public ZmqOrch
                                         std::string& table_name);
     void enqueue(const swss::KeyOpFieldsValuesTuple& entry);
     ReturnCode drain();
+    // Position of the manager in m_p4ManagerAddPrecedence.
+    size_t getManagerPrecedence(ObjectManagerInterface* manager) const;
     void handlePortStatusChangeNotification(const std::string &op, const std::string &data);
 
     // P4 object manager request processing order.
@@ -105,6 +108,9 @@ class P4Orch : public ZmqOrch
     swss::ZmqServer* m_zmqServer;
     // Sepcial publisher that writes to APPL DB instead of APPL STATE DB.
     ResponsePublisher m_publisher;
+    // Front end of m_publisher used by the managers, keeps the responses of a
+    // reordered batch in request order.
+    p4orch::ResponseSequencer m_responseSequencer;
 
     friend class P4OrchTest;
     friend class p4orch::test::WcmpManagerTest;
@@ -1,8 +1,14 @@
 #include "p4orch/p4orch_util.h"
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <iomanip>
+#include <list>
+#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "p4orch/p4orch.h"
 #include "schema.h"
@@ -118,6 +124,306 @@ ActionInfo *getTableActionInfo(TableInfo *table, const std::string &action_name)
     return &it->second;
 }
 
+namespace
+{
+
+// Memoized P4RT keys. When the cache is full, the least recently decoded key
+// is evicted.
+struct P4KeyCache
+{
+    struct Entry
+    {
+        std::shared_ptr<const P4MatchKey> match_key;
+        std::list<std::string>::iterator lru_it;
+    };
+
+    // Most recently decoded key first.
+    std::list<std::string> lru;
+    std::unordered_map<std::string, Entry> entries;
+};
+
+P4KeyCache &p4KeyCache()
+{
+    static P4KeyCache cache;
+    return cache;
+}
+
+bool isJsonSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+void skipJsonSpace(const std::string &str, size_t &pos)
+{
+    while (pos < str.size() && isJsonSpace(str[pos]))
+    {
+        pos++;
+    }
+}
+
+// Scans a JSON string without escape sequences starting at the opening quote.
+// Sets [begin, end) to the string content and advances pos past the closing
+// quote.
+bool scanPlainJsonString(const std::string &str, size_t &pos, size_t &begin, size_t &end)
+{
+    if (pos >= str.size() || str[pos] != '"')
+    {
+        return false;
+    }
+    begin = ++pos;
+    while (pos < str.size())
+    {
+        char c = str[pos];
+        if (c == '"')
+        {
+            end = pos++;
+            return true;
+        }
+        if (c == '\\' || static_cast<unsigned char>(c) < 0x20)
+        {
+            return false;
+        }
+        pos++;
+    }
+    return false;
+}
+
+bool isUnsignedJsonNumber(const std::string &str)
+{
+    if (str.empty() || (str.size() > 1 && str[0] == '0'))
+    {
+        return false;
+    }
+    for (char c : str)
+    {
+        if (c < '0' || c > '9')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void P4MatchKey::addField(std::string name, std::string value, bool is_string)
+{
+    // Later duplicates override earlier ones, as in the generic JSON parser.
+    for (auto &field : m_fields)
+    {
+        if (field.name == name)
+        {
+            field.value = std::move(value);
+            field.is_string = is_string;
+            return;
+        }
+    }
+    m_fields.push_back(Field{std::move(name), std::move(value), is_string});
+}
+
+const P4MatchKey::Field *P4MatchKey::find(const std::string &name) const
+{
+    for (const auto &field : m_fields)
+    {
+        if (field.name == name)
+        {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+const P4MatchKey::Field *P4MatchKey::findMatchField(const std::string &name) const
+{
+    const size_t prefix_len = strlen(p4orch::kMatchPrefix);
+    for (const auto &field : m_fields)
+    {
+        if (field.name.size() == prefix_len + 1 + name.size() &&
+            field.name.compare(0, prefix_len, p4orch::kMatchPrefix) == 0 &&
+            field.name[prefix_len] == p4orch::kFieldDelimiter &&
+            field.name.compare(prefix_len + 1, std::string::npos, name) == 0)
+        {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+bool P4MatchKey::getMatchField(const std::string &name, std::string &value) const
+{
+    const auto *field = findMatchField(name);
+    if (field == nullptr || !field->is_string)
+    {
+        return false;
+    }
+    value = field->value;
+    return true;
+}
+
+bool P4MatchKey::getUnsigned(const std::string &name, uint64_t &value) const
+{
+    const auto *field = find(name);
+    if (field == nullptr || field->is_string || !isUnsignedJsonNumber(field->value))
+    {
+        return false;
+    }
+    errno = 0;
+    value = strtoull(field->value.c_str(), nullptr, 10);
+    return errno == 0;
+}
+
+std::shared_ptr<const P4MatchKey> P4KeyDecoder::decode(const std::string &key)
+{
+    auto &cache = p4KeyCache();
+    auto it = cache.entries.find(key);
+    if (it != cache.entries.end())
+    {
+        cache.lru.splice(cache.lru.begin(), cache.lru, it->second.lru_it);
+        return it->second.match_key;
+    }
+
+    auto match_key = std::make_shared<P4MatchKey>();
+    if (!scan(key, *match_key))
+    {
+        match_key = std::make_shared<P4MatchKey>();
+        if (!parse(key, *match_key))
+        {
+            return nullptr;
+        }
+    }
+
+    if (cache.entries.size() >= kMaxCachedKeys)
+    {
+        cache.entries.erase(cache.lru.back());
+        cache.lru.pop_back();
+    }
+    cache.lru.push_front(key);
+    cache.entries.emplace(key, P4KeyCache::Entry{match_key, cache.lru.begin()});
+    return match_key;
+}
+
+void P4KeyDecoder::clearCache()
+{
+    auto &cache = p4KeyCache();
+    cache.entries.clear();
+    cache.lru.clear();
+}
+
+size_t P4KeyDecoder::cacheSize()
+{
+    return p4KeyCache().entries.size();
+}
+
+// Decodes a flat object of plain strings and unsigned integers. Returns false
+// for anything else, which is then left to the generic parser.
+bool P4KeyDecoder::scan(const std::string &key, P4MatchKey &match_key)
+{
+    size_t pos = 0;
+    skipJsonSpace(key, pos);
+    if (pos >= key.size() || key[pos++] != '{')
+    {
+        return false;
+    }
+    skipJsonSpace(key, pos);
+    if (pos < key.size() && key[pos] == '}')
+    {
+        pos++;
+        skipJsonSpace(key, pos);
+        return pos == key.size();
+    }
+
+    while (true)
+    {
+        size_t name_begin, name_end;
+        skipJsonSpace(key, pos);
+        if (!scanPlainJsonString(key, pos, name_begin, name_end))
+        {
+            return false;
+        }
+        skipJsonSpace(key, pos);
+        if (pos >= key.size() || key[pos++] != ':')
+        {
+            return false;
+        }
+        skipJsonSpace(key, pos);
+        if (pos >= key.size())
+        {
+            return false;
+        }
+
+        std::string name = key.substr(name_begin, name_end - name_begin);
+        if (key[pos] == '"')
+        {
+            size_t value_begin, value_end;
+            if (!scanPlainJsonString(key, pos, value_begin, value_end))
+            {
+                return false;
+            }
+            match_key.addField(std::move(name), key.substr(value_begin, value_end - value_begin), true);
+        }
+        else
+        {
+            size_t value_begin = pos;
+            while (pos < key.size() && key[pos] >= '0' && key[pos] <= '9')
+            {
+                pos++;
+            }
+            std::string value = key.substr(value_begin, pos - value_begin);
+            if (!isUnsignedJsonNumber(value))
+            {
+                return false;
+            }
+            match_key.addField(std::move(name), std::move(value), false);
+        }
+
+        skipJsonSpace(key, pos);
+        if (pos >= key.size())
+        {
+            return false;
+        }
+        char c = key[pos++];
+        if (c == '}')
+        {
+            break;
+        }
+        if (c != ',')
+        {
+            return false;
+        }
+    }
+
+    skipJsonSpace(key, pos);
+    return pos == key.size();
+}
+
+bool P4KeyDecoder::parse(const std::string &key, P4MatchKey &match_key)
+{
+    try
+    {
+        const auto &j = nlohmann::json::parse(key);
+        if (!j.is_object())
+        {
+            return false;
+        }
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            if (it.value().is_string())
+            {
+                match_key.addField(it.key(), it.value().get<std::string>(), true);
+            }
+            else
+            {
+                match_key.addField(it.key(), it.value().dump(), false);
+            }
+        }
+    }
+    catch (std::exception &ex)
+    {
+        return false;
+    }
+    return true;
+}
+
 std::string KeyGenerator::generateTablesInfoKey(const std::string &context)
 {
     std::map<std::string, std::string> fv_map = {{"context", context}};
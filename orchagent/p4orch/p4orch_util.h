@@ -3,6 +3,7 @@
 #include <deque>
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -392,6 +393,71 @@ void drainMgmtWithNotExecuted(std::deque<swss::KeyOpFieldsValuesTuple>& entries,
 // Helper function to parse an int or hex int from a string to a bool.
 ReturnCodeOr<bool> parseFlag(const std::string& name, const std::string& value);
 
+// P4MatchKey holds the decoded fields of a P4RT APP DB key. The key is a flat
+// JSON object, e.g.
+// {"match/vrf_id":"b4-traffic","match/ipv4_dst":"10.11.12.0/24","priority":10}
+class P4MatchKey
+{
+  public:
+    struct Field
+    {
+        std::string name;
+        // The string value, or the JSON text if the value is not a string.
+        std::string value;
+        bool is_string;
+    };
+
+    // Returns the field with the given name, or nullptr if it is absent.
+    const Field *find(const std::string &name) const;
+
+    // Returns the "match/<name>" field, or nullptr if it is absent.
+    const Field *findMatchField(const std::string &name) const;
+
+    // Gets the string value of the "match/<name>" field.
+    // Returns false if the field is absent or its value is not a string.
+    bool getMatchField(const std::string &name, std::string &value) const;
+
+    // Gets the value of a non-negative integer field, e.g. "priority".
+    // Returns false if the field is absent or is not an unsigned integer.
+    bool getUnsigned(const std::string &name, uint64_t &value) const;
+
+    const std::vector<Field> &fields() const
+    {
+        return m_fields;
+    }
+
+  private:
+    friend class P4KeyDecoder;
+
+    void addField(std::string name, std::string value, bool is_string);
+
+    std::vector<Field> m_fields;
+};
+
+// P4KeyDecoder is the shared decoder of P4RT APP DB keys for all P4 Orch
+// managers. Keys in the common flat format are decoded by a single pass
+// scanner without building a JSON document; anything else (escaped strings,
+// nested values) falls back to the generic JSON parser. Decoded keys are
+// memoized, so deserialization, dependency lookups and state verification of
+// an entry decode its key only once.
+class P4KeyDecoder
+{
+  public:
+    // Upper bound of memoized keys, the least recently decoded key is evicted
+    // when it is reached.
+    static constexpr size_t kMaxCachedKeys = 65536;
+
+    // Returns the decoded key, or nullptr if the key is not a JSON object.
+    static std::shared_ptr<const P4MatchKey> decode(const std::string &key);
+
+    static void clearCache();
+    static size_t cacheSize();
+
+  private:
+    static bool scan(const std::string &key, P4MatchKey &match_key);
+    static bool parse(const std::string &key, P4MatchKey &match_key);
+};
+
 // class KeyGenerator includes member functions to generate keys for entries
 // stored in P4 Orch managers.
 class KeyGenerator
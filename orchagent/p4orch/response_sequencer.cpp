@@ -0,0 +1,106 @@
+#include "p4orch/response_sequencer.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace p4orch {
+
+ResponseSequencer::ResponseSequencer(ResponsePublisherInterface* publisher)
+    : m_publisher(publisher) {}
+
+void ResponseSequencer::begin() {
+  m_active = true;
+  m_order.clear();
+  m_held.clear();
+  m_heldByKey.clear();
+}
+
+void ResponseSequencer::expect(const std::string& key) {
+  if (m_active) {
+    m_order.push_back(key);
+  }
+}
+
+void ResponseSequencer::end() {
+  if (!m_active) {
+    return;
+  }
+  m_active = false;
+
+  for (const auto& key : m_order) {
+    auto it = m_heldByKey.find(key);
+    if (it == m_heldByKey.end() || it->second.empty()) {
+      continue;
+    }
+    release(m_held[it->second.front()]);
+    it->second.pop_front();
+  }
+
+  for (auto& response : m_held) {
+    if (!response.published) {
+      release(response);
+    }
+  }
+
+  m_order.clear();
+  m_held.clear();
+  m_heldByKey.clear();
+}
+
+void ResponseSequencer::publish(
+    const std::string& table, const std::string& key,
+    const std::vector<swss::FieldValueTuple>& intent_attrs,
+    const ReturnCode& status,
+    const std::vector<swss::FieldValueTuple>& state_attrs, bool replace) {
+  if (!m_active) {
+    m_publisher->publish(table, key, intent_attrs, status, state_attrs,
+                         replace);
+    return;
+  }
+  hold(Response{table, key, intent_attrs, status, state_attrs,
+                /*has_state_attrs=*/true, replace});
+}
+
+void ResponseSequencer::publish(
+    const std::string& table, const std::string& key,
+    const std::vector<swss::FieldValueTuple>& intent_attrs,
+    const ReturnCode& status, bool replace) {
+  if (!m_active) {
+    m_publisher->publish(table, key, intent_attrs, status, replace);
+    return;
+  }
+  hold(Response{table, key, intent_attrs, status, {},
+                /*has_state_attrs=*/false, replace});
+}
+
+void ResponseSequencer::writeToDB(
+    const std::string& table, const std::string& key,
+    const std::vector<swss::FieldValueTuple>& values, const std::string& op,
+    bool replace) {
+  m_publisher->writeToDB(table, key, values, op, replace);
+}
+
+void ResponseSequencer::setEnableDbWriteAndNotify(
+    bool enable_db_write_and_notify) {
+  m_publisher->setEnableDbWriteAndNotify(enable_db_write_and_notify);
+}
+
+void ResponseSequencer::hold(Response response) {
+  m_heldByKey[response.key].push_back(m_held.size());
+  m_held.push_back(std::move(response));
+}
+
+void ResponseSequencer::release(Response& response) {
+  if (response.has_state_attrs) {
+    m_publisher->publish(response.table, response.key, response.intent_attrs,
+                         response.status, response.state_attrs,
+                         response.replace);
+  } else {
+    m_publisher->publish(response.table, response.key, response.intent_attrs,
+                         response.status, response.replace);
+  }
+  response.published = true;
+}
+
+}  // namespace p4orch
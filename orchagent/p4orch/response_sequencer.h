@@ -0,0 +1,77 @@
+#pragma once
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "response_publisher_interface.h"
+#include "return_code.h"
+#include "table.h"
+
+namespace p4orch {
+
+// ResponseSequencer sits between the P4 object managers and the response
+// publisher. P4Orch may execute the entries of a batch in a different order
+// than they were received (grouped per manager). While a batch is open, the
+// responses are held and released in the order the entries were received
+// when the batch is closed, so the P4RT client observes one response per
+// entry in request order. Outside of a batch, every call is forwarded as is.
+class ResponseSequencer : public ResponsePublisherInterface {
+ public:
+  explicit ResponseSequencer(ResponsePublisherInterface* publisher);
+  ~ResponseSequencer() override = default;
+
+  // Opens a batch. Responses are held until end() is called.
+  void begin();
+
+  // Records that a response for the key is expected at this position.
+  void expect(const std::string& key);
+
+  // Publishes the held responses in request order and closes the batch.
+  // Responses that were not expected are published last, in the order they
+  // were produced.
+  void end();
+
+  void publish(const std::string& table, const std::string& key,
+               const std::vector<swss::FieldValueTuple>& intent_attrs,
+               const ReturnCode& status,
+               const std::vector<swss::FieldValueTuple>& state_attrs,
+               bool replace = false) override;
+
+  void publish(const std::string& table, const std::string& key,
+               const std::vector<swss::FieldValueTuple>& intent_attrs,
+               const ReturnCode& status, bool replace = false) override;
+
+  void writeToDB(const std::string& table, const std::string& key,
+                 const std::vector<swss::FieldValueTuple>& values,
+                 const std::string& op, bool replace = false) override;
+
+  void setEnableDbWriteAndNotify(bool enable_db_write_and_notify) override;
+
+ private:
+  struct Response {
+    std::string table;
+    std::string key;
+    std::vector<swss::FieldValueTuple> intent_attrs;
+    ReturnCode status;
+    std::vector<swss::FieldValueTuple> state_attrs;
+    bool has_state_attrs;
+    bool replace;
+    bool published = false;
+  };
+
+  void hold(Response response);
+  void release(Response& response);
+
+  ResponsePublisherInterface* m_publisher;
+  bool m_active = false;
+  // Keys in request order.
+  std::vector<std::string> m_order;
+  // Held responses in production order.
+  std::vector<Response> m_held;
+  // Key -> indexes into m_held of the responses not released yet.
+  std::unordered_map<std::string, std::deque<size_t>> m_heldByKey;
+};
+
+}  // namespace p4orch
@@ -1,7 +1,6 @@
 #include "p4orch/route_manager.h"
 
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <unordered_set>
@@ -340,34 +339,18 @@ ReturnCodeOr<P4RouteEntry> RouteManager::deserializeRouteEntry(const std::string
 
     P4RouteEntry route_entry = {};
     std::string route_prefix;
-    try
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr || !match_key->getMatchField(p4orch::kVrfId, route_entry.vrf_id))
     {
-        nlohmann::json j = nlohmann::json::parse(key);
-        route_entry.vrf_id = j[prependMatchField(p4orch::kVrfId)];
-        if (table_name == APP_P4RT_IPV4_TABLE_NAME)
-        {
-            if (j.find(prependMatchField(p4orch::kIpv4Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv4Dst)];
-            }
-            else
-            {
-                route_prefix = "0.0.0.0/0";
-            }
-        }
-        else
-        {
-            if (j.find(prependMatchField(p4orch::kIpv6Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv6Dst)];
-            }
-            else
-            {
-                route_prefix = "::/0";
-            }
-        }
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
     }
-    catch (std::exception &ex)
+    const bool is_ipv4 = (table_name == APP_P4RT_IPV4_TABLE_NAME);
+    const std::string dst_field = is_ipv4 ? p4orch::kIpv4Dst : p4orch::kIpv6Dst;
+    if (match_key->findMatchField(dst_field) == nullptr)
+    {
+        route_prefix = is_ipv4 ? "0.0.0.0/0" : "::/0";
+    }
+    else if (!match_key->getMatchField(dst_field, route_prefix))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
     }
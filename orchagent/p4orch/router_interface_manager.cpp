@@ -2,7 +2,6 @@
 
 #include <map>
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -133,12 +132,8 @@ ReturnCodeOr<P4RouterInterfaceAppDbEntry> RouterInterfaceManager::deserializeRou
     SWSS_LOG_ENTER();
 
     P4RouterInterfaceAppDbEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_interface_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-    }
-    catch (std::exception &ex)
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr || !match_key->getMatchField(p4orch::kRouterInterfaceId, app_db_entry.router_interface_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize router interface id";
     }
@@ -510,23 +505,23 @@ ReturnCode RouterInterfaceManager::getSaiObject(const std::string &json_key, sai
 {
     std::string value;
 
-    try
+    const auto match_key = P4KeyDecoder::decode(json_key);
+    if (match_key == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kRouterInterfaceId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kRouterInterfaceId)).get<std::string>();
-            object_key = KeyGenerator::generateRouterInterfaceKey(value);
-            object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
-                           p4orch::kRouterInterfaceId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+    }
+    else if (match_key->findMatchField(p4orch::kRouterInterfaceId) == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
+                       p4orch::kRouterInterfaceId);
+    }
+    else if (match_key->getMatchField(p4orch::kRouterInterfaceId, value))
+    {
+        object_key = KeyGenerator::generateRouterInterfaceKey(value);
+        object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
+        return ReturnCode();
     }
-    catch (std::exception &ex)
+    else
     {
         SWSS_LOG_ERROR("json_key parse error");
     }
@@ -462,7 +462,8 @@ TEST_F(P4OrchTest, ProcessP4NotificationWrongOrder) {
   consumer.m_queue.push_back(
       swss::KeyOpFieldsValuesTuple{route_key, SET_COMMAND, route_attrs});
 
-  // Delete in wrong order
+  // Delete in wrong order. The deletions are executed in reverse add
+  // precedence, but the responses are published in request order.
   consumer.m_queue.push_back(swss::KeyOpFieldsValuesTuple{
       ritf_key, DEL_COMMAND, std::vector<swss::FieldValueTuple>{}});
   consumer.m_queue.push_back(swss::KeyOpFieldsValuesTuple{
@@ -489,16 +490,95 @@ TEST_F(P4OrchTest, ProcessP4NotificationWrongOrder) {
   std::vector<swss::FieldValueTuple> exp_values;
   EXPECT_CALL(*gMockResponsePublisher,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(ritf_key), Eq(exp_values),
-                      Eq(StatusCode::SWSS_RC_INVALID_PARAM), Eq(true)));
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
   EXPECT_CALL(*gMockResponsePublisher,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(neighbor_key), Eq(exp_values),
-                      Eq(StatusCode::SWSS_RC_NOT_EXECUTED), Eq(true)));
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
   EXPECT_CALL(*gMockResponsePublisher,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(nexthop_key), Eq(exp_values),
-                      Eq(StatusCode::SWSS_RC_NOT_EXECUTED), Eq(true)));
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
   EXPECT_CALL(*gMockResponsePublisher,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(route_key), Eq(exp_values),
-                      Eq(StatusCode::SWSS_RC_NOT_EXECUTED), Eq(true)));
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  DoTask(consumer);
+}
+
+TEST_F(P4OrchTest, ProcessP4NotificationAddInReverseOrder) {
+  InSequence s;
+  ZmqServer zmq_server("endpoint");
+  DBConnector db("APPL_DB", 0);
+  ZmqConsumerStateTable* table =
+      new ZmqConsumerStateTable(&db, APP_P4RT_TABLE_NAME, zmq_server,
+                                TableConsumable::DEFAULT_POP_BATCH_SIZE, 0,
+                                /*dbPersistence=*/false);
+  ZmqConsumer consumer(table, nullptr, APP_P4RT_TABLE_NAME,
+                       /*orderedQueue=*/true);
+
+  // Route
+  const std::string route_key =
+      std::string(APP_P4RT_IPV4_TABLE_NAME) + kTableKeyDelimiter +
+      "{\"match/vrf_id\":\"b4-traffic\",\"match/ipv4_dst\":\"10.11.12.0/24\"}";
+  std::vector<swss::FieldValueTuple> route_attrs;
+  route_attrs.push_back(
+      swss::FieldValueTuple{p4orch::kAction, p4orch::kSetNexthopId});
+  route_attrs.push_back(swss::FieldValueTuple{
+      prependParamField(p4orch::kNexthopId), "ju1u32m1.atl11:qe-3/7"});
+  consumer.m_queue.push_back(
+      swss::KeyOpFieldsValuesTuple{route_key, SET_COMMAND, route_attrs});
+
+  // Nexthop
+  const std::string nexthop_key =
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter +
+      "{\"match/nexthop_id\":\"ju1u32m1.atl11:qe-3/7\"}";
+  std::vector<swss::FieldValueTuple> nexthop_attrs;
+  nexthop_attrs.push_back(
+      swss::FieldValueTuple{p4orch::kAction, p4orch::kSetIpNexthop});
+  nexthop_attrs.push_back(swss::FieldValueTuple{
+      prependParamField(p4orch::kNeighborId), "10.0.0.22"});
+  nexthop_attrs.push_back(swss::FieldValueTuple{
+      prependParamField(p4orch::kRouterInterfaceId), "intf-3/4"});
+  consumer.m_queue.push_back(
+      swss::KeyOpFieldsValuesTuple{nexthop_key, SET_COMMAND, nexthop_attrs});
+
+  // Neighbor
+  const std::string neighbor_key = std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) +
+                                   kTableKeyDelimiter +
+                                   "{\"match/router_interface_id\":\"intf-3/"
+                                   "4\",\"match/neighbor_id\":\"10.0.0.22\"}";
+  std::vector<swss::FieldValueTuple> neighbor_attrs;
+  neighbor_attrs.push_back(swss::FieldValueTuple{
+      prependParamField(p4orch::kDstMac), "00:01:02:03:04:05"});
+  consumer.m_queue.push_back(
+      swss::KeyOpFieldsValuesTuple{neighbor_key, SET_COMMAND, neighbor_attrs});
+
+  // Router interface
+  const std::string ritf_key =
+      std::string(APP_P4RT_ROUTER_INTERFACE_TABLE_NAME) + kTableKeyDelimiter +
+      "{\"match/router_interface_id\":\"intf-3/4\"}";
+  std::vector<swss::FieldValueTuple> ritf_attrs;
+  ritf_attrs.push_back(
+      swss::FieldValueTuple{prependParamField(p4orch::kPort), "Ethernet1"});
+  ritf_attrs.push_back(swss::FieldValueTuple{prependParamField(p4orch::kSrcMac),
+                                             "00:01:02:03:04:05"});
+  consumer.m_queue.push_back(
+      swss::KeyOpFieldsValuesTuple{ritf_key, SET_COMMAND, ritf_attrs});
+
+  // The entries are created in add precedence, but the responses are
+  // published in request order.
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(route_key), Eq(route_attrs),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(nexthop_key), Eq(nexthop_attrs),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(neighbor_key), Eq(neighbor_attrs),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(ritf_key), Eq(ritf_attrs),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
   DoTask(consumer);
 }
 
@@ -2,7 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "ipaddress.h"
 #include "ipprefix.h"
@@ -196,4 +198,96 @@ TEST(P4OrchUtilTest, ParseFlagTest) {
   EXPECT_FALSE(flag_or.ok());
 }
 
+TEST(P4OrchUtilTest, P4KeyDecoderFlatKeyTest) {
+  P4KeyDecoder::clearCache();
+  const std::string key =
+      R"({"match/vrf_id":"b4-traffic", "match/ipv4_dst":"10.11.12.0/24","priority":100})";
+  auto match_key = P4KeyDecoder::decode(key);
+  ASSERT_NE(nullptr, match_key);
+  EXPECT_EQ(3, match_key->fields().size());
+
+  std::string value;
+  EXPECT_TRUE(match_key->getMatchField(p4orch::kVrfId, value));
+  EXPECT_EQ("b4-traffic", value);
+  EXPECT_TRUE(match_key->getMatchField(p4orch::kIpv4Dst, value));
+  EXPECT_EQ("10.11.12.0/24", value);
+  EXPECT_FALSE(match_key->getMatchField(p4orch::kIpv6Dst, value));
+  EXPECT_EQ(nullptr, match_key->findMatchField(p4orch::kPriority));
+
+  uint64_t priority;
+  EXPECT_TRUE(match_key->getUnsigned(p4orch::kPriority, priority));
+  EXPECT_EQ(100, priority);
+  EXPECT_FALSE(
+      match_key->getUnsigned(prependMatchField(p4orch::kVrfId), priority));
+
+  // The second decode of the same key is served from the cache.
+  EXPECT_EQ(1, P4KeyDecoder::cacheSize());
+  EXPECT_EQ(match_key, P4KeyDecoder::decode(key));
+  EXPECT_EQ(1, P4KeyDecoder::cacheSize());
+}
+
+TEST(P4OrchUtilTest, P4KeyDecoderGenericKeyTest) {
+  P4KeyDecoder::clearCache();
+  std::string value;
+  uint64_t number;
+
+  // Escaped strings and non unsigned values go through the generic parser.
+  auto match_key = P4KeyDecoder::decode(
+      R"({"match/nexthop_id":"ju1u32m1.atl11:qe-3\/7","priority":-1})");
+  ASSERT_NE(nullptr, match_key);
+  EXPECT_TRUE(match_key->getMatchField(p4orch::kNexthopId, value));
+  EXPECT_EQ("ju1u32m1.atl11:qe-3/7", value);
+  EXPECT_FALSE(match_key->getUnsigned(p4orch::kPriority, number));
+
+  match_key = P4KeyDecoder::decode(R"({"match/vrf_id":{"a":"b"}})");
+  ASSERT_NE(nullptr, match_key);
+  EXPECT_FALSE(match_key->getMatchField(p4orch::kVrfId, value));
+  EXPECT_NE(nullptr, match_key->findMatchField(p4orch::kVrfId));
+
+  match_key = P4KeyDecoder::decode(R"({})");
+  ASSERT_NE(nullptr, match_key);
+  EXPECT_TRUE(match_key->fields().empty());
+
+  EXPECT_EQ(nullptr, P4KeyDecoder::decode(R"(["match/vrf_id"])"));
+  EXPECT_EQ(nullptr, P4KeyDecoder::decode(R"({"match/vrf_id":"b4-traffic")"));
+  EXPECT_EQ(nullptr,
+            P4KeyDecoder::decode(R"({"match/vrf_id":"b4-traffic"} x)"));
+  EXPECT_EQ(nullptr, P4KeyDecoder::decode(""));
+  EXPECT_EQ(3, P4KeyDecoder::cacheSize());
+}
+
+TEST(P4OrchUtilTest, P4KeyDecoderCacheEvictionTest) {
+  P4KeyDecoder::clearCache();
+  const size_t max_keys = P4KeyDecoder::kMaxCachedKeys;
+  auto makeKey = [](size_t i) {
+    return R"({"match/nexthop_id":"nexthop-)" + std::to_string(i) + R"("})";
+  };
+
+  std::vector<std::shared_ptr<const P4MatchKey>> match_keys;
+  for (size_t i = 0; i < max_keys; i++) {
+    match_keys.push_back(P4KeyDecoder::decode(makeKey(i)));
+  }
+  EXPECT_EQ(max_keys, P4KeyDecoder::cacheSize());
+
+  // Touch the oldest key, so the second oldest is evicted next.
+  EXPECT_EQ(match_keys[0], P4KeyDecoder::decode(makeKey(0)));
+
+  auto match_key = P4KeyDecoder::decode(makeKey(max_keys));
+  ASSERT_NE(nullptr, match_key);
+  EXPECT_EQ(max_keys, P4KeyDecoder::cacheSize());
+  EXPECT_EQ(match_keys[0], P4KeyDecoder::decode(makeKey(0)));
+  EXPECT_EQ(match_keys[2], P4KeyDecoder::decode(makeKey(2)));
+  EXPECT_EQ(match_key, P4KeyDecoder::decode(makeKey(max_keys)));
+
+  // The evicted key is decoded again, the handle held by the caller stays
+  // valid.
+  auto redecoded = P4KeyDecoder::decode(makeKey(1));
+  ASSERT_NE(nullptr, redecoded);
+  EXPECT_NE(match_keys[1], redecoded);
+  std::string value;
+  EXPECT_TRUE(match_keys[1]->getMatchField(p4orch::kNexthopId, value));
+  EXPECT_EQ("nexthop-1", value);
+  EXPECT_EQ(max_keys, P4KeyDecoder::cacheSize());
+}
+
 } // namespace
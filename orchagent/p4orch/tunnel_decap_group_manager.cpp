@@ -1,7 +1,6 @@
 #include "p4orch/tunnel_decap_group_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -352,10 +351,21 @@ TunnelDecapGroupManager::deserializeIpv6TunnelTermAppDbEntry(
   app_db_entry.dst_ipv6_ip = swss::IpAddress("0:0:0:0:0:0:0:0");
   app_db_entry.dst_ipv6_mask = swss::IpAddress("0:0:0:0:0:0:0:0");
 
+  const auto match_key = P4KeyDecoder::decode(key);
+  if (match_key == nullptr) {
+    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+           << "Failed to deserialize Ipv6 tunnel termination table entry "
+           << "destination IPv6";
+  }
+
   try {
-    nlohmann::json j = nlohmann::json::parse(key);
-    if (j.find(prependMatchField(p4orch::kDecapSrcIpv6)) != j.end()) {
-      std::string src_ipv6 = j[prependMatchField(p4orch::kDecapSrcIpv6)];
+    if (match_key->findMatchField(p4orch::kDecapSrcIpv6) != nullptr) {
+      std::string src_ipv6;
+      if (!match_key->getMatchField(p4orch::kDecapSrcIpv6, src_ipv6)) {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+               << "Failed to deserialize Ipv6 tunnel termination table entry "
+               << "destination IPv6";
+      }
       const auto& src_ip_and_mask =
           swss::tokenize(src_ipv6, p4orch::kDataMaskDelimiter);
       if (src_ip_and_mask.size() != 2) {
@@ -366,8 +376,13 @@ TunnelDecapGroupManager::deserializeIpv6TunnelTermAppDbEntry(
       app_db_entry.src_ipv6_ip = swss::IpAddress(trim(src_ip_and_mask[0]));
       app_db_entry.src_ipv6_mask = swss::IpAddress(trim(src_ip_and_mask[1]));
     }
-    if (j.find(prependMatchField(p4orch::kDecapDstIpv6)) != j.end()) {
-      std::string ipv6 = j[prependMatchField(p4orch::kDecapDstIpv6)];
+    if (match_key->findMatchField(p4orch::kDecapDstIpv6) != nullptr) {
+      std::string ipv6;
+      if (!match_key->getMatchField(p4orch::kDecapDstIpv6, ipv6)) {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+               << "Failed to deserialize Ipv6 tunnel termination table entry "
+               << "destination IPv6";
+      }
       const auto& ip_and_mask =
           swss::tokenize(ipv6, p4orch::kDataMaskDelimiter);
       if (ip_and_mask.size() != 2) {
@@ -378,13 +393,13 @@ TunnelDecapGroupManager::deserializeIpv6TunnelTermAppDbEntry(
       app_db_entry.dst_ipv6_ip = swss::IpAddress(trim(ip_and_mask[0]));
       app_db_entry.dst_ipv6_mask = swss::IpAddress(trim(ip_and_mask[1]));
     }
-    auto priority_j = j[p4orch::kPriority];
-    if (!priority_j.is_number_unsigned()) {
+    uint64_t priority;
+    if (!match_key->getUnsigned(p4orch::kPriority, priority)) {
       return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
              << "Invalid Ipv6 tunnel termination table entry priority type: "
                 "should be uint32_t";
     }
-    app_db_entry.priority = static_cast<uint32_t>(priority_j);
+    app_db_entry.priority = static_cast<uint32_t>(priority);
   } catch (std::exception& ex) {
     return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
            << "Failed to deserialize Ipv6 tunnel termination table entry "
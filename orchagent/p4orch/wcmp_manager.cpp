@@ -153,16 +153,12 @@ ReturnCodeOr<P4WcmpGroupEntry> WcmpManager::deserializeP4WcmpGroupAppDbEntry(
     const std::string &key, const std::vector<swss::FieldValueTuple> &attributes)
 {
     P4WcmpGroupEntry app_db_entry = {};
-    try
+    const auto match_key = P4KeyDecoder::decode(key);
+    if (match_key == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(key);
-        if (!j.is_object())
-        {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid WCMP group key: should be a JSON object.";
-        }
-        app_db_entry.wcmp_group_id = j[prependMatchField(kWcmpGroupId)];
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid WCMP group key: should be a JSON object.";
     }
-    catch (std::exception &ex)
+    if (!match_key->getMatchField(kWcmpGroupId, app_db_entry.wcmp_group_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize WCMP group key";
     }
@@ -550,22 +546,22 @@ ReturnCode WcmpManager::getSaiObject(const std::string &json_key, sai_object_typ
 {
     std::string value;
 
-    try
+    const auto match_key = P4KeyDecoder::decode(json_key);
+    if (match_key == nullptr)
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kWcmpGroupId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kWcmpGroupId)).get<std::string>();
-            object_key = KeyGenerator::generateWcmpGroupKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
+    }
+    else if (match_key->findMatchField(p4orch::kWcmpGroupId) == nullptr)
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
+    }
+    else if (match_key->getMatchField(p4orch::kWcmpGroupId, value))
+    {
+        object_key = KeyGenerator::generateWcmpGroupKey(value);
+        object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
+        return ReturnCode();
     }
-    catch (std::exception &ex)
+    else
     {
         SWSS_LOG_ERROR("json_key parse error");
     }
@@ -76,6 +76,7 @@ extern EvpnMhOrch *gEvpnMhOrch;
 extern event_handle_t g_events_handle;
 extern bool isChassisDbInUse();
 extern bool gMultiAsicVoq;
+extern bool gNativeCounterRates;
 
 // defines ------------------------------------------------------------------------------------------------------------
 
@@ -842,6 +843,14 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
         SWSS_LOG_ERROR("Port flex counter groups were not set successfully: %s", e.what());
     }
 
+    if (gNativeCounterRates)
+    {
+        /* Rates and BER of the ASIC ports are computed by m_portRateEngine */
+        m_portRateEngine = make_unique<CounterRateEngine>(m_counter_db.get(), CounterRateEngine::port_profile,
+                                                          stoi(PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS));
+        portRateSha.clear();
+    }
+
     // Build portStatPlugins string, only adding non-empty plugin SHAs
     std::string portStatPlugins;
     if (!portRateSha.empty())
@@ -863,7 +872,11 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
         isPortStatSupported(SAI_PORT_STAT_TX_TRIM_PACKETS) && \
         !isPortStatSupported(SAI_PORT_STAT_DROPPED_TRIM_PACKETS))
     {
-        portStatPlugins += "," + nvdaPortTrimSha;
+        if (!portStatPlugins.empty())
+        {
+            portStatPlugins += ",";
+        }
+        portStatPlugins += nvdaPortTrimSha;
     }
 
     setFlexCounterGroupParameter(QUEUE_WATERMARK_STAT_COUNTER_FLEX_COUNTER_GROUP,
@@ -1133,6 +1146,14 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
 
     auto executor = new ExecutableTimer(m_port_state_poller, this, "PORT_STATE_POLLER");
     Orch::addExecutor(executor);
+
+    if (m_portRateEngine)
+    {
+        auto interval = timespec { .tv_sec = stoi(PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS) / 1000, .tv_nsec = 0 };
+        m_portRateTimer = new SelectableTimer(interval);
+        /* Started once the PORT flex counter group is enabled */
+        Orch::addExecutor(new ExecutableTimer(m_portRateTimer, this, "PORT_RATE_POLLER"));
+    }
 }
 
 void PortsOrch::initializeCpuPort()
@@ -4043,6 +4064,10 @@ sai_status_t PortsOrch::removePort(sai_object_id_t port_id)
 
     /* Remove port counters */
     port_stat_manager.clearCounterIdList(port.m_port_id);
+    if (m_portRateEngine)
+    {
+        m_portRateEngine->removeObject(port.m_port_id);
+    }
     port_buffer_drop_stat_manager.clearCounterIdList(port.m_port_id);
 
     /*
@@ -4237,6 +4262,7 @@ void PortsOrch::registerPort(Port &p)
         auto port_counter_stats = generateCounterStats(port_stat_ids, sai_serialize_port_stat);
         port_stat_manager.setCounterIdList(p.m_port_id,
                 CounterType::PORT, port_counter_stats);
+        addPortToRateEngine(p);
         auto gbport_counter_stats = generateCounterStats(gbport_stat_ids, sai_serialize_port_stat);
         if (p.m_system_side_id)
             gb_port_stat_manager.setCounterIdList(p.m_system_side_id,
@@ -4371,6 +4397,10 @@ void PortsOrch::deInitPort(string alias, sai_object_id_t port_id)
     {
         port_stat_manager.clearCounterIdList(p.m_port_id);
     }
+    if (m_portRateEngine)
+    {
+        m_portRateEngine->removeObject(p.m_port_id);
+    }
 
     if (flex_counters_orch->getPortBufferDropCountersState())
     {
@@ -9288,6 +9318,7 @@ void PortsOrch::generatePortCounterMap()
         }
         port_stat_manager.setCounterIdList(it.second.m_port_id,
                 CounterType::PORT, port_counter_stats);
+        addPortToRateEngine(it.second);
         if (it.second.m_system_side_id)
             gb_port_stat_manager.setCounterIdList(it.second.m_system_side_id,
                     CounterType::PORT, gbport_counter_stats, it.second.m_switch_id);
@@ -11887,8 +11918,93 @@ bool PortsOrch::removePtTam(sai_object_id_t tam_id)
     return true;
 }
 
+void PortsOrch::addPortToRateEngine(const Port &port)
+{
+    if (!m_portRateEngine || port.m_type != Port::Type::PHY)
+    {
+        return;
+    }
+
+    m_portRateEngine->addObject(port.m_port_id);
+}
+
+void PortsOrch::setPortRatePollInterval(const string &interval_ms)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_portRateEngine)
+    {
+        return;
+    }
+
+    uint32_t interval;
+    try
+    {
+        interval = to_uint<uint32_t>(interval_ms);
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid port rate poll interval %s: %s", interval_ms.c_str(), e.what());
+        return;
+    }
+
+    /* Follow the poll interval of the PORT flex counter group, as port_rates.lua does */
+    m_portRateEngine->setInterval(interval);
+    auto intervT = timespec { .tv_sec = static_cast<time_t>(interval / 1000),
+                              .tv_nsec = static_cast<long>(interval % 1000) * 1000000 };
+    m_portRateTimer->setInterval(intervT);
+    if (m_portRatePollEnabled)
+    {
+        m_portRateTimer->reset();
+    }
+}
+
+void PortsOrch::setPortRatePollEnabled(bool enabled)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_portRateEngine || enabled == m_portRatePollEnabled)
+    {
+        return;
+    }
+
+    /* Rates are only computed while the PORT flex counter group is polled, as with port_rates.lua */
+    m_portRatePollEnabled = enabled;
+    if (enabled)
+    {
+        m_portRateTimer->start();
+    }
+    else
+    {
+        m_portRateTimer->stop();
+    }
+}
+
+void PortsOrch::pollPortRates()
+{
+    SWSS_LOG_ENTER();
+
+    /* Lanes and speed give the serdes rate used for BER, speed can change at any time */
+    for (const auto &it : m_portListLaneMap)
+    {
+        Port port;
+        if (m_portRateEngine->hasObject(it.second) && getPort(it.second, port))
+        {
+            m_portRateEngine->setLanes(it.second, static_cast<uint32_t>(it.first.size()), port.m_speed);
+        }
+    }
+
+    m_portRateEngine->poll();
+}
+
 void PortsOrch::doTask(swss::SelectableTimer &timer)
 {
+    if (&timer == m_portRateTimer)
+    {
+        pollPortRates();
+        return;
+    }
+
     Port port;
 
     for (auto it = m_port_state_poll.begin(); it != m_port_state_poll.end(); )
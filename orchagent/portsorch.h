@@ -11,6 +11,7 @@
 #include "macaddress.h"
 #include "producertable.h"
 #include "flex_counter_manager.h"
+#include "counter_rate_engine.h"
 #include "gearboxutils.h"
 #include "saihelper.h"
 #include "lagid.h"
@@ -251,6 +252,8 @@ public:
     void generateWredQueueCounterMap();
 
     void flushCounters();
+    void setPortRatePollInterval(const std::string &interval_ms);
+    void setPortRatePollEnabled(bool enabled);
 
     void refreshPortStatus();
     bool removeAclTableGroup(const Port &p);
@@ -421,6 +424,13 @@ private:
 
     swss::SelectableTimer *m_port_state_poller = nullptr;
 
+    /* Port rates computed in orchagent instead of port_rates.lua */
+    std::unique_ptr<CounterRateEngine> m_portRateEngine;
+    swss::SelectableTimer *m_portRateTimer = nullptr;
+    bool m_portRatePollEnabled = false;
+    void addPortToRateEngine(const Port &port);
+    void pollPortRates();
+
     bool m_cmisModuleAsicSyncSupported = false;
 
     void doTask() override;
@@ -1342,6 +1342,9 @@ void QosOrch::initTableHandlers()
     m_qos_handler_map.insert(qos_handler_pair(CFG_TC_TO_PRIORITY_GROUP_MAP_TABLE_NAME, &QosOrch::handleTcToPgTable));
     m_qos_handler_map.insert(qos_handler_pair(CFG_PFC_PRIORITY_TO_PRIORITY_GROUP_MAP_TABLE_NAME, &QosOrch::handlePfcPrioToPgTable));
     m_qos_handler_map.insert(qos_handler_pair(CFG_PFC_PRIORITY_TO_QUEUE_MAP_TABLE_NAME, &QosOrch::handlePfcToQueueTable));
+
+    m_qos_flush_handler_map.insert(qos_flush_handler_pair(CFG_QUEUE_TABLE_NAME, &QosOrch::processQueueBulk));
+    m_qos_flush_handler_map.insert(qos_flush_handler_pair(CFG_PORT_QOS_MAP_TABLE_NAME, &QosOrch::processPortQosMapBulk));
 }
 
 task_process_status QosOrch::handleSchedulerTable(Consumer& consumer, KeyOpFieldsValuesTuple &tuple)
@@ -1627,12 +1630,12 @@ sai_object_id_t QosOrch::getSchedulerGroup(const Port &port, const sai_object_id
     return SAI_NULL_OBJECT_ID;
 }
 
-bool QosOrch::applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind, sai_object_id_t scheduler_profile_id)
+bool QosOrch::getQueueSchedulerGroup(Port port, size_t queue_ind, sai_object_id_t &group_id)
 {
     SWSS_LOG_ENTER();
     sai_object_id_t queue_id;
-    Port input_port = port;
-    sai_object_id_t group_id = 0;
+
+    group_id = SAI_NULL_OBJECT_ID;
 
     if (gMySwitchType == "voq") 
     {
@@ -1645,72 +1648,30 @@ bool QosOrch::applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind,
         if (!gPortsOrch->getPort(port.m_system_port_info.local_port_oid, port))
         {
             SWSS_LOG_ERROR("Port with alias:%s not found", port.m_alias.c_str());
-            return task_process_status::task_invalid_entry;
-        }
-
-        if (port.m_queue_ids.size() <= queue_ind)
-        {
-            SWSS_LOG_ERROR("Invalid queue index specified:%zd", queue_ind);
-            return false;
-        }
-        queue_id = port.m_queue_ids[queue_ind];
-        
-        group_id = getSchedulerGroup(port, queue_id);
-        if(group_id == SAI_NULL_OBJECT_ID)
-        {
-            SWSS_LOG_ERROR("Failed to find a scheduler group for port: %s queue: %zu", port.m_alias.c_str(), queue_ind);
             return false;
         }
-
-        // port is set back to system port
-        port = input_port;
     }
-    else
+
+    if (port.m_queue_ids.size() <= queue_ind)
     {
-        if (port.m_queue_ids.size() <= queue_ind)
-        {
-            SWSS_LOG_ERROR("Invalid queue index specified:%zd", queue_ind);
-            return false;
-        }
-        queue_id = port.m_queue_ids[queue_ind];
-        
-        group_id = getSchedulerGroup(port, queue_id);
-        if(group_id == SAI_NULL_OBJECT_ID)
-        {
-            SWSS_LOG_ERROR("Failed to find a scheduler group for port: %s queue: %zu", port.m_alias.c_str(), queue_ind);
-            return false;
-        }
+        SWSS_LOG_ERROR("Invalid queue index specified:%zd", queue_ind);
+        return false;
     }
-    
-    /* Apply scheduler profile to all port groups  */
-    sai_attribute_t attr;
-    sai_status_t    sai_status;
+    queue_id = port.m_queue_ids[queue_ind];
 
-    attr.id = SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID;
-    attr.value.oid = scheduler_profile_id;
-
-    sai_status = sai_scheduler_group_api->set_scheduler_group_attribute(group_id, &attr);
-    if (SAI_STATUS_SUCCESS != sai_status)
+    group_id = getSchedulerGroup(port, queue_id);
+    if(group_id == SAI_NULL_OBJECT_ID)
     {
-        SWSS_LOG_ERROR("Failed applying scheduler profile:0x%" PRIx64 " to scheduler group:0x%" PRIx64 ", port:%s", scheduler_profile_id, group_id, port.m_alias.c_str());
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_SCHEDULER_GROUP, sai_status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
+        SWSS_LOG_ERROR("Failed to find a scheduler group for port: %s queue: %zu", port.m_alias.c_str(), queue_ind);
+        return false;
     }
 
-    SWSS_LOG_DEBUG("port:%s, scheduler_profile_id:0x%" PRIx64 " applied to scheduler group:0x%" PRIx64, port.m_alias.c_str(), scheduler_profile_id, group_id);
-
     return true;
 }
 
-bool QosOrch::applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_id_t sai_wred_profile)
+bool QosOrch::getWredQueue(Port &port, size_t queue_ind, sai_object_id_t &queue_id)
 {
     SWSS_LOG_ENTER();
-    sai_attribute_t attr;
-    sai_status_t    sai_status;
-    sai_object_id_t queue_id;
 
     if (gMySwitchType == "voq") 
     {
@@ -1718,7 +1679,7 @@ bool QosOrch::applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_i
         if (queue_ids.size() <= queue_ind)
         {
             SWSS_LOG_ERROR("Invalid voq index specified:%zd", queue_ind);
-            return task_process_status::task_invalid_entry;
+            return false;
         }
         queue_id = queue_ids[queue_ind];
     } 
@@ -1732,18 +1693,6 @@ bool QosOrch::applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_i
         queue_id = port.m_queue_ids[queue_ind];
     }
 
-    attr.id = SAI_QUEUE_ATTR_WRED_PROFILE_ID;
-    attr.value.oid = sai_wred_profile;
-    sai_status = sai_queue_api->set_queue_attribute(queue_id, &attr);
-    if (sai_status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to set queue attribute:%d", sai_status);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_QUEUE, sai_status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
     return true;
 }
 
@@ -1751,7 +1700,6 @@ task_process_status QosOrch::handleQueueTable(Consumer& consumer, KeyOpFieldsVal
 {
     SWSS_LOG_ENTER();
     Port port;
-    bool result;
     string key = kfvKey(tuple);
     string op = kfvOp(tuple);
     size_t queue_ind = 0;
@@ -1898,6 +1846,13 @@ task_process_status QosOrch::handleQueueTable(Consumer& consumer, KeyOpFieldsVal
         return task_process_status::task_invalid_entry;
     }
 
+    QosQueueTask task;
+    task.kofvs = tuple;
+    task.update_scheduler = !donotChangeScheduler;
+    task.update_wred = !donotChangeWredProfile;
+    task.scheduler_profile = sai_scheduler_profile;
+    task.wred_profile = sai_wred_profile;
+
     for (string port_name : port_names)
     {
         Port port;
@@ -1913,41 +1868,294 @@ task_process_status QosOrch::handleQueueTable(Consumer& consumer, KeyOpFieldsVal
             SWSS_LOG_ERROR("Port with alias:%s not found", port_name.c_str());
             return task_process_status::task_invalid_entry;
         }
+
+        QosQueueTask::PortContext portContext;
+        portContext.port_name = port_name;
+
         SWSS_LOG_DEBUG("processing range:%d-%d", range_low, range_high);
         for (size_t ind = range_low; ind <= range_high; ind++)
         {
             queue_ind = ind;
             SWSS_LOG_DEBUG("processing queue:%zd", queue_ind);
 
-            if (!donotChangeScheduler)
-            {
-                result = applySchedulerToQueueSchedulerGroup(port, queue_ind, sai_scheduler_profile);
+            QosQueueTask::QueueContext queueContext;
+            queueContext.index = queue_ind;
 
-                if (!result)
+            if (task.update_scheduler)
+            {
+                if (!getQueueSchedulerGroup(port, queue_ind, queueContext.group_id))
                 {
                     SWSS_LOG_ERROR("Failed setting field:%s to port:%s, queue:%zd, line:%d", scheduler_field_name.c_str(), port.m_alias.c_str(), queue_ind, __LINE__);
                     return task_process_status::task_failed;
                 }
-                SWSS_LOG_DEBUG("Applied scheduler to port:%s", port_name.c_str());
             }
 
-            if (!donotChangeWredProfile)
+            if (task.update_wred)
             {
-                result = applyWredProfileToQueue(port, queue_ind, sai_wred_profile);
-
-                if (!result)
+                if (!getWredQueue(port, queue_ind, queueContext.queue_id))
                 {
                     SWSS_LOG_ERROR("Failed setting field:%s to port:%s, queue:%zd, line:%d", wred_profile_field_name.c_str(), port.m_alias.c_str(), queue_ind, __LINE__);
                     return task_process_status::task_failed;
                 }
-                SWSS_LOG_DEBUG("Applied wred profile to port:%s", port_name.c_str());
             }
+
+            portContext.queues.emplace_back(queueContext);
         }
+
+        task.ports.emplace_back(portContext);
     }
+
+    m_queueBulk.emplace_back(task);
+
     SWSS_LOG_DEBUG("finished");
     return task_process_status::task_success;
 }
 
+task_process_status QosOrch::processQueuePost(const QosQueueTask& task)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& portContext: task.ports)
+    {
+        for (const auto& queueContext: portContext.queues)
+        {
+            if (queueContext.scheduler_status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed applying scheduler profile:0x%" PRIx64 " to scheduler group:0x%" PRIx64 ", port:%s, queue:%zd",
+                               task.scheduler_profile, queueContext.group_id, portContext.port_name.c_str(), queueContext.index);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_SCHEDULER_GROUP, queueContext.scheduler_status);
+                if (handle_status != task_process_status::task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status) ? task_process_status::task_failed : task_process_status::task_need_retry;
+                }
+            }
+
+            if (queueContext.wred_status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to set queue attribute:%d, port:%s, queue:%zd",
+                               queueContext.wred_status, portContext.port_name.c_str(), queueContext.index);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_QUEUE, queueContext.wred_status);
+                if (handle_status != task_process_status::task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status) ? task_process_status::task_failed : task_process_status::task_need_retry;
+                }
+            }
+        }
+    }
+
+    return task_process_status::task_success;
+}
+
+void QosOrch::processQueueBulk(Consumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Scheduler groups have no bulk SAI API: each group is set once, queues
+     * sharing a group with the same profile in this flush reuse the result.
+     * The queues relying on the new profile of a group are counted, so that
+     * the group is only rolled back once none of them keeps it.
+     */
+    struct SchedulerGroupUpdate
+    {
+        sai_object_id_t profile;
+        sai_object_id_t prev_profile;
+        bool has_prev;
+        sai_status_t status;
+        size_t refs;
+    };
+    std::map<sai_object_id_t, SchedulerGroupUpdate> groupUpdates;
+
+    for (auto& task: m_queueBulk)
+    {
+        if (!task.update_scheduler)
+        {
+            continue;
+        }
+
+        for (auto& port: task.ports)
+        {
+            for (auto& queue: port.queues)
+            {
+                if (queue.group_id == SAI_NULL_OBJECT_ID)
+                {
+                    /* Remote system port, nothing to apply */
+                    queue.scheduler_status = SAI_STATUS_SUCCESS;
+                    continue;
+                }
+
+                auto update = groupUpdates.find(queue.group_id);
+                if (update == groupUpdates.end() || update->second.profile != task.scheduler_profile)
+                {
+                    /* A later profile of the group replaces the earlier one of this flush */
+                    auto prev = m_schedulerGroupProfiles.find(queue.group_id);
+
+                    sai_attribute_t attr;
+                    attr.id = SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID;
+                    attr.value.oid = task.scheduler_profile;
+
+                    SchedulerGroupUpdate groupUpdate;
+                    groupUpdate.profile = task.scheduler_profile;
+                    groupUpdate.has_prev = prev != m_schedulerGroupProfiles.end();
+                    groupUpdate.prev_profile = groupUpdate.has_prev ? prev->second : SAI_NULL_OBJECT_ID;
+                    groupUpdate.status = sai_scheduler_group_api->set_scheduler_group_attribute(queue.group_id, &attr);
+                    groupUpdate.refs = 0;
+
+                    if (groupUpdate.status == SAI_STATUS_SUCCESS)
+                    {
+                        m_schedulerGroupProfiles[queue.group_id] = task.scheduler_profile;
+                        SWSS_LOG_DEBUG("port:%s, scheduler_profile_id:0x%" PRIx64 " applied to scheduler group:0x%" PRIx64,
+                                       port.port_name.c_str(), task.scheduler_profile, queue.group_id);
+                    }
+                    groupUpdates[queue.group_id] = groupUpdate;
+                    update = groupUpdates.find(queue.group_id);
+                }
+
+                queue.scheduler_status = update->second.status;
+                if (queue.scheduler_status == SAI_STATUS_SUCCESS)
+                {
+                    update->second.refs++;
+                }
+            }
+        }
+    }
+
+    /* WRED profiles are set in one bulk call, skipping the queues whose scheduler failed */
+    std::vector<sai_object_id_t> oids;
+    std::vector<sai_attribute_t> attrs;
+    std::vector<sai_status_t> statuses;
+
+    for (const auto& task: m_queueBulk)
+    {
+        for (const auto& port: task.ports)
+        {
+            for (const auto& queue: port.queues)
+            {
+                if (task.update_wred && (!task.update_scheduler || queue.scheduler_status == SAI_STATUS_SUCCESS))
+                {
+                    sai_attribute_t attr;
+                    attr.id = SAI_QUEUE_ATTR_WRED_PROFILE_ID;
+                    attr.value.oid = task.wred_profile;
+
+                    oids.push_back(queue.queue_id);
+                    attrs.push_back(attr);
+                    statuses.push_back(SAI_STATUS_NOT_EXECUTED);
+                }
+            }
+        }
+    }
+
+    const auto objectCount = static_cast<uint32_t>(oids.size());
+
+    if (objectCount > 0)
+    {
+        SWSS_LOG_TIMER("Set %u queues wred profile", objectCount);
+
+        sai_queue_api->set_queues_attribute(objectCount, oids.data(), attrs.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+    }
+
+    size_t i = 0;
+    for (auto& task: m_queueBulk)
+    {
+        for (auto& port: task.ports)
+        {
+            for (auto& queue: port.queues)
+            {
+                if (!task.update_wred)
+                {
+                    queue.wred_status = SAI_STATUS_SUCCESS;
+                }
+                else if (!task.update_scheduler || queue.scheduler_status == SAI_STATUS_SUCCESS)
+                {
+                    queue.wred_status = statuses[i];
+                    i++;
+                }
+                else
+                {
+                    /* Not applied, the scheduler failure is reported for this queue */
+                    queue.wred_status = SAI_STATUS_SUCCESS;
+                }
+            }
+        }
+    }
+
+    /*
+     * Release the scheduler group of the queues whose WRED profile failed,
+     * a group is rolled back once the last queue relying on it is released.
+     */
+    for (auto& task: m_queueBulk)
+    {
+        if (!task.update_scheduler)
+        {
+            continue;
+        }
+
+        for (auto& port: task.ports)
+        {
+            for (auto& queue: port.queues)
+            {
+                if (queue.wred_status == SAI_STATUS_SUCCESS || queue.group_id == SAI_NULL_OBJECT_ID ||
+                    queue.scheduler_status != SAI_STATUS_SUCCESS)
+                {
+                    continue;
+                }
+
+                auto& update = groupUpdates.at(queue.group_id);
+                if (update.profile != task.scheduler_profile)
+                {
+                    /* Replaced by a later profile of this flush, nothing left to roll back */
+                    continue;
+                }
+
+                if (--update.refs > 0)
+                {
+                    SWSS_LOG_INFO("Scheduler group:0x%" PRIx64 " of port:%s queue:%zd kept, used by %zu other queues",
+                                  queue.group_id, port.port_name.c_str(), queue.index, update.refs);
+                    continue;
+                }
+
+                if (!update.has_prev)
+                {
+                    continue;
+                }
+
+                sai_attribute_t attr;
+                attr.id = SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID;
+                attr.value.oid = update.prev_profile;
+
+                sai_status_t status = sai_scheduler_group_api->set_scheduler_group_attribute(queue.group_id, &attr);
+                if (status == SAI_STATUS_SUCCESS)
+                {
+                    m_schedulerGroupProfiles[queue.group_id] = update.prev_profile;
+                    SWSS_LOG_NOTICE("Rolled back scheduler group:0x%" PRIx64 " of port:%s queue:%zd",
+                                    queue.group_id, port.port_name.c_str(), queue.index);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Failed to roll back scheduler group:0x%" PRIx64 " of port:%s queue:%zd, rv:%d",
+                                   queue.group_id, port.port_name.c_str(), queue.index, status);
+                }
+            }
+        }
+    }
+
+    for (const auto& task: m_queueBulk)
+    {
+        auto task_status = processQueuePost(task);
+        if (task_status == task_process_status::task_need_retry)
+        {
+            consumer.m_toSync.emplace(kfvKey(task.kofvs), task.kofvs);
+        }
+        else if (task_status == task_process_status::task_failed)
+        {
+            SWSS_LOG_ERROR("Failed to apply QUEUE|%s, drop it", kfvKey(task.kofvs).c_str());
+        }
+    }
+
+    m_queueBulk.clear();
+}
+
 bool QosOrch::applyDscpToTcMapToSwitch(sai_attr_id_t attr_id, sai_object_id_t map_id)
 {
     SWSS_LOG_ENTER();
@@ -2057,9 +2265,28 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
 
     vector<string> port_names = tokenize(key, list_item_delimiter);
 
+    QosPortMapTask task;
+    task.kofvs = tuple;
+
     if (op == DEL_COMMAND)
     {
         /* Handle DEL command. Just set all the maps to oid:0x0 */
+        vector<QosPortMapTask::AttrContext> attrs;
+        for (auto &mapRef : qos_to_attr_map)
+        {
+            string referenced_obj;
+            if (!doesObjectExist(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key, mapRef.first, referenced_obj))
+            {
+                continue;
+            }
+
+            QosPortMapTask::AttrContext attrContext;
+            attrContext.map_name = mapRef.first;
+            attrContext.attr_id = mapRef.second;
+            attrContext.map_id = SAI_NULL_OBJECT_ID;
+            attrs.push_back(attrContext);
+        }
+
         for (string port_name : port_names)
         {
             Port port;
@@ -2071,42 +2298,13 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
                 continue;
             }
 
-            for (auto &mapRef : qos_to_attr_map)
-            {
-                string referenced_obj;
-                if (!doesObjectExist(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key, mapRef.first, referenced_obj))
-                {
-                    continue;
-                }
-
-                sai_attribute_t attr;
-                attr.id = mapRef.second;
-                attr.value.oid = SAI_NULL_OBJECT_ID;
-
-                sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-                if (status != SAI_STATUS_SUCCESS)
-                {
-                    SWSS_LOG_ERROR("Failed to remove %s on port %s, rv:%d",
-                                   mapRef.first.c_str(), port_name.c_str(), status);
-                    task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
-                    if (handle_status != task_process_status::task_success)
-                    {
-                        return task_process_status::task_invalid_entry;
-                    }
-                }
-                SWSS_LOG_INFO("Removed %s on port %s", mapRef.first.c_str(), port_name.c_str());
-            }
-
-            if (!gPortsOrch->setPortPfc(port.m_port_id, 0))
-            {
-                SWSS_LOG_ERROR("Failed to disable PFC on port %s", port_name.c_str());
-            }
-
-            SWSS_LOG_INFO("Disabled PFC on port %s", port_name.c_str());
+            task.ports.emplace_back(QosPortMapTask::PortContext{port_name, port.m_port_id, attrs});
         }
 
         removeObject(m_qos_maps, CFG_PORT_QOS_MAP_TABLE_NAME, key);
 
+        m_portQosMapBulk.emplace_back(task);
+
         return task_process_status::task_success;
     }
 
@@ -2172,6 +2370,20 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
         }
     }
 
+    /* A list of attributes to be applied */
+    vector<QosPortMapTask::AttrContext> attrs;
+    for (auto it = update_list.begin(); it != update_list.end(); it++)
+    {
+        QosPortMapTask::AttrContext attrContext;
+        attrContext.map_name = it->second.first;
+        attrContext.attr_id = it->first;
+        attrContext.map_id = it->second.second;
+        attrs.push_back(attrContext);
+    }
+
+    task.pfc_enable = pfc_enable;
+    task.pfcwd_sw_enable = pfcwd_sw_enable;
+
     for (string port_name : port_names)
     {
         Port port;
@@ -2183,51 +2395,215 @@ task_process_status QosOrch::handlePortQosMapTable(Consumer& consumer, KeyOpFiel
             continue;
         }
 
-        /* Apply a list of attributes to be applied */
-        for (auto it = update_list.begin(); it != update_list.end(); it++)
-        {
-            sai_attribute_t attr;
-            attr.id = it->first;
-            attr.value.oid = it->second.second;
+        task.ports.emplace_back(QosPortMapTask::PortContext{port_name, port.m_port_id, attrs});
+    }
 
-            sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
-            if (status != SAI_STATUS_SUCCESS)
+    m_portQosMapBulk.emplace_back(task);
+
+    return task_process_status::task_success;
+}
+
+task_process_status QosOrch::processPortQosMapPost(const QosPortMapTask& task)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& op = kfvOp(task.kofvs);
+
+    for (const auto& portContext: task.ports)
+    {
+        const auto& port_name = portContext.port_name;
+
+        for (const auto& attrContext: portContext.attrs)
+        {
+            if (attrContext.status != SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_ERROR("Failed to apply %s to port %s, rv:%d",
-                               it->second.first.c_str(), port_name.c_str(), status);
-                task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, status);
+                               attrContext.map_name.c_str(), port_name.c_str(), attrContext.status);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_PORT, attrContext.status);
                 if (handle_status != task_process_status::task_success)
                 {
                     return task_process_status::task_invalid_entry;
                 }
             }
-            SWSS_LOG_INFO("Applied %s to port %s", it->second.first.c_str(), port_name.c_str());
+            SWSS_LOG_INFO("Applied %s to port %s", attrContext.map_name.c_str(), port_name.c_str());
+        }
+
+        if (op == DEL_COMMAND)
+        {
+            if (!gPortsOrch->setPortPfc(portContext.port_oid, 0))
+            {
+                SWSS_LOG_ERROR("Failed to disable PFC on port %s", port_name.c_str());
+            }
+
+            SWSS_LOG_INFO("Disabled PFC on port %s", port_name.c_str());
+            continue;
         }
 
         sai_uint8_t old_pfc_enable = 0;
-        if (!gPortsOrch->getPortPfc(port.m_port_id, &old_pfc_enable))
+        if (!gPortsOrch->getPortPfc(portContext.port_oid, &old_pfc_enable))
         {
             SWSS_LOG_ERROR("Failed to retrieve PFC bits on port %s", port_name.c_str());
         }
 
-        if (pfc_enable || old_pfc_enable)
+        if (task.pfc_enable || old_pfc_enable)
         {
-            if (!gPortsOrch->setPortPfc(port.m_port_id, pfc_enable))
+            if (!gPortsOrch->setPortPfc(portContext.port_oid, task.pfc_enable))
             {
-                SWSS_LOG_ERROR("Failed to apply PFC bits 0x%x to port %s", pfc_enable, port_name.c_str());
+                SWSS_LOG_ERROR("Failed to apply PFC bits 0x%x to port %s", task.pfc_enable, port_name.c_str());
             }
 
-            SWSS_LOG_INFO("Applied PFC bits 0x%x to port %s", pfc_enable, port_name.c_str());
+            SWSS_LOG_INFO("Applied PFC bits 0x%x to port %s", task.pfc_enable, port_name.c_str());
         }
 
         // Save pfd_wd bitmask unconditionally
-        gPortsOrch->setPortPfcWatchdogStatus(port.m_port_id, pfcwd_sw_enable);
+        gPortsOrch->setPortPfcWatchdogStatus(portContext.port_oid, task.pfcwd_sw_enable);
+    }
+
+    if (op == SET_COMMAND)
+    {
+        SWSS_LOG_NOTICE("Applied QoS maps to ports");
     }
 
-    SWSS_LOG_NOTICE("Applied QoS maps to ports");
     return task_process_status::task_success;
 }
 
+void QosOrch::processPortQosMapBulk(Consumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> oids;
+    std::vector<sai_attribute_t> attrs;
+    std::vector<sai_status_t> statuses;
+
+    for (auto& task: m_portQosMapBulk)
+    {
+        for (auto& port: task.ports)
+        {
+            auto& applied = m_portQosMapIds[port.port_oid];
+            for (auto& attrContext: port.attrs)
+            {
+                /* Remember the value to restore if the port fails */
+                auto prev = applied.find(attrContext.attr_id);
+                attrContext.has_prev = prev != applied.end();
+                attrContext.prev_map_id = attrContext.has_prev ? prev->second : SAI_NULL_OBJECT_ID;
+                applied[attrContext.attr_id] = attrContext.map_id;
+
+                sai_attribute_t attr;
+                attr.id = attrContext.attr_id;
+                attr.value.oid = attrContext.map_id;
+
+                oids.push_back(port.port_oid);
+                attrs.push_back(attr);
+                statuses.push_back(SAI_STATUS_NOT_EXECUTED);
+            }
+        }
+    }
+
+    const auto objectCount = static_cast<uint32_t>(oids.size());
+
+    if (objectCount > 0)
+    {
+        SWSS_LOG_TIMER("Set %u ports qos map", objectCount);
+
+        sai_port_api->set_ports_attribute(objectCount, oids.data(), attrs.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+    }
+
+    size_t i = 0;
+    for (auto& task: m_portQosMapBulk)
+    {
+        for (auto& port: task.ports)
+        {
+            for (auto& attrContext: port.attrs)
+            {
+                attrContext.status = statuses[i];
+                i++;
+            }
+        }
+    }
+
+    /*
+     * A port either gets all the maps of its task or keeps the ones it had:
+     * the maps applied to a port that failed are set back to their previous value.
+     */
+    oids.clear();
+    attrs.clear();
+    std::vector<std::pair<sai_object_id_t, QosPortMapTask::AttrContext*>> rollbacks;
+
+    for (auto& task: m_portQosMapBulk)
+    {
+        for (auto& port: task.ports)
+        {
+            bool failed = false;
+            for (const auto& attrContext: port.attrs)
+            {
+                failed = failed || attrContext.status != SAI_STATUS_SUCCESS;
+            }
+
+            if (!failed)
+            {
+                continue;
+            }
+
+            auto& applied = m_portQosMapIds[port.port_oid];
+            for (auto& attrContext: port.attrs)
+            {
+                if (attrContext.has_prev)
+                {
+                    applied[attrContext.attr_id] = attrContext.prev_map_id;
+                }
+                else
+                {
+                    applied.erase(attrContext.attr_id);
+                }
+
+                if (attrContext.status != SAI_STATUS_SUCCESS || attrContext.map_id == attrContext.prev_map_id)
+                {
+                    continue;
+                }
+
+                sai_attribute_t attr;
+                attr.id = attrContext.attr_id;
+                attr.value.oid = attrContext.prev_map_id;
+
+                oids.push_back(port.port_oid);
+                attrs.push_back(attr);
+                rollbacks.emplace_back(port.port_oid, &attrContext);
+            }
+        }
+    }
+
+    if (!oids.empty())
+    {
+        statuses.assign(oids.size(), SAI_STATUS_NOT_EXECUTED);
+
+        sai_port_api->set_ports_attribute(static_cast<uint32_t>(oids.size()), oids.data(), attrs.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+
+        for (size_t j = 0; j < rollbacks.size(); j++)
+        {
+            if (statuses[j] != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to roll back %s on port 0x%" PRIx64 ", rv:%d",
+                               rollbacks[j].second->map_name.c_str(), rollbacks[j].first, statuses[j]);
+                /* The map stays applied */
+                m_portQosMapIds[rollbacks[j].first][rollbacks[j].second->attr_id] = rollbacks[j].second->map_id;
+            }
+        }
+    }
+
+    for (const auto& task: m_portQosMapBulk)
+    {
+        auto task_status = processPortQosMapPost(task);
+        if (task_status == task_process_status::task_need_retry)
+        {
+            consumer.m_toSync.emplace(kfvKey(task.kofvs), task.kofvs);
+        }
+    }
+
+    m_portQosMapBulk.clear();
+}
+
 void QosOrch::doTask()
 {
     SWSS_LOG_ENTER();
@@ -2285,7 +2661,9 @@ void QosOrch::doTask(Consumer &consumer)
             case task_process_status::task_failed :
                 SWSS_LOG_ERROR("Failed to process QOS task, drop it");
                 it = consumer.m_toSync.erase(it);
-                return;
+                /* Stop processing, the tasks staged so far are still flushed */
+                it = consumer.m_toSync.end();
+                break;
             case task_process_status::task_need_retry :
                 SWSS_LOG_INFO("Failed to process QOS task, retry it");
                 it++;
@@ -2296,6 +2674,12 @@ void QosOrch::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    auto flush_handler = m_qos_flush_handler_map.find(consumer.getTableName());
+    if (flush_handler != m_qos_flush_handler_map.end())
+    {
+        (this->*(flush_handler->second))(consumer);
+    }
 }
 
 /**
@@ -62,6 +62,57 @@ const string ecn_green_red                      = "ecn_green_red";
 const string ecn_green_yellow                   = "ecn_green_yellow";
 const string ecn_all                            = "ecn_all";
 
+struct QosPortMapTask
+{
+    struct AttrContext
+    {
+        std::string map_name;
+        sai_port_attr_t attr_id;
+        sai_object_id_t map_id = SAI_NULL_OBJECT_ID;
+        sai_object_id_t prev_map_id = SAI_NULL_OBJECT_ID;
+        bool has_prev = false;
+        sai_status_t status = SAI_STATUS_NOT_EXECUTED;
+    };
+
+    struct PortContext
+    {
+        std::string port_name;
+        sai_object_id_t port_oid = SAI_NULL_OBJECT_ID;
+        std::vector<AttrContext> attrs;
+    };
+
+    KeyOpFieldsValuesTuple kofvs;
+    sai_uint8_t pfc_enable = 0;
+    sai_uint8_t pfcwd_sw_enable = 0;
+    std::vector<PortContext> ports;
+};
+
+struct QosQueueTask
+{
+    struct QueueContext
+    {
+        size_t index;
+        // Scheduler group of the queue, SAI_NULL_OBJECT_ID if the scheduler is not applied to it
+        sai_object_id_t group_id = SAI_NULL_OBJECT_ID;
+        sai_object_id_t queue_id = SAI_NULL_OBJECT_ID;
+        sai_status_t scheduler_status = SAI_STATUS_NOT_EXECUTED;
+        sai_status_t wred_status = SAI_STATUS_NOT_EXECUTED;
+    };
+
+    struct PortContext
+    {
+        std::string port_name;
+        std::vector<QueueContext> queues;
+    };
+
+    KeyOpFieldsValuesTuple kofvs;
+    bool update_scheduler = false;
+    bool update_wred = false;
+    sai_object_id_t scheduler_profile = SAI_NULL_OBJECT_ID;
+    sai_object_id_t wred_profile = SAI_NULL_OBJECT_ID;
+    std::vector<PortContext> ports;
+};
+
 class QosMapHandler
 {
 public:
@@ -202,6 +253,10 @@ private:
     typedef map<string, qos_table_handler> qos_table_handler_map;
     typedef pair<string, qos_table_handler> qos_handler_pair;
 
+    typedef void (QosOrch::*qos_table_flush_handler)(Consumer& consumer);
+    typedef map<string, qos_table_flush_handler> qos_table_flush_handler_map;
+    typedef pair<string, qos_table_flush_handler> qos_flush_handler_pair;
+
     void initTableHandlers();
 
     task_process_status handleDscpToTcTable(Consumer& consumer, KeyOpFieldsValuesTuple &tuple);
@@ -224,11 +279,30 @@ private:
 
     sai_object_id_t getSchedulerGroup(const Port &port, const sai_object_id_t queue_id);
 
-    bool applySchedulerToQueueSchedulerGroup(Port &port, size_t queue_ind, sai_object_id_t scheduler_profile_id);
-    bool applyWredProfileToQueue(Port &port, size_t queue_ind, sai_object_id_t sai_wred_profile);
+    bool getQueueSchedulerGroup(Port port, size_t queue_ind, sai_object_id_t &group_id);
+    bool getWredQueue(Port &port, size_t queue_ind, sai_object_id_t &queue_id);
     bool applyDscpToTcMapToSwitch(sai_attr_id_t attr_id, sai_object_id_t sai_dscp_to_tc_map);
+
+    // These methods flush the tasks staged by handlePortQosMapTable and handleQueueTable
+    // with bulk SAI calls and update the task status per object.
+    void processPortQosMapBulk(Consumer& consumer);
+    void processQueueBulk(Consumer& consumer);
+
+    // These methods are invoked by the corresponding *Bulk methods after SAI operations complete
+    // and failed objects have been rolled back. These handle SAI return status code per task.
+    task_process_status processPortQosMapPost(const QosPortMapTask& task);
+    task_process_status processQueuePost(const QosQueueTask& task);
 private:
     qos_table_handler_map m_qos_handler_map;
+    qos_table_flush_handler_map m_qos_flush_handler_map;
+
+    // Bulk task buffers, in the order the tasks were processed
+    std::vector<QosPortMapTask> m_portQosMapBulk;
+    std::vector<QosQueueTask> m_queueBulk;
+
+    // Values applied by QosOrch, used to roll back objects on failure
+    std::unordered_map<sai_object_id_t, std::map<sai_port_attr_t, sai_object_id_t>> m_portQosMapIds;
+    std::unordered_map<sai_object_id_t, sai_object_id_t> m_schedulerGroupProfiles;
 
     struct SchedulerGroupPortInfo_t
     {
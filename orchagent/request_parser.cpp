@@ -16,6 +16,29 @@ using namespace std;
 using namespace swss;
 
 
+Request::Request(const request_description_t& request_description, const char key_separator, bool relaxed_attr_parsing)
+    : request_description_(request_description),
+      key_separator_(key_separator),
+      is_parsed_(false),
+      number_of_key_items_(request_description.key_item_types.size()),
+      relaxed_attr_parsing_(relaxed_attr_parsing)
+{
+    key_item_values_.resize(number_of_key_items_);
+    for (size_t i = 0; i < number_of_key_items_; i++)
+    {
+        key_item_values_[i].type = request_description_.key_item_types[i];
+    }
+
+    attr_item_values_.resize(request_description_.attr_item_types.size());
+    size_t index = 0;
+    for (const auto& attr: request_description_.attr_item_types)
+    {
+        attr_item_values_[index].type = attr.second;
+        attr_item_index_[attr.first] = index;
+        index++;
+    }
+}
+
 void Request::parse(const KeyOpFieldsValuesTuple& request)
 {
     if (is_parsed_)
@@ -35,17 +58,51 @@ void Request::clear()
     operation_.clear();
     full_key_.clear();
     attr_names_.clear();
-    key_item_strings_.clear();
-    key_item_mac_addresses_.clear();
-    attr_item_strings_.clear();
-    attr_item_bools_.clear();
-    attr_item_mac_addresses_.clear();
-    attr_item_packet_actions_.clear();
-    attr_item_string_list_.clear();
+    for (auto& item: key_item_values_)
+    {
+        item.present = false;
+    }
+    for (auto& item: attr_item_values_)
+    {
+        item.present = false;
+    }
 
     is_parsed_ = false;
 }
 
+const Request::Item& Request::getKeyItem(int position, request_types_t type) const
+{
+    if (position < 0 || static_cast<size_t>(position) >= key_item_values_.size())
+    {
+        throw std::out_of_range(std::string("Key item position out of range: ") + std::to_string(position));
+    }
+
+    const auto& item = key_item_values_[position];
+    if (!item.present || item.type != type)
+    {
+        throw std::out_of_range(std::string("Key item has another type: ") + std::to_string(position));
+    }
+
+    return item;
+}
+
+const Request::Item& Request::getAttrItem(const std::string& attr_name, request_types_t type) const
+{
+    const auto index = attr_item_index_.find(attr_name);
+    if (index == std::end(attr_item_index_))
+    {
+        throw std::out_of_range(std::string("Unknown attribute name: ") + attr_name);
+    }
+
+    const auto& item = attr_item_values_[index->second];
+    if (!item.present || item.type != type)
+    {
+        throw std::out_of_range(std::string("Attribute not found: ") + attr_name);
+    }
+
+    return item;
+}
+
 void Request::parseOperation(const KeyOpFieldsValuesTuple& request)
 {
     operation_ = kfvOp(request);
@@ -59,17 +116,23 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
 {
     full_key_ = kfvKey(request);
 
-    // split the key by separator
-    std::vector<std::string> key_items;
+    // split the key by separator, reusing the strings of the previous key
+    auto& key_items = key_items_;
+    size_t number_of_items = 0;
     size_t key_item_start = 0;
-    size_t key_item_end = full_key_.find(key_separator_);
-    while (key_item_end != std::string::npos)
+    size_t key_item_end;
+    do
     {
-        key_items.push_back(full_key_.substr(key_item_start, key_item_end - key_item_start));
-        key_item_start = key_item_end + 1;
         key_item_end = full_key_.find(key_separator_, key_item_start);
-    }
-    key_items.push_back(full_key_.substr(key_item_start, full_key_.length()));
+        if (number_of_items == key_items.size())
+        {
+            key_items.emplace_back();
+        }
+        key_items[number_of_items++].assign(full_key_, key_item_start,
+                                            key_item_end == std::string::npos ? std::string::npos : key_item_end - key_item_start);
+        key_item_start = key_item_end + 1;
+    } while (key_item_end != std::string::npos);
+    key_items.resize(number_of_items);
 
     /*
      * Attempt to parse an IPv6/MAC address only if the following conditions are met:
@@ -113,24 +176,17 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
     }
 
     // check types of the key items
-    for (int i = 0; i < static_cast<int>(number_of_key_items_); i++)
+    for (size_t i = 0; i < number_of_key_items_; i++)
     {
-        switch(request_description_.key_item_types[i])
+        auto& item = key_item_values_[i];
+        switch(item.type)
         {
             case REQ_T_STRING:
-                key_item_strings_[i] = key_items[i];
-                break;
             case REQ_T_MAC_ADDRESS:
-                key_item_mac_addresses_[i] = parseMacAddress(key_items[i]);
-                break;
             case REQ_T_IP:
-                key_item_ip_addresses_[i] = parseIpAddress(key_items[i]);
-                break;
             case REQ_T_IP_PREFIX:
-                key_item_ip_prefix_[i] = parseIpPrefix(key_items[i]);
-                break;
             case REQ_T_UINT:
-                key_item_uint_[i] = parseUint(key_items[i]);
+                parseItem(item, key_items[i]);
                 break;
             default:
                 throw std::logic_error(std::string("Not implemented key type parser. Key '")
@@ -143,7 +199,7 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
 
 void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
 {
-    const auto not_found = std::end(request_description_.attr_item_types);
+    const auto not_found = std::end(attr_item_index_);
 
     for (auto i = kfvFieldsValues(request).begin();
          i != kfvFieldsValues(request).end(); i++)
@@ -154,8 +210,8 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
             // it's used when we don't have any attributes, but we have to provide one for redis
             continue;
         }
-        const auto item = request_description_.attr_item_types.find(fvField(*i));
-        if (item == not_found)
+        const auto index = attr_item_index_.find(fvField(*i));
+        if (index == not_found)
         {
             if (!relaxed_attr_parsing_)
             {
@@ -167,54 +223,14 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
             }
         }
 
-        attr_names_.insert(fvField(*i));
-        switch(item->second)
+        auto& item = attr_item_values_[index->second];
+        if (item.type == REQ_T_NOT_USED)
         {
-            case REQ_T_STRING:
-                attr_item_strings_[fvField(*i)] = fvValue(*i);
-                break;
-            case REQ_T_BOOL:
-                attr_item_bools_[fvField(*i)] = parseBool(fvValue(*i));
-                break;
-            case REQ_T_MAC_ADDRESS:
-                attr_item_mac_addresses_[fvField(*i)] = parseMacAddress(fvValue(*i));
-                break;
-            case REQ_T_PACKET_ACTION:
-                attr_item_packet_actions_[fvField(*i)] = parsePacketAction(fvValue(*i));
-                break;
-            case REQ_T_VLAN:
-                attr_item_vlan_[fvField(*i)] = parseVlan(fvValue(*i));
-                break;
-            case REQ_T_IP:
-                attr_item_ip_[fvField(*i)] = parseIpAddress(fvValue(*i));
-                break;
-            case REQ_T_IP_PREFIX:
-                attr_item_ip_prefix_[fvField(*i)] = parseIpPrefix(fvValue(*i));
-                break;
-            case REQ_T_UINT:
-                attr_item_uint_[fvField(*i)] = parseUint(fvValue(*i));
-                break;
-            case REQ_T_SET:
-                attr_item_set_[fvField(*i)] = parseSet(fvValue(*i));
-                break;
-            case REQ_T_MAC_ADDRESS_LIST:
-                attr_item_mac_addresses_list_[fvField(*i)] = parseMacAddressList(fvValue(*i));
-                break;
-            case REQ_T_IP_LIST:
-                attr_item_ip_list_[fvField(*i)] = parseIpAddressList(fvValue(*i));
-                break;
-            case REQ_T_UINT_LIST:
-                attr_item_uint_list_[fvField(*i)] = parseUintList(fvValue(*i));
-                break;
-            case REQ_T_BOOL_LIST:
-                attr_item_bool_list_[fvField(*i)] = parseBoolList(fvValue(*i));
-                break;
-            case REQ_T_STRING_LIST:
-                attr_item_string_list_[fvField(*i)] = parseStringList(fvValue(*i));
-                break;
-            default:
-                throw std::logic_error(std::string("Not implemented attribute type parser for attribute:") + fvField(*i));
+            throw std::logic_error(std::string("Not implemented attribute type parser for attribute:") + fvField(*i));
         }
+
+        attr_names_.insert(fvField(*i));
+        parseItem(item, fvValue(*i));
     }
 
     if (operation_ == DEL_COMMAND && attr_names_.size() > 0)
@@ -234,6 +250,60 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
     }
 }
 
+void Request::parseItem(Item& item, const std::string& str)
+{
+    // An item is marked present only once its value is parsed
+    item.present = false;
+    switch(item.type)
+    {
+        case REQ_T_STRING:
+            item.str.assign(str);
+            break;
+        case REQ_T_BOOL:
+            item.b = parseBool(str);
+            break;
+        case REQ_T_MAC_ADDRESS:
+            item.mac = parseMacAddress(str);
+            break;
+        case REQ_T_PACKET_ACTION:
+            item.packet_action = parsePacketAction(str);
+            break;
+        case REQ_T_VLAN:
+            item.vlan = parseVlan(str);
+            break;
+        case REQ_T_IP:
+            item.ip = parseIpAddress(str);
+            break;
+        case REQ_T_IP_PREFIX:
+            item.ip_prefix = parseIpPrefix(str);
+            break;
+        case REQ_T_UINT:
+            item.uint = parseUint(str);
+            break;
+        case REQ_T_SET:
+            item.set = parseSet(str);
+            break;
+        case REQ_T_MAC_ADDRESS_LIST:
+            item.mac_list = parseMacAddressList(str);
+            break;
+        case REQ_T_IP_LIST:
+            item.ip_list = parseIpAddressList(str);
+            break;
+        case REQ_T_UINT_LIST:
+            item.uint_list = parseUintList(str);
+            break;
+        case REQ_T_BOOL_LIST:
+            item.bool_list = parseBoolList(str);
+            break;
+        case REQ_T_STRING_LIST:
+            item.string_list = parseStringList(str);
+            break;
+        default:
+            throw std::logic_error(std::string("Not implemented type parser for value:") + str);
+    }
+    item.present = true;
+}
+
 bool Request::parseBool(const std::string& str)
 {
     if (str == "true")
@@ -358,7 +428,7 @@ uint16_t Request::parseVlan(const std::string& str)
 
 sai_packet_action_t Request::parsePacketAction(const std::string& str)
 {
-    std::unordered_map<std::string, sai_packet_action_t> m = {
+    static const std::unordered_map<std::string, sai_packet_action_t> m = {
         {"drop", SAI_PACKET_ACTION_DROP},
         {"forward", SAI_PACKET_ACTION_FORWARD},
         {"copy", SAI_PACKET_ACTION_COPY},
@@ -54,31 +54,31 @@ public:
     const std::string& getKeyString(int position) const
     {
         assert(is_parsed_);
-        return key_item_strings_.at(position);
+        return getKeyItem(position, REQ_T_STRING).str;
     }
 
     const swss::MacAddress& getKeyMacAddress(int position) const
     {
         assert(is_parsed_);
-        return key_item_mac_addresses_.at(position);
+        return getKeyItem(position, REQ_T_MAC_ADDRESS).mac;
     }
 
     const swss::IpAddress& getKeyIpAddress(int position) const
     {
         assert(is_parsed_);
-        return key_item_ip_addresses_.at(position);
+        return getKeyItem(position, REQ_T_IP).ip;
     }
 
     const swss::IpPrefix& getKeyIpPrefix(int position) const
     {
         assert(is_parsed_);
-        return key_item_ip_prefix_.at(position);
+        return getKeyItem(position, REQ_T_IP_PREFIX).ip_prefix;
     }
 
     const uint64_t& getKeyUint(int position) const
     {
         assert(is_parsed_);
-        return key_item_uint_.at(position);
+        return getKeyItem(position, REQ_T_UINT).uint;
     }
 
     const std::unordered_set<std::string>& getAttrFieldNames() const
@@ -90,55 +90,55 @@ public:
     const std::string& getAttrString(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_strings_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_STRING).str;
     }
 
     bool getAttrBool(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_bools_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_BOOL).b;
     }
 
     const swss::MacAddress& getAttrMacAddress(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_mac_addresses_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_MAC_ADDRESS).mac;
     }
 
     sai_packet_action_t getAttrPacketAction(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_packet_actions_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_PACKET_ACTION).packet_action;
     }
 
     uint16_t getAttrVlan(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_vlan_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_VLAN).vlan;
     }
 
     swss::IpAddress getAttrIP(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_IP).ip;
     }
 
     swss::IpPrefix getAttrIpPrefix(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_prefix_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_IP_PREFIX).ip_prefix;
     }
 
     const uint64_t& getAttrUint(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_uint_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_UINT).uint;
     }
 
     const std::set<std::string>& getAttrSet(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_set_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_SET).set;
     }
 
     void setTableName(std::string& table_name)
@@ -155,42 +155,35 @@ public:
     const std::vector<swss::IpAddress>& getAttrIPList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_IP_LIST).ip_list;
     }
 
     const std::vector<swss::MacAddress>& getAttrMacAddressList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_mac_addresses_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_MAC_ADDRESS_LIST).mac_list;
     }
 
     const std::vector<uint64_t>& getAttrUintList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_uint_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_UINT_LIST).uint_list;
     }
 
     const std::vector<bool> getAttrBoolList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_bool_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_BOOL_LIST).bool_list;
     }
 
     const std::vector<std::string>& getAttrStringList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_string_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_STRING_LIST).string_list;
     }
 
 protected:
-    Request(const request_description_t& request_description, const char key_separator, bool relaxed_attr_parsing = false)
-        : request_description_(request_description),
-          key_separator_(key_separator),
-          is_parsed_(false),
-          relaxed_attr_parsing_(relaxed_attr_parsing),
-          number_of_key_items_(request_description.key_item_types.size())
-    {
-    }
+    Request(const request_description_t& request_description, const char key_separator, bool relaxed_attr_parsing = false);
 
 
 private:
@@ -219,30 +212,45 @@ private:
     // Enable if only interested in only a subset of attributes
     bool relaxed_attr_parsing_;
 
+    /*
+     * Parsed key and attribute values. The items are laid out once from the
+     * request description, an attribute name is resolved to its item with a
+     * single lookup, and the values are parsed in place. The items, and the
+     * memory of their strings and containers, are reused by the next request
+     * parsed by this object.
+     */
+    struct Item
+    {
+        request_types_t type = REQ_T_NOT_USED;
+        bool present = false;
+        std::string str;
+        bool b = false;
+        swss::MacAddress mac;
+        sai_packet_action_t packet_action = SAI_PACKET_ACTION_DROP;
+        uint16_t vlan = 0;
+        swss::IpAddress ip;
+        swss::IpPrefix ip_prefix;
+        uint64_t uint = 0;
+        std::set<std::string> set;
+        std::vector<swss::IpAddress> ip_list;
+        std::vector<swss::MacAddress> mac_list;
+        std::vector<uint64_t> uint_list;
+        std::vector<bool> bool_list;
+        std::vector<std::string> string_list;
+    };
+
+    void parseItem(Item& item, const std::string& str);
+    const Item& getKeyItem(int position, request_types_t type) const;
+    const Item& getAttrItem(const std::string& attr_name, request_types_t type) const;
+
     std::string table_name_;
     std::string operation_;
     std::string full_key_;
-    std::unordered_map<int, std::string> key_item_strings_;
-    std::unordered_map<int, swss::MacAddress> key_item_mac_addresses_;
-    std::unordered_map<int, swss::IpAddress> key_item_ip_addresses_;
-    std::unordered_map<int, swss::IpPrefix> key_item_ip_prefix_;
-    std::unordered_map<int, uint64_t> key_item_uint_;
+    std::vector<std::string> key_items_;
+    std::vector<Item> key_item_values_;
     std::unordered_set<std::string> attr_names_;
-    // FIXME: Make one union with all the values, except string
-    std::unordered_map<std::string, std::string> attr_item_strings_;
-    std::unordered_map<std::string, bool> attr_item_bools_;
-    std::unordered_map<std::string, std::vector<bool>> attr_item_bool_list_;
-    std::unordered_map<std::string, swss::MacAddress> attr_item_mac_addresses_;
-    std::unordered_map<std::string, sai_packet_action_t> attr_item_packet_actions_;
-    std::unordered_map<std::string, uint16_t> attr_item_vlan_;
-    std::unordered_map<std::string, swss::IpAddress> attr_item_ip_;
-    std::unordered_map<std::string, swss::IpPrefix> attr_item_ip_prefix_;
-    std::unordered_map<std::string, uint64_t> attr_item_uint_;
-    std::unordered_map<std::string, std::set<std::string>> attr_item_set_;
-    std::unordered_map<std::string, std::vector<swss::IpAddress>> attr_item_ip_list_;
-    std::unordered_map<std::string, std::vector<swss::MacAddress>> attr_item_mac_addresses_list_;
-    std::unordered_map<std::string, std::vector<uint64_t>> attr_item_uint_list_;
-    std::unordered_map<std::string, std::vector<std::string>> attr_item_string_list_;
+    std::unordered_map<std::string, size_t> attr_item_index_;
+    std::vector<Item> attr_item_values_;
 };
 
 #endif // __REQUEST_PARSER_H
@@ -97,31 +97,38 @@ void ResponsePublisher::publish(const std::string &table, const std::string &key
                                 const std::vector<swss::FieldValueTuple> &intent_attrs, const ReturnCode &status,
                                 const std::vector<swss::FieldValueTuple> &state_attrs, bool replace)
 {
-    auto intent_attrs_copy = intent_attrs;
-    // Add error message as the first field-value-pair.
-    swss::FieldValueTuple err_str("err_str", PrependedComponent(status) + status.message());
-    intent_attrs_copy.insert(intent_attrs_copy.begin(), err_str);
-    std::string response_channel = "APPL_DB_" + table + "_RESPONSE_CHANNEL";
+    const bool record = swss::Recorder::Instance().respub.isRecord();
 
-    if (m_enable_db_write_and_notify) {
-      if (m_zmqServer != nullptr) {
-        auto intent_attrs_zmq_copy = intent_attrs;
-        // Add status code and error message as the first field-value-pair.
-        swss::FieldValueTuple fvs(status.codeStr(),
-                                  PrependedComponent(status) + status.message());
-        intent_attrs_zmq_copy.insert(intent_attrs_zmq_copy.begin(), fvs);
-        // Queue the response.
-        responses[table].push_back(
-            swss::KeyOpFieldsValuesTuple{key, SET_COMMAND, intent_attrs_zmq_copy});
-      } else {
-        // Sends the response to the notification channel.
-        swss::NotificationProducer notificationProducer{
-            m_ntf_pipe.get(), response_channel, m_buffered};
-        notificationProducer.send(status.codeStr(), key, intent_attrs_copy);
-      }
-    }
+    if (m_enable_db_write_and_notify || record)
+    {
+        // Add error message as the first field-value-pair.
+        std::vector<swss::FieldValueTuple> response_attrs;
+        response_attrs.reserve(intent_attrs.size() + 1);
+        response_attrs.emplace_back("err_str", PrependedComponent(status) + status.message());
+        response_attrs.insert(response_attrs.end(), intent_attrs.begin(), intent_attrs.end());
+
+        if (record)
+        {
+            RecordResponse("APPL_DB_" + table + "_RESPONSE_CHANNEL", key, response_attrs, status.codeStr());
+        }
 
-    RecordResponse(response_channel, key, intent_attrs_copy, status.codeStr());
+        if (m_enable_db_write_and_notify)
+        {
+            if (m_zmqServer != nullptr)
+            {
+                // ZMQ responses carry the status code as the field of the
+                // first field-value-pair. Queue the response, the responses of
+                // a table are sent together on flush.
+                response_attrs.front().first = status.codeStr();
+                responses[table].emplace_back(key, SET_COMMAND, std::move(response_attrs));
+            }
+            else
+            {
+                // Sends the response to the notification channel.
+                getNotificationProducer(table).send(status.codeStr(), key, response_attrs);
+            }
+        }
+    }
 
     // Write to the DB only if: m_enable_db_write_and_notify is true and:
     // 1) A write operation is being performed and state attributes are specified.
@@ -141,12 +148,8 @@ void ResponsePublisher::publish(const std::string &table, const std::string &key
     // APPL_STATE_DB. In this case, pass the intent attributes as state
     // attributes. In case of a failure status, nothing needs to be written in
     // APPL_STATE_DB.
-    std::vector<swss::FieldValueTuple> state_attrs;
-    if (status.ok())
-    {
-        state_attrs = intent_attrs;
-    }
-    publish(table, key, intent_attrs, status, state_attrs, replace);
+    static const std::vector<swss::FieldValueTuple> no_state_attrs;
+    publish(table, key, intent_attrs, status, status.ok() ? intent_attrs : no_state_attrs, replace);
 }
 
 void ResponsePublisher::writeToDB(const std::string &table, const std::string &key,
@@ -171,16 +174,17 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
                                           const std::vector<swss::FieldValueTuple> &values, const std::string &op,
                                           bool replace)
 {
-    swss::Table applStateTable{m_db_pipe.get(), table, m_buffered};
+    swss::Table &applStateTable = getStateTable(table);
 
-    auto attrs = values;
     if (op == SET_COMMAND)
     {
         if (m_directDbWrite)
         {
-            applStateTable.set(key, attrs);
+            applStateTable.set(key, values);
             return;
         }
+
+        auto attrs = values;
         if (replace)
         {
             applStateTable.del(key);
@@ -247,13 +251,39 @@ void ResponsePublisher::flush() {
 void ResponsePublisher::setBuffered(bool buffered)
 {
     m_buffered = buffered;
+    // Producers take the buffering mode at construction.
+    m_ntfProducers.clear();
+}
+
+swss::NotificationProducer &ResponsePublisher::getNotificationProducer(const std::string &table)
+{
+    auto it = m_ntfProducers.find(table);
+    if (it == m_ntfProducers.end())
+    {
+        it = m_ntfProducers
+                 .emplace(table, std::make_unique<swss::NotificationProducer>(
+                                     m_ntf_pipe.get(), "APPL_DB_" + table + "_RESPONSE_CHANNEL", m_buffered))
+                 .first;
+    }
+    return *it->second;
+}
+
+swss::Table &ResponsePublisher::getStateTable(const std::string &table)
+{
+    auto it = m_stateTables.find(table);
+    if (it == m_stateTables.end())
+    {
+        it = m_stateTables.emplace(table, std::make_unique<swss::Table>(m_db_pipe.get(), table, m_buffered)).first;
+    }
+    it->second->setBuffered(m_buffered);
+    return *it->second;
 }
 
 void ResponsePublisher::dbUpdateThread()
 {
+    std::queue<entry, std::list<entry>> entries;
     while (true)
     {
-        entry e;
         {
             std::unique_lock<std::mutex> lock(m_lock);
             while (m_queue.empty())
@@ -261,20 +291,25 @@ void ResponsePublisher::dbUpdateThread()
                 m_signal.wait(lock);
             }
 
-            e = m_queue.front();
-            m_queue.pop();
-        }
-        if (e.shutdown)
-        {
-            break;
-        }
-        if (e.flush)
-        {
-            m_db_pipe->flush();
+            // Take all the pending writes at once to keep the pipeline filled.
+            std::swap(entries, m_queue);
         }
-        else
+        while (!entries.empty())
         {
-            writeToDBInternal(e.table, e.key, e.values, e.op, e.replace);
+            const entry &e = entries.front();
+            if (e.shutdown)
+            {
+                return;
+            }
+            if (e.flush)
+            {
+                m_db_pipe->flush();
+            }
+            else
+            {
+                writeToDBInternal(e.table, e.key, e.values, e.op, e.replace);
+            }
+            entries.pop();
         }
     }
 }
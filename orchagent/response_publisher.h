@@ -97,6 +97,12 @@ class ResponsePublisher : public ResponsePublisherInterface
     void writeToDBInternal(const std::string &table, const std::string &key,
                            const std::vector<swss::FieldValueTuple> &values, const std::string &op, bool replace);
 
+    // Returns the notification producer of the table response channel,
+    // created on first use.
+    swss::NotificationProducer &getNotificationProducer(const std::string &table);
+    // Returns the APPL_STATE_DB table, created on first use.
+    swss::Table &getStateTable(const std::string &table);
+
     std::unique_ptr<swss::DBConnector> m_db;
     std::unique_ptr<swss::RedisPipeline> m_ntf_pipe;
     std::unique_ptr<swss::RedisPipeline> m_db_pipe;
@@ -109,6 +115,11 @@ class ResponsePublisher : public ResponsePublisherInterface
     // Thread to write to DB.
     std::unique_ptr<std::thread> m_update_thread;
     std::queue<entry, std::list<entry>> m_queue;
+    // Per table response channel producers and APPL_STATE_DB tables, so
+    // that a response does not build a channel name, a producer or a table.
+    // The state tables are only used by the thread writing to the DB.
+    std::unordered_map<std::string, std::unique_ptr<swss::NotificationProducer>> m_ntfProducers;
+    std::unordered_map<std::string, std::unique_ptr<swss::Table>> m_stateTables;
     mutable std::mutex m_lock;
     std::condition_variable m_signal;
     bool m_enable_db_write_and_notify{true};
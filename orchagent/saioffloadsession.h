@@ -49,6 +49,8 @@ struct SaiOffloadHandlerTraits<sai_bfd_api_t>
     using get_session_stats_ext_fn = sai_get_bfd_session_stats_ext_fn;
     using clear_session_stats_fn = sai_clear_bfd_session_stats_fn;
     using notif_t = sai_bfd_session_state_notification_t;
+    using state_t = sai_bfd_session_state_t;
+    static sai_object_id_t notif_session_id(const notif_t &notif) { return notif.bfd_session_id; }
 };
 
 template<>
@@ -63,6 +65,60 @@ struct SaiOffloadHandlerTraits<sai_icmp_echo_api_t>
     using get_session_stats_ext_fn = sai_get_icmp_echo_session_stats_ext_fn;
     using clear_session_stats_fn = sai_clear_icmp_echo_session_stats_fn;
     using notif_t = sai_icmp_echo_session_state_notification_t;
+    using state_t = sai_icmp_echo_session_state_t;
+    static sai_object_id_t notif_session_id(const notif_t &notif) { return notif.icmp_echo_session_id; }
+};
+
+/**
+ *@class SaiOffloadStateBatch
+ *
+ *@brief Collects the session state notifications drained in one run and
+ *       keeps only the last state of each session, in first seen order
+ */
+template<typename T>
+class SaiOffloadStateBatch
+{
+public:
+    using Tapis = SaiOffloadHandlerTraits<T>;
+    using state_t = typename Tapis::state_t;
+    using session_state_t = std::pair<sai_object_id_t, state_t>;
+
+    /**
+     *@method add
+     *
+     *@brief Add the entries of one deserialized notification
+     *
+     *@param count(in)  number of entries
+     *@param notif(in)  notification entries
+     */
+    void add(uint32_t count, const typename Tapis::notif_t *notif)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            auto id = Tapis::notif_session_id(notif[i]);
+            auto rc = m_index.emplace(id, m_states.size());
+            if (rc.second)
+            {
+                m_states.emplace_back(id, notif[i].session_state);
+            }
+            else
+            {
+                m_states[rc.first->second].second = notif[i].session_state;
+            }
+        }
+    }
+
+    const std::vector<session_state_t>& states() const { return m_states; }
+
+    void clear()
+    {
+        m_states.clear();
+        m_index.clear();
+    }
+
+private:
+    std::vector<session_state_t> m_states;
+    std::unordered_map<sai_object_id_t, size_t> m_index;
 };
 
 /**
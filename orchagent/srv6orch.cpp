@@ -38,6 +38,7 @@ extern sai_router_interface_api_t* sai_router_intfs_api;
 extern RouteOrch *gRouteOrch;
 extern CrmOrch *gCrmOrch;
 extern bool gTraditionalFlexCounter;
+extern size_t gMaxBulkSize;
 
 const map<string, sai_my_sid_entry_endpoint_behavior_t> end_behavior_map =
 {
@@ -106,7 +107,9 @@ Srv6Orch::Srv6Orch(DBConnector *cfgDb, DBConnector *applDb, const vector<TableCo
     m_piccontextTable(applDb, APP_PIC_CONTEXT_TABLE_NAME),
     m_mysidCfgTable(cfgDb, CFG_SRV6_MY_SID_TABLE_NAME),
     m_locatorCfgTable(cfgDb, CFG_SRV6_MY_LOCATOR_TABLE_NAME),
-    m_counter_manager(SRV6_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, SRV6_STAT_COUNTER_POLLING_INTERVAL_MS, false)
+    m_counter_manager(SRV6_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, SRV6_STAT_COUNTER_POLLING_INTERVAL_MS, false),
+    m_mysid_bulker(sai_srv6_api, gMaxBulkSize),
+    m_sidlist_bulker(sai_srv6_api, gSwitchId, gMaxBulkSize)
 {
     m_neighOrch->attach(this);
 
@@ -193,11 +196,9 @@ bool Srv6Orch::addMySidCounter(const sai_my_sid_entry_t& sai_entry, sai_object_i
     }
 
     auto key = getMySidCounterKey(sai_entry);
-    vector<FieldValueTuple> fvs = {
-        {key, sai_serialize_object_id(counter_oid)}
-    };
 
-    m_mysid_counters_table->set("", fvs);
+    /* The name map is written once for all the counters of the batch */
+    m_pending_counter_names.emplace_back(key, sai_serialize_object_id(counter_oid));
 
     auto was_empty = m_pending_counters.empty();
     m_pending_counters[counter_oid] = key;
@@ -221,6 +222,7 @@ void Srv6Orch::removeMySidCounter(const sai_my_sid_entry_t& sai_entry, sai_objec
 
     auto key = getMySidCounterKey(sai_entry);
 
+    flushMySidCounterNames();
     m_mysid_counters_table->hdel("", key);
 
     auto was_pending = m_pending_counters.erase(counter_oid) == 1;
@@ -234,19 +236,17 @@ void Srv6Orch::removeMySidCounter(const sai_my_sid_entry_t& sai_entry, sai_objec
     counter_oid = SAI_NULL_OBJECT_ID;
 }
 
-void Srv6Orch::setMySidEntryCounter(const sai_my_sid_entry_t& sai_entry, sai_object_id_t counter_oid)
+void Srv6Orch::flushMySidCounterNames()
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t attr;
-    attr.id = SAI_MY_SID_ENTRY_ATTR_COUNTER_ID;
-    attr.value.oid = counter_oid;
-
-    auto status = sai_srv6_api->set_my_sid_entry_attribute(&sai_entry, &attr);
-    if (status != SAI_STATUS_SUCCESS)
+    if (m_pending_counter_names.empty())
     {
-        SWSS_LOG_ERROR("Failed to set my_sid entry counter oid to %s, rc: %s", sai_serialize_object_id(counter_oid).c_str(), sai_serialize_status(status).c_str());
+        return;
     }
+
+    m_mysid_counters_table->set("", m_pending_counter_names);
+    m_pending_counter_names.clear();
 }
 
 void Srv6Orch::setCountersState(bool enable)
@@ -266,6 +266,15 @@ void Srv6Orch::setCountersState(bool enable)
 
     SWSS_LOG_NOTICE("Setting SRv6 MySID counters state to %s", enable ? "enabled" : "disabled");
 
+    /* Entries still queued in the bulker would be missed by the walk below */
+    flushMySidEntries();
+
+    vector<sai_status_t> statuses(srv6_my_sid_table_.size());
+    size_t idx = 0;
+
+    sai_attribute_t attr;
+    attr.id = SAI_MY_SID_ENTRY_ATTR_COUNTER_ID;
+
     for (auto& mysid : srv6_my_sid_table_)
     {
         const auto& sai_entry = mysid.second.entry;
@@ -274,10 +283,29 @@ void Srv6Orch::setCountersState(bool enable)
         if (enable)
         {
             addMySidCounter(sai_entry, counter_oid);
-            setMySidEntryCounter(sai_entry, counter_oid);
-        } else {
-            setMySidEntryCounter(sai_entry, SAI_NULL_OBJECT_ID);
-            removeMySidCounter(sai_entry, counter_oid);
+        }
+
+        attr.value.oid = enable ? counter_oid : SAI_NULL_OBJECT_ID;
+        m_mysid_bulker.set_entry_attribute(&statuses[idx++], &sai_entry, &attr);
+    }
+
+    m_mysid_bulker.flush();
+    flushMySidCounterNames();
+
+    idx = 0;
+    for (auto& mysid : srv6_my_sid_table_)
+    {
+        auto status = statuses[idx++];
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to set my_sid entry %s counter oid to %s, rc: %s", mysid.first.c_str(),
+                           sai_serialize_object_id(enable ? mysid.second.counter : SAI_NULL_OBJECT_ID).c_str(),
+                           sai_serialize_status(status).c_str());
+        }
+
+        if (!enable)
+        {
+            removeMySidCounter(mysid.second.entry, mysid.second.counter);
         }
     }
 
@@ -1045,6 +1073,10 @@ bool Srv6Orch::srv6Nexthops(const NextHopGroupKey &nhgKey, sai_object_id_t &next
 bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list, const string sidlist_type)
 {
     SWSS_LOG_ENTER();
+    if (m_pending_sidlist_names.count(sid_name))
+    {
+        flushSidLists();
+    }
     bool exists = (sid_table_.find(sid_name) != sid_table_.end()) && sid_table_[sid_name].sid_object_id;
     sai_segment_list_t segment_list;
     vector<string>sid_ips = tokenize(sid_list, SID_LIST_DELIMITER);
@@ -1070,9 +1102,14 @@ bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list,
     sai_status_t status;
     if (!exists)
     {
-        /* Create sidlist object with list of ipv6 prefixes */
+        /* Queue the creation of the sidlist object with list of ipv6 prefixes */
         SWSS_LOG_INFO("Create SID list");
-        vector<sai_attribute_t> attributes;
+        m_sidlist_bulk_ctx.emplace_back();
+        auto& ctx = m_sidlist_bulk_ctx.back();
+        ctx.name = sid_name;
+        ctx.create = true;
+        ctx.segments = std::move(segment_buf);
+        auto& attributes = ctx.attrs;
         attr.id = SAI_SRV6_SIDLIST_ATTR_SEGMENT_LIST;
         attr.value.segmentlist.list = segment_list.list;
         attr.value.segmentlist.count = segment_list.count;
@@ -1090,13 +1127,8 @@ bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list,
             attr.value.s32 = sidlist_type_map.at(sidlist_type);
         }
         attributes.push_back(attr);
-        status = sai_srv6_api->create_srv6_sidlist(&segment_oid, gSwitchId, (uint32_t) attributes.size(), attributes.data());
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to create srv6 sidlist object, rv %d", status);
-            return false;
-        }
-        sid_table_[sid_name].sid_object_id = segment_oid;
+        m_sidlist_bulker.create_entry(&ctx.oid, (uint32_t) attributes.size(), attributes.data());
+        m_pending_sidlist_names.insert(sid_name);
     }
     else
     {
@@ -1120,7 +1152,10 @@ bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list,
 task_process_status Srv6Orch::deleteSidList(const string sid_name)
 {
     SWSS_LOG_ENTER();
-    sai_status_t status = SAI_STATUS_SUCCESS;
+    if (m_pending_sidlist_names.count(sid_name))
+    {
+        flushSidLists();
+    }
     if (sid_table_.find(sid_name) == sid_table_.end())
     {
         SWSS_LOG_ERROR("segment name %s doesn't exist", sid_name.c_str());
@@ -1134,14 +1169,52 @@ task_process_status Srv6Orch::deleteSidList(const string sid_name)
         return task_process_status::task_need_retry;
     }
     SWSS_LOG_INFO("Remove sid list, segname %s", sid_name.c_str());
-    status = sai_srv6_api->remove_srv6_sidlist(sid_table_[sid_name].sid_object_id);
-    if (status != SAI_STATUS_SUCCESS)
+    m_sidlist_bulk_ctx.emplace_back();
+    auto& ctx = m_sidlist_bulk_ctx.back();
+    ctx.name = sid_name;
+    ctx.create = false;
+    ctx.oid = sid_table_[sid_name].sid_object_id;
+    m_sidlist_bulker.remove_entry(&ctx.status, ctx.oid);
+    m_pending_sidlist_names.insert(sid_name);
+    return task_process_status::task_success;
+}
+
+void Srv6Orch::flushSidLists()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_sidlist_bulk_ctx.empty())
     {
-        SWSS_LOG_ERROR("Failed to delete SRV6 sidlist object for %s", sid_name.c_str());
-        return task_process_status::task_failed;
+        return;
     }
-    sid_table_.erase(sid_name);
-    return task_process_status::task_success;
+
+    m_sidlist_bulker.flush();
+
+    for (auto& ctx : m_sidlist_bulk_ctx)
+    {
+        if (ctx.create)
+        {
+            if (ctx.oid == SAI_NULL_OBJECT_ID)
+            {
+                SWSS_LOG_ERROR("Failed to create srv6 sidlist object for %s", ctx.name.c_str());
+                continue;
+            }
+            sid_table_[ctx.name].sid_object_id = ctx.oid;
+        }
+        else
+        {
+            if (ctx.status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to delete SRV6 sidlist object for %s, rv %d", ctx.name.c_str(), ctx.status);
+                continue;
+            }
+            sid_table_.erase(ctx.name);
+        }
+    }
+
+    m_sidlist_bulker.clear();
+    m_sidlist_bulk_ctx.clear();
+    m_pending_sidlist_names.clear();
 }
 
 task_process_status Srv6Orch::doTaskSidTable(const KeyOpFieldsValuesTuple & tuple)
@@ -1234,7 +1307,7 @@ void Srv6Orch::updateNeighbor(const NeighborUpdate& update)
         auto &nexthop_key = it->first;
         auto &pending_my_sid_entries = it->second;
 
-        for (auto iter = pending_my_sid_entries.begin(); iter != pending_my_sid_entries.end();)
+        for (auto iter = pending_my_sid_entries.begin(); iter != pending_my_sid_entries.end(); ++iter)
         {
             string my_sid_string = get<0>(*iter);
             const string dt_vrf = get<1>(*iter);
@@ -1246,11 +1319,21 @@ void Srv6Orch::updateNeighbor(const NeighborUpdate& update)
             if(!createUpdateMysidEntry(my_sid_string, dt_vrf, adj, end_action))
             {
                 SWSS_LOG_ERROR("Failed to create/update my_sid entry for sid %s", my_sid_string.c_str());
+            }
+        }
+
+        /* Program the SIDs at once, the ones installed are no longer pending */
+        flushMySidEntries();
+
+        for (auto iter = pending_my_sid_entries.begin(); iter != pending_my_sid_entries.end();)
+        {
+            if (!mySidExists(get<0>(*iter)))
+            {
                 ++iter;
                 continue;
             }
 
-            SWSS_LOG_INFO("SID %s created successfully", my_sid_string.c_str());
+            SWSS_LOG_INFO("SID %s created successfully", get<0>(*iter).c_str());
 
             iter = pending_my_sid_entries.erase(iter);
         }
@@ -1270,12 +1353,15 @@ void Srv6Orch::updateNeighbor(const NeighborUpdate& update)
         SWSS_LOG_INFO("Neighbor DELETE event: %s alias '%s', removing associated SRv6 SIDs",
                         update.entry.ip_address.to_string().c_str(), update.entry.alias.c_str());
 
-        for (auto it = srv6_my_sid_table_.begin(); it != srv6_my_sid_table_.end();)
+        /* Entries queued by an ongoing batch must be in the table before it is walked */
+        flushMySidEntries();
+
+        vector<tuple<string, string, string, string>> removed_my_sid_entries;
+        for (auto it = srv6_my_sid_table_.begin(); it != srv6_my_sid_table_.end(); ++it)
         {
             /* Skip SIDs that are not associated with a L3 Adjacency */
             if (it->second.endAdjString.empty())
             {
-                ++it;
                 continue;
             }
 
@@ -1284,14 +1370,12 @@ void Srv6Orch::updateNeighbor(const NeighborUpdate& update)
                 /* Skip SIDs that are not associated with this neighbor */
                 if (IpAddress(it->second.endAdjString) != update.entry.ip_address)
                 {
-                    ++it;
                     continue;
                 }
             }
             catch (const std::invalid_argument &e)
             {
                 /* SRv6 SID is associated with an invalid L3 Adjacency IP address, skipping */
-                ++it;
                 continue;
             }
 
@@ -1315,30 +1399,36 @@ void Srv6Orch::updateNeighbor(const NeighborUpdate& update)
             /* Skip SIDs with unknown SRv6 behavior */
             if (end_action.empty())
             {
-                ++it;
                 continue;
             }
 
             SWSS_LOG_INFO("Removing SID %s, action %s, vrf %s, adj %s", my_sid_string.c_str(), dt_vrf.c_str(), adj.c_str(), end_action.c_str());
 
-            /* Let's delete the SID from the ASIC */
-            unordered_map<string, MySidEntry>::iterator tmp = it;
-            ++tmp;
+            /* Let's queue the removal of the SID from the ASIC, the table is left untouched until the flush */
             if(!deleteMysidEntry(it->first))
             {
                 SWSS_LOG_ERROR("Failed to delete my_sid entry for sid %s", it->first.c_str());
-                ++it;
                 continue;
             }
-            it = tmp;
 
-            SWSS_LOG_INFO("SID %s removed successfully", my_sid_string.c_str());
+            removed_my_sid_entries.push_back(make_tuple(my_sid_string, dt_vrf, adj, end_action));
+        }
+
+        flushMySidEntries();
+
+        for (auto& pending_mysid_entry : removed_my_sid_entries)
+        {
+            if (mySidExists(get<0>(pending_mysid_entry)))
+            {
+                continue;
+            }
+
+            SWSS_LOG_INFO("SID %s removed successfully", get<0>(pending_mysid_entry).c_str());
 
             /*
              * Finally, add the SID to the pending MySID entries set, so that we can re-install it 
              * when the neighbor comes back
              */
-            auto pending_mysid_entry = make_tuple(my_sid_string, dt_vrf, adj, end_action);
             m_pendingSRv6MySIDEntries[NextHopKey(update.entry.ip_address.to_string(), update.entry.alias)].insert(pending_mysid_entry);
         }
     }
@@ -1438,6 +1528,11 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
     sai_my_sid_entry_endpoint_behavior_t end_behavior;
     sai_my_sid_entry_endpoint_behavior_flavor_t end_flavor = SAI_MY_SID_ENTRY_ENDPOINT_BEHAVIOR_FLAVOR_NONE;
 
+    if (m_pending_mysid_keys.count(key_string))
+    {
+        flushMySidEntries();
+    }
+
     bool entry_exists = false;
     if (mySidExists(key_string))
     {
@@ -1549,6 +1644,7 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
     }
 
     boost::optional<sai_tunnel_dscp_mode_t> dscp_mode;
+    sai_object_id_t term_entry_oid = SAI_NULL_OBJECT_ID;
     if (mySidTunnelRequired(my_sid_string, my_sid_entry, end_behavior, dscp_mode))
     {
         sai_object_id_t tunnel_oid;
@@ -1558,7 +1654,6 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
             return false;
         }
 
-        sai_object_id_t term_entry_oid;
         ok = createMySidIpInIpTunnelTermEntry(tunnel_oid, my_sid_entry.sid, term_entry_oid);
         if (!ok)
         {
@@ -1566,8 +1661,11 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
             return false;
         }
 
-        srv6_my_sid_table_[key_string].tunnel_term_entry = term_entry_oid;
-        srv6_my_sid_table_[key_string].dscp_mode = dscp_mode.get();
+        if (entry_exists)
+        {
+            srv6_my_sid_table_[key_string].tunnel_term_entry = term_entry_oid;
+            srv6_my_sid_table_[key_string].dscp_mode = dscp_mode.get();
+        }
 
         attr.id = SAI_MY_SID_ENTRY_ATTR_TUNNEL_ID;
         attr.value.oid = tunnel_oid;
@@ -1596,6 +1694,11 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
             auto ok = addMySidCounter(my_sid_entry, counter_oid);
             if (!ok)
             {
+                if (term_entry_oid != SAI_NULL_OBJECT_ID)
+                {
+                    removeMySidIpInIpTunnelTermEntry(term_entry_oid);
+                    removeMySidIpInIpTunnel(dscp_mode.get());
+                }
                 return false;
             }
 
@@ -1604,14 +1707,24 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
             attributes.push_back(attr);
         }
 
-        status = sai_srv6_api->create_my_sid_entry(&my_sid_entry, (uint32_t) attributes.size(), attributes.data());
-        if (status != SAI_STATUS_SUCCESS)
-        {
-          SWSS_LOG_ERROR("Failed to create my_sid entry %s, rv %d", key_string.c_str(), status);
-          return false;
-        }
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_MY_SID_ENTRY);
-        srv6_my_sid_table_[key_string].counter = counter_oid;
+        /*
+         * The entry is created in bulk at the end of the batch and only
+         * added to the cache by commitMySidEntryCreate once programmed.
+         */
+        m_mysid_bulk_ctx.emplace_back();
+        auto& ctx = m_mysid_bulk_ctx.back();
+        ctx.key = key_string;
+        ctx.entry = my_sid_entry;
+        ctx.create = true;
+        ctx.end_behavior = end_behavior;
+        ctx.vrf = vrf_update ? dt_vrf : "";
+        ctx.adj = nh_update ? adj : "";
+        ctx.counter = counter_oid;
+        ctx.tunnel_term_entry = term_entry_oid;
+        ctx.dscp_mode = dscp_mode ? dscp_mode.get() : SAI_TUNNEL_DSCP_MODE_UNIFORM_MODEL;
+        m_mysid_bulker.create_entry(&ctx.status, &ctx.entry, (uint32_t) attributes.size(), attributes.data());
+        m_pending_mysid_keys.insert(key_string);
+        return true;
     }
     else
     {
@@ -1657,60 +1770,149 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
 
 bool Srv6Orch::deleteMysidEntry(const string my_sid_string)
 {
-    sai_status_t status = SAI_STATUS_SUCCESS;
+    if (m_pending_mysid_keys.count(my_sid_string))
+    {
+        flushMySidEntries();
+    }
     if (!mySidExists(my_sid_string))
     {
         SWSS_LOG_ERROR("My_sid_entry doesn't exist for %s", my_sid_string.c_str());
         return false;
     }
-    sai_my_sid_entry_t my_sid_entry = srv6_my_sid_table_[my_sid_string].entry;
-    sai_object_id_t& counter = srv6_my_sid_table_[my_sid_string].counter;
 
     SWSS_LOG_NOTICE("MySid Delete: sid %s", my_sid_string.c_str());
-    status = sai_srv6_api->remove_my_sid_entry(&my_sid_entry);
-    if (status != SAI_STATUS_SUCCESS)
+
+    /* The entry is removed in bulk, the cache is updated by commitMySidEntryRemove */
+    m_mysid_bulk_ctx.emplace_back();
+    auto& ctx = m_mysid_bulk_ctx.back();
+    ctx.key = my_sid_string;
+    ctx.entry = srv6_my_sid_table_[my_sid_string].entry;
+    ctx.create = false;
+    m_mysid_bulker.remove_entry(&ctx.status, &ctx.entry);
+    m_pending_mysid_keys.insert(my_sid_string);
+    return true;
+}
+
+void Srv6Orch::flushMySidEntries()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_mysid_bulk_ctx.empty())
     {
-        SWSS_LOG_ERROR("Failed to delete my_sid entry rv %d", status);
-        return false;
+        return;
+    }
+
+    m_mysid_bulker.flush();
+
+    for (auto& ctx : m_mysid_bulk_ctx)
+    {
+        if (ctx.create)
+        {
+            commitMySidEntryCreate(ctx);
+        }
+        else
+        {
+            commitMySidEntryRemove(ctx);
+        }
+    }
+
+    m_mysid_bulker.clear();
+    m_mysid_bulk_ctx.clear();
+    m_pending_mysid_keys.clear();
+
+    flushMySidCounterNames();
+}
+
+void Srv6Orch::commitMySidEntryCreate(MySidBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    if (ctx.status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to create my_sid entry %s, rv %d", ctx.key.c_str(), ctx.status);
+
+        removeMySidCounter(ctx.entry, ctx.counter);
+        if (ctx.tunnel_term_entry != SAI_NULL_OBJECT_ID)
+        {
+            removeMySidIpInIpTunnelTermEntry(ctx.tunnel_term_entry);
+            removeMySidIpInIpTunnel(ctx.dscp_mode);
+        }
+        return;
+    }
+    gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_MY_SID_ENTRY);
+
+    SWSS_LOG_INFO("Store keystring %s in cache", ctx.key.c_str());
+    auto& mysid = srv6_my_sid_table_[ctx.key];
+    mysid.entry = ctx.entry;
+    mysid.endBehavior = ctx.end_behavior;
+    mysid.counter = ctx.counter;
+    mysid.tunnel_term_entry = ctx.tunnel_term_entry;
+    mysid.dscp_mode = ctx.dscp_mode;
+
+    if (!ctx.vrf.empty())
+    {
+        m_vrfOrch->increaseVrfRefCount(ctx.vrf);
+        mysid.endVrfString = ctx.vrf;
+    }
+    if (!ctx.adj.empty())
+    {
+        NextHopKey nexthop(ctx.adj);
+        m_neighOrch->increaseNextHopRefCount(nexthop, 1);
+
+        SWSS_LOG_INFO("Increasing refcount to %d for Nexthop %s",
+          m_neighOrch->getNextHopRefCount(nexthop), nexthop.to_string(false,true).c_str());
+
+        mysid.endAdjString = ctx.adj;
+    }
+}
+
+void Srv6Orch::commitMySidEntryRemove(MySidBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    if (ctx.status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to delete my_sid entry %s, rv %d", ctx.key.c_str(), ctx.status);
+        return;
     }
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SRV6_MY_SID_ENTRY);
 
-    removeMySidCounter(my_sid_entry, counter);
+    auto& mysid = srv6_my_sid_table_[ctx.key];
+    removeMySidCounter(mysid.entry, mysid.counter);
 
-    auto endBehavior = srv6_my_sid_table_[my_sid_string].endBehavior;
+    auto endBehavior = mysid.endBehavior;
     /* Decrease VRF refcount */
     if (mySidVrfRequired(endBehavior))
     {
-        m_vrfOrch->decreaseVrfRefCount(srv6_my_sid_table_[my_sid_string].endVrfString);
+        m_vrfOrch->decreaseVrfRefCount(mysid.endVrfString);
     }
     /* Decrease NextHop refcount */
     if (mySidNextHopRequired(endBehavior))
     {
-        NextHopKey nexthop = NextHopKey(srv6_my_sid_table_[my_sid_string].endAdjString);
+        NextHopKey nexthop = NextHopKey(mysid.endAdjString);
         m_neighOrch->decreaseNextHopRefCount(nexthop, 1);
 
         SWSS_LOG_INFO("Decreasing refcount to %d for Nexthop %s",
           m_neighOrch->getNextHopRefCount(nexthop), nexthop.to_string(false,true).c_str());
     }
 
-    auto tunnel_term_entry = srv6_my_sid_table_[my_sid_string].tunnel_term_entry;
+    auto tunnel_term_entry = mysid.tunnel_term_entry;
     if (tunnel_term_entry != SAI_NULL_OBJECT_ID)
     {
         auto ok = removeMySidIpInIpTunnelTermEntry(tunnel_term_entry);
         if (!ok)
         {
-            return false;
+            return;
         }
 
-        ok = removeMySidIpInIpTunnel(srv6_my_sid_table_[my_sid_string].dscp_mode);
+        ok = removeMySidIpInIpTunnel(mysid.dscp_mode);
         if (!ok)
         {
-            return false;
+            return;
         }
     }
 
-    srv6_my_sid_table_.erase(my_sid_string);
-    return true;
+    srv6_my_sid_table_.erase(ctx.key);
 }
 
 uint32_t Srv6Orch::getAggId(const NextHopGroupKey &nhg)
@@ -2392,4 +2594,7 @@ void Srv6Orch::doTask(Consumer &consumer)
         }
         consumer.m_toSync.erase(it++);
     }
+
+    flushSidLists();
+    flushMySidEntries();
 }
@@ -1,6 +1,7 @@
 #ifndef SWSS_SRV6ORCH_H
 #define SWSS_SRV6ORCH_H
 
+#include <deque>
 #include <vector>
 #include <string>
 #include <set>
@@ -19,6 +20,7 @@
 #include "nexthopkey.h"
 #include "neighorch.h"
 #include "producerstatetable.h"
+#include "bulker.h"
 
 #include "ipaddress.h"
 #include "ipaddresses.h"
@@ -52,6 +54,32 @@ struct MySidEntry
     sai_object_id_t   counter;
 };
 
+/* MySID entry create or remove queued in the bulker until the end of the batch */
+struct MySidBulkContext
+{
+    string key;
+    sai_my_sid_entry_t entry;
+    bool create;
+    sai_status_t status;
+    sai_my_sid_entry_endpoint_behavior_t end_behavior;
+    string vrf;
+    string adj;
+    sai_object_id_t counter;
+    sai_object_id_t tunnel_term_entry;
+    sai_tunnel_dscp_mode_t dscp_mode;
+};
+
+/* SID list create or remove queued in the bulker, owns the segment buffer */
+struct SidListBulkContext
+{
+    string name;
+    bool create;
+    sai_object_id_t oid;
+    sai_status_t status;
+    unique_ptr<sai_ip6_t[]> segments;
+    vector<sai_attribute_t> attrs;
+};
+
 struct MySidIpInIpTunnel
 {
     sai_object_id_t overlay_rif_oid;
@@ -233,7 +261,11 @@ class Srv6Orch : public Orch, public Observer
         IpAddress getMySidAddress(const sai_my_sid_entry_t& sai_entry) const;
         bool addMySidCounter(const sai_my_sid_entry_t& sai_entry, sai_object_id_t& counter_oid);
         void removeMySidCounter(const sai_my_sid_entry_t& sai_entry, sai_object_id_t& counter_oid);
-        void setMySidEntryCounter(const sai_my_sid_entry_t& sai_entry, sai_object_id_t counter_oid);
+        void flushMySidCounterNames();
+        void flushSidLists();
+        void flushMySidEntries();
+        void commitMySidEntryCreate(MySidBulkContext& ctx);
+        void commitMySidEntryRemove(MySidBulkContext& ctx);
 
         ProducerStateTable m_sidTable;
         ProducerStateTable m_mysidTable;
@@ -275,6 +307,19 @@ class Srv6Orch : public Orch, public Observer
          *           each SID entry is encoded as a tuple <My SID key, VRF name, Adjacency, SRv6 Behavior>
          */
         map<NextHopKey, set<tuple<string, string, string, string>>> m_pendingSRv6MySIDEntries;
+
+        /*
+         * MySID entries and SID lists are created and removed in bulk. The
+         * requests of a batch are queued in the bulkers and flushed at the
+         * end of doTask, the contexts keep the state to commit afterwards.
+         */
+        EntityBulker<sai_srv6_api_t> m_mysid_bulker;
+        ObjectBulker<sai_srv6_api_t> m_sidlist_bulker;
+        deque<MySidBulkContext> m_mysid_bulk_ctx;
+        deque<SidListBulkContext> m_sidlist_bulk_ctx;
+        set<string> m_pending_mysid_keys;
+        set<string> m_pending_sidlist_names;
+        vector<FieldValueTuple> m_pending_counter_names;
 };
 
 #endif // SWSS_SRV6ORCH_H
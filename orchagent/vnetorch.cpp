@@ -46,6 +46,7 @@ extern MacAddress gVxlanMacAddress;
 extern BfdOrch *gBfdOrch;
 extern SwitchOrch *gSwitchOrch;
 extern TunnelDecapOrch *gTunneldecapOrch;
+extern size_t gMaxBulkSize;
 /*
  * VRF Modeling and VNetVrf class definitions
  */
@@ -731,7 +732,9 @@ static bool update_route(sai_object_id_t vr_id, sai_ip_prefix_t& ip_pfx, sai_obj
 
 VNetRouteOrch::VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOrch *vnetOrch)
                                   : Orch2(db, tableNames, request_), vnet_orch_(vnetOrch), bfd_session_producer_(db, APP_BFD_SESSION_TABLE_NAME),
-                                    app_tunnel_decap_term_producer_(db, APP_TUNNEL_DECAP_TERM_TABLE_NAME)
+                                    app_tunnel_decap_term_producer_(db, APP_TUNNEL_DECAP_TERM_TABLE_NAME),
+                                    gRouteBulker(sai_route_api, gMaxBulkSize),
+                                    gNextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize)
 {
     SWSS_LOG_ENTER();
 
@@ -824,9 +827,10 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
     NextHopGroupInfo next_hop_group_entry;
     next_hop_group_entry.next_hop_group_id = next_hop_group_id;
 
-    for (auto nhid: next_hop_ids)
+    // Create the next hop group members in bulk
+    vector<sai_object_id_t> nhgm_ids(next_hop_ids.size(), SAI_NULL_OBJECT_ID);
+    for (size_t i = 0; i < next_hop_ids.size(); i++)
     {
-        // Create a next hop group member
         vector<sai_attribute_t> nhgm_attrs;
 
         sai_attribute_t nhgm_attr;
@@ -835,34 +839,45 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
         nhgm_attrs.push_back(nhgm_attr);
 
         nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-        nhgm_attr.value.oid = nhid;
+        nhgm_attr.value.oid = next_hop_ids[i];
         nhgm_attrs.push_back(nhgm_attr);
 
         if (gSwitchOrch->checkOrderedEcmpEnable())
         {
             nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_SEQUENCE_ID;
-            nhgm_attr.value.u32 = nh_seq_id_in_nhgrp[nhopgroup_members_set.find(nhid)->second];
+            nhgm_attr.value.u32 = nh_seq_id_in_nhgrp[nhopgroup_members_set.find(next_hop_ids[i])->second];
             nhgm_attrs.push_back(nhgm_attr);
         }
 
-        sai_object_id_t next_hop_group_member_id;
-        status = sai_next_hop_group_api->create_next_hop_group_member(&next_hop_group_member_id,
-                                                                    gSwitchId,
-                                                                    (uint32_t)nhgm_attrs.size(),
-                                                                    nhgm_attrs.data());
+        gNextHopGroupMemberBulker.create_entry(&nhgm_ids[i],
+                                               (uint32_t)nhgm_attrs.size(),
+                                               nhgm_attrs.data());
+    }
 
-        if (status != SAI_STATUS_SUCCESS)
+    gNextHopGroupMemberBulker.flush();
+
+    bool members_created = true;
+    for (size_t i = 0; i < next_hop_ids.size(); i++)
+    {
+        NextHopKey nexthop = nhopgroup_members_set.find(next_hop_ids[i])->second;
+
+        if (nhgm_ids[i] == SAI_NULL_OBJECT_ID)
         {
-            SWSS_LOG_ERROR("Failed to create next hop group %" PRIx64 " member %" PRIx64 ": %d\n",
-                           next_hop_group_id, next_hop_group_member_id, status);
-            return false;
+            SWSS_LOG_ERROR("Failed to create next hop group %" PRIx64 " member %s: %d",
+                           next_hop_group_id, nexthop.to_string().c_str(),
+                           gNextHopGroupMemberBulker.create_status(nhgm_ids[i]));
+            if (!isLocalEp)
+            {
+                vrf_obj->removeTunnelNextHop(nexthop);
+            }
+            members_created = false;
+            continue;
         }
 
         gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
 
         // Save the membership into next hop structure
-        next_hop_group_entry.active_members[nhopgroup_members_set.find(nhid)->second] =
-                                                                next_hop_group_member_id;
+        next_hop_group_entry.active_members[nexthop] = nhgm_ids[i];
     }
 
     /*
@@ -870,7 +885,14 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
      * count will increase once the route is successfully syncd.
      */
     next_hop_group_entry.ref_count = 0;
-    syncd_nexthop_groups_[vnet][nexthops] = next_hop_group_entry;
+    addNextHopGroupEntry(vnet, nexthops, next_hop_group_entry);
+
+    if (!members_created)
+    {
+        // Remove the members which were created, and the group
+        removeNextHopGroup(vnet, nexthops, vrf_obj);
+        return false;
+    }
 
     return true;
 }
@@ -893,17 +915,30 @@ bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey
     next_hop_group_id = next_hop_group_entry->second.next_hop_group_id;
     SWSS_LOG_NOTICE("Delete next hop group %s", nexthops.to_string().c_str());
 
-    for (auto nhop = next_hop_group_entry->second.active_members.begin();
-         nhop != next_hop_group_entry->second.active_members.end();)
+    // Remove the next hop group members in bulk
+    auto& active_members = next_hop_group_entry->second.active_members;
+    vector<sai_status_t> statuses(active_members.size(), SAI_STATUS_SUCCESS);
+    size_t i = 0;
+    for (const auto& nhop : active_members)
+    {
+        gNextHopGroupMemberBulker.remove_entry(&statuses[i++], nhop.second);
+    }
+
+    gNextHopGroupMemberBulker.flush();
+
+    bool members_removed = true;
+    i = 0;
+    for (auto nhop = active_members.begin(); nhop != active_members.end();)
     {
         NextHopKey nexthop = nhop->first;
 
-        status = sai_next_hop_group_api->remove_next_hop_group_member(nhop->second);
-        if (status != SAI_STATUS_SUCCESS)
+        if (statuses[i++] != SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR("Failed to remove next hop group member %" PRIx64 ", rv:%d",
-                           nhop->second, status);
-            return false;
+                           nhop->second, statuses[i - 1]);
+            members_removed = false;
+            ++nhop;
+            continue;
         }
 
         /* For local endpoint, we don't remove the next hop from NeighOrch,
@@ -915,7 +950,12 @@ bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey
         }
 
         gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-        nhop = next_hop_group_entry->second.active_members.erase(nhop);
+        nhop = active_members.erase(nhop);
+    }
+
+    if (!members_removed)
+    {
+        return false;
     }
 
     status = sai_next_hop_group_api->remove_next_hop_group(next_hop_group_id);
@@ -928,11 +968,58 @@ bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey
     gRouteOrch->decreaseNextHopGroupCount();
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP);
 
-    syncd_nexthop_groups_[vnet].erase(nexthops);
+    removeNextHopGroupEntry(vnet, nexthops);
 
     return true;
 }
 
+/*
+ * Adds a next hop group of the VNET, and indexes it by its endpoints for the
+ * BFD state changes.
+ */
+void VNetRouteOrch::addNextHopGroupEntry(const string& vnet, const NextHopGroupKey& nexthops,
+                                         const NextHopGroupInfo& nhg_info)
+{
+    syncd_nexthop_groups_[vnet][nexthops] = nhg_info;
+
+    auto& endpoint_nhgs = endpoint_nexthop_groups_[vnet];
+    for (const auto& nh : nexthops.getNextHops())
+    {
+        endpoint_nhgs[nh].insert(nexthops);
+    }
+}
+
+void VNetRouteOrch::removeNextHopGroupEntry(const string& vnet, const NextHopGroupKey& nexthops)
+{
+    syncd_nexthop_groups_[vnet].erase(nexthops);
+
+    auto it_vnet = endpoint_nexthop_groups_.find(vnet);
+    if (it_vnet == endpoint_nexthop_groups_.end())
+    {
+        return;
+    }
+
+    for (const auto& nh : nexthops.getNextHops())
+    {
+        auto it_nh = it_vnet->second.find(nh);
+        if (it_nh == it_vnet->second.end())
+        {
+            continue;
+        }
+
+        it_nh->second.erase(nexthops);
+        if (it_nh->second.empty())
+        {
+            it_vnet->second.erase(it_nh);
+        }
+    }
+
+    if (it_vnet->second.empty())
+    {
+        endpoint_nexthop_groups_.erase(it_vnet);
+    }
+}
+
 bool VNetRouteOrch::createNextHopGroup(const string& vnet,
                                        NextHopGroupKey& nexthops,
                                        VNetVrfObject *vrf_obj,
@@ -970,7 +1057,7 @@ bool VNetRouteOrch::createNextHopGroup(const string& vnet,
             SWSS_LOG_INFO("Adding nexthop: %s to the active group", nexthop.ip_address.to_string().c_str());
             next_hop_group_entry.active_members[nexthop] = SAI_NULL_OBJECT_ID;
         }
-        syncd_nexthop_groups_[vnet][nexthops] = next_hop_group_entry;
+        addNextHopGroupEntry(vnet, nexthops, next_hop_group_entry);
     }
     else
     {
@@ -1123,7 +1210,7 @@ bool VNetRouteOrch::selectNextHopGroup(const string& vnet,
             NextHopGroupInfo next_hop_group_entry;
             next_hop_group_entry.next_hop_group_id = SAI_NULL_OBJECT_ID;
             next_hop_group_entry.ref_count = 0;
-            syncd_nexthop_groups_[vnet][nhg_custom] = next_hop_group_entry;
+            addNextHopGroupEntry(vnet, nhg_custom, next_hop_group_entry);
         }
         nexthops_selected = nhg_custom;
         return true;
@@ -1162,6 +1249,12 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
         return (op == DEL_COMMAND)?true:false;
     }
 
+    // Changes of the same prefix are applied in order
+    if (route_task_prefixes_.find(ipPrefix) != route_task_prefixes_.end())
+    {
+        flushRouteTasks();
+    }
+
     set<sai_object_id_t> vr_set;
     auto& peer_list = vnet_orch_->getPeerList(vnet);
 
@@ -1183,8 +1276,6 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
     }
 
     auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
-    sai_ip_prefix_t pfx;
-    copy(pfx, ipPrefix);
 
     if (op == SET_COMMAND)
     {
@@ -1214,24 +1305,14 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
         nh_id = syncd_nexthop_groups_[vnet][active_nhg].next_hop_group_id;
 
         auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
-        for (auto vr_id : vr_set)
-        {
-            bool route_status = true;
+        bool has_active_members = !syncd_nexthop_groups_[vnet][active_nhg].active_members.empty();
+        bool had_active_members = it_route != syncd_tunnel_routes_[vnet].end() &&
+                                  !syncd_nexthop_groups_[vnet][it_route->second.nhg_key].active_members.empty();
 
-            // Remove route if the nexthop group has no active endpoint
-            if (syncd_nexthop_groups_[vnet][active_nhg].active_members.empty())
-            {
-                if (it_route != syncd_tunnel_routes_[vnet].end())
-                {
-                    NextHopGroupKey nhg = it_route->second.nhg_key;
-                    // Remove route when updating from a nhg with active member to another nhg without
-                    if (!syncd_nexthop_groups_[vnet][nhg].active_members.empty())
-                    {
-                        del_route(vr_id, pfx);
-                    }
-                }
-            }
-            else
+        RouteOpType route_op = ROUTE_OP_NONE;
+        if (has_active_members)
+        {
+            for (auto vr_id : vr_set)
             {
                 auto prefixToRemove = ipPrefix;
                 if (adv_prefix.to_string() != ipPrefix.to_string())
@@ -1249,35 +1330,118 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
                     SWSS_LOG_INFO("Successfully removed existing bgp route for prefix: %s\n",
                                   prefixSubnet.to_string().c_str());
                 }
-                if (it_route == syncd_tunnel_routes_[vnet].end())
+            }
+            route_op = had_active_members ? ROUTE_OP_UPDATE : ROUTE_OP_CREATE;
+        }
+        else if (had_active_members)
+        {
+            // Remove route when updating from a nhg with active member to another nhg without
+            route_op = ROUTE_OP_REMOVE;
+        }
+
+        for (auto vr_id : vr_set)
+        {
+            addRouteOp(vnet, ipPrefix, vr_id, route_op, nh_id);
+        }
+
+        // Keep the selected group until the routes are programmed
+        syncd_nexthop_groups_[vnet][active_nhg].ref_count++;
+
+        auto& task = addRouteTask(vnet, ipPrefix, vr_set, true);
+        task.route_op = route_op;
+        task.nexthops = nexthops;
+        task.nexthops_secondary = nexthops_secondary;
+        task.active_nhg = active_nhg;
+        task.profile = profile;
+        task.monitoring = monitoring;
+        task.adv_prefix = adv_prefix;
+        task.custom_monitor_ep_updated = custom_monitor_ep_updated;
+        task.custom_monitor_pinned_state_updated = is_custom_monitor_pinned_state_updated;
+        task.origin_primary_monitors = origin_primary_monitors;
+        task.origin_secondary_monitors = origin_secondary_monitors;
+    }
+    else if (op == DEL_COMMAND)
+    {
+        auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
+        if (it_route == syncd_tunnel_routes_[vnet].end())
+        {
+            SWSS_LOG_INFO("Failed to find tunnel route entry, prefix %s\n",
+                ipPrefix.to_string().c_str());
+            return true;
+        }
+
+        // If an nhg has no active member, the route should already be removed
+        NextHopGroupKey nhg = it_route->second.nhg_key;
+        RouteOpType route_op = syncd_nexthop_groups_[vnet][nhg].active_members.empty() ? ROUTE_OP_NONE : ROUTE_OP_REMOVE;
+        for (auto vr_id : vr_set)
+        {
+            addRouteOp(vnet, ipPrefix, vr_id, route_op);
+        }
+
+        auto& task = addRouteTask(vnet, ipPrefix, vr_set, true);
+        task.route_op = route_op;
+    }
+
+    // The entry is completed by flushRouteTasks()
+    return false;
+}
+
+/*
+ * Completes a tunnel route task once its routes are programmed. Returns false
+ * if the task is to be retried.
+ */
+bool VNetRouteOrch::doTunnelRouteTaskPost(RouteTask& task, bool route_failed)
+{
+    SWSS_LOG_ENTER();
+
+    const string& vnet = task.vnet;
+    IpPrefix& ipPrefix = task.prefix;
+    auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
+
+    if (task.op == SET_COMMAND)
+    {
+        NextHopGroupKey& nexthops = task.nexthops;
+        NextHopGroupKey& nexthops_secondary = task.nexthops_secondary;
+        NextHopGroupKey& active_nhg = task.active_nhg;
+        string& profile = task.profile;
+        const string& monitoring = task.monitoring;
+        const IpPrefix& adv_prefix = task.adv_prefix;
+        bool custom_monitor_ep_updated = task.custom_monitor_ep_updated;
+        bool is_custom_monitor_pinned_state_updated = task.custom_monitor_pinned_state_updated;
+        auto& origin_primary_monitors = task.origin_primary_monitors;
+        auto& origin_secondary_monitors = task.origin_secondary_monitors;
+
+        syncd_nexthop_groups_[vnet][active_nhg].ref_count--;
+
+        auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
+
+        if (route_failed && task.route_op != ROUTE_OP_REMOVE)
+        {
+            SWSS_LOG_ERROR("Route add/update failed for %s", ipPrefix.to_string().c_str());
+
+            // Restore the routes of the virtual routers which were programmed
+            sai_ip_prefix_t pfx;
+            copy(pfx, ipPrefix);
+            for (auto vr_id : task.vr_set)
+            {
+                if (task.route_op == ROUTE_OP_CREATE)
                 {
-                    route_status = add_route(vr_id, pfx, nh_id);
+                    del_route(vr_id, pfx);
                 }
                 else
                 {
-                    NextHopGroupKey nhg = it_route->second.nhg_key;
-                    if (syncd_nexthop_groups_[vnet][nhg].active_members.empty())
-                    {
-                        route_status = add_route(vr_id, pfx, nh_id);
-                    }
-                    else
-                    {
-                        route_status = update_route(vr_id, pfx, nh_id);
-                    }
+                    update_route(vr_id, pfx, syncd_nexthop_groups_[vnet][it_route->second.nhg_key].next_hop_group_id);
                 }
             }
 
-            if (!route_status)
+            /* Clean up the newly created next hop group entry */
+            if (active_nhg.getSize() > 1)
             {
-                SWSS_LOG_ERROR("Route add/update failed for %s, vr_id '0x%" PRIx64, ipPrefix.to_string().c_str(), vr_id);
-                /* Clean up the newly created next hop group entry */
-                if (active_nhg.getSize() > 1)
-                {
-                    removeNextHopGroup(vnet, active_nhg, vrf_obj);
-                }
-                return false;
+                removeNextHopGroup(vnet, active_nhg, vrf_obj);
             }
+            return false;
         }
+
         bool route_updated = false;
         bool priority_route_updated = false;
         if (it_route != syncd_tunnel_routes_[vnet].end())
@@ -1325,7 +1489,7 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
                         }
                         else
                         {
-                            syncd_nexthop_groups_[vnet].erase(nhg);
+                            removeNextHopGroupEntry(vnet, nhg);
                             if(nhg.getSize() == 1)
                             {
                                 NextHopKey nexthop = *nhg.getNextHops().begin();
@@ -1394,31 +1558,25 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
         }
         postRouteState(vnet, ipPrefix, active_nhg, profile);
     }
-    else if (op == DEL_COMMAND)
+    else if (task.op == DEL_COMMAND)
     {
+        if (route_failed)
+        {
+            SWSS_LOG_ERROR("Route del failed for %s", ipPrefix.to_string().c_str());
+            return false;
+        }
+        if (task.route_op == ROUTE_OP_REMOVE)
+        {
+            SWSS_LOG_INFO("Successfully deleted the route for prefix: %s", ipPrefix.to_string().c_str());
+        }
+
         auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
         if (it_route == syncd_tunnel_routes_[vnet].end())
         {
-            SWSS_LOG_INFO("Failed to find tunnel route entry, prefix %s\n",
-                ipPrefix.to_string().c_str());
             return true;
         }
         NextHopGroupKey nhg = it_route->second.nhg_key;
         auto last_nhg_size = nhg.getSize();
-        for (auto vr_id : vr_set)
-        {
-            // If an nhg has no active member, the route should already be removed
-            if (!syncd_nexthop_groups_[vnet][nhg].active_members.empty())
-            {
-                if (!del_route(vr_id, pfx))
-                {
-                    SWSS_LOG_ERROR("Route del failed for %s, vr_id '0x%" PRIx64, ipPrefix.to_string().c_str(), vr_id);
-                    return false;
-                }
-                SWSS_LOG_INFO("Successfully deleted the route for prefix: %s", ipPrefix.to_string().c_str());
-
-            }
-        }
 
         if(--syncd_nexthop_groups_[vnet][nhg].ref_count == 0)
         {
@@ -1428,7 +1586,7 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
             }
             else
             {
-                syncd_nexthop_groups_[vnet].erase(nhg);
+                removeNextHopGroupEntry(vnet, nhg);
                 // We need to check specifically if there is only one next hop active.
                 // In case of Priority routes we can end up in a situation where the active NHG has 0 nexthops.
                 if(nhg.getSize() == 1)
@@ -1484,6 +1642,10 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
     return true;
 }
 
+/*
+ * Adds the route operations of a tunnel route to the route bulker. They are
+ * programmed, and their result checked, by flushRoutes().
+ */
 bool VNetRouteOrch::updateTunnelRoute(const string& vnet, IpPrefix& ipPrefix,
                                 NextHopGroupKey& nexthops, string& op)
 {
@@ -1516,24 +1678,12 @@ bool VNetRouteOrch::updateTunnelRoute(const string& vnet, IpPrefix& ipPrefix,
         l_fn(peer);
     }
 
-    sai_ip_prefix_t pfx;
-    copy(pfx, ipPrefix);
-
     if (op == SET_COMMAND)
     {
         sai_object_id_t nh_id = syncd_nexthop_groups_[vnet][nexthops].next_hop_group_id;
-
         for (auto vr_id : vr_set)
         {
-            bool route_status = true;
-
-            route_status = add_route(vr_id, pfx, nh_id);
-
-            if (!route_status)
-            {
-                SWSS_LOG_ERROR("Route add failed for %s, vr_id '0x%" PRIx64, ipPrefix.to_string().c_str(), vr_id);
-                return false;
-            }
+            addRouteOp(vnet, ipPrefix, vr_id, ROUTE_OP_CREATE, nh_id);
         }
     }
     else if (op == DEL_COMMAND)
@@ -1545,132 +1695,262 @@ bool VNetRouteOrch::updateTunnelRoute(const string& vnet, IpPrefix& ipPrefix,
                 ipPrefix.to_string().c_str());
             return true;
         }
-        NextHopGroupKey nhg = it_route->second.nhg_key;
 
         for (auto vr_id : vr_set)
         {
-            if (!del_route(vr_id, pfx))
-            {
-                SWSS_LOG_ERROR("Route del failed for %s, vr_id '0x%" PRIx64, ipPrefix.to_string().c_str(), vr_id);
-                return false;
-            }
+            addRouteOp(vnet, ipPrefix, vr_id, ROUTE_OP_REMOVE);
         }
     }
 
     return true;
 }
 
-inline void VNetRouteOrch::createSubnetDecapTerm(const IpPrefix &ipPrefix)
+/*
+ * Adds a route operation to the route bulker, to be programmed by flushRoutes()
+ */
+void VNetRouteOrch::addRouteOp(const string& vnet, const IpPrefix& ipPrefix, sai_object_id_t vr_id,
+                               RouteOpType type, sai_object_id_t nh_id)
 {
-    const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
-    if (!config.enable || subnet_decap_terms_created_.find(ipPrefix) != subnet_decap_terms_created_.end())
+    RouteOp route_op;
+    route_op.vnet = vnet;
+    route_op.prefix = ipPrefix;
+    route_op.route_entry.switch_id = gSwitchId;
+    route_op.route_entry.vr_id = vr_id;
+    copy(route_op.route_entry.destination, ipPrefix);
+    route_op.type = type;
+    route_op.status = SAI_STATUS_NOT_EXECUTED;
+
+    route_ops_.push_back(route_op);
+    auto& queued = route_ops_.back();
+
+    sai_attribute_t route_attr;
+    route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    route_attr.value.oid = nh_id;
+
+    switch (type)
     {
-        return;
+    case ROUTE_OP_CREATE:
+        gRouteBulker.create_entry(&queued.status, &queued.route_entry, 1, &route_attr);
+        break;
+    case ROUTE_OP_UPDATE:
+        gRouteBulker.set_entry_attribute(&queued.status, &queued.route_entry, &route_attr);
+        break;
+    case ROUTE_OP_REMOVE:
+        gRouteBulker.remove_entry(&queued.status, &queued.route_entry);
+        break;
+    default:
+        route_ops_.pop_back();
+        break;
     }
-    SWSS_LOG_NOTICE("Add subnet decap term for %s", ipPrefix.to_string().c_str());
-    static const vector<FieldValueTuple> data = {
-        {"term_type", "MP2MP"},
-        {"subnet_type", "vip"}
-    };
-    string tunnel_name = ipPrefix.isV4() ? config.tunnel : config.tunnel_v6;
-    string key = tunnel_name + ":" + ipPrefix.to_string();
-    app_tunnel_decap_term_producer_.set(key, data);
-    subnet_decap_terms_created_.insert(ipPrefix);
 }
 
-inline void VNetRouteOrch::removeSubnetDecapTerm(const IpPrefix &ipPrefix)
+/*
+ * Programs the routes added by addRouteOp() in bulk. Returns the prefixes
+ * whose route could not be programmed, per VNET.
+ */
+map<string, set<IpPrefix>> VNetRouteOrch::flushRoutes()
 {
-    const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
-    auto it = subnet_decap_terms_created_.find(ipPrefix);
-    if (it == subnet_decap_terms_created_.end())
+    SWSS_LOG_ENTER();
+
+    map<string, set<IpPrefix>> failed;
+
+    if (route_ops_.empty())
     {
-        return;
+        return failed;
     }
-    SWSS_LOG_NOTICE("Remove subnet decap term for %s", ipPrefix.to_string().c_str());
-    string tunnel_name = ipPrefix.isV4() ? config.tunnel : config.tunnel_v6;
-    string key = tunnel_name + ":" + ipPrefix.to_string();
-    app_tunnel_decap_term_producer_.del(key);
-    subnet_decap_terms_created_.erase(it);
+
+    gRouteBulker.flush();
+
+    for (auto& route_op : route_ops_)
+    {
+        auto& route_entry = route_op.route_entry;
+        bool ipv4 = route_entry.destination.addr_family == SAI_IP_ADDR_FAMILY_IPV4;
+
+        switch (route_op.type)
+        {
+        case ROUTE_OP_CREATE:
+            if (route_op.status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Route add failed for %s, vr_id '0x%" PRIx64 "', rv: %d",
+                               route_op.prefix.to_string().c_str(), route_entry.vr_id, route_op.status);
+                failed[route_op.vnet].insert(route_op.prefix);
+                break;
+            }
+
+            gCrmOrch->incCrmResUsedCounter(ipv4 ? CrmResourceType::CRM_IPV4_ROUTE : CrmResourceType::CRM_IPV6_ROUTE);
+            gFlowCounterRouteOrch->onAddMiscRouteEntry(route_entry.vr_id, route_entry.destination, false);
+            break;
+        case ROUTE_OP_UPDATE:
+            if (route_op.status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Route update failed for %s, vr_id '0x%" PRIx64 "', rv: %d",
+                               route_op.prefix.to_string().c_str(), route_entry.vr_id, route_op.status);
+                failed[route_op.vnet].insert(route_op.prefix);
+            }
+            break;
+        case ROUTE_OP_REMOVE:
+            if (route_op.status == SAI_STATUS_ITEM_NOT_FOUND || route_op.status == SAI_STATUS_INVALID_PARAMETER)
+            {
+                SWSS_LOG_INFO("Unable to remove route since route is already removed");
+                break;
+            }
+            else if (route_op.status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Route del failed for %s, vr_id '0x%" PRIx64 "', rv: %d",
+                               route_op.prefix.to_string().c_str(), route_entry.vr_id, route_op.status);
+                failed[route_op.vnet].insert(route_op.prefix);
+                break;
+            }
+
+            gCrmOrch->decCrmResUsedCounter(ipv4 ? CrmResourceType::CRM_IPV4_ROUTE : CrmResourceType::CRM_IPV6_ROUTE);
+            gFlowCounterRouteOrch->onRemoveMiscRouteEntry(route_entry.vr_id, route_entry.destination, false);
+            break;
+        default:
+            break;
+        }
+    }
+
+    route_ops_.clear();
+
+    return failed;
 }
 
-bool VNetRouteOrch::setAndDeleteRoutesWithRouteOrch(const sai_object_id_t vr_id, const IpPrefix& ipPrefix,
-                                                    const NextHopGroupKey& nhg, const string& op)
+/*
+ * Records a route task of the request being processed. The routes of the
+ * tasks are programmed in bulk, and the tasks completed, by flushRouteTasks().
+ */
+VNetRouteOrch::RouteTask& VNetRouteOrch::addRouteTask(const string& vnet, const IpPrefix& ipPrefix,
+                                                      const set<sai_object_id_t>& vr_set, bool is_tunnel)
 {
-    auto& bulkNhgReducedRefCnt = gRouteOrch->getBulkNhgReducedRefCnt();
+    route_tasks_.emplace_back();
+    auto& task = route_tasks_.back();
+    task.table = request_.getTableName();
+    task.key = request_.getFullKey();
+    task.op = request_.getOperation();
+    task.vnet = vnet;
+    task.prefix = ipPrefix;
+    task.is_tunnel = is_tunnel;
+    task.vr_set = vr_set;
+    task.route_op = ROUTE_OP_NONE;
+    task.custom_monitor_ep_updated = false;
+    task.custom_monitor_pinned_state_updated = false;
+    task.is_subnet = false;
+
+    route_task_prefixes_.insert(ipPrefix);
+
+    return task;
+}
+
+/*
+ * Programs the routes of the queued route tasks in bulk, completes the tasks
+ * and removes the entries of the completed ones from m_toSync.
+ */
+void VNetRouteOrch::flushRouteTasks()
+{
+    SWSS_LOG_ENTER();
 
-    // Get vnet name from vrf id
-    std::string vnet_name;
-    if (!vnet_orch_->getVnetNameByVrfId(vr_id, vnet_name))
+    if (route_tasks_.empty())
     {
-        SWSS_LOG_INFO("Failed to get VNET name for vrf id '0x%" PRIx64, vr_id);
-        return false;
+        return;
     }
 
-    // Set up route bulk context
-    string key = vnet_name + ":" + ipPrefix.to_string();
-    RouteBulkContext ctx(key, (op == SET_COMMAND));
-    ctx.vrf_id = vr_id;
-    ctx.ip_prefix = ipPrefix;
-    ctx.nhg = nhg;
+    auto failed_routes = flushRoutes();
 
-    if (op == SET_COMMAND)
+    bool route_orch_routes = false;
+    for (const auto& task : route_tasks_)
     {
-        // Add route via route orch
-        if (gRouteOrch->addRoute(ctx, nhg))
+        if (!task.route_ctxs.empty())
         {
-            return true;
+            route_orch_routes = true;
+            break;
         }
-        
+    }
+
+    auto& bulkNhgReducedRefCnt = gRouteOrch->getBulkNhgReducedRefCnt();
+    if (route_orch_routes)
+    {
         // Flush the route bulker, so routes will be written to syncd and ASIC
         gRouteOrch->flushRouteBulker();
         bulkNhgReducedRefCnt.clear();
-
-        // Post add route via route orch
-        if (gRouteOrch->addRoutePost(ctx, nhg))
-        {
-            SWSS_LOG_NOTICE("Route %s added via routeorch for vnet %s", ipPrefix.to_string().c_str(), vnet_name.c_str());
-        }
-        else
-        {
-            SWSS_LOG_ERROR("Route %s add failed in routeorch for vnet %s", ipPrefix.to_string().c_str(), vnet_name.c_str());
-            return false;
-        }
     }
-    else if (op == DEL_COMMAND)
+
+    for (auto& task : route_tasks_)
     {
-        // Remove route via route orch
-        if (gRouteOrch->removeRoute(ctx))
+        auto it_failed = failed_routes.find(task.vnet);
+        bool route_failed = it_failed != failed_routes.end() &&
+                            it_failed->second.find(task.prefix) != it_failed->second.end();
+
+        bool done = task.is_tunnel ? doTunnelRouteTaskPost(task, route_failed) : doRouteTaskPost(task, route_failed);
+        if (!done)
         {
-            return true;
+            continue;
         }
 
-        // Flush the route bulker, so routes will be written to syncd and ASIC
-        gRouteOrch->flushRouteBulker();
-        bulkNhgReducedRefCnt.clear();
-
-        // Post remove route via route orch
-        if (gRouteOrch->removeRoutePost(ctx))
+        auto *consumer = dynamic_cast<Consumer *>(getExecutor(task.table));
+        if (!consumer)
         {
-            SWSS_LOG_NOTICE("Route %s removed via routeorch for vnet %s", ipPrefix.to_string().c_str(), vnet_name.c_str());
+            continue;
         }
-        else
+
+        auto range = consumer->m_toSync.equal_range(task.key);
+        for (auto it = range.first; it != range.second; ++it)
         {
-            SWSS_LOG_ERROR("Route %s remove failed in routeorch for vnet %s", ipPrefix.to_string().c_str(), vnet_name.c_str());
-            return false;
+            if (kfvOp(it->second) == task.op)
+            {
+                consumer->m_toSync.erase(it);
+                break;
+            }
         }
     }
 
-    // Remove next hop groups with 0 ref count
-    for (auto& it : bulkNhgReducedRefCnt)
+    if (route_orch_routes)
     {
-        if (gRouteOrch->getNextHopGroupRefCount(it.first) == 0)
+        // Remove next hop groups with 0 ref count
+        for (auto& it : bulkNhgReducedRefCnt)
         {
-            gRouteOrch->removeNextHopGroup(it.first);
-            SWSS_LOG_INFO("Next hop group %s has 0 references, removed via routeorch", it.first.to_string().c_str());
+            if (gRouteOrch->getNextHopGroupRefCount(it.first) == 0)
+            {
+                gRouteOrch->removeNextHopGroup(it.first);
+                SWSS_LOG_INFO("Next hop group %s has 0 references, removed via routeorch", it.first.to_string().c_str());
+            }
         }
     }
 
-    return true;
+    route_tasks_.clear();
+    route_task_prefixes_.clear();
+}
+
+inline void VNetRouteOrch::createSubnetDecapTerm(const IpPrefix &ipPrefix)
+{
+    const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
+    if (!config.enable || subnet_decap_terms_created_.find(ipPrefix) != subnet_decap_terms_created_.end())
+    {
+        return;
+    }
+    SWSS_LOG_NOTICE("Add subnet decap term for %s", ipPrefix.to_string().c_str());
+    static const vector<FieldValueTuple> data = {
+        {"term_type", "MP2MP"},
+        {"subnet_type", "vip"}
+    };
+    string tunnel_name = ipPrefix.isV4() ? config.tunnel : config.tunnel_v6;
+    string key = tunnel_name + ":" + ipPrefix.to_string();
+    app_tunnel_decap_term_producer_.set(key, data);
+    subnet_decap_terms_created_.insert(ipPrefix);
+}
+
+inline void VNetRouteOrch::removeSubnetDecapTerm(const IpPrefix &ipPrefix)
+{
+    const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
+    auto it = subnet_decap_terms_created_.find(ipPrefix);
+    if (it == subnet_decap_terms_created_.end())
+    {
+        return;
+    }
+    SWSS_LOG_NOTICE("Remove subnet decap term for %s", ipPrefix.to_string().c_str());
+    string tunnel_name = ipPrefix.isV4() ? config.tunnel : config.tunnel_v6;
+    string key = tunnel_name + ":" + ipPrefix.to_string();
+    app_tunnel_decap_term_producer_.del(key);
+    subnet_decap_terms_created_.erase(it);
 }
 
 template<>
@@ -1686,6 +1966,12 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
         return (op == DEL_COMMAND)?true:false;
     }
 
+    // Changes of the same prefix are applied in order
+    if (route_task_prefixes_.find(ipPrefix) != route_task_prefixes_.end())
+    {
+        flushRouteTasks();
+    }
+
     auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
     if (op == DEL_COMMAND && !vrf_obj->getRouteNextHop(ipPrefix, nh))
     {
@@ -1740,10 +2026,11 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
         l_fn(peer);
     }
 
-    sai_ip_prefix_t pfx;
-    copy(pfx, ipPrefix);
+    vr_set.erase(SAI_NULL_OBJECT_ID);
+
     sai_object_id_t nh_id=SAI_NULL_OBJECT_ID;
     string nhg_str;
+    map<sai_object_id_t, string> vr_vnets;
 
     if (is_subnet)
     {
@@ -1764,45 +2051,102 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
             nhg_str += it.to_string() + "@" + ifnames[idx];
             idx++;
         }
+
+        // Get vnet name from vrf id, for the routes added via route orch
+        for (auto vr_id : vr_set)
+        {
+            if (!vnet_orch_->getVnetNameByVrfId(vr_id, vr_vnets[vr_id]))
+            {
+                SWSS_LOG_INFO("Failed to get VNET name for vrf id '0x%" PRIx64, vr_id);
+                return false;
+            }
+        }
     }
 
-    for (auto vr_id : vr_set)
+    auto& task = addRouteTask(vnet, ipPrefix, vr_set, false);
+    task.nh = nh;
+    task.is_subnet = is_subnet;
+
+    if (is_subnet)
     {
-        if (vr_id == SAI_NULL_OBJECT_ID)
+        task.route_op = (op == SET_COMMAND) ? ROUTE_OP_CREATE : ROUTE_OP_REMOVE;
+        for (auto vr_id : vr_set)
         {
-            continue;
+            addRouteOp(vnet, ipPrefix, vr_id, task.route_op, nh_id);
         }
-
-        if (is_subnet)
+    }
+    else
+    {
+        NextHopGroupKey nhg(nhg_str);
+        for (auto vr_id : vr_set)
         {
-            if (op == SET_COMMAND && !add_route(vr_id, pfx, nh_id))
+            // Set up route bulk context
+            string key = vr_vnets[vr_id] + ":" + ipPrefix.to_string();
+            task.route_ctxs.emplace_back(key, (op == SET_COMMAND));
+            auto& ctx = task.route_ctxs.back();
+            ctx.vrf_id = vr_id;
+            ctx.ip_prefix = ipPrefix;
+            ctx.nhg = nhg;
+
+            // Add or remove route via route orch, the routes which are not done are completed once its bulker is flushed
+            bool done = (op == SET_COMMAND) ? gRouteOrch->addRoute(ctx, nhg) : gRouteOrch->removeRoute(ctx);
+            if (done)
             {
-                SWSS_LOG_INFO("Route add failed for %s", ipPrefix.to_string().c_str());
-                break;
+                task.route_ctxs.pop_back();
             }
-            else if (op == DEL_COMMAND && !del_route(vr_id, pfx))
+        }
+    }
+
+    // The entry is completed by flushRouteTasks()
+    return false;
+}
+
+/*
+ * Completes a route task once its routes are programmed. Returns false if the
+ * task is to be retried.
+ */
+bool VNetRouteOrch::doRouteTaskPost(RouteTask& task, bool route_failed)
+{
+    SWSS_LOG_ENTER();
+
+    if (route_failed)
+    {
+        SWSS_LOG_INFO("Route %s failed for %s", (task.op == SET_COMMAND) ? "add" : "del",
+                      task.prefix.to_string().c_str());
+    }
+
+    for (const auto& ctx : task.route_ctxs)
+    {
+        if (task.op == SET_COMMAND)
+        {
+            // Post add route via route orch
+            if (!gRouteOrch->addRoutePost(ctx, ctx.nhg))
             {
-                SWSS_LOG_INFO("Route del failed for %s", ipPrefix.to_string().c_str());
-                break;
+                SWSS_LOG_ERROR("Route %s add failed in routeorch", ctx.key.c_str());
+                return false;
             }
+            SWSS_LOG_NOTICE("Route %s added via routeorch", ctx.key.c_str());
         }
         else
         {
-            NextHopGroupKey nhg(nhg_str);
-            if (!setAndDeleteRoutesWithRouteOrch(vr_id, ipPrefix, nhg, op))
+            // Post remove route via route orch
+            if (!gRouteOrch->removeRoutePost(ctx))
             {
+                SWSS_LOG_ERROR("Route %s remove failed in routeorch", ctx.key.c_str());
                 return false;
             }
+            SWSS_LOG_NOTICE("Route %s removed via routeorch", ctx.key.c_str());
         }
     }
 
-    if (op == SET_COMMAND)
+    auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(task.vnet);
+    if (task.op == SET_COMMAND)
     {
-        vrf_obj->addRoute(ipPrefix, nh, is_subnet);
+        vrf_obj->addRoute(task.prefix, task.nh, task.is_subnet);
     }
     else
     {
-        vrf_obj->removeRoute(ipPrefix, is_subnet);
+        vrf_obj->removeRoute(task.prefix, task.is_subnet);
     }
 
     return true;
@@ -2660,8 +3004,9 @@ void VNetRouteOrch::update(SubjectType type, void *cntx)
     switch(type) {
     case SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE:
     {
+        // Handled in doTask(), together with the other updates of the same batch
         BfdUpdate *update = static_cast<BfdUpdate *>(cntx);
-        updateVnetTunnel(*update);
+        pending_bfd_updates_.push_back(*update);
         break;
     }
     default:
@@ -2671,97 +3016,189 @@ void VNetRouteOrch::update(SubjectType type, void *cntx)
     }
 }
 
-void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
+void VNetRouteOrch::doTask()
 {
-    SWSS_LOG_ENTER();
+    updateVnetTunnels();
+    Orch::doTask();
+}
+
+/*
+ * The routes of the entries of a table are programmed in bulk, once all the
+ * entries are processed.
+ */
+void VNetRouteOrch::doTask(Consumer& consumer)
+{
+    Orch2::doTask(consumer);
+    flushRouteTasks();
+}
 
-    auto key = update.peer;
-    sai_bfd_session_state_t state = update.state;
+/*
+ * Applies the pending BFD state changes. The state changes of an endpoint
+ * are coalesced, the groups of the changed endpoints are looked up in the
+ * endpoint index, the group members are created and removed in bulk, and
+ * then the routes of the groups which got their first active member, or
+ * lost their last one, are programmed in bulk.
+ */
+void VNetRouteOrch::updateVnetTunnels()
+{
+    SWSS_LOG_ENTER();
 
-    size_t found_vrf = key.find(state_db_key_delimiter);
-    if (found_vrf == string::npos)
+    if (pending_bfd_updates_.empty())
     {
-        SWSS_LOG_WARN("Failed to parse key %s, no vrf is given", key.c_str());
         return;
     }
 
-    size_t found_ifname = key.find(state_db_key_delimiter, found_vrf + 1);
-    if (found_ifname == string::npos)
-    {
-        SWSS_LOG_ERROR("Failed to parse key %s, no ifname is given", key.c_str());
-        return;
-    }
+    vector<BfdUpdate> updates;
+    updates.swap(pending_bfd_updates_);
 
-    string vrf_name = key.substr(0, found_vrf);
-    string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
-    IpAddress peer_address(key.substr(found_ifname + 1));
+    // Endpoint up state before and after the batch, per VNET
+    map<string, map<NextHopKey, pair<bool, bool>>> endpoint_changes;
 
-    if (alias != "default" || vrf_name != "default")
+    for (const auto& update : updates)
     {
-        return;
-    }
+        auto key = update.peer;
+        sai_bfd_session_state_t state = update.state;
 
-    auto it_peer = bfd_sessions_.find(peer_address);
+        size_t found_vrf = key.find(state_db_key_delimiter);
+        if (found_vrf == string::npos)
+        {
+            SWSS_LOG_WARN("Failed to parse key %s, no vrf is given", key.c_str());
+            continue;
+        }
 
-    if (it_peer == bfd_sessions_.end()) {
-        SWSS_LOG_INFO("No endpoint for BFD peer %s", peer_address.to_string().c_str());
-        return;
-    }
+        size_t found_ifname = key.find(state_db_key_delimiter, found_vrf + 1);
+        if (found_ifname == string::npos)
+        {
+            SWSS_LOG_ERROR("Failed to parse key %s, no ifname is given", key.c_str());
+            continue;
+        }
 
-    BfdSessionInfo& bfd_info = it_peer->second;
+        string vrf_name = key.substr(0, found_vrf);
+        string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
+        IpAddress peer_address(key.substr(found_ifname + 1));
 
-    if (bfd_info.custom_bfd)
-    {
-        SWSS_LOG_DEBUG("Skip single NHG BFD state update for custom BFD session %s", peer_address.to_string().c_str());
-        return;
-    }
+        if (alias != "default" || vrf_name != "default")
+        {
+            continue;
+        }
 
-    bfd_info.bfd_state = state;
+        auto it_peer = bfd_sessions_.find(peer_address);
 
-    string vnet = bfd_info.vnet;
-    NextHopKey endpoint = bfd_info.endpoint;
-    auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
+        if (it_peer == bfd_sessions_.end()) {
+            SWSS_LOG_INFO("No endpoint for BFD peer %s", peer_address.to_string().c_str());
+            continue;
+        }
 
-    if (syncd_nexthop_groups_.find(vnet) == syncd_nexthop_groups_.end())
-    {
-        SWSS_LOG_ERROR("Vnet %s not found", vnet.c_str());
-        return;
-    }
+        BfdSessionInfo& bfd_info = it_peer->second;
+
+        if (bfd_info.custom_bfd)
+        {
+            SWSS_LOG_DEBUG("Skip single NHG BFD state update for custom BFD session %s", peer_address.to_string().c_str());
+            continue;
+        }
 
-    nexthop_info_[vnet][endpoint.ip_address].bfd_state = state;
+        bool was_up = (bfd_info.bfd_state == SAI_BFD_SESSION_STATE_UP);
+        bfd_info.bfd_state = state;
+
+        const string& vnet = bfd_info.vnet;
+        const NextHopKey& endpoint = bfd_info.endpoint;
+
+        if (syncd_nexthop_groups_.find(vnet) == syncd_nexthop_groups_.end())
+        {
+            SWSS_LOG_ERROR("Vnet %s not found", vnet.c_str());
+            continue;
+        }
+
+        nexthop_info_[vnet][endpoint.ip_address].bfd_state = state;
+
+        auto it_change = endpoint_changes[vnet].emplace(endpoint, make_pair(was_up, was_up)).first;
+        it_change->second.second = (state == SAI_BFD_SESSION_STATE_UP);
+    }
 
-    for (auto& nhg_info_pair : syncd_nexthop_groups_[vnet])
+    for (auto& vnet_changes : endpoint_changes)
     {
-        NextHopGroupKey nexthops = nhg_info_pair.first;
-        NextHopGroupInfo& nhg_info = nhg_info_pair.second;
+        const string& vnet = vnet_changes.first;
+        auto& changes = vnet_changes.second;
 
-        std::set<NextHopKey> next_hop_set = nexthops.getNextHops();
-        uint32_t seq_id = 0;
-        uint32_t nh_seq_id = 0;
-        for (auto nh: next_hop_set)
+        // Only the endpoints whose up state differs after the batch change their groups
+        for (auto it = changes.begin(); it != changes.end();)
         {
-            seq_id++;
-            if (nh == endpoint)
+            if (it->second.first == it->second.second)
             {
-                nh_seq_id = seq_id;
-                break;
+                it = changes.erase(it);
+            }
+            else
+            {
+                ++it;
             }
         }
 
-        if (!nh_seq_id)
+        if (!changes.empty())
+        {
+            updateVnetTunnelEndpoints(vnet, changes);
+        }
+    }
+}
+
+void VNetRouteOrch::updateVnetTunnelEndpoints(const string& vnet, const map<NextHopKey, pair<bool, bool>>& changes)
+{
+    SWSS_LOG_ENTER();
+
+    auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
+    auto& nexthop_groups = syncd_nexthop_groups_[vnet];
+
+    struct MemberUpdate
+    {
+        const NextHopGroupKey *nexthops;
+        NextHopGroupInfo *nhg_info;
+        NextHopKey endpoint;
+        bool up;
+        sai_object_id_t member_id;
+        sai_status_t status;
+    };
+
+    // when we add the first nexthop to the route, we dont create a nexthop group, we call the updateTunnelRoute with NHG with one member.
+    // when adding the 2nd, 3rd ... members we create each NH using the next hop group member bulker but give it the reference of next_hop_group_id.
+    // this way we dont have to update the route, the syncd does it by itself. we only call the updateTunnelRoute to add/remove when adding or removing the
+    // route fully.
+    deque<MemberUpdate> member_updates;
+    map<const NextHopGroupKey *, bool> nhg_had_active_members;
+    auto it_vnet = endpoint_nexthop_groups_.find(vnet);
+    if (it_vnet == endpoint_nexthop_groups_.end())
+    {
+        return;
+    }
+    const auto& endpoint_nhgs = it_vnet->second;
+
+    for (const auto& change : changes)
+    {
+        NextHopKey endpoint = change.first;
+        bool up = change.second.second;
+
+        // Groups of the endpoint, from the endpoint index
+        auto it_endpoint = endpoint_nhgs.find(endpoint);
+        if (it_endpoint == endpoint_nhgs.end())
         {
             continue;
         }
-        // when we add the first nexthop to the route, we dont create a nexthop group, we call the updateTunnelRoute with NHG with one member.
-        // when adding the 2nd, 3rd ... members we create each NH using this create_next_hop_group_member call but give it the reference of next_hop_group_id.
-        // this way we dont have to update the route, the syncd does it by itself. we only call the updateTunnelRoute to add/remove when adding or removing the
-        // route fully.
 
-        bool failed = false;
-        if (state == SAI_BFD_SESSION_STATE_UP)
+        for (const auto& nhg : it_endpoint->second)
         {
-            sai_object_id_t next_hop_group_member_id = SAI_NULL_OBJECT_ID;
-            if (nexthops.getSize() > 1)
+            auto it_nhg = nexthop_groups.find(nhg);
+            if (it_nhg == nexthop_groups.end())
+            {
+                continue;
+            }
+
+            const NextHopGroupKey& nexthops = it_nhg->first;
+            NextHopGroupInfo& nhg_info = it_nhg->second;
+
+            nhg_had_active_members.emplace(&nexthops, !nhg_info.active_members.empty());
+
+            member_updates.push_back({&nexthops, &nhg_info, endpoint, up, SAI_NULL_OBJECT_ID, SAI_STATUS_SUCCESS});
+            auto& member_update = member_updates.back();
+
+            if (up && nexthops.getSize() > 1)
             {
                 // Create a next hop group member
                 vector<sai_attribute_t> nhgm_attrs;
@@ -2777,23 +3214,47 @@ void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
 
                 if (gSwitchOrch->checkOrderedEcmpEnable())
                 {
+                    // Sequence id of the endpoint in the group
+                    const auto& next_hops = nexthops.getNextHops();
                     nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_SEQUENCE_ID;
-                    nhgm_attr.value.u32 = nh_seq_id;
+                    nhgm_attr.value.u32 = (uint32_t)distance(next_hops.begin(), next_hops.find(endpoint)) + 1;
                     nhgm_attrs.push_back(nhgm_attr);
                 }
 
-                sai_status_t status = sai_next_hop_group_api->create_next_hop_group_member(&next_hop_group_member_id,
-                                                                                gSwitchId,
-                                                                                (uint32_t)nhgm_attrs.size(),
-                                                                                nhgm_attrs.data());
+                gNextHopGroupMemberBulker.create_entry(&member_update.member_id,
+                                                       (uint32_t)nhgm_attrs.size(),
+                                                       nhgm_attrs.data());
+            }
+            else if (!up && nexthops.getSize() > 1 && nhg_info.active_members.find(endpoint) != nhg_info.active_members.end())
+            {
+                member_update.member_id = nhg_info.active_members[endpoint];
+                gNextHopGroupMemberBulker.remove_entry(&member_update.status, member_update.member_id);
+            }
+        }
+    }
+
+    gNextHopGroupMemberBulker.flush();
+
+    set<const NextHopGroupKey *> failed_nhgs;
+    for (auto& update : member_updates)
+    {
+        const NextHopGroupKey& nexthops = *update.nexthops;
+        NextHopGroupInfo& nhg_info = *update.nhg_info;
+        NextHopKey& endpoint = update.endpoint;
 
-                if (status != SAI_STATUS_SUCCESS)
+        if (update.up)
+        {
+            if (nexthops.getSize() > 1)
+            {
+                if (update.member_id == SAI_NULL_OBJECT_ID)
                 {
+                    sai_status_t status = gNextHopGroupMemberBulker.create_status(update.member_id);
                     SWSS_LOG_ERROR("Failed to add next hop member to group %" PRIx64 ": %d\n",
                                     nhg_info.next_hop_group_id, status);
                     task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP_GROUP, status);
                     if (handle_status != task_success)
                     {
+                        failed_nhgs.insert(&nexthops);
                         continue;
                     }
                 }
@@ -2801,77 +3262,20 @@ void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
                 gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
             }
 
-            // Re-create routes when it was temporarily removed
-            if (nhg_info.active_members.empty())
-            {
-                nhg_info.active_members[endpoint] = next_hop_group_member_id;
-                if (vnet_orch_->isVnetExecVrf())
-                {
-                    for (auto ip_pfx : syncd_nexthop_groups_[vnet][nexthops].tunnel_routes)
-                    {
-                        // remove the bgp learnt route first if any exists and then add the tunnel route.
-                        auto ipPrefixsubnet = ip_pfx.getSubnet();
-                        auto prefixStr = ip_pfx.to_string();
-                        auto nhStr = nexthops.to_string();
-                        if (prefix_to_adv_prefix_.find(ip_pfx) != prefix_to_adv_prefix_.end())
-                        {
-                            auto adv_prefix = prefix_to_adv_prefix_[ip_pfx];
-                            if(adv_prefix.to_string() != prefixStr)
-                            {
-                                ipPrefixsubnet = adv_prefix.getSubnet();
-                            }
-                        }
-
-                        sai_object_id_t vr_id = vrf_obj->getVRidIngress();
-                        if(gRouteOrch && gRouteOrch->isRouteExists(vr_id, ipPrefixsubnet))
-                        {
-                            if (!gRouteOrch->removeRoutePrefix(ipPrefixsubnet))
-                            {
-                                SWSS_LOG_ERROR("Could not remove existing bgp route for prefix: %s\n", prefixStr.c_str());
-                                return;
-                            }
-                            SWSS_LOG_INFO("Successfully removed existing bgp route for prefix: %s\n", prefixStr.c_str());
-                        }
-                        string op = SET_COMMAND;
-                        SWSS_LOG_INFO("Adding Vnet route for prefix:%s with nexthop group: %s\n", prefixStr.c_str(), nhStr.c_str());
-
-                        if (!updateTunnelRoute(vnet, ip_pfx, nexthops, op))
-                        {
-                            SWSS_LOG_NOTICE("Failed to create tunnel route in hardware for prefix: %s\n", prefixStr.c_str());
-                            failed = true;
-                        }
-                        else
-                        {
-                            SWSS_LOG_INFO("Successfully created tunnel route in hardware for prefix: %s\n", prefixStr.c_str());
-                        }
-                    }
-                }
-                if (failed)
-                {
-                    // This is an unrecoverable error, Throw a LOG_ERROR and return
-                    SWSS_LOG_ERROR("Inconsistent hardware State. Failed to create tunnel routes.\n");
-                    return;
-                }
-            }
-            else
-            {
-                nhg_info.active_members[endpoint] = next_hop_group_member_id;
-            }
+            nhg_info.active_members[endpoint] = update.member_id;
         }
         else
         {
-            if (nexthops.getSize() > 1 && nhg_info.active_members.find(endpoint) != nhg_info.active_members.end())
+            if (update.member_id != SAI_NULL_OBJECT_ID)
             {
-                sai_object_id_t nexthop_id = nhg_info.active_members[endpoint];
-                sai_status_t status = sai_next_hop_group_api->remove_next_hop_group_member(nexthop_id);
-
-                if (status != SAI_STATUS_SUCCESS)
+                if (update.status != SAI_STATUS_SUCCESS)
                 {
                     SWSS_LOG_ERROR("Failed to remove next hop member %" PRIx64 " from group %" PRIx64 ": %d\n",
-                                nexthop_id, nhg_info.next_hop_group_id, status);
-                    task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, status);
+                                update.member_id, nhg_info.next_hop_group_id, update.status);
+                    task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, update.status);
                     if (handle_status != task_success)
                     {
+                        failed_nhgs.insert(&nexthops);
                         continue;
                     }
                 }
@@ -2885,35 +3289,107 @@ void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
                 gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
             }
 
-            if (nhg_info.active_members.find(endpoint) != nhg_info.active_members.end())
+            nhg_info.active_members.erase(endpoint);
+        }
+    }
+
+    // Re-create the routes of the groups which got their first active member,
+    // and remove the routes of the groups which lost their last one.
+    // A route is only removed and then created in one batch, which the route
+    // bulker programs in this order.
+    if (vnet_orch_->isVnetExecVrf())
+    {
+        for (const auto& nhg_active : nhg_had_active_members)
+        {
+            NextHopGroupKey nexthops = *nhg_active.first;
+            NextHopGroupInfo& nhg_info = nexthop_groups[nexthops];
+            bool has_active_members = !nhg_info.active_members.empty();
+
+            if (has_active_members == nhg_active.second)
+            {
+                continue;
+            }
+
+            string op = has_active_members ? SET_COMMAND : DEL_COMMAND;
+            auto nhStr = nexthops.to_string();
+
+            for (auto ip_pfx : nhg_info.tunnel_routes)
             {
-                nhg_info.active_members.erase(endpoint);
+                auto prefixStr = ip_pfx.to_string();
 
-                // Remove routes when nexthop group has no active endpoint
-                if (nhg_info.active_members.empty())
+                if (has_active_members)
                 {
-                    if (vnet_orch_->isVnetExecVrf())
+                    // remove the bgp learnt route first if any exists and then add the tunnel route.
+                    auto ipPrefixsubnet = ip_pfx.getSubnet();
+                    if (prefix_to_adv_prefix_.find(ip_pfx) != prefix_to_adv_prefix_.end())
+                    {
+                        auto adv_prefix = prefix_to_adv_prefix_[ip_pfx];
+                        if(adv_prefix.to_string() != prefixStr)
+                        {
+                            ipPrefixsubnet = adv_prefix.getSubnet();
+                        }
+                    }
+
+                    sai_object_id_t vr_id = vrf_obj->getVRidIngress();
+                    if(gRouteOrch && gRouteOrch->isRouteExists(vr_id, ipPrefixsubnet))
                     {
-                        for (auto ip_pfx : syncd_nexthop_groups_[vnet][nexthops].tunnel_routes)
+                        if (!gRouteOrch->removeRoutePrefix(ipPrefixsubnet))
                         {
-                            SWSS_LOG_NOTICE("Removing Vnet route for prefix : %s due to no active nexthops.\n",ip_pfx.to_string().c_str());
-                            string op = DEL_COMMAND;
-                            updateTunnelRoute(vnet, ip_pfx, nexthops, op);
+                            SWSS_LOG_ERROR("Could not remove existing bgp route for prefix: %s\n", prefixStr.c_str());
+                            failed_nhgs.insert(nhg_active.first);
+                            continue;
                         }
+                        SWSS_LOG_INFO("Successfully removed existing bgp route for prefix: %s\n", prefixStr.c_str());
                     }
+                    SWSS_LOG_INFO("Adding Vnet route for prefix:%s with nexthop group: %s\n", prefixStr.c_str(), nhStr.c_str());
+                }
+                else
+                {
+                    SWSS_LOG_NOTICE("Removing Vnet route for prefix : %s due to no active nexthops.\n", prefixStr.c_str());
+                }
+
+                if (!updateTunnelRoute(vnet, ip_pfx, nexthops, op))
+                {
+                    SWSS_LOG_NOTICE("Failed to update tunnel route in hardware for prefix: %s\n", prefixStr.c_str());
+                    failed_nhgs.insert(nhg_active.first);
                 }
             }
         }
-        if (!failed)
+
+        auto failed_routes = flushRoutes()[vnet];
+        if (!failed_routes.empty())
         {
-            // Post configured in State DB
-            for (auto ip_pfx : syncd_nexthop_groups_[vnet][nexthops].tunnel_routes)
+            // This is an unrecoverable error, Throw a LOG_ERROR
+            SWSS_LOG_ERROR("Inconsistent hardware State. Failed to update %zu tunnel routes.\n", failed_routes.size());
+            for (const auto& nhg_active : nhg_had_active_members)
             {
-                string profile = vrf_obj->getProfile(ip_pfx);
-                postRouteState(vnet, ip_pfx, nexthops, profile);
+                for (const auto& ip_pfx : nexthop_groups[*nhg_active.first].tunnel_routes)
+                {
+                    if (failed_routes.find(ip_pfx) != failed_routes.end())
+                    {
+                        failed_nhgs.insert(nhg_active.first);
+                        break;
+                    }
+                }
             }
         }
     }
+
+    // Post configured in State DB
+    for (const auto& nhg_active : nhg_had_active_members)
+    {
+        if (failed_nhgs.find(nhg_active.first) != failed_nhgs.end())
+        {
+            continue;
+        }
+
+        NextHopGroupKey nexthops = *nhg_active.first;
+        for (auto ip_pfx : nexthop_groups[nexthops].tunnel_routes)
+        {
+            string profile = vrf_obj->getProfile(ip_pfx);
+            postRouteState(vnet, ip_pfx, nexthops, profile);
+        }
+    }
 }
 
 void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
@@ -3046,7 +3522,7 @@ void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
             NextHopGroupInfo next_hop_group_entry;
             next_hop_group_entry.next_hop_group_id = SAI_NULL_OBJECT_ID;
             next_hop_group_entry.ref_count = 0;
-            syncd_nexthop_groups_[vnet][nhg_custom] = next_hop_group_entry;
+            addNextHopGroupEntry(vnet, nhg_custom, next_hop_group_entry);
         }
     }
     auto active_nhg_size = active_nhg.getSize();
@@ -3132,7 +3608,7 @@ void VNetRouteOrch::updateVnetTunnelCustomMonitor(const MonitorUpdate& update)
             }
             else
             {
-                syncd_nexthop_groups_[vnet].erase(active_nhg);
+                removeNextHopGroupEntry(vnet, active_nhg);
                 if(active_nhg_size == 1)
                 {
                     NextHopKey nexthop(active_nhg.to_string(), true);
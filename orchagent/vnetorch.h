@@ -2,6 +2,7 @@
 #define __VNETORCH_H
 
 #include <vector>
+#include <deque>
 #include <set>
 #include <unordered_map>
 #include <algorithm>
@@ -16,6 +17,8 @@
 #include "nexthopgroupkey.h"
 #include "bfdorch.h"
 #include "tunneltermhelper.h"
+#include "bulker.h"
+#include "routeorch.h"
 
 #define VNET_BITMAP_SIZE 32
 #define VNET_TUNNEL_SIZE 40960
@@ -513,11 +516,64 @@ public:
     void detach(Observer* observer, const IpAddress& dstAddr);
 
     void update(SubjectType, void *);
+    void doTask() override;
+    void doTask(Consumer& consumer) override;
+    using Orch2::doTask;
     void updateMonitorState(string& op, const IpPrefix& prefix , const IpAddress& endpoint, string state);
     void updateCustomBfdState(const IpAddress& monitoring_ip, const string& state);
     void updateAllMonitoringSession(const string& vnet);
 
 private:
+    enum RouteOpType
+    {
+        ROUTE_OP_NONE,
+        ROUTE_OP_CREATE,
+        ROUTE_OP_UPDATE,
+        ROUTE_OP_REMOVE
+    };
+
+    struct RouteOp
+    {
+        string vnet;
+        IpPrefix prefix;
+        sai_route_entry_t route_entry;
+        RouteOpType type;
+        sai_status_t status;
+    };
+
+    /*
+     * Route change of a VNET_ROUTE_TABLE or VNET_ROUTE_TUNNEL_TABLE entry,
+     * from doRouteTask() until the routes are programmed by flushRouteTasks()
+     */
+    struct RouteTask
+    {
+        string table;                               // Table, key and operation of the entry in m_toSync
+        string key;
+        string op;
+        string vnet;
+        IpPrefix prefix;
+        bool is_tunnel;
+        set<sai_object_id_t> vr_set;
+        RouteOpType route_op;                       // Route change queued for each virtual router
+
+        // Tunnel routes
+        NextHopGroupKey nexthops;
+        NextHopGroupKey nexthops_secondary;
+        NextHopGroupKey active_nhg;
+        string profile;
+        string monitoring;
+        IpPrefix adv_prefix;
+        bool custom_monitor_ep_updated;
+        bool custom_monitor_pinned_state_updated;
+        map<NextHopKey, IpAddress> origin_primary_monitors;
+        map<NextHopKey, IpAddress> origin_secondary_monitors;
+
+        // Routes with next hops
+        nextHop nh;
+        bool is_subnet;
+        std::deque<RouteBulkContext> route_ctxs;    // Routes added or removed by RouteOrch
+    };
+
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
 
@@ -566,14 +622,15 @@ private:
     void addRouteAdvertisement(IpPrefix& ipPrefix, string& profile);
     void removeRouteAdvertisement(IpPrefix& ipPrefix);
 
-    void updateVnetTunnel(const BfdUpdate&);
+    void updateVnetTunnels();
+    void updateVnetTunnelEndpoints(const string& vnet, const map<NextHopKey, pair<bool, bool>>& changes);
     void updateVnetTunnelCustomMonitor(const MonitorUpdate& update);
     bool updateTunnelRoute(const string& vnet, IpPrefix& ipPrefix, NextHopGroupKey& nexthops, string& op);
     void createSubnetDecapTerm(const IpPrefix &ipPrefix);
     void removeSubnetDecapTerm(const IpPrefix &ipPrefix);
 
-    bool setAndDeleteRoutesWithRouteOrch(const sai_object_id_t vr_id, const IpPrefix& ipPrefix,
-                                        const NextHopGroupKey& nhg, const string& op);
+    void addNextHopGroupEntry(const string& vnet, const NextHopGroupKey& nexthops, const NextHopGroupInfo& nhg_info);
+    void removeNextHopGroupEntry(const string& vnet, const NextHopGroupKey& nexthops);
 
     template<typename T>
     bool doRouteTask(const string& vnet, IpPrefix& ipPrefix, NextHopGroupKey& nexthops, string& op, string& profile,
@@ -585,6 +642,14 @@ private:
     template<typename T>
     bool doRouteTask(const string& vnet, IpPrefix& ipPrefix, nextHop& nh, string& op);
 
+    RouteTask& addRouteTask(const string& vnet, const IpPrefix& ipPrefix, const set<sai_object_id_t>& vr_set, bool is_tunnel);
+    void addRouteOp(const string& vnet, const IpPrefix& ipPrefix, sai_object_id_t vr_id, RouteOpType type,
+                    sai_object_id_t nh_id = SAI_NULL_OBJECT_ID);
+    map<string, set<IpPrefix>> flushRoutes();
+    void flushRouteTasks();
+    bool doTunnelRouteTaskPost(RouteTask& task, bool route_failed);
+    bool doRouteTaskPost(RouteTask& task, bool route_failed);
+
     bool isLocalEndpoint(const string&vnet, const IpAddress &ipAddr);
     bool isPartiallyLocal(const std::vector<swss::IpAddress>& ip_list);
 
@@ -595,6 +660,8 @@ private:
     VNetRouteTable syncd_routes_;
     VNetNextHopObserverTable next_hop_observers_;
     std::map<std::string, VNetNextHopGroupInfoTable> syncd_nexthop_groups_;
+    // Next hop groups of each endpoint, per VNET
+    std::map<std::string, std::map<NextHopKey, std::set<NextHopGroupKey>>> endpoint_nexthop_groups_;
     std::map<std::string, VNetTunnelRouteTable> syncd_tunnel_routes_;
     std::map<std::string, bool> vnet_tunnel_route_check_directly_connected;
     BfdSessionTable bfd_sessions_;
@@ -613,6 +680,17 @@ private:
     unique_ptr<Table> state_vnet_rt_adv_table_;
 
     shared_ptr<VNetTunnelTermAcl> vnet_tunnel_term_acl_;
+
+    // Route changes queued by addRouteOp() until flushRoutes()
+    std::deque<RouteOp> route_ops_;
+    // Route tasks queued by doRouteTask() until flushRouteTasks(), and their prefixes
+    std::deque<RouteTask> route_tasks_;
+    std::set<IpPrefix> route_task_prefixes_;
+    // BFD state changes received since the last doTask()
+    std::vector<BfdUpdate> pending_bfd_updates_;
+
+    EntityBulker<sai_route_api_t> gRouteBulker;
+    ObjectBulker<sai_next_hop_group_api_t> gNextHopGroupMemberBulker;
 };
 
 class VNetCfgRouteOrch : public Orch
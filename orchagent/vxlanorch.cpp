@@ -1,4 +1,5 @@
 #include <cassert>
+#include <deque>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -21,6 +22,7 @@ extern "C" {
 #include "flex_counter_manager.h"
 #include "converter.h"
 #include "saihelper.h"
+#include "bulker.h"
 
 /* Global variables */
 extern sai_object_id_t gSwitchId;
@@ -32,6 +34,7 @@ extern PortsOrch*       gPortsOrch;
 extern sai_object_id_t  gUnderlayIfId;
 extern FlexManagerDirectory g_FlexManagerDirectory;
 extern bool gTraditionalFlexCounter;
+extern size_t gMaxBulkSize;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
 
@@ -286,16 +289,18 @@ static sai_status_t create_nexthop_tunnel(
     return status;
 }
 
-// Create Tunnel
-static sai_object_id_t
-create_tunnel(
+// Tunnel attributes, the mapper lists point into map_list and emap_list
+static std::vector<sai_attribute_t>
+get_tunnel_attrs(
     struct tunnel_ids_t* ids,
     sai_ip_address_t *src_ip,
     sai_ip_address_t *dst_ip,
     sai_object_id_t underlay_rif,
     bool p2p,
     VxlanTunnelTTLMode decap_ttl_mode,
-    sai_uint8_t encap_ttl=0)
+    sai_uint8_t encap_ttl,
+    std::vector<sai_object_id_t>& map_list,
+    std::vector<sai_object_id_t>& emap_list)
 {
     sai_attribute_t attr;
     std::vector<sai_attribute_t> tunnel_attrs;
@@ -308,40 +313,34 @@ create_tunnel(
     attr.value.oid = underlay_rif;
     tunnel_attrs.push_back(attr);
 
-    sai_object_id_t map_list[TUNNEL_MAP_T_MAX_MAPPER+1];
-    uint8_t num_map=0;
-
+    map_list.clear();
     for (int i=TUNNEL_MAP_T_VLAN;i<TUNNEL_MAP_T_MAX_MAPPER;i++)
     {
       if (ids->tunnel_decap_id[i] != SAI_NULL_OBJECT_ID)
       {
-          map_list[num_map] = ids->tunnel_decap_id[i];
-          SWSS_LOG_INFO("create_tunnel:maplist[%d]=0x%" PRIx64 "",num_map,map_list[num_map]);
-          num_map++;
+          map_list.push_back(ids->tunnel_decap_id[i]);
+          SWSS_LOG_INFO("create_tunnel:maplist[%zu]=0x%" PRIx64 "",map_list.size()-1,map_list.back());
       }
     }
       
     attr.id = SAI_TUNNEL_ATTR_DECAP_MAPPERS;
-    attr.value.objlist.count = num_map;
-    attr.value.objlist.list = map_list;
+    attr.value.objlist.count = static_cast<uint32_t>(map_list.size());
+    attr.value.objlist.list = map_list.data();
     tunnel_attrs.push_back(attr);
 
-    sai_object_id_t emap_list[TUNNEL_MAP_T_MAX_MAPPER+1];
-    uint8_t num_emap=0;
-
+    emap_list.clear();
     for (int i=TUNNEL_MAP_T_VLAN;i<TUNNEL_MAP_T_MAX_MAPPER;i++)
     {
         if (ids->tunnel_encap_id[i] != SAI_NULL_OBJECT_ID)
         {
-            emap_list[num_emap] = ids->tunnel_encap_id[i];
-            SWSS_LOG_NOTICE("create_tunnel:encapmaplist[%d]=0x%" PRIx64 "",num_emap,emap_list[num_emap]);
-            num_emap++;
+            emap_list.push_back(ids->tunnel_encap_id[i]);
+            SWSS_LOG_NOTICE("create_tunnel:encapmaplist[%zu]=0x%" PRIx64 "",emap_list.size()-1,emap_list.back());
         }
     }
 
     attr.id = SAI_TUNNEL_ATTR_ENCAP_MAPPERS;
-    attr.value.objlist.count = num_emap;
-    attr.value.objlist.list = emap_list;
+    attr.value.objlist.count = static_cast<uint32_t>(emap_list.size());
+    attr.value.objlist.list = emap_list.data();
     tunnel_attrs.push_back(attr);
 
     // source ip
@@ -393,6 +392,24 @@ create_tunnel(
         tunnel_attrs.push_back(attr);
     }
 
+    return tunnel_attrs;
+}
+
+// Create Tunnel
+static sai_object_id_t
+create_tunnel(
+    struct tunnel_ids_t* ids,
+    sai_ip_address_t *src_ip,
+    sai_ip_address_t *dst_ip,
+    sai_object_id_t underlay_rif,
+    bool p2p,
+    VxlanTunnelTTLMode decap_ttl_mode,
+    sai_uint8_t encap_ttl=0)
+{
+    std::vector<sai_object_id_t> map_list, emap_list;
+    auto tunnel_attrs = get_tunnel_attrs(ids, src_ip, dst_ip, underlay_rif, p2p,
+                                         decap_ttl_mode, encap_ttl, map_list, emap_list);
+
     sai_object_id_t tunnel_id;
     sai_status_t status = sai_tunnel_api->create_tunnel(
                                 &tunnel_id,
@@ -949,6 +966,101 @@ bool VxlanTunnel::createTunnelHw(uint8_t mapper_list, tunnel_map_use_t map_src,
     return true;
 }
 
+// Bulk creation of SAI Tunnel Objects, without tunnel termination
+void VxlanTunnel::createTunnelsHw(const std::vector<VxlanTunnel*>& tunnels, uint8_t mapper_list,
+                                  tunnel_map_use_t map_src)
+{
+    if (tunnels.empty())
+    {
+        return;
+    }
+
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+
+    if (sai_tunnel_api->create_tunnels == nullptr)
+    {
+        for (auto tunnel : tunnels)
+        {
+            tunnel->createTunnelHw(mapper_list, map_src, false);
+        }
+        return;
+    }
+
+    struct TunnelCreateCtx
+    {
+        VxlanTunnel *tunnel;
+        sai_ip_address_t ips;
+        sai_ip_address_t ipd;
+        std::vector<sai_object_id_t> map_list;
+        std::vector<sai_object_id_t> emap_list;
+        std::vector<sai_attribute_t> attrs;
+    };
+
+    // Attributes point into the contexts, which must not move until the flush
+    std::deque<TunnelCreateCtx> ctxs;
+    ObjectBulker<sai_tunnel_api_t> tunnel_bulker(sai_tunnel_api, gSwitchId, gMaxBulkSize);
+
+    for (auto tunnel : tunnels)
+    {
+        try
+        {
+            tunnel->createMapperHw(mapper_list, map_src);
+        }
+        catch (const std::runtime_error& error)
+        {
+            SWSS_LOG_ERROR("Error creating tunnel %s: %s", tunnel->tunnel_name_.c_str(), error.what());
+            continue;
+        }
+
+        ctxs.emplace_back();
+        auto& ctx = ctxs.back();
+        ctx.tunnel = tunnel;
+
+        swss::copy(ctx.ips, tunnel->src_ip_);
+        sai_ip_address_t *ip = nullptr;
+        bool p2p = false;
+        if (!tunnel->dst_ip_.isZero())
+        {
+            swss::copy(ctx.ipd, tunnel->dst_ip_);
+            ip = &ctx.ipd;
+            p2p = (tunnel->src_creation_ == TNL_CREATION_SRC_EVPN)? true:false;
+        }
+
+        ctx.attrs = get_tunnel_attrs(&tunnel->ids_, &ctx.ips, ip, gUnderlayIfId, p2p,
+                                     tunnel->decap_ttl_mode_, DEFAULT_TUNNEL_ENCAP_TTL,
+                                     ctx.map_list, ctx.emap_list);
+        tunnel_bulker.create_entry(&tunnel->ids_.tunnel_id,
+                                   static_cast<uint32_t>(ctx.attrs.size()), ctx.attrs.data());
+    }
+
+    tunnel_bulker.flush();
+
+    for (auto& ctx : ctxs)
+    {
+        auto tunnel = ctx.tunnel;
+
+        if (tunnel->ids_.tunnel_id == SAI_NULL_OBJECT_ID)
+        {
+            sai_status_t status = tunnel_bulker.create_status(SAI_NULL_OBJECT_ID);
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_TUNNEL, status);
+            if (handle_status != task_success)
+            {
+                SWSS_LOG_ERROR("Can't create a tunnel object for %s", tunnel->tunnel_name_.c_str());
+            }
+
+            // Undo changes in createMapperHw if create_tunnel fails.
+            tunnel->deleteMapperHw(mapper_list, map_src);
+            tunnel->ids_.tunnel_term_id = SAI_NULL_OBJECT_ID;
+            tunnel->active_ = false;
+            continue;
+        }
+
+        tunnel_orch->addTunnelToFlexCounter(tunnel->ids_.tunnel_id, tunnel->tunnel_name_);
+        tunnel->active_ = true;
+        SWSS_LOG_INFO("Vxlan tunnel '%s' was created", tunnel->tunnel_name_.c_str());
+    }
+}
+
 void VxlanTunnel::deletePendingSIPTunnel()
 {
    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
@@ -1164,6 +1276,17 @@ bool VxlanTunnel::createDynamicDIPTunnel(const std::string dip, tunnel_user_t us
     if (it == tnl_users_.end())
     {
         tunnel_orch->getTunnelNameFromDIP(dip, tunnel_name);
+
+        // Tunnel already created by createDynamicDIPTunnels()
+        if (tunnel_orch->isTunnelExists(tunnel_name) &&
+            tunnel_orch->getVxlanTunnel(tunnel_name)->isActive())
+        {
+            memset(&tnl_refcnts,0,sizeof(tunnel_refcnt_t));
+            updateRemoteEndPointRefCnt(true,tnl_refcnts,usr);
+            tnl_users_[dip] = tnl_refcnts;
+            return true;
+        }
+
         auto dipaddr = IpAddress(dip);
         dip_tunnel = (new VxlanTunnel(tunnel_name, src_ip_, dipaddr, TNL_CREATION_SRC_EVPN));
         tunnel_orch->addTunnel(tunnel_name,dip_tunnel);
@@ -1187,6 +1310,70 @@ bool VxlanTunnel::createDynamicDIPTunnel(const std::string dip, tunnel_user_t us
     return true;
 }
 
+/*
+ * Creates the P2P tunnels of the remote VTEPs of a batch of updates in bulk.
+ * The tunnels get their users from createDynamicDIPTunnel(), the ones which
+ * got none are removed by removeUnusedDynamicDIPTunnels().
+ */
+void VxlanTunnel::createDynamicDIPTunnels(const std::vector<std::string>& dips)
+{
+    uint8_t mapper_list = 0;
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+    std::vector<VxlanTunnel*> dip_tunnels;
+    string tunnel_name;
+
+    for (const auto& dip : dips)
+    {
+        tunnel_orch->getTunnelNameFromDIP(dip, tunnel_name);
+        if (tnl_users_.find(dip) != tnl_users_.end() || tunnel_orch->isTunnelExists(tunnel_name))
+        {
+            continue;
+        }
+
+        auto dip_tunnel = new VxlanTunnel(tunnel_name, src_ip_, IpAddress(dip), TNL_CREATION_SRC_EVPN);
+        tunnel_orch->addTunnel(tunnel_name, dip_tunnel);
+        dip_tunnels.push_back(dip_tunnel);
+    }
+
+    TUNNELMAP_SET_VLAN(mapper_list);
+    TUNNELMAP_SET_VRF(mapper_list);
+    createTunnelsHw(dip_tunnels, mapper_list, TUNNEL_MAP_USE_COMMON_ENCAP_DECAP);
+
+    // Failed tunnels are created again, one at a time, by createDynamicDIPTunnel()
+    for (auto dip_tunnel : dip_tunnels)
+    {
+        if (!dip_tunnel->isActive())
+        {
+            tunnel_orch->delTunnel(dip_tunnel->getTunnelName());
+        }
+    }
+
+    SWSS_LOG_NOTICE("Created %zu P2P Tunnels", dip_tunnels.size());
+}
+
+void VxlanTunnel::removeUnusedDynamicDIPTunnels(const std::vector<std::string>& dips)
+{
+    uint8_t mapper_list = 0;
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+    string tunnel_name;
+
+    TUNNELMAP_SET_VLAN(mapper_list);
+    TUNNELMAP_SET_VRF(mapper_list);
+
+    for (const auto& dip : dips)
+    {
+        tunnel_orch->getTunnelNameFromDIP(dip, tunnel_name);
+        if (tnl_users_.find(dip) != tnl_users_.end() || !tunnel_orch->isTunnelExists(tunnel_name))
+        {
+            continue;
+        }
+
+        tunnel_orch->getVxlanTunnel(tunnel_name)->deleteTunnelHw(mapper_list, TUNNEL_MAP_USE_COMMON_ENCAP_DECAP, false);
+        tunnel_orch->delTunnel(tunnel_name);
+        SWSS_LOG_INFO("Removed unused P2P Tunnel %s", tunnel_name.c_str());
+    }
+}
+
 bool VxlanTunnel::deleteDynamicDIPTunnel(const std::string dip, tunnel_user_t usr, 
                                                                 bool update_refcnt)
 {
@@ -1347,6 +1534,17 @@ void VxlanTunnelOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    if (m_pendingAddToFlexCntr.empty())
+    {
+        return;
+    }
+
+    // The tunnels ready in this run are registered with one write per map
+    vector<FieldValueTuple> tunnelNameFvs;
+    vector<FieldValueTuple> tunnelTypeFvs;
+    vector<sai_object_id_t> tunnelIds;
+    string type = "SAI_TUNNEL_TYPE_VXLAN";
+
     for (auto it = m_pendingAddToFlexCntr.begin(); it != m_pendingAddToFlexCntr.end(); )
     {
         string value;
@@ -1355,19 +1553,11 @@ void VxlanTunnelOrch::doTask(SelectableTimer &timer)
         if (!gTraditionalFlexCounter || m_vidToRidTable->hget("", id, value))
         {
             SWSS_LOG_INFO("Registering %s, id %s", it->second.c_str(), id.c_str());
-            vector<FieldValueTuple> tunnelNameFvs;
-            vector<FieldValueTuple> tunnelTypeFvs;
-            string type = "SAI_TUNNEL_TYPE_VXLAN";
 
             tunnelNameFvs.emplace_back(it->second, id);
             tunnelTypeFvs.emplace_back(id, type);
+            tunnelIds.push_back(it->first);
 
-            m_tunnelNameTable->set("", tunnelNameFvs);
-            m_tunnelTypeTable->set("", tunnelTypeFvs);
-            auto tunnel_stats = generateTunnelCounterStats();
-
-            tunnel_stat_manager->setCounterIdList(it->first, CounterType::TUNNEL,
-                                                  tunnel_stats);
             it = m_pendingAddToFlexCntr.erase(it);
         }
         else
@@ -1375,6 +1565,21 @@ void VxlanTunnelOrch::doTask(SelectableTimer &timer)
             ++it;
         }
     }
+
+    if (tunnelIds.empty())
+    {
+        return;
+    }
+
+    m_tunnelNameTable->set("", tunnelNameFvs);
+    m_tunnelTypeTable->set("", tunnelTypeFvs);
+
+    auto tunnel_stats = generateTunnelCounterStats();
+    for (auto tunnel_id : tunnelIds)
+    {
+        tunnel_stat_manager->setCounterIdList(tunnel_id, CounterType::TUNNEL,
+                                              tunnel_stats);
+    }
 }
 void VxlanTunnelOrch::addTunnelToFlexCounter(sai_object_id_t oid, const string &name)
 {
@@ -2500,6 +2705,98 @@ bool VxlanVrfMapOrch::delOperation(const Request& request)
 
 //------------------- EVPN_REMOTE_VNI Table --------------------------//
 
+bool EvpnRemoteVnip2pOrch::isRemoteVniReady(const std::string& vlan_name, const std::vector<FieldValueTuple>& fvs)
+{
+    if (vlan_name.compare(0, 4, "Vlan") != 0)
+    {
+        return false;
+    }
+
+    uint32_t vni_id = 0;
+    sai_vlan_id_t vlan_id = 0;
+    try
+    {
+        vlan_id = to_uint<sai_vlan_id_t>(vlan_name.substr(4));
+        for (const auto& fv : fvs)
+        {
+            if (fvField(fv) == "vni")
+            {
+                vni_id = to_uint<uint32_t>(fvValue(fv));
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Reported by addOperation()
+        return false;
+    }
+
+    Port vlanPort;
+    std::string vniVlanMapName;
+    uint32_t tmp_vlan_id = 0;
+    sai_object_id_t tnl_map_entry_id = SAI_NULL_OBJECT_ID;
+    VxlanTunnelMapOrch* vxlan_tun_map_orch = gDirectory.get<VxlanTunnelMapOrch*>();
+    VRFOrch* vrf_orch = gDirectory.get<VRFOrch*>();
+
+    return gPortsOrch->getVlanByVlanId(vlan_id, vlanPort) &&
+           vxlan_tun_map_orch->isVniVlanMapExists(vni_id, vniVlanMapName, &tnl_map_entry_id, &tmp_vlan_id) &&
+           !vrf_orch->isL3VniVlan(vni_id);
+}
+
+void EvpnRemoteVnip2pOrch::doTask(Consumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    EvpnNvoOrch* evpn_orch = gDirectory.get<EvpnNvoOrch*>();
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+    auto vtep_ptr = evpn_orch->getEVPNVtep();
+    std::vector<std::string> dips;
+
+    // Create the tunnels of the new remote VTEPs of the batch at once
+    if (vtep_ptr && vtep_ptr->isActive() && tunnel_orch->isDipTunnelsSupported())
+    {
+        for (const auto& entry : consumer.m_toSync)
+        {
+            if (kfvOp(entry.second) != SET_COMMAND)
+            {
+                continue;
+            }
+
+            const auto& key = kfvKey(entry.second);
+            auto found = key.find(consumer.getConsumerTable()->getTableNameSeparator());
+            if (found == string::npos)
+            {
+                continue;
+            }
+
+            Port tunnelPort;
+            auto remote_vtep = key.substr(found + 1);
+            if (tunnel_orch->getTunnelPort(remote_vtep, tunnelPort))
+            {
+                continue;
+            }
+
+            // Skip the updates which addOperation() would keep for retry,
+            // so that their tunnels are not created again on every retry
+            if (!isRemoteVniReady(key.substr(0, found), kfvFieldsValues(entry.second)))
+            {
+                continue;
+            }
+
+            dips.push_back(remote_vtep);
+        }
+
+        vtep_ptr->createDynamicDIPTunnels(dips);
+    }
+
+    Orch2::doTask(consumer);
+
+    if (!dips.empty())
+    {
+        vtep_ptr->removeUnusedDynamicDIPTunnels(dips);
+    }
+}
+
 bool EvpnRemoteVnip2pOrch::addOperation(const Request& request)
 {
     SWSS_LOG_ENTER();
@@ -205,6 +205,7 @@ public:
     bool deleteMapperHw(uint8_t mapper_list, tunnel_map_use_t map_src);
     bool createMapperHw(uint8_t mapper_list, tunnel_map_use_t map_src);
     bool createTunnelHw(uint8_t mapper_list, tunnel_map_use_t map_src, bool with_term = true, sai_uint8_t encap_ttl=DEFAULT_TUNNEL_ENCAP_TTL);
+    static void createTunnelsHw(const std::vector<VxlanTunnel*>& tunnels, uint8_t mapper_list, tunnel_map_use_t map_src);
     bool deleteTunnelHw(uint8_t mapper_list, tunnel_map_use_t map_src, bool with_term = true);
     void deletePendingSIPTunnel();
     void increment_spurious_imr_add(const std::string remote_vtep);
@@ -217,6 +218,8 @@ public:
     // Total DIP tunnels associated with this SIP tunnel.
     int getDipTunnelCnt();
     bool createDynamicDIPTunnel(const string dip, tunnel_user_t usr);
+    void createDynamicDIPTunnels(const std::vector<std::string>& dips);
+    void removeUnusedDynamicDIPTunnels(const std::vector<std::string>& dips);
     bool deleteDynamicDIPTunnel(const string dip, tunnel_user_t usr, bool update_refcnt = true);
     void cleanupDynamicDIPTunnel(const std::string remote_vtep);
     bool isTunnelReferenced(void);
@@ -506,6 +509,8 @@ public:
 
 
 private:
+    void doTask(Consumer& consumer) override;
+    bool isRemoteVniReady(const std::string& vlan_name, const std::vector<FieldValueTuple>& fvs);
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
 
@@ -176,9 +176,6 @@ void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
         return;
     }
 
-    /* Insert or update the ifindex to key map */
-    m_ifindexNameMap[ifindex] = key;
-
     if (nlmsg_type == RTM_DELLINK)
     {
         m_statePortTable.del(key);
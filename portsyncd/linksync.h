@@ -22,7 +22,6 @@ private:
     ProducerStateTable m_portTableProducer;
     Table m_portTable, m_statePortTable;
 
-    std::map<unsigned int, std::string> m_ifindexNameMap;
     std::map<unsigned int, std::string> m_ifindexOldNameMap;
 };
 
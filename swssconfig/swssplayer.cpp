@@ -1,24 +1,49 @@
+#include <getopt.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <set>
+#include <thread>
+#include <unordered_set>
 
 #include <dbconnector.h>
 #include <producerstatetable.h>
+#include <subscriberstatetable.h>
+#include <select.h>
+#include <ipprefix.h>
+#include <ipaddress.h>
 #include "zmqclient.h"
 #include "zmqproducerstatetable.h"
 #include "orch_zmq_config.h"
 #include <schema.h>
 #include <tokenize.h>
+#include <nlohmann/json.hpp>
 
 using namespace std;
 using namespace swss;
+using json = nlohmann::json;
+using Clock = chrono::steady_clock;
 
 static int line_index = 0;
 static DBConnector db("APPL_DB", 0, true);
 
 void usage()
 {
-	cout << "Usage: swssplayer <file>" << endl;
-	/* TODO: Add sample input file */
+	cout << "Usage: swssplayer [OPTIONS] <file>" << endl;
+	cout << "Options:" << endl;
+	cout << "  -b, --benchmark          Replay the file and report APPL_DB to ASIC_DB latency" << endl;
+	cout << "                           and per table throughput as JSON" << endl;
+	cout << "  -r, --rate OPS           Replay rate in operations per second, 0 replays as" << endl;
+	cout << "                           fast as possible (default: 0)" << endl;
+	cout << "  -i, --idle MS            ASIC_DB idle time after which the replay is considered" << endl;
+	cout << "                           complete (default: 5000)" << endl;
+	cout << "  -o, --output FILE        Write the benchmark report to FILE instead of stdout" << endl;
 }
 
 vector<FieldValueTuple> processFieldsValuesTuple(string s)
@@ -84,15 +109,588 @@ void processTokens(vector<string> tokens, unordered_map<string, shared_ptr<Produ
 	}
 }
 
+/*
+ * Benchmark mode
+ *
+ * The recording is loaded up front, then replayed into APPL_DB at a fixed
+ * rate or as fast as possible while a collector thread timestamps every
+ * ASIC_STATE keyspace event. Once ASIC_DB has been idle for the configured
+ * time, the events are matched to the replayed operations offline:
+ *
+ *  - Tables whose entries map to a keyed SAI object (routes, neighbors) are
+ *    matched on the object key, e.g. ROUTE_TABLE:10.0.0.0/24 completes on the
+ *    first ROUTE_ENTRY event with "dest":"10.0.0.0/24" sent after it. Routes
+ *    are matched within their VRF, the virtual router of a VRF is learnt from
+ *    the first route event matched to it.
+ *  - Tables whose entries map to an OID object (ACL rules, ACL tables, next
+ *    hop groups) are matched in FIFO order on creates and removes of that
+ *    object type.
+ *
+ * Operations of other tables are only accounted in the replay throughput.
+ * Keyspace notifications must be enabled on the redis instance serving
+ * ASIC_DB (notify-keyspace-events AKE, as configured on SONiC).
+ */
+
+struct ReplayOp
+{
+	string table;
+	string key;
+	string op;
+	vector<FieldValueTuple> fvs;
+	Clock::time_point sent;
+};
+
+struct AsicEvent
+{
+	Clock::time_point time;
+	string key;
+	string op;
+};
+
+static const map<string, string> fifo_matched_tables = {
+	{ APP_ACL_RULE_TABLE_NAME,       "SAI_OBJECT_TYPE_ACL_ENTRY" },
+	{ APP_ACL_TABLE_TABLE_NAME,      "SAI_OBJECT_TYPE_ACL_TABLE" },
+	{ APP_NEXTHOP_GROUP_TABLE_NAME,  "SAI_OBJECT_TYPE_NEXT_HOP_GROUP" },
+};
+
+bool loadReplayOps(const string &file_name, vector<ReplayOp> &ops)
+{
+	ifstream file(file_name);
+	if (!file.is_open())
+	{
+		cerr << "Failed to open " << file_name << endl;
+		return false;
+	}
+
+	string line;
+	while (getline(file, line))
+	{
+		auto tokens = tokenize(line, '|', 3);
+		if (tokens.size() < 3)
+		{
+			/* e.g. "recording started" markers */
+			continue;
+		}
+
+		auto v_key = tokenize(tokens[1], ':', 1);
+		if (v_key.size() != 2 || (tokens[2] != SET_COMMAND && tokens[2] != DEL_COMMAND))
+		{
+			continue;
+		}
+
+		ReplayOp op;
+		op.table = v_key[0];
+		op.key = v_key[1];
+		op.op = tokens[2];
+		if (op.op == SET_COMMAND && tokens.size() > 3)
+		{
+			op.fvs = processFieldsValuesTuple(tokens[3]);
+		}
+		ops.push_back(move(op));
+	}
+
+	return true;
+}
+
+/* Splits a ROUTE_TABLE key into its VRF, empty for the default VRF, and prefix */
+void splitRouteKey(const string &key, string &vrf, string &prefix)
+{
+	vrf.clear();
+	prefix = key;
+	if (key.compare(0, 3, "Vrf") == 0)
+	{
+		auto pos = key.find(':');
+		vrf = key.substr(0, pos);
+		prefix = pos == string::npos ? "" : key.substr(pos + 1);
+	}
+}
+
+string routeMatchToken(const string &vrf, const string &prefix)
+{
+	return "SAI_OBJECT_TYPE_ROUTE_ENTRY|" + vrf + "|" + prefix;
+}
+
+/* Token identifying the ASIC object an APPL_DB entry maps to, empty if the entry is not matched by key */
+string appMatchToken(const ReplayOp &op)
+{
+	try
+	{
+		if (op.table == APP_ROUTE_TABLE_NAME)
+		{
+			string vrf, prefix;
+			splitRouteKey(op.key, vrf, prefix);
+			return routeMatchToken(vrf, IpPrefix(prefix).to_string());
+		}
+		if (op.table == APP_NEIGH_TABLE_NAME)
+		{
+			auto pos = op.key.find(':');
+			if (pos == string::npos)
+			{
+				return "";
+			}
+			return "SAI_OBJECT_TYPE_NEIGHBOR_ENTRY|" + IpAddress(op.key.substr(pos + 1)).to_string();
+		}
+	}
+	catch (const exception &)
+	{
+		return "";
+	}
+
+	return "";
+}
+
+/* Gets the virtual router and prefix of a ROUTE_ENTRY object key */
+bool parseAsicRouteKey(const string &object_key, string &vr, string &prefix)
+{
+	try
+	{
+		auto j = json::parse(object_key);
+		vr = j.at("vr").get<string>();
+		prefix = IpPrefix(j.at("dest").get<string>()).to_string();
+	}
+	catch (const exception &)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * Gets the VRF of a virtual router. A virtual router seen for the first time
+ * is bound to the VRF of the oldest pending route with the same prefix and
+ * operation, among the VRFs not bound yet.
+ */
+bool resolveRouteVrf(const string &vr, const string &prefix, const string &op, const set<string> &vrfs,
+					 const map<pair<string, string>, deque<size_t>> &pending, map<string, string> &vr_vrfs,
+					 string &vrf)
+{
+	auto it = vr_vrfs.find(vr);
+	if (it != vr_vrfs.end())
+	{
+		vrf = it->second;
+		return true;
+	}
+
+	bool found = false;
+	size_t oldest = 0;
+	for (const auto &name : vrfs)
+	{
+		auto bound = find_if(vr_vrfs.begin(), vr_vrfs.end(), [&name](const pair<const string, string> &v) {
+			return v.second == name;
+		});
+		if (bound != vr_vrfs.end())
+		{
+			continue;
+		}
+
+		auto p = pending.find({ routeMatchToken(name, prefix), op });
+		if (p == pending.end() || p->second.empty())
+		{
+			continue;
+		}
+		if (!found || p->second.front() < oldest)
+		{
+			found = true;
+			oldest = p->second.front();
+			vrf = name;
+		}
+	}
+
+	if (found)
+	{
+		vr_vrfs[vr] = vrf;
+	}
+	return found;
+}
+
+string asicMatchToken(const string &object_type, const string &object_key)
+{
+	try
+	{
+		if (object_type == "SAI_OBJECT_TYPE_NEIGHBOR_ENTRY")
+		{
+			auto j = json::parse(object_key);
+			return object_type + "|" + IpAddress(j.at("ip").get<string>()).to_string();
+		}
+	}
+	catch (const exception &)
+	{
+		return "";
+	}
+
+	return "";
+}
+
+void collectAsicEvents(atomic<bool> &ready, atomic<bool> &stop, atomic<int64_t> &last_event,
+					   vector<string> &existing, vector<AsicEvent> &events)
+{
+	DBConnector asic_db("ASIC_DB", 0, true);
+	SubscriberStateTable asic_state(&asic_db, "ASIC_STATE");
+	Select s;
+	s.addSelectable(&asic_state);
+
+	bool initial = true;
+	while (!stop)
+	{
+		Selectable *sel;
+		int ret = s.select(&sel, initial ? 10 : 100);
+		if (ret == Select::TIMEOUT)
+		{
+			if (initial)
+			{
+				/* The snapshot of the existing objects has been drained */
+				initial = false;
+				ready = true;
+			}
+			continue;
+		}
+		if (ret != Select::OBJECT)
+		{
+			continue;
+		}
+
+		auto now = Clock::now();
+		deque<KeyOpFieldsValuesTuple> entries;
+		asic_state.pops(entries);
+		for (const auto &entry : entries)
+		{
+			if (initial)
+			{
+				existing.push_back(kfvKey(entry));
+				continue;
+			}
+			events.push_back({ now, kfvKey(entry), kfvOp(entry) });
+		}
+		if (!initial)
+		{
+			last_event = now.time_since_epoch().count();
+		}
+	}
+}
+
+double percentile(const vector<double> &sorted, double p)
+{
+	if (sorted.empty())
+	{
+		return 0;
+	}
+	size_t idx = static_cast<size_t>(p / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+	return sorted[min(idx, sorted.size() - 1)];
+}
+
+json latencyReport(vector<double> &latencies)
+{
+	json j;
+	sort(latencies.begin(), latencies.end());
+	double sum = 0;
+	for (auto l : latencies)
+	{
+		sum += l;
+	}
+	j["p50"] = percentile(latencies, 50);
+	j["p90"] = percentile(latencies, 90);
+	j["p99"] = percentile(latencies, 99);
+	j["max"] = latencies.empty() ? 0 : latencies.back();
+	j["mean"] = latencies.empty() ? 0 : sum / static_cast<double>(latencies.size());
+	return j;
+}
+
+json matchAndReport(const vector<ReplayOp> &ops, const vector<string> &existing, const vector<AsicEvent> &events,
+					Clock::time_point start, Clock::time_point replay_end)
+{
+	/* Pending operations per match token and operation, in send order */
+	map<pair<string, string>, deque<size_t>> pending;
+	vector<double> latency_us(ops.size(), -1);
+	unordered_set<string> known(existing.begin(), existing.end());
+	/* VRFs of the replayed routes, and the VRF of each virtual router seen */
+	set<string> route_vrfs;
+	map<string, string> vr_vrfs;
+
+	size_t next_op = 0;
+	for (const auto &event : events)
+	{
+		/* Release the operations sent before this event */
+		for (; next_op < ops.size() && ops[next_op].sent <= event.time; next_op++)
+		{
+			const auto &op = ops[next_op];
+			string token = appMatchToken(op);
+			if (token.empty())
+			{
+				auto it = fifo_matched_tables.find(op.table);
+				if (it == fifo_matched_tables.end())
+				{
+					continue;
+				}
+				token = it->second;
+			}
+			else if (op.table == APP_ROUTE_TABLE_NAME)
+			{
+				string vrf, prefix;
+				splitRouteKey(op.key, vrf, prefix);
+				route_vrfs.insert(vrf);
+			}
+			pending[{ token, op.op }].push_back(next_op);
+		}
+
+		auto v_key = tokenize(event.key, ':', 1);
+		if (v_key.size() != 2)
+		{
+			continue;
+		}
+
+		bool created = event.op == SET_COMMAND && known.insert(event.key).second;
+		if (event.op == DEL_COMMAND)
+		{
+			known.erase(event.key);
+		}
+
+		string token;
+		if (v_key[0] == "SAI_OBJECT_TYPE_ROUTE_ENTRY")
+		{
+			string vr, prefix, vrf;
+			if (!parseAsicRouteKey(v_key[1], vr, prefix) ||
+				!resolveRouteVrf(vr, prefix, event.op, route_vrfs, pending, vr_vrfs, vrf))
+			{
+				continue;
+			}
+			token = routeMatchToken(vrf, prefix);
+		}
+		else
+		{
+			token = asicMatchToken(v_key[0], v_key[1]);
+		}
+		if (token.empty())
+		{
+			/* OID objects only complete an operation when created or removed */
+			if (!created && event.op != DEL_COMMAND)
+			{
+				continue;
+			}
+			token = v_key[0];
+		}
+
+		auto it = pending.find({ token, event.op });
+		if (it == pending.end() || it->second.empty())
+		{
+			continue;
+		}
+
+		size_t idx = it->second.front();
+		it->second.pop_front();
+		latency_us[idx] = static_cast<double>(
+				chrono::duration_cast<chrono::microseconds>(event.time - ops[idx].sent).count());
+	}
+
+	struct TableStats
+	{
+		size_t ops = 0;
+		size_t matched = 0;
+		Clock::time_point first_sent;
+		Clock::time_point last_done;
+		vector<double> latencies;
+	};
+
+	map<string, TableStats> tables;
+	vector<double> all_latencies;
+	for (size_t i = 0; i < ops.size(); i++)
+	{
+		auto &stats = tables[ops[i].table];
+		if (stats.ops++ == 0)
+		{
+			stats.first_sent = ops[i].sent;
+		}
+		if (latency_us[i] < 0)
+		{
+			continue;
+		}
+		stats.matched++;
+		stats.latencies.push_back(latency_us[i]);
+		all_latencies.push_back(latency_us[i]);
+		stats.last_done = max(stats.last_done, ops[i].sent + chrono::microseconds(static_cast<int64_t>(latency_us[i])));
+	}
+
+	auto seconds = [](Clock::duration d) {
+		return chrono::duration<double>(d).count();
+	};
+
+	Clock::time_point settled = events.empty() ? replay_end : max(replay_end, events.back().time);
+
+	json report;
+	report["ops"] = ops.size();
+	report["asic_events"] = events.size();
+	report["replay_sec"] = seconds(replay_end - start);
+	report["settle_sec"] = seconds(settled - start);
+	report["replay_ops_per_sec"] = replay_end > start ? static_cast<double>(ops.size()) / seconds(replay_end - start) : 0;
+	report["end_to_end_ops_per_sec"] = settled > start ? static_cast<double>(ops.size()) / seconds(settled - start) : 0;
+	report["latency_us"] = latencyReport(all_latencies);
+
+	json table_reports = json::object();
+	for (auto &it : tables)
+	{
+		auto &stats = it.second;
+		json t;
+		t["ops"] = stats.ops;
+		t["matched"] = stats.matched;
+		if (stats.matched)
+		{
+			double duration = seconds(stats.last_done - stats.first_sent);
+			t["ops_per_sec"] = duration > 0 ? static_cast<double>(stats.matched) / duration : 0;
+			t["latency_us"] = latencyReport(stats.latencies);
+		}
+		table_reports[it.first] = t;
+	}
+	report["tables"] = table_reports;
+
+	return report;
+}
+
+int runBenchmark(const string &file_name, double rate, int idle_ms, const string &output)
+{
+	vector<ReplayOp> ops;
+	if (!loadReplayOps(file_name, ops))
+	{
+		return EXIT_FAILURE;
+	}
+
+	auto zmq_tables = load_zmq_tables();
+	std::shared_ptr<ZmqClient> zmq_client = nullptr;
+	if (zmq_tables.size() > 0)
+	{
+		zmq_client = create_zmq_client(ZMQ_LOCAL_ADDRESS);
+	}
+
+	/* Create the producers before the replay starts so that their setup is not measured */
+	unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
+	for (const auto &op : ops)
+	{
+		get_table(table_map, op.table, zmq_tables, zmq_client);
+	}
+
+	atomic<bool> ready(false);
+	atomic<bool> stop(false);
+	atomic<int64_t> last_event(0);
+	vector<string> existing;
+	vector<AsicEvent> events;
+	thread collector(collectAsicEvents, ref(ready), ref(stop), ref(last_event), ref(existing), ref(events));
+	while (!ready)
+	{
+		this_thread::sleep_for(chrono::milliseconds(10));
+	}
+
+	auto start = Clock::now();
+	for (size_t i = 0; i < ops.size(); i++)
+	{
+		auto &op = ops[i];
+		if (rate > 0)
+		{
+			this_thread::sleep_until(start + chrono::duration_cast<Clock::duration>(
+						chrono::duration<double>(static_cast<double>(i) / rate)));
+		}
+
+		auto &p_producer = table_map[op.table];
+		op.sent = Clock::now();
+		if (op.op == SET_COMMAND)
+		{
+			p_producer->set(op.key, op.fvs, SET_COMMAND);
+		}
+		else
+		{
+			p_producer->del(op.key, DEL_COMMAND);
+		}
+	}
+	auto replay_end = Clock::now();
+
+	/* Wait for ASIC_DB to settle */
+	while (true)
+	{
+		this_thread::sleep_for(chrono::milliseconds(100));
+		auto last = max(replay_end, Clock::time_point(Clock::duration(last_event.load())));
+		if (Clock::now() - last >= chrono::milliseconds(idle_ms))
+		{
+			break;
+		}
+	}
+	stop = true;
+	collector.join();
+
+	json report = matchAndReport(ops, existing, events, start, replay_end);
+	report["file"] = file_name;
+	report["rate"] = rate;
+
+	if (output.empty())
+	{
+		cout << report.dump(4) << endl;
+	}
+	else
+	{
+		ofstream ofs(output);
+		if (!ofs.is_open())
+		{
+			cerr << "Failed to open " << output << endl;
+			return EXIT_FAILURE;
+		}
+		ofs << report.dump(4) << endl;
+	}
+
+	return EXIT_SUCCESS;
+}
+
 int main(int argc, char **argv)
 {
-	if (argc != 2)
+	bool benchmark = false;
+	double rate = 0;
+	int idle_ms = 5000;
+	string output;
+
+	static struct option long_options[] =
+	{
+		{ "benchmark", no_argument,       0, 'b' },
+		{ "rate",      required_argument, 0, 'r' },
+		{ "idle",      required_argument, 0, 'i' },
+		{ "output",    required_argument, 0, 'o' },
+		{ "help",      no_argument,       0, 'h' },
+		{ 0,           0,                 0,  0  }
+	};
+
+	int opt;
+	while ((opt = getopt_long(argc, argv, "br:i:o:h", long_options, NULL)) != -1)
+	{
+		switch (opt)
+		{
+			case 'b':
+				benchmark = true;
+				break;
+			case 'r':
+				rate = atof(optarg);
+				break;
+			case 'i':
+				idle_ms = atoi(optarg);
+				break;
+			case 'o':
+				output = optarg;
+				break;
+			case 'h':
+				usage();
+				exit(EXIT_SUCCESS);
+			default:
+				usage();
+				exit(EXIT_FAILURE);
+		}
+	}
+
+	if (optind != argc - 1 || rate < 0 || idle_ms <= 0)
 	{
 		usage();
 		exit(EXIT_FAILURE);
 	}
 
-	ifstream file(argv[1]);
+	if (benchmark)
+	{
+		return runBenchmark(argv[optind], rate, idle_ms, output);
+	}
+
+	ifstream file(argv[optind]);
 	string line;
 
     auto zmq_tables = load_zmq_tables();
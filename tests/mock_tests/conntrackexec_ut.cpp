@@ -0,0 +1,82 @@
+#include <errno.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <linux/netfilter/nf_conntrack_common.h>
+
+#include "gtest/gtest.h"
+#include "netns_test.h"
+#include "conntrackexec.h"
+
+namespace conntrackexec_test
+{
+    using namespace std;
+    using namespace swss;
+
+    static ConntrackExecutor::Endpoint endpoint(const char *ip, uint16_t port)
+    {
+        return { inet_addr(ip), port };
+    }
+
+    class ConntrackExecutorTest : public netns_test::NetworkNamespaceTest
+    {
+    };
+
+    TEST_F(ConntrackExecutorTest, BatchInNetworkNamespace)
+    {
+        vector<ConntrackExecutor::Error> created, duplicated, recreated, flushed;
+        size_t pending = 0;
+
+        ASSERT_TRUE(runInNetworkNamespace([&]() {
+            ConntrackExecutor executor;
+            const ConntrackExecutor::Endpoint none = { 0, 0 };
+            const auto loopback = endpoint("127.0.0.1", 127);
+
+            executor.create(IPPROTO_UDP, endpoint("10.0.0.1", 1), loopback, none, none, 600);
+            executor.create(IPPROTO_UDP, endpoint("10.0.0.2", 1), loopback, none, none, 600);
+            executor.create(IPPROTO_TCP, endpoint("10.0.0.2", 2), loopback, none, none, 600, true);
+            executor.flush(created);
+
+            // Creating an existing entry fails
+            executor.create(IPPROTO_UDP, endpoint("10.0.0.1", 1), loopback, none, none, 600);
+            executor.flush(duplicated);
+
+            // The delete is resolved first, so the entry can be created again in the same batch
+            ConntrackExecutor::Filter filter;
+            filter.src = inet_addr("10.0.0.1");
+            executor.deleteMatching(filter);
+            executor.create(IPPROTO_UDP, endpoint("10.0.0.1", 1), loopback, none, none, 600);
+
+            // Both entries of the second source are updated, a filter without match is no error
+            filter.src = inet_addr("10.0.0.2");
+            executor.updateMatching(filter, 300);
+            filter.src = inet_addr("10.0.0.3");
+            executor.updateMatching(filter, 300);
+            executor.update(IPPROTO_UDP, endpoint("10.0.0.2", 1), loopback, 300, IPS_ASSURED);
+            pending = executor.pending();
+            executor.flush(recreated);
+
+            // After a table flush nothing is left to delete
+            executor.flushTable();
+            filter.src = 0;
+            filter.protocol = IPPROTO_UDP;
+            executor.deleteMatching(filter);
+            executor.create(IPPROTO_UDP, endpoint("10.0.0.1", 1), loopback, none, none, 600);
+            executor.update(IPPROTO_UDP, endpoint("10.0.0.2", 1), loopback, 300, IPS_ASSURED);
+            executor.flush(flushed);
+            EXPECT_EQ(executor.pending(), 0u);
+        }));
+
+        ASSERT_TRUE(created.empty());
+
+        ASSERT_EQ(duplicated.size(), 1u);
+        ASSERT_EQ(duplicated[0].error, EEXIST);
+
+        ASSERT_EQ(pending, 5u);
+        ASSERT_TRUE(recreated.empty());
+
+        // Only the update of the flushed entry fails, it is reported as its command
+        ASSERT_EQ(flushed.size(), 1u);
+        ASSERT_EQ(flushed[0].op, "conntrack -U -p udp -s 10.0.0.2 --sport 1 -d 127.0.0.1 --dport 127 -t 300");
+        ASSERT_EQ(flushed[0].error, ENOENT);
+    }
+}
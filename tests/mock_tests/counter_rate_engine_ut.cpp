@@ -0,0 +1,164 @@
+#include "ut_helper.h"
+#include "counter_rate_engine.h"
+
+namespace counter_rate_engine_test
+{
+    using namespace std;
+
+    const sai_object_id_t PORT_OID = 0x1000000000001;
+    const sai_object_id_t PORT2_OID = 0x1000000000002;
+    const uint8_t SAMPLE_ALL = CounterRateEngine::SAMPLE_RATES | CounterRateEngine::SAMPLE_FEC;
+
+    struct CounterRateEngineTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_counters_db;
+        shared_ptr<CounterRateEngine> m_engine;
+
+        void SetUp() override
+        {
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_engine = make_shared<CounterRateEngine>(m_counters_db.get(), CounterRateEngine::port_profile, 1000);
+        }
+
+        // One sample row of the port profile, FEC counters set to 0.
+        vector<uint64_t> row(uint64_t rx_octets, uint64_t tx_octets, uint64_t rx_ucast, uint64_t rx_non_ucast,
+                             uint64_t tx_ucast, uint64_t tx_non_ucast)
+        {
+            vector<uint64_t> values(m_engine->fields().size(), 0);
+            values[0] = rx_octets;
+            values[1] = tx_octets;
+            values[2] = rx_ucast;
+            values[3] = rx_non_ucast;
+            values[4] = tx_ucast;
+            values[5] = tx_non_ucast;
+            return values;
+        }
+
+        size_t fieldIndex(const string &field)
+        {
+            const auto &fields = m_engine->fields();
+            return distance(fields.begin(), find(fields.begin(), fields.end(), field));
+        }
+    };
+
+    TEST_F(CounterRateEngineTest, SerdesSpeed)
+    {
+        ASSERT_DOUBLE_EQ(CounterRateEngine::serdesSpeed(4, 100000), 25.78125e+9);
+        ASSERT_DOUBLE_EQ(CounterRateEngine::serdesSpeed(8, 400000), 53.125e+9);
+        ASSERT_DOUBLE_EQ(CounterRateEngine::serdesSpeed(1, 10000), 10.3125e+9);
+        ASSERT_DOUBLE_EQ(CounterRateEngine::serdesSpeed(4, 10000), 0);
+        ASSERT_DOUBLE_EQ(CounterRateEngine::serdesSpeed(0, 100000), 0);
+    }
+
+    TEST_F(CounterRateEngineTest, Rates)
+    {
+        m_engine->addObject(PORT_OID);
+        double rx_bps, tx_bps, rx_pps, tx_pps;
+
+        // First sample only records the counters
+        m_engine->update(row(0, 0, 0, 0, 0, 0), { 1 }, 1000, true, 0.5);
+        ASSERT_FALSE(m_engine->getRates(PORT_OID, rx_bps, tx_bps, rx_pps, tx_pps));
+
+        // Second sample gives the raw rates
+        m_engine->update(row(1000, 2000, 10, 5, 20, 0), { 1 }, 1000, true, 0.5);
+        ASSERT_TRUE(m_engine->getRates(PORT_OID, rx_bps, tx_bps, rx_pps, tx_pps));
+        ASSERT_DOUBLE_EQ(rx_bps, 1000);
+        ASSERT_DOUBLE_EQ(tx_bps, 2000);
+        ASSERT_DOUBLE_EQ(rx_pps, 15);
+        ASSERT_DOUBLE_EQ(tx_pps, 20);
+
+        // Following samples are averaged
+        m_engine->update(row(2000, 4000, 20, 10, 40, 0), { 1 }, 500, true, 0.5);
+        ASSERT_TRUE(m_engine->getRates(PORT_OID, rx_bps, tx_bps, rx_pps, tx_pps));
+        ASSERT_DOUBLE_EQ(rx_bps, 1500);
+        ASSERT_DOUBLE_EQ(tx_bps, 3000);
+        ASSERT_DOUBLE_EQ(rx_pps, 22.5);
+        ASSERT_DOUBLE_EQ(tx_pps, 30);
+
+        // Cleared counters count as no traffic
+        m_engine->update(row(0, 0, 0, 0, 0, 0), { 1 }, 1000, true, 0.5);
+        ASSERT_TRUE(m_engine->getRates(PORT_OID, rx_bps, tx_bps, rx_pps, tx_pps));
+        ASSERT_DOUBLE_EQ(rx_bps, 750);
+
+        // Invalid samples and missing alpha leave the rates unchanged
+        m_engine->update(row(5000, 0, 0, 0, 0, 0), { 0 }, 1000, true, 0.5);
+        m_engine->update(row(5000, 0, 0, 0, 0, 0), { 1 }, 1000, false, 0);
+        ASSERT_TRUE(m_engine->getRates(PORT_OID, rx_bps, tx_bps, rx_pps, tx_pps));
+        ASSERT_DOUBLE_EQ(rx_bps, 750);
+    }
+
+    TEST_F(CounterRateEngineTest, Ber)
+    {
+        m_engine->addObject(PORT_OID);
+        m_engine->setLanes(PORT_OID, 4, 100000);
+
+        double pre_ber, post_ber;
+        int max_t;
+
+        m_engine->update(row(0, 0, 0, 0, 0, 0), { SAMPLE_ALL }, 1000, true, 0.5);
+        ASSERT_FALSE(m_engine->getBer(PORT_OID, pre_ber, post_ber, max_t));
+
+        auto sample = row(0, 0, 0, 0, 0, 0);
+        sample[fieldIndex("SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS")] = 1031250;
+        sample[fieldIndex("SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES")] = 1031250;
+        sample[fieldIndex("SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S3")] = 7;
+        m_engine->update(sample, { SAMPLE_ALL }, 1000, true, 0.5);
+
+        ASSERT_TRUE(m_engine->getBer(PORT_OID, pre_ber, post_ber, max_t));
+        ASSERT_DOUBLE_EQ(pre_ber, 1e-5);
+        ASSERT_DOUBLE_EQ(post_ber, 1e-13);
+        ASSERT_EQ(max_t, 3);
+
+        // BER does not depend on the rated counters
+        sample[fieldIndex("SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS")] = 2062500;
+        m_engine->update(sample, { CounterRateEngine::SAMPLE_FEC }, 1000, true, 0.5);
+        ASSERT_TRUE(m_engine->getBer(PORT_OID, pre_ber, post_ber, max_t));
+        ASSERT_DOUBLE_EQ(pre_ber, 1e-5);
+        ASSERT_DOUBLE_EQ(post_ber, 0);
+    }
+
+    TEST_F(CounterRateEngineTest, NoFecCounters)
+    {
+        m_engine->addObject(PORT_OID);
+        m_engine->setLanes(PORT_OID, 4, 100000);
+
+        // Ports without FEC counters get rates but no FEC fields
+        m_engine->update(row(0, 0, 0, 0, 0, 0), { CounterRateEngine::SAMPLE_RATES }, 1000, true, 0.5);
+        m_engine->update(row(1000, 0, 0, 0, 0, 0), { CounterRateEngine::SAMPLE_RATES }, 1000, true, 0.5);
+        m_engine->update(row(2000, 0, 0, 0, 0, 0), { CounterRateEngine::SAMPLE_RATES }, 1000, true, 0.5);
+
+        double rx_bps, tx_bps, rx_pps, tx_pps;
+        ASSERT_TRUE(m_engine->getRates(PORT_OID, rx_bps, tx_bps, rx_pps, tx_pps));
+        ASSERT_DOUBLE_EQ(rx_bps, 1000);
+
+        double pre_ber, post_ber;
+        int max_t;
+        ASSERT_FALSE(m_engine->getBer(PORT_OID, pre_ber, post_ber, max_t));
+    }
+
+    TEST_F(CounterRateEngineTest, RemoveObject)
+    {
+        m_engine->addObject(PORT_OID);
+        m_engine->addObject(PORT2_OID);
+        ASSERT_EQ(m_engine->size(), 2u);
+
+        auto samples = row(0, 0, 0, 0, 0, 0);
+        auto second = row(0, 0, 0, 0, 0, 0);
+        samples.insert(samples.end(), second.begin(), second.end());
+        m_engine->update(samples, { 1, 1 }, 1000, true, 1);
+
+        samples = row(100, 0, 0, 0, 0, 0);
+        second = row(200, 0, 0, 0, 0, 0);
+        samples.insert(samples.end(), second.begin(), second.end());
+        m_engine->update(samples, { 1, 1 }, 1000, true, 1);
+
+        m_engine->removeObject(PORT_OID);
+        ASSERT_EQ(m_engine->size(), 1u);
+        ASSERT_FALSE(m_engine->hasObject(PORT_OID));
+
+        // The remaining object keeps its state
+        double rx_bps, tx_bps, rx_pps, tx_pps;
+        ASSERT_TRUE(m_engine->getRates(PORT2_OID, rx_bps, tx_bps, rx_pps, tx_pps));
+        ASSERT_DOUBLE_EQ(rx_bps, 200);
+    }
+}
@@ -0,0 +1,158 @@
+#include <thread>
+
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+
+namespace crmorch_test
+{
+    using namespace std;
+
+    vector<uint32_t> switch_get_attr_counts;
+
+    sai_status_t _ut_stub_get_switch_attribute(sai_object_id_t switch_id, uint32_t attr_count, sai_attribute_t *attr_list)
+    {
+        switch_get_attr_counts.push_back(attr_count);
+
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (attr_list[i].id == SAI_SWITCH_ATTR_AVAILABLE_IPV6_NEXTHOP_ENTRY)
+            {
+                return SAI_STATUS_ATTR_NOT_SUPPORTED_0 + i;
+            }
+            attr_list[i].value.u32 = 100 + i;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    }
+
+    struct CrmOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<CrmOrch> m_crmOrch;
+
+        void SetUp() override
+        {
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_crmOrch = make_shared<CrmOrch>(m_config_db.get(), CFG_CRM_TABLE_NAME);
+        }
+
+        uint32_t getUsed(CrmResourceType resource, const string &key)
+        {
+            const auto &cntMap = m_crmOrch->m_resourcesMap.at(resource).countersMap;
+            auto it = cntMap.find(key);
+            return it == cntMap.end() ? 0 : it->second.usedCounter.load();
+        }
+    };
+
+    TEST_F(CrmOrchTest, RingThreadResourcesRegistered)
+    {
+        const auto &cntMap = m_crmOrch->m_resourcesMap.at(CrmResourceType::CRM_IPV4_ROUTE).countersMap;
+        ASSERT_NE(cntMap.find("STATS"), cntMap.end());
+
+        // Concurrent updates, as done by the ring thread and the main thread
+        vector<thread> threads;
+        for (int i = 0; i < 4; i++)
+        {
+            threads.emplace_back([this]() {
+                for (int j = 0; j < 1000; j++)
+                {
+                    m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+                }
+            });
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+
+        ASSERT_EQ(getUsed(CrmResourceType::CRM_IPV4_ROUTE, "STATS"), 4000u);
+
+        m_crmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        ASSERT_EQ(getUsed(CrmResourceType::CRM_IPV4_ROUTE, "STATS"), 3999u);
+    }
+
+    TEST_F(CrmOrchTest, AclCounterSlots)
+    {
+        const sai_object_id_t tableId = 0x7000000000001;
+        auto aclKey = m_crmOrch->getCrmAclKey(SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_PORT);
+        auto tableKey = m_crmOrch->getCrmAclTableKey(tableId);
+
+        m_crmOrch->incCrmAclUsedCounter(CrmResourceType::CRM_ACL_TABLE, SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_PORT);
+        m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+        m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+        ASSERT_EQ(getUsed(CrmResourceType::CRM_ACL_TABLE, aclKey), 1u);
+        ASSERT_EQ(getUsed(CrmResourceType::CRM_ACL_ENTRY, tableKey), 2u);
+        ASSERT_EQ(m_crmOrch->m_resourcesMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap.at(tableKey).id, tableId);
+
+        // Removing the ACL table drops its per table counters and slots
+        m_crmOrch->decCrmAclUsedCounter(CrmResourceType::CRM_ACL_TABLE, SAI_ACL_STAGE_INGRESS, SAI_ACL_BIND_POINT_TYPE_PORT, tableId);
+        ASSERT_EQ(getUsed(CrmResourceType::CRM_ACL_TABLE, aclKey), 0u);
+        ASSERT_EQ(m_crmOrch->m_resourcesMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap.count(tableKey), 0u);
+
+        // A table created again with the same OID starts from a new counter
+        m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+        ASSERT_EQ(getUsed(CrmResourceType::CRM_ACL_ENTRY, tableKey), 1u);
+    }
+
+    TEST_F(CrmOrchTest, ExhaustionEstimate)
+    {
+        CrmOrch::CrmResourceCounter cnt;
+        double secondsLeft = 0;
+
+        // The first poll only records the counter
+        cnt.availableCounter = 1000;
+        ASSERT_FALSE(CrmOrch::updateExhaustionEstimate(cnt, 0, secondsLeft));
+
+        // 100 entries in 10 seconds with 1000 left
+        cnt.usedCounter = 100;
+        ASSERT_TRUE(CrmOrch::updateExhaustionEstimate(cnt, 10, secondsLeft));
+        ASSERT_DOUBLE_EQ(secondsLeft, 100);
+
+        // No growth halves the averaged rate
+        ASSERT_TRUE(CrmOrch::updateExhaustionEstimate(cnt, 10, secondsLeft));
+        ASSERT_DOUBLE_EQ(secondsLeft, 200);
+
+        // Shrinking usage gives no estimate
+        cnt.usedCounter = 0;
+        ASSERT_FALSE(CrmOrch::updateExhaustionEstimate(cnt, 10, secondsLeft));
+    }
+
+    TEST_F(CrmOrchTest, SwitchAttributesReadAtOnce)
+    {
+        sai_switch_api_t ut_sai_switch_api = {};
+        ut_sai_switch_api.get_switch_attribute = _ut_stub_get_switch_attribute;
+        auto *orig_sai_switch_api = sai_switch_api;
+        sai_switch_api = &ut_sai_switch_api;
+        switch_get_attr_counts.clear();
+
+        auto &resources = m_crmOrch->m_resourcesMap;
+
+        // Resources without object type availability use one switch get
+        m_crmOrch->getSwitchResAvailability({ CrmResourceType::CRM_IPV4_NEXTHOP, CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER });
+        ASSERT_EQ(switch_get_attr_counts, vector<uint32_t>({ 2 }));
+        ASSERT_EQ(resources.at(CrmResourceType::CRM_IPV4_NEXTHOP).countersMap.at("STATS").availableCounter, 100u);
+        ASSERT_EQ(resources.at(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER).countersMap.at("STATS").availableCounter, 101u);
+
+        // An unsupported attribute makes the batch fall back to single gets
+        switch_get_attr_counts.clear();
+        m_crmOrch->getSwitchResAvailability({ CrmResourceType::CRM_IPV4_NEXTHOP, CrmResourceType::CRM_IPV6_NEXTHOP });
+        ASSERT_EQ(switch_get_attr_counts, vector<uint32_t>({ 2, 1, 1 }));
+        ASSERT_EQ(resources.at(CrmResourceType::CRM_IPV6_NEXTHOP).resStatus, CrmResourceStatus::CRM_RES_NOT_SUPPORTED);
+        ASSERT_EQ(resources.at(CrmResourceType::CRM_IPV4_NEXTHOP).resStatus, CrmResourceStatus::CRM_RES_SUPPORTED);
+
+        sai_switch_api = orig_sai_switch_api;
+    }
+
+    TEST_F(CrmOrchTest, AvailableCounterStale)
+    {
+        CrmOrch::CrmResourceCounter cnt;
+        ASSERT_TRUE(CrmOrch::isAvailableCounterStale(cnt, false));
+
+        CrmOrch::setAvailableCounter(cnt, 10);
+        ASSERT_FALSE(CrmOrch::isAvailableCounterStale(cnt, false));
+        ASSERT_TRUE(CrmOrch::isAvailableCounterStale(cnt, true));
+
+        cnt.usedCounter++;
+        ASSERT_TRUE(CrmOrch::isAvailableCounterStale(cnt, false));
+    }
+}
@@ -0,0 +1,382 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_dash_orch_test.h"
+#include "dash/dashaclorch.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+
+namespace dashaclgroupmgr_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    struct CreatedRule
+    {
+        sai_object_id_t m_oid;
+        sai_object_id_t m_group_oid;
+        vector<sai_ip_prefix_t> m_sips;
+    };
+
+    sai_dash_acl_api_t ut_dash_acl_api;
+    sai_dash_acl_api_t *old_dash_acl_api;
+    sai_dash_eni_api_t ut_dash_eni_api;
+    sai_dash_eni_api_t *old_dash_eni_api;
+
+    sai_object_id_t next_oid;
+    size_t rule_create_attempts;
+    size_t fail_rule_create;
+    vector<sai_object_id_t> created_groups;
+    vector<sai_object_id_t> removed_groups;
+    vector<CreatedRule> created_rules;
+    vector<sai_object_id_t> removed_rules;
+    vector<sai_object_id_t> bound_groups;
+
+    sai_status_t _ut_stub_create_dash_acl_group(sai_object_id_t *object_id, sai_object_id_t switch_id,
+                                                uint32_t attr_count, const sai_attribute_t *attr_list)
+    {
+        *object_id = next_oid++;
+        created_groups.push_back(*object_id);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_remove_dash_acl_group(sai_object_id_t object_id)
+    {
+        removed_groups.push_back(object_id);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_create_dash_acl_rules(sai_object_id_t switch_id, uint32_t object_count,
+                                                const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                                sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id,
+                                                sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (rule_create_attempts++ == fail_rule_create)
+            {
+                object_id[i] = SAI_NULL_OBJECT_ID;
+                object_statuses[i] = SAI_STATUS_INSUFFICIENT_RESOURCES;
+                status = SAI_STATUS_FAILURE;
+                continue;
+            }
+
+            CreatedRule rule = { next_oid++, SAI_NULL_OBJECT_ID, {} };
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                const auto &attr = attr_list[i][j];
+                if (attr.id == SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID)
+                {
+                    rule.m_group_oid = attr.value.oid;
+                }
+                else if (attr.id == SAI_DASH_ACL_RULE_ATTR_SIP)
+                {
+                    rule.m_sips.assign(attr.value.ipprefixlist.list,
+                                       attr.value.ipprefixlist.list + attr.value.ipprefixlist.count);
+                }
+            }
+
+            object_id[i] = rule.m_oid;
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+            created_rules.push_back(rule);
+        }
+
+        return status;
+    }
+
+    sai_status_t _ut_stub_remove_dash_acl_rules(uint32_t object_count, const sai_object_id_t *object_id,
+                                                sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            removed_rules.push_back(object_id[i]);
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_set_eni_attribute(sai_object_id_t eni_id, const sai_attribute_t *attr)
+    {
+        bound_groups.push_back(attr->value.oid);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_ip_prefix_t v4Prefix(const string &ip, const string &mask)
+    {
+        sai_ip_prefix_t prefix = {};
+        prefix.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        prefix.addr.ip4 = swss::IpAddress(ip).getV4Addr();
+        prefix.mask.ip4 = swss::IpAddress(mask).getV4Addr();
+        return prefix;
+    }
+
+    class DashAclGroupMgrTest : public MockDashOrchTest
+    {
+    protected:
+        DashAclOrch *m_dashAclOrch;
+
+        void ApplySaiMock() override
+        {
+            old_dash_acl_api = sai_dash_acl_api;
+            ut_dash_acl_api = *sai_dash_acl_api;
+            ut_dash_acl_api.create_dash_acl_group = _ut_stub_create_dash_acl_group;
+            ut_dash_acl_api.remove_dash_acl_group = _ut_stub_remove_dash_acl_group;
+            ut_dash_acl_api.create_dash_acl_rules = _ut_stub_create_dash_acl_rules;
+            ut_dash_acl_api.remove_dash_acl_rules = _ut_stub_remove_dash_acl_rules;
+            sai_dash_acl_api = &ut_dash_acl_api;
+
+            old_dash_eni_api = sai_dash_eni_api;
+            ut_dash_eni_api = *sai_dash_eni_api;
+            ut_dash_eni_api.set_eni_attribute = _ut_stub_set_eni_attribute;
+            sai_dash_eni_api = &ut_dash_eni_api;
+
+            next_oid = 0x1000;
+            fail_rule_create = SIZE_MAX;
+        }
+
+        void PostSetUp() override
+        {
+            CreateApplianceEntry();
+            CreateVnet();
+            SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, BuildEniEntry());
+
+            vector<string> dash_acl_tables = {
+                APP_DASH_PREFIX_TAG_TABLE_NAME,
+                APP_DASH_ACL_IN_TABLE_NAME,
+                APP_DASH_ACL_OUT_TABLE_NAME,
+                APP_DASH_ACL_GROUP_TABLE_NAME,
+                APP_DASH_ACL_RULE_TABLE_NAME
+            };
+            m_dashAclOrch = new DashAclOrch(m_app_db.get(), dash_acl_tables, m_DashOrch, m_dpu_app_state_db.get(), nullptr);
+            ut_orch_list.push_back((Orch **)&m_dashAclOrch);
+
+            clearCalls();
+        }
+
+        void PreTearDown() override
+        {
+            sai_dash_acl_api = old_dash_acl_api;
+            sai_dash_eni_api = old_dash_eni_api;
+        }
+
+        void clearCalls()
+        {
+            rule_create_attempts = 0;
+            created_groups.clear();
+            removed_groups.clear();
+            created_rules.clear();
+            removed_rules.clear();
+            bound_groups.clear();
+        }
+
+        DashAclGroupMgr &groupMgr()
+        {
+            return m_dashAclOrch->getDashAclGroupMgr();
+        }
+
+        DashTagMgr &tagMgr()
+        {
+            return m_dashAclOrch->getDashAclTagMgr();
+        }
+
+        void createTag(const string &tag_id, const sai_ip_prefix_t &prefix)
+        {
+            DashTag tag;
+            tag.m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+            tag.m_prefixes = { prefix };
+            ASSERT_EQ(tagMgr().create(tag_id, tag), task_success);
+        }
+
+        DashAclRule buildRule(uint32_t priority, const string &src_tag = "")
+        {
+            DashAclRule rule = {};
+            rule.m_priority = priority;
+            rule.m_action = DashAclRule::Action::ALLOW;
+            rule.m_terminating = true;
+            if (!src_tag.empty())
+            {
+                rule.m_src_tags.insert(src_tag);
+            }
+            return rule;
+        }
+
+        // Creates an IPv4 group with two rules, the first one using the tag
+        sai_object_id_t createBoundGroup(const string &group_id, const string &tag_id)
+        {
+            DashAclGroup group;
+            group.m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+            EXPECT_EQ(groupMgr().create(group_id, group), task_success);
+
+            auto rule1 = buildRule(1, tag_id);
+            auto rule2 = buildRule(2);
+            EXPECT_EQ(groupMgr().createRule(group_id, "rule1", rule1), task_success);
+            EXPECT_EQ(groupMgr().createRule(group_id, "rule2", rule2), task_success);
+            groupMgr().flushRules();
+
+            EXPECT_EQ(groupMgr().bind(group_id, eni1, DashAclDirection::IN, DashAclStage::STAGE1), task_success);
+            EXPECT_TRUE(groupMgr().isBound(group_id));
+
+            EXPECT_EQ(created_groups.size(), 1u);
+            sai_object_id_t group_oid = created_groups.empty() ? SAI_NULL_OBJECT_ID : created_groups.back();
+            clearCalls();
+            return group_oid;
+        }
+    };
+
+    TEST_F(DashAclGroupMgrTest, BoundGroupTagUpdateSwapsGroup)
+    {
+        createTag("tag1", v4Prefix("10.0.0.0", "255.255.255.0"));
+        auto old_group_oid = createBoundGroup("group1", "tag1");
+        auto new_prefix = v4Prefix("10.0.1.0", "255.255.255.0");
+
+        DashTag tag;
+        tag.m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+        tag.m_prefixes = { new_prefix };
+        ASSERT_EQ(tagMgr().update("tag1", tag), task_success);
+        groupMgr().flushRules();
+
+        // The whole group is rebuilt in a new group, no rule of the bound group is changed in place
+        ASSERT_EQ(created_groups.size(), 1u);
+        auto new_group_oid = created_groups[0];
+        ASSERT_EQ(created_rules.size(), 2u);
+        bool tag_rule_found = false;
+        for (const auto &rule : created_rules)
+        {
+            EXPECT_EQ(rule.m_group_oid, new_group_oid);
+            if (rule.m_sips.size() == 1 && rule.m_sips[0].addr.ip4 == new_prefix.addr.ip4)
+            {
+                tag_rule_found = true;
+            }
+        }
+        EXPECT_TRUE(tag_rule_found);
+
+        // The ENI is moved to the new group before the old one is removed
+        ASSERT_EQ(bound_groups.size(), 1u);
+        EXPECT_EQ(bound_groups[0], new_group_oid);
+        EXPECT_EQ(removed_rules.size(), 2u);
+        ASSERT_EQ(removed_groups.size(), 1u);
+        EXPECT_EQ(removed_groups[0], old_group_oid);
+    }
+
+    TEST_F(DashAclGroupMgrTest, UnboundGroupTagUpdateReplacesRules)
+    {
+        createTag("tag1", v4Prefix("10.0.0.0", "255.255.255.0"));
+
+        DashAclGroup group;
+        group.m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+        ASSERT_EQ(groupMgr().create("group1", group), task_success);
+        auto rule1 = buildRule(1, "tag1");
+        auto rule2 = buildRule(2);
+        ASSERT_EQ(groupMgr().createRule("group1", "rule1", rule1), task_success);
+        ASSERT_EQ(groupMgr().createRule("group1", "rule2", rule2), task_success);
+        groupMgr().flushRules();
+        auto group_oid = created_groups.back();
+        clearCalls();
+
+        DashTag tag;
+        tag.m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+        tag.m_prefixes = { v4Prefix("10.0.1.0", "255.255.255.0") };
+        ASSERT_EQ(tagMgr().update("tag1", tag), task_success);
+        groupMgr().flushRules();
+
+        // Only the rule using the tag is replaced, in the same group
+        EXPECT_TRUE(created_groups.empty());
+        ASSERT_EQ(created_rules.size(), 1u);
+        EXPECT_EQ(created_rules[0].m_group_oid, group_oid);
+        EXPECT_EQ(removed_rules.size(), 1u);
+        EXPECT_TRUE(removed_groups.empty());
+        EXPECT_TRUE(bound_groups.empty());
+    }
+
+    TEST_F(DashAclGroupMgrTest, BoundGroupRuleUpdateSwapsGroup)
+    {
+        createTag("tag1", v4Prefix("10.0.0.0", "255.255.255.0"));
+        auto old_group_oid = createBoundGroup("group1", "tag1");
+
+        auto rule2 = buildRule(20);
+        ASSERT_EQ(groupMgr().createRule("group1", "rule2", rule2), task_success);
+        groupMgr().flushRules();
+
+        ASSERT_EQ(created_groups.size(), 1u);
+        auto new_group_oid = created_groups[0];
+        ASSERT_EQ(created_rules.size(), 2u);
+        for (const auto &rule : created_rules)
+        {
+            EXPECT_EQ(rule.m_group_oid, new_group_oid);
+        }
+        ASSERT_EQ(bound_groups.size(), 1u);
+        EXPECT_EQ(bound_groups[0], new_group_oid);
+        EXPECT_EQ(removed_rules.size(), 2u);
+        ASSERT_EQ(removed_groups.size(), 1u);
+        EXPECT_EQ(removed_groups[0], old_group_oid);
+
+        // One bind by createBoundGroup, one by the swap
+        auto stats = groupMgr().getEniStats(eni1);
+        ASSERT_NE(stats, nullptr);
+        EXPECT_EQ(stats->m_rules, 2u);
+        EXPECT_EQ(stats->m_binds, 2u);
+
+        swss::DBConnector counters_db("COUNTERS_DB", 0);
+        swss::Table stats_table(&counters_db, "DASH_ACL_ENI_STATS");
+        string value;
+        ASSERT_TRUE(stats_table.hget(eni1, "binds", value));
+        EXPECT_EQ(value, "2");
+        ASSERT_TRUE(stats_table.hget(eni1, "rules", value));
+        EXPECT_EQ(value, "2");
+        EXPECT_TRUE(stats_table.hget(eni1, "create_time_us", value));
+        EXPECT_TRUE(stats_table.hget(eni1, "bind_time_us", value));
+    }
+
+    TEST_F(DashAclGroupMgrTest, BoundGroupSwapFailureKeepsGroup)
+    {
+        createTag("tag1", v4Prefix("10.0.0.0", "255.255.255.0"));
+        auto old_group_oid = createBoundGroup("group1", "tag1");
+
+        // The second rule of the shadow group fails
+        fail_rule_create = 1;
+        auto rule3 = buildRule(3);
+        ASSERT_EQ(groupMgr().createRule("group1", "rule3", rule3), task_success);
+        groupMgr().flushRules();
+
+        // The rules created in the shadow group and the shadow group are removed
+        ASSERT_EQ(created_groups.size(), 1u);
+        auto shadow_group_oid = created_groups[0];
+        ASSERT_EQ(created_rules.size(), 2u);
+        vector<sai_object_id_t> shadow_rules;
+        for (const auto &rule : created_rules)
+        {
+            EXPECT_EQ(rule.m_group_oid, shadow_group_oid);
+            shadow_rules.push_back(rule.m_oid);
+        }
+        sort(removed_rules.begin(), removed_rules.end());
+        EXPECT_EQ(removed_rules, shadow_rules);
+        ASSERT_EQ(removed_groups.size(), 1u);
+        EXPECT_EQ(removed_groups[0], shadow_group_oid);
+
+        // The ENI keeps the current group
+        EXPECT_TRUE(bound_groups.empty());
+        EXPECT_TRUE(groupMgr().isBound("group1"));
+        EXPECT_EQ(groupMgr().getEniStats(eni1)->m_binds, 1u);
+
+        // The next update replaces the group which was kept
+        fail_rule_create = SIZE_MAX;
+        clearCalls();
+        ASSERT_EQ(groupMgr().createRule("group1", "rule3", rule3), task_success);
+        groupMgr().flushRules();
+
+        EXPECT_EQ(created_rules.size(), 3u);
+        ASSERT_EQ(bound_groups.size(), 1u);
+        EXPECT_EQ(bound_groups[0], created_groups.back());
+        EXPECT_EQ(removed_rules.size(), 2u);
+        ASSERT_EQ(removed_groups.size(), 1u);
+        EXPECT_EQ(removed_groups[0], old_group_oid);
+    }
+}
@@ -500,7 +500,7 @@ namespace dashrouteorch_test
         OutboundRoutingBulkContext ctxt;
         ctxt.route_group = route_group1;
         ctxt.destination = swss::IpPrefix("1.2.3.4/32");
-        ctxt.metadata = route;
+        ctxt.metadata = &route;
 
         EXPECT_TRUE(m_DashRouteOrch->addOutboundRouting(route_group1 + ":1.2.3.4/32", ctxt));
         EXPECT_EQ(ctxt.pre_op_result, DASH_RESULT_FAILURE);
@@ -517,7 +517,7 @@ namespace dashrouteorch_test
         OutboundRoutingBulkContext ctxt;
         ctxt.route_group = route_group1;
         ctxt.destination = swss::IpPrefix("1.2.3.4/32");
-        ctxt.metadata = route;
+        ctxt.metadata = &route;
 
         EXPECT_TRUE(m_DashRouteOrch->addOutboundRouting(route_group1 + ":1.2.3.4/32", ctxt));
         EXPECT_EQ(ctxt.pre_op_result, DASH_RESULT_FAILURE);
@@ -535,7 +535,7 @@ namespace dashrouteorch_test
         OutboundRoutingBulkContext ctxt;
         ctxt.route_group = route_group1;
         ctxt.destination = swss::IpPrefix("1.2.3.4/32");
-        ctxt.metadata = route;
+        ctxt.metadata = &route;
 
         EXPECT_TRUE(m_DashRouteOrch->addOutboundRouting(route_group1 + ":1.2.3.4/32", ctxt));
         EXPECT_EQ(ctxt.pre_op_result, DASH_RESULT_FAILURE);
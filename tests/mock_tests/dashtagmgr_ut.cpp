@@ -0,0 +1,39 @@
+#include "ut_helper.h"
+#include "dash/dashtagmgr.h"
+
+namespace dashtagmgr_test
+{
+    using namespace std;
+
+    sai_ip_prefix_t v4Prefix(const string &ip, const string &mask)
+    {
+        sai_ip_prefix_t prefix = {};
+        prefix.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        prefix.addr.ip4 = swss::IpAddress(ip).getV4Addr();
+        prefix.mask.ip4 = swss::IpAddress(mask).getV4Addr();
+        return prefix;
+    }
+
+    TEST(DashTagMgrTest, DiffPrefixes)
+    {
+        auto p1 = v4Prefix("10.0.0.0", "255.255.255.0");
+        auto p2 = v4Prefix("10.0.1.0", "255.255.255.0");
+        auto p3 = v4Prefix("10.0.2.0", "255.255.255.0");
+        auto p4 = v4Prefix("10.0.2.0", "255.255.0.0");
+
+        vector<sai_ip_prefix_t> added;
+        vector<sai_ip_prefix_t> removed;
+
+        // Same prefixes in another order
+        diffPrefixes({ p1, p2 }, { p2, p1 }, added, removed);
+        ASSERT_TRUE(added.empty());
+        ASSERT_TRUE(removed.empty());
+
+        // One prefix replaced, a mask change counts as a new prefix
+        diffPrefixes({ p1, p2, p3 }, { p1, p2, p4, p4 }, added, removed);
+        ASSERT_EQ(added.size(), 1u);
+        ASSERT_EQ(added[0].mask.ip4, p4.mask.ip4);
+        ASSERT_EQ(removed.size(), 1u);
+        ASSERT_EQ(removed[0].mask.ip4, p3.mask.ip4);
+    }
+}
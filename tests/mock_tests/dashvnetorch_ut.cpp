@@ -17,7 +17,9 @@
 #include "gtest/gtest.h"
 #include "crmorch.h"
 #include "table.h"
+#include "dash/taskworker.h"
 
+#include <chrono>
 #include <deque>
 
 EXTERN_MOCK_FNS
@@ -696,4 +698,109 @@ namespace dashvnetorch_test
         found = getResultEntry(APP_DASH_VNET_TABLE_NAME, vnet1, values);
         EXPECT_FALSE(found);
     }
+
+    TEST(DashVnetMapParse, ArenaParse)
+    {
+        auto makeEntry = [](uint32_t underlay_ip, bool use_dst_vni) {
+            dash::vnet_mapping::VnetMapping vnet_map;
+            vnet_map.set_routing_type(dash::route_type::ROUTING_TYPE_VNET_ENCAP);
+            vnet_map.mutable_underlay_ip()->set_ipv4(underlay_ip);
+            if (use_dst_vni)
+            {
+                vnet_map.set_mac_address(std::string("\x00\x11\x22\x33\x44\x55", 6));
+                vnet_map.set_use_dst_vni(true);
+            }
+            return std::vector<swss::FieldValueTuple>{{"pb", vnet_map.SerializeAsString()}};
+        };
+
+        // Messages of a batch share the arena and keep their own values
+        google::protobuf::Arena arena;
+        std::vector<dash::vnet_mapping::VnetMapping *> batch;
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            auto vnet_map = parsePbMessage<dash::vnet_mapping::VnetMapping>(makeEntry(0x0a000000 + i, i % 2 == 0), arena);
+            ASSERT_NE(vnet_map, nullptr);
+            EXPECT_EQ(vnet_map->GetArena(), &arena);
+            batch.push_back(vnet_map);
+        }
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(batch[i]->underlay_ip().ipv4(), 0x0a000000 + i);
+            EXPECT_EQ(batch[i]->use_dst_vni(), i % 2 == 0);
+            EXPECT_EQ(batch[i]->mac_address().size(), i % 2 == 0 ? 6u : 0u);
+        }
+
+        // The arena of the next batch starts from scratch
+        arena.Reset();
+        auto vnet_map = parsePbMessage<dash::vnet_mapping::VnetMapping>(makeEntry(0x0b000001, false), arena);
+        ASSERT_NE(vnet_map, nullptr);
+        EXPECT_EQ(vnet_map->underlay_ip().ipv4(), 0x0b000001u);
+        EXPECT_FALSE(vnet_map->use_dst_vni());
+        EXPECT_TRUE(vnet_map->mac_address().empty());
+
+        // A reused message does not keep the fields of the previous entry
+        dash::vnet_mapping::VnetMapping reused;
+        ASSERT_TRUE(parsePbMessage(makeEntry(0x0a000001, true), reused));
+        EXPECT_TRUE(reused.use_dst_vni());
+        ASSERT_TRUE(parsePbMessage(makeEntry(0x0a000002, false), reused));
+        EXPECT_EQ(reused.underlay_ip().ipv4(), 0x0a000002u);
+        EXPECT_FALSE(reused.use_dst_vni());
+        EXPECT_TRUE(reused.mac_address().empty());
+
+        // Entries without a valid message are rejected
+        EXPECT_EQ(parsePbMessage<dash::vnet_mapping::VnetMapping>({{"other", "value"}}, arena), nullptr);
+        EXPECT_EQ(parsePbMessage<dash::vnet_mapping::VnetMapping>({{"pb", "\xff\xff\xff"}}, arena), nullptr);
+    }
+
+    // Opt-in benchmark, run with --gtest_also_run_disabled_tests
+    // --gtest_filter=DashVnetMapParse.DISABLED_ArenaParseBenchmark
+    TEST(DashVnetMapParse, DISABLED_ArenaParseBenchmark)
+    {
+        // Outbound CA to PA entries as delivered to doTaskVnetMapTable,
+        // cycled to parse 1M entries in batches of the pool size
+        const size_t pool_size = 1024;
+        const size_t entries = 1000000;
+
+        std::vector<std::vector<swss::FieldValueTuple>> pool(pool_size);
+        for (size_t i = 0; i < pool_size; i++)
+        {
+            dash::vnet_mapping::VnetMapping vnet_map;
+            vnet_map.set_routing_type(dash::route_type::ROUTING_TYPE_VNET_ENCAP);
+            vnet_map.mutable_underlay_ip()->set_ipv4(static_cast<uint32_t>(0x0a000000 + i));
+            vnet_map.set_mac_address(std::string("\x00\x11\x22\x33\x44\x55", 6));
+            vnet_map.set_use_dst_vni(true);
+            pool[i] = {{"pb", vnet_map.SerializeAsString()}};
+        }
+
+        // One message per entry, parsed from a copy of the field
+        auto start = std::chrono::steady_clock::now();
+        size_t parsed = 0;
+        for (size_t i = 0; i < entries; i++)
+        {
+            dash::vnet_mapping::VnetMapping vnet_map;
+            auto pb = swss::fvsGetValue(pool[i % pool_size], "pb");
+            parsed += (pb && vnet_map.ParseFromString(*pb)) ? 1 : 0;
+        }
+        auto copy_elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        EXPECT_EQ(parsed, entries);
+
+        // One arena per batch, parsed in place
+        start = std::chrono::steady_clock::now();
+        parsed = 0;
+        for (size_t batch = 0; batch < entries; batch += pool_size)
+        {
+            google::protobuf::Arena arena;
+            for (size_t i = 0; i < pool_size && batch + i < entries; i++)
+            {
+                auto vnet_map = parsePbMessage<dash::vnet_mapping::VnetMapping>(pool[i], arena);
+                parsed += (vnet_map && vnet_map->use_dst_vni()) ? 1 : 0;
+            }
+        }
+        auto arena_elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        EXPECT_EQ(parsed, entries);
+
+        std::cout << "Parsed " << entries << " CA to PA entries, "
+                  << copy_elapsed.count() / static_cast<long long>(entries) << " ns per entry with copies, "
+                  << arena_elapsed.count() / static_cast<long long>(entries) << " ns per entry with arenas" << std::endl;
+    }
 }
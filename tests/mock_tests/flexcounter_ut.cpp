@@ -1251,4 +1251,55 @@ namespace flexcounter_test
                                          }
                                      }));
     }
+
+    TEST_F(StandaloneFCTest, TestCachingHold)
+    {
+        mockFlexCounterOperationCallCount = 0;
+
+        gTraditionalFlexCounter = false;
+        FlexCounterTaggedCachedManager<void> port_stat_manager(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, 1000, false);
+        FlexCounterTaggedCachedManager<void> rif_stat_manager(RIF_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, 1000, false);
+
+        sai_object_id_t port1_oid = 0x100000000000d;
+        sai_object_id_t port2_oid = 0x100000000000e;
+        sai_object_id_t rif_oid = 0x6000000000001;
+
+        // The same stats inserted in another order share one pending entry
+        std::unordered_set<string> stats = {
+            "SAI_PORT_STAT_IF_IN_OCTETS",
+            "SAI_PORT_STAT_IF_IN_ERRORS"
+        };
+        std::unordered_set<string> reordered_stats;
+        reordered_stats.insert("SAI_PORT_STAT_IF_IN_ERRORS");
+        reordered_stats.insert("SAI_PORT_STAT_IF_IN_OCTETS");
+
+        g_FlexManagerDirectory.holdRegistrations();
+        g_FlexManagerDirectory.holdRegistrations();
+        ASSERT_TRUE(g_FlexManagerDirectory.isHoldingRegistrations());
+
+        port_stat_manager.setCounterIdList(port1_oid, CounterType::PORT, stats);
+        port_stat_manager.flush();
+        port_stat_manager.setCounterIdList(port2_oid, CounterType::PORT, reordered_stats);
+        port_stat_manager.flush();
+        rif_stat_manager.setCounterIdList(rif_oid, CounterType::RIF, { "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS" });
+        rif_stat_manager.flush();
+
+        // Nothing is sent while registrations are held
+        ASSERT_EQ(mockFlexCounterOperationCallCount, 0u);
+        ASSERT_EQ(g_FlexManagerDirectory.releaseRegistrations(), 0u);
+        ASSERT_EQ(mockFlexCounterOperationCallCount, 0u);
+
+        // The last release sends one operation per manager and stats list
+        ASSERT_EQ(g_FlexManagerDirectory.releaseRegistrations(), 2u);
+        ASSERT_FALSE(g_FlexManagerDirectory.isHoldingRegistrations());
+        ASSERT_EQ(mockFlexCounterOperationCallCount, 2u);
+
+        ASSERT_TRUE(checkFlexCounter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, port2_oid,
+                                     {
+                                         {PORT_COUNTER_ID_LIST,
+                                          "SAI_PORT_STAT_IF_IN_ERRORS,"
+                                          "SAI_PORT_STAT_IF_IN_OCTETS"
+                                         }
+                                     }));
+    }
 }
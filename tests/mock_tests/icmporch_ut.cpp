@@ -98,4 +98,37 @@ namespace icmporch_test
                 SaiOffloadHandlerStatus::SUCCESS_VALID_ENTRY);
         EXPECT_EQ(h.create(makeMinimalIcmpSessionFvs()), SaiOffloadHandlerStatus::SUCCESS_VALID_ENTRY);
     }
+
+    /**
+     * SaiOffloadStateBatch keeps the last state of each session, in first seen order.
+     */
+    TEST(SaiOffloadStateBatchTest, KeepsLastStatePerSession)
+    {
+        SaiOffloadStateBatch<sai_icmp_echo_api_t> batch;
+
+        sai_icmp_echo_session_state_notification_t first[] = {
+            {0x1, SAI_ICMP_ECHO_SESSION_STATE_UP},
+            {0x2, SAI_ICMP_ECHO_SESSION_STATE_UP},
+        };
+        sai_icmp_echo_session_state_notification_t second[] = {
+            {0x1, SAI_ICMP_ECHO_SESSION_STATE_DOWN},
+            {0x3, SAI_ICMP_ECHO_SESSION_STATE_DOWN},
+            {0x2, SAI_ICMP_ECHO_SESSION_STATE_DOWN},
+            {0x2, SAI_ICMP_ECHO_SESSION_STATE_UP},
+        };
+        batch.add(2, first);
+        batch.add(4, second);
+
+        const auto& states = batch.states();
+        ASSERT_EQ(states.size(), 3u);
+        EXPECT_EQ(states[0].first, 0x1u);
+        EXPECT_EQ(states[0].second, SAI_ICMP_ECHO_SESSION_STATE_DOWN);
+        EXPECT_EQ(states[1].first, 0x2u);
+        EXPECT_EQ(states[1].second, SAI_ICMP_ECHO_SESSION_STATE_UP);
+        EXPECT_EQ(states[2].first, 0x3u);
+        EXPECT_EQ(states[2].second, SAI_ICMP_ECHO_SESSION_STATE_DOWN);
+
+        batch.clear();
+        EXPECT_TRUE(batch.states().empty());
+    }
 } // namespace icmporch_test
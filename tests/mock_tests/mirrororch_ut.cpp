@@ -53,5 +53,41 @@ namespace mirrororch_test
         auto ret = gMirrorOrch->setUnsetPortMirror(dummyPort, /*ingress*/ false, /*set*/ true, /*sessionId*/ SAI_NULL_OBJECT_ID);
         ASSERT_FALSE(ret);
     }
-}
 
+    TEST_F(MirrorOrchTest, NeighborUpdatesAreCoalesced)
+    {
+        const string name = "coalesced_session";
+        ASSERT_EQ(gMirrorOrch->createEntry(name, {
+                    { "src_ip", "1.1.1.1" },
+                    { "dst_ip", "2.2.2.2" },
+                }), task_process_status::task_success);
+        gMirrorOrch->resolveSessions();
+
+        // The session is indexed under its destination IP
+        auto sessions = gMirrorOrch->getDependentSessions("IP|2.2.2.2");
+        ASSERT_EQ(sessions, vector<string>({ name }));
+
+        // Several updates of the same neighbor mark the session once
+        NeighborUpdate update = { NeighborEntry("2.2.2.2", "Ethernet0"), MacAddress("00:01:02:03:04:05"), true };
+        gMirrorOrch->update(SUBJECT_TYPE_NEIGH_CHANGE, &update);
+        update.add = false;
+        gMirrorOrch->update(SUBJECT_TYPE_NEIGH_CHANGE, &update);
+        ASSERT_EQ(gMirrorOrch->m_dirtySessions.size(), 1u);
+
+        // Unrelated neighbors do not touch the session
+        NeighborUpdate other = { NeighborEntry("3.3.3.3", "Ethernet0"), MacAddress("00:01:02:03:04:06"), true };
+        gMirrorOrch->update(SUBJECT_TYPE_NEIGH_CHANGE, &other);
+        ASSERT_EQ(gMirrorOrch->m_dirtySessions.size(), 1u);
+
+        // No neighbor is known, so the session stays inactive
+        gMirrorOrch->resolveSessions();
+        ASSERT_TRUE(gMirrorOrch->m_dirtySessions.empty());
+        bool active = true;
+        ASSERT_TRUE(gMirrorOrch->getSessionStatus(name, active));
+        ASSERT_FALSE(active);
+
+        ASSERT_EQ(gMirrorOrch->deleteEntry(name), task_process_status::task_success);
+        ASSERT_TRUE(gMirrorOrch->getDependentSessions("IP|2.2.2.2").empty());
+        ASSERT_EQ(gMirrorOrch->m_sessionDependencies.count(name), 0u);
+    }
+}
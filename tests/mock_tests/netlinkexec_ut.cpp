@@ -0,0 +1,79 @@
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+#include "gtest/gtest.h"
+#include "netns_test.h"
+#include "netlinkexec.h"
+
+extern std::vector<std::string> mockCallArgs;
+
+namespace netlinkexec_test
+{
+    using namespace std;
+    using namespace swss;
+
+    static int getMtu(const string &name)
+    {
+        struct ifreq ifr;
+        memset(&ifr, 0, sizeof(ifr));
+        strncpy(ifr.ifr_name, name.c_str(), IFNAMSIZ - 1);
+
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        int ret = ioctl(fd, SIOCGIFMTU, &ifr);
+        close(fd);
+        return ret < 0 ? -1 : ifr.ifr_mtu;
+    }
+
+    class NetlinkExecutorTest : public netns_test::NetworkNamespaceTest
+    {
+    };
+
+    TEST_F(NetlinkExecutorTest, BatchInNetworkNamespace)
+    {
+        bool flushed = false;
+        vector<NetlinkExecutor::Error> errors;
+        size_t pending = 0;
+        int mtu = 0;
+        bool bridge_exists = false;
+        size_t shell_calls = 0;
+
+        ASSERT_TRUE(runInNetworkNamespace([&]() {
+            NetlinkExecutor executor;
+            mockCallArgs.clear();
+
+            executor.setContext("Bridge");
+            executor.addLink("Bridge", "bridge", true);
+            executor.setLinkMtu("Bridge", 9100);
+            executor.setContext("Ethernet0");
+            executor.setLinkMtu("Ethernet0", 9100);
+            pending = executor.pending();
+
+            flushed = executor.flush(errors);
+            mtu = getMtu("Bridge");
+            bridge_exists = if_nametoindex("Bridge") != 0;
+
+            // The shell fallback runs after the queued requests
+            executor.setLinkAdminState("Bridge", false);
+            string res;
+            executor.exec("/bin/true", res);
+            shell_calls = mockCallArgs.size();
+            EXPECT_EQ(executor.pending(), 0u);
+        }));
+
+        ASSERT_EQ(pending, 3u);
+        ASSERT_FALSE(flushed);
+        ASSERT_TRUE(bridge_exists);
+        ASSERT_EQ(mtu, 9100);
+        ASSERT_EQ(shell_calls, 1u);
+
+        // Only the request on the missing link fails, it is reported as its command and context
+        ASSERT_EQ(errors.size(), 1u);
+        ASSERT_EQ(errors[0].op, "ip link set Ethernet0 mtu 9100");
+        ASSERT_EQ(errors[0].error, ENODEV);
+        ASSERT_EQ(errors[0].context, "Ethernet0");
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <sched.h>
+#include <functional>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace netns_test
+{
+    /*
+     * Fixture of the tests that need a private network namespace, with its
+     * own links and conntrack table. The namespace is per thread, so the test
+     * code runs in its own thread, and the test is skipped when it cannot
+     * create one.
+     */
+    class NetworkNamespaceTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            if (!runInNetworkNamespace([]() {}))
+            {
+                GTEST_SKIP() << "Cannot create a network namespace";
+            }
+        }
+
+        /* Runs fn in a new network namespace, returns false if it cannot be created */
+        static bool runInNetworkNamespace(const std::function<void()> &fn)
+        {
+            bool in_netns = false;
+
+            std::thread t([&]() {
+                if (unshare(CLONE_NEWNET) < 0)
+                {
+                    return;
+                }
+                in_netns = true;
+                fn();
+            });
+            t.join();
+
+            return in_netns;
+        }
+    };
+}
@@ -5,6 +5,7 @@
 #define private public 
 #include "linksync.h"
 #undef private
+#include "linkindex.h"
 
 struct if_nameindex *if_ni_mock = NULL;
 
@@ -229,10 +230,6 @@ namespace portsyncd_ut
             if (fvField(value) == "speed") {ASSERT_EQ(fvValue(value), "10000");}
         }
 
-        /* Verify if the internal strctures are updated as expected */
-        ASSERT_NE(sync.m_ifindexNameMap.find(142), sync.m_ifindexNameMap.end());
-        ASSERT_EQ(sync.m_ifindexNameMap[142], "Ethernet0");
-
         /* Free Nl_object */
         free_nlobj(msg);
     }
@@ -305,4 +302,56 @@ namespace portsyncd_ut
         std::vector<swss::FieldValueTuple> ovalues;
         ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), false);
     }
+
+    TEST_F(PortSyncdTest, test_linkIndexIncrementalUpdate){
+        swss::LinkIndex index;
+        std::vector<unsigned int> flags = {IFF_UP};
+
+        struct nl_object* vrf = draft_nlmsg("Vrf1", flags, "vrf", "1c:34:da:1c:9f:01", 200, 9100, 0);
+        struct nl_object* vlan = draft_nlmsg("Vlan100", flags, "bridge", "1c:34:da:1c:9f:02", 300, 9100, 200);
+        struct nl_object* sparse = draft_nlmsg("Ethernet8", flags, "", "1c:34:da:1c:9f:03", 70000, 9100, 300);
+        index.onMsg(RTM_NEWLINK, vrf);
+        index.onMsg(RTM_NEWLINK, vlan);
+        index.onMsg(RTM_NEWLINK, sparse);
+
+        ASSERT_EQ(index.size(), 3u);
+        ASSERT_EQ(index.getIfindex("Vlan100"), 300);
+        ASSERT_EQ(index.getMaster(300), 200);
+        ASSERT_EQ(index.isVrf(200), true);
+        ASSERT_EQ(index.isVrf(300), false);
+
+        std::string name;
+        ASSERT_EQ(index.getMasterName(300, name), true);
+        ASSERT_EQ(name, "Vrf1");
+        ASSERT_EQ(index.getMasterName(70000, name), true);
+        ASSERT_EQ(name, "Vlan100");
+        ASSERT_EQ(index.getSlaves(200), std::vector<int>({300}));
+        ASSERT_EQ(index.getSlaves(300), std::vector<int>({70000}));
+
+        /* Rename keeps the ifindex but drops the old name */
+        struct nl_object* renamed = draft_nlmsg("Vlan200", flags, "bridge", "1c:34:da:1c:9f:02", 300, 9100, 200);
+        index.onMsg(RTM_NEWLINK, renamed);
+        ASSERT_EQ(index.size(), 3u);
+        ASSERT_EQ(index.getIfindex("Vlan100"), 0);
+        ASSERT_EQ(index.getIfindex("Vlan200"), 300);
+
+        /* Moving a link to another master updates both slave lists */
+        struct nl_object* moved = draft_nlmsg("Ethernet8", flags, "", "1c:34:da:1c:9f:03", 70000, 9100, 200);
+        index.onMsg(RTM_NEWLINK, moved);
+        ASSERT_EQ(index.getSlaves(200), std::vector<int>({300, 70000}));
+        ASSERT_EQ(index.getSlaves(300).empty(), true);
+
+        index.onMsg(RTM_DELLINK, renamed);
+        index.onMsg(RTM_DELLINK, sparse);
+        ASSERT_EQ(index.size(), 1u);
+        ASSERT_EQ(index.getSlaves(200).empty(), true);
+        ASSERT_EQ(index.get(300), nullptr);
+        ASSERT_EQ(index.getName(70000, name), false);
+
+        free_nlobj(vrf);
+        free_nlobj(vlan);
+        free_nlobj(sparse);
+        free_nlobj(renamed);
+        free_nlobj(moved);
+    }
 }
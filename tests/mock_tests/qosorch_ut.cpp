@@ -38,6 +38,37 @@ namespace qosorch_test
     sai_set_switch_attribute_fn old_set_switch_attribute_fn;
     sai_switch_api_t ut_sai_switch_api, *pold_sai_switch_api;
     sai_tunnel_api_t ut_sai_tunnel_api, *pold_sai_tunnel_api;
+    sai_port_api_t ut_sai_port_api, *pold_sai_port_api;
+
+    // Bulk port set calls seen, and the port on which QoS map sets must fail
+    vector<vector<pair<sai_object_id_t, sai_attribute_t>>> sai_set_ports_attribute_calls;
+    sai_object_id_t sai_set_ports_attribute_failing_port;
+
+    sai_status_t _ut_stub_sai_set_ports_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        vector<pair<sai_object_id_t, sai_attribute_t>> call;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            call.emplace_back(object_id[i], attr_list[i]);
+        }
+        sai_set_ports_attribute_calls.push_back(call);
+
+        auto rc = pold_sai_port_api->set_ports_attribute(object_count, object_id, attr_list, mode, object_statuses);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (object_id[i] == sai_set_ports_attribute_failing_port && attr_list[i].id == SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP)
+            {
+                object_statuses[i] = SAI_STATUS_FAILURE;
+                rc = SAI_STATUS_FAILURE;
+            }
+        }
+        return rc;
+    }
 
     typedef struct
     {
@@ -332,6 +363,12 @@ namespace qosorch_test
             pold_sai_tunnel_api = sai_tunnel_api;
             ut_sai_tunnel_api = *pold_sai_tunnel_api;
             sai_tunnel_api = &ut_sai_tunnel_api;
+            pold_sai_port_api = sai_port_api;
+            ut_sai_port_api = *pold_sai_port_api;
+            sai_port_api = &ut_sai_port_api;
+            ut_sai_port_api.set_ports_attribute = _ut_stub_sai_set_ports_attribute;
+            sai_set_ports_attribute_calls.clear();
+            sai_set_ports_attribute_failing_port = SAI_NULL_OBJECT_ID;
             ut_sai_tunnel_api.set_tunnel_attribute = _ut_stub_sai_set_tunnel_attribute;
             ut_sai_tunnel_api.create_tunnel = _ut_stub_sai_create_tunnel;
             ut_sai_tunnel_api.create_tunnel_term_table_entry = _ut_stub_sai_create_tunnel_term_table_entry;
@@ -626,6 +663,7 @@ namespace qosorch_test
             sai_wred_api = pold_sai_wred_api;
             sai_switch_api = pold_sai_switch_api;
             sai_tunnel_api = pold_sai_tunnel_api;
+            sai_port_api = pold_sai_port_api;
             ut_helper::uninitSaiApi();
         }
     };
@@ -1632,4 +1670,80 @@ namespace qosorch_test
         static_cast<Orch *>(tunnel_decap_orch)->doTask();
         entries.clear();
     }
+
+    TEST_F(QosOrchTest, QosOrchTestPortQosMapBulkRollback)
+    {
+        Port ethernet0, ethernet4;
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", ethernet0));
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet4", ethernet4));
+
+        // Fail the DSCP to TC map of Ethernet4 only
+        sai_set_ports_attribute_failing_port = ethernet4.m_port_id;
+        sai_set_ports_attribute_calls.clear();
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"Ethernet0,Ethernet4", "SET",
+                           {
+                               {"dscp_to_tc_map", "AZURE"},
+                               {"tc_to_queue_map", "AZURE"}
+                           }});
+        auto consumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_PORT_QOS_MAP_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        // Both ports are set in one bulk call, then the maps of Ethernet4 are rolled back
+        ASSERT_EQ(sai_set_ports_attribute_calls.size(), 2u);
+        ASSERT_EQ(sai_set_ports_attribute_calls[0].size(), 4u);
+
+        const auto &rollback = sai_set_ports_attribute_calls[1];
+        ASSERT_EQ(rollback.size(), 1u);
+        ASSERT_EQ(rollback[0].first, ethernet4.m_port_id);
+        ASSERT_EQ(rollback[0].second.id, SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP);
+        ASSERT_EQ(rollback[0].second.value.oid, SAI_NULL_OBJECT_ID);
+
+        // The failed task is not retried
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        // Ethernet0 keeps its maps
+        sai_attribute_t attr;
+        attr.id = SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP;
+        ASSERT_EQ(sai_port_api->get_port_attribute(ethernet0.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(attr.value.oid, (*QosOrch::getTypeMap()[CFG_TC_TO_QUEUE_MAP_TABLE_NAME])["AZURE"].m_saiObjectId);
+
+        attr.id = SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP;
+        ASSERT_EQ(sai_port_api->get_port_attribute(ethernet4.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(attr.value.oid, SAI_NULL_OBJECT_ID);
+    }
+
+    TEST_F(QosOrchTest, ObjectReferenceLists)
+    {
+        type_map maps = {
+            {"PROFILE", make_shared<object_reference_map>()},
+            {"PG", make_shared<object_reference_map>()}
+        };
+        (*maps["PROFILE"])["p0"].m_saiObjectId = 0x100;
+        (*maps["PROFILE"])["p1"].m_saiObjectId = 0x101;
+
+        // A list is parsed once, the cached list is returned for the same string
+        const auto &refs = Orch::getObjectReferences("PROFILE:p0,PROFILE:p1");
+        ASSERT_EQ(refs.size(), 2u);
+        ASSERT_EQ(&refs, &Orch::getObjectReferences("PROFILE:p0,PROFILE:p1"));
+        ASSERT_EQ(refs[1].m_table, "PROFILE");
+        ASSERT_EQ(refs[1].m_name, "p1");
+        ASSERT_EQ(Orch::getObjectReferences("PROFILE:p0,malformed").size(), 1u);
+
+        gQosOrch->setObjectReference(maps, "PG", "Ethernet0:0", "profile", "PROFILE:p0,PROFILE:p1");
+        ASSERT_TRUE(gQosOrch->isObjectBeingReferenced(maps, "PROFILE", "p0"));
+        ASSERT_TRUE(gQosOrch->isObjectBeingReferenced(maps, "PROFILE", "p1"));
+
+        // Replacing the reference drops the old one
+        gQosOrch->setObjectReference(maps, "PG", "Ethernet0:0", "profile", "PROFILE:p1");
+        ASSERT_FALSE(gQosOrch->isObjectBeingReferenced(maps, "PROFILE", "p0"));
+        ASSERT_EQ((*maps["PG"])["Ethernet0:0"].m_objsReferencingByMe["profile"], "PROFILE:p1");
+
+        // Removing the referencing object releases the referenced ones
+        gQosOrch->removeObject(maps, "PG", "Ethernet0:0");
+        ASSERT_FALSE(gQosOrch->isObjectBeingReferenced(maps, "PROFILE", "p1"));
+        ASSERT_EQ(maps["PROFILE"]->size(), 2u);
+    }
 }
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include "notificationconsumer.h"
+#include "select.h"
+
 using namespace swss;
 
 TEST(ResponsePublisher, TestPublish)
@@ -58,3 +61,52 @@ TEST(ResponsePublisher, TestPublishEnableDbWrite)
     ASSERT_EQ(value, "new-value");
 }
 
+
+TEST(ResponsePublisher, TestPublishBufferedNotifications)
+{
+    DBConnector conn{"APPL_STATE_DB", 0};
+    NotificationConsumer consumer{&conn, "APPL_DB_SOME_TABLE_RESPONSE_CHANNEL"};
+    ResponsePublisher publisher{"APPL_STATE_DB", /*buffered=*/true};
+
+    publisher.publish("SOME_TABLE", "KEY_1", {{"field", "value"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("SOME_TABLE", "KEY_2", {{"field", "value"}}, ReturnCode(SAI_STATUS_FAILURE));
+    publisher.flush();
+
+    Select s;
+    s.addSelectable(&consumer);
+    Selectable *sel;
+    ASSERT_EQ(s.select(&sel, 1000), Select::OBJECT);
+
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+    ASSERT_EQ(entries.size(), 2u);
+
+    EXPECT_EQ(kfvKey(entries[0]), "SWSS_RC_SUCCESS");
+    EXPECT_EQ(kfvOp(entries[0]), "KEY_1");
+    ASSERT_EQ(kfvFieldsValues(entries[0]).size(), 2u);
+    EXPECT_EQ(fvField(kfvFieldsValues(entries[0])[0]), "err_str");
+    EXPECT_EQ(fvField(kfvFieldsValues(entries[0])[1]), "field");
+
+    EXPECT_EQ(kfvKey(entries[1]), "SWSS_RC_UNKNOWN");
+    EXPECT_EQ(kfvOp(entries[1]), "KEY_2");
+}
+
+TEST(ResponsePublisher, TestPublishDbWriteThread)
+{
+    DBConnector conn{"APPL_STATE_DB", 0};
+    Table stateTable{&conn, "SOME_TABLE"};
+    std::string value;
+
+    {
+        ResponsePublisher publisher{"APPL_STATE_DB", /*buffered=*/true, /*db_write_thread=*/true};
+        publisher.publish("SOME_TABLE", "KEY_1", {{"field", "value-1"}}, ReturnCode(SAI_STATUS_SUCCESS));
+        publisher.publish("SOME_TABLE", "KEY_2", {{"field", "value-2"}}, ReturnCode(SAI_STATUS_SUCCESS));
+        publisher.publish("SOME_TABLE", "KEY_1", {}, ReturnCode(SAI_STATUS_SUCCESS));
+        publisher.flush();
+        // The destructor waits for the queued writes.
+    }
+
+    EXPECT_FALSE(stateTable.hget("KEY_1", "field", value));
+    ASSERT_TRUE(stateTable.hget("KEY_2", "field", value));
+    EXPECT_EQ(value, "value-2");
+}
@@ -19,6 +19,7 @@ DEFINE_SAI_API_MOCK(srv6, my_sid);
 
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 using namespace mock_orch_test;
 
 class Srv6OrchMySidTest : public MockOrchTest
@@ -113,4 +114,58 @@ TEST_F(Srv6OrchMySidTest, MySidEntryCreation_WithoutDecapDscpMode)
     runAppMySidTask(app_key, "un", "default", "");
 }
 
+TEST_F(Srv6OrchMySidTest, MySidEntriesProgrammedInBulk)
+{
+    ASSERT_NE(gSrv6Orch, nullptr);
+
+    const vector<string> app_keys = {"32:16:16:0:fc00:0:1:1::", "32:16:16:0:fc00:0:1:2::"};
+
+    auto bulk_success = [](uint32_t object_count, sai_status_t *object_statuses)
+    {
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+
+    EXPECT_CALL(*mock_sai_srv6_api, create_my_sid_entry(_, _, _)).Times(0);
+    EXPECT_CALL(*mock_sai_srv6_api, create_my_sid_entries(2, _, _, _, _, _))
+        .WillOnce(Invoke([&](uint32_t object_count, const sai_my_sid_entry_t *, const uint32_t *,
+                             const sai_attribute_t **, sai_bulk_op_error_mode_t, sai_status_t *object_statuses) {
+            return bulk_success(object_count, object_statuses);
+        }));
+    EXPECT_CALL(*mock_sai_srv6_api, remove_my_sid_entries(2, _, _, _))
+        .WillOnce(Invoke([&](uint32_t object_count, const sai_my_sid_entry_t *, sai_bulk_op_error_mode_t,
+                             sai_status_t *object_statuses) {
+            return bulk_success(object_count, object_statuses);
+        }));
+
+    auto* consumer = dynamic_cast<Consumer*>(static_cast<Orch*>(gSrv6Orch)->getExecutor(APP_SRV6_MY_SID_TABLE_NAME));
+    ASSERT_NE(consumer, nullptr);
+
+    // Both entries of the batch are created with one bulk call
+    deque<KeyOpFieldsValuesTuple> entries;
+    for (const auto& key : app_keys)
+    {
+        entries.push_back({key, SET_COMMAND, {{"action", "un"}, {"vrf", "default"}}});
+    }
+    consumer->addToSync(entries);
+    static_cast<Orch*>(gSrv6Orch)->doTask(*consumer);
+
+    ASSERT_EQ(gSrv6Orch->srv6_my_sid_table_.size(), 2u);
+    ASSERT_TRUE(gSrv6Orch->m_mysid_bulk_ctx.empty());
+
+    // And removed with one bulk call
+    entries.clear();
+    for (const auto& key : app_keys)
+    {
+        entries.push_back({key, DEL_COMMAND, {}});
+    }
+    consumer->addToSync(entries);
+    static_cast<Orch*>(gSrv6Orch)->doTask(*consumer);
+
+    ASSERT_TRUE(gSrv6Orch->srv6_my_sid_table_.empty());
+}
+
 } // namespace srv6orch_test
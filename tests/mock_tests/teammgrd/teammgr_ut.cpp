@@ -2,6 +2,7 @@
 #include "../mock_table.h"
 #include "teammgr.h"
 #include <dlfcn.h>
+#include <mutex>
 #include <net/if.h>
 #include <netlink/addr.h>
 #include <netlink/netlink.h>
@@ -188,6 +189,10 @@ FILE* fopen64(const char *pathname, const char *mode)
 
 int cb(const std::string &cmd, std::string &stdout)
 {
+    // teamd is started from several threads
+    static std::mutex cbMutex;
+    std::lock_guard<std::mutex> lock(cbMutex);
+
     mockCallArgs.push_back(cmd);
     if (cmd.find("/usr/bin/teamd -r -t PortChannel382") != std::string::npos)
     {
@@ -376,6 +381,67 @@ namespace teammgr_ut
         EXPECT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count(), 200);
     }
 
+    TEST_F(TeamMgrTest, testParallelLagBringupRecordsLatency)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
+        for (int i = 600; i < 604; i++)
+        {
+            cfg_lag_table.set(std::string("PortChannel") + std::to_string(i), { { "admin_status", "up" },
+                    { "mtu", "9100" } });
+        }
+        teammgr.addExistingData(&cfg_lag_table);
+        teammgr.doTask();
+
+        // All the teamd are started before the port channels are configured
+        ASSERT_EQ(mockCallArgs.size(), 12u);
+        for (size_t i = 0; i < 4; i++)
+        {
+            EXPECT_NE(mockCallArgs[i].find("/usr/bin/teamd -r -t PortChannel60"), std::string::npos);
+        }
+
+        swss::Table bringupTable(m_state_db.get(), STATE_LAG_BRINGUP_TABLE_NAME);
+        for (int i = 600; i < 604; i++)
+        {
+            std::vector<swss::FieldValueTuple> values;
+            ASSERT_TRUE(bringupTable.get(std::string("PortChannel") + std::to_string(i), values));
+            EXPECT_TRUE(swss::fvsGetValue(values, "teamd_ready_ms", true));
+            EXPECT_TRUE(swss::fvsGetValue(values, "bringup_ms", true));
+        }
+    }
+
+    TEST_F(TeamMgrTest, testAddLagMembersInOneCommand)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::Table state_lag_table(m_state_db.get(), STATE_LAG_TABLE_NAME);
+        swss::Table state_port_table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+        swss::Table cfg_lag_member_table(m_config_db.get(), CFG_LAG_MEMBER_TABLE_NAME);
+
+        state_lag_table.set("PortChannel1", { { "state", "ok" } });
+        state_port_table.set("Ethernet0", { { "state", "ok" } });
+        state_port_table.set("Ethernet4", { { "state", "ok" } });
+        cfg_lag_member_table.set("PortChannel1|Ethernet0", { { "NULL", "NULL" } });
+        cfg_lag_member_table.set("PortChannel1|Ethernet4", { { "NULL", "NULL" } });
+
+        teammgr.addExistingData(&cfg_lag_member_table);
+        teammgr.doTask();
+
+        // One command enslaves both members, one sets their admin status
+        ASSERT_EQ(mockCallArgs.size(), 2u);
+        EXPECT_NE(mockCallArgs[0].find("port add \"Ethernet0\""), std::string::npos);
+        EXPECT_NE(mockCallArgs[0].find("port add \"Ethernet4\""), std::string::npos);
+        EXPECT_NE(mockCallArgs[1].find("link set dev \"Ethernet0\""), std::string::npos);
+        EXPECT_NE(mockCallArgs[1].find("link set dev \"Ethernet4\""), std::string::npos);
+        // A member failing to come up does not stop the others
+        EXPECT_NE(mockCallArgs[1].find("|| /bin/echo \"Ethernet0\";"), std::string::npos);
+        EXPECT_EQ(mockCallArgs[1].find("&&"), std::string::npos);
+
+        swss::Table appPortTable(m_app_db.get(), APP_PORT_TABLE_NAME);
+        std::vector<swss::FieldValueTuple> values;
+        EXPECT_TRUE(appPortTable.get("Ethernet0", values));
+        EXPECT_TRUE(appPortTable.get("Ethernet4", values));
+    }
+
     TEST_F(TeamMgrTest, testSetLagSysmacUpdatesKernelAppAndState)
     {
         swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
@@ -0,0 +1,160 @@
+#include <net/if.h>
+
+#include "gtest/gtest.h"
+#define protected public
+#include "orch.h"
+#undef protected
+#include "mock_table.h"
+#include "netns_test.h"
+#include "warm_restart.h"
+#define private public
+#include "vlanmgr.h"
+#undef private
+
+extern swss::MacAddress gMacAddress;
+
+namespace vlanmgr_ut
+{
+    using namespace std;
+    using namespace swss;
+
+    /*
+     * VlanMgr sends its host changes to the kernel of a private network
+     * namespace. The Bridge and the member ports are created by the test, as
+     * the bridge setup of the constructor goes to the mocked shell.
+     */
+    class VlanMgrTest : public netns_test::NetworkNamespaceTest
+    {
+    protected:
+        shared_ptr<DBConnector> m_app_db;
+        shared_ptr<DBConnector> m_config_db;
+        shared_ptr<DBConnector> m_state_db;
+
+        void SetUp() override
+        {
+            NetworkNamespaceTest::SetUp();
+            if (IsSkipped())
+            {
+                return;
+            }
+
+            bool supported = false;
+            runInNetworkNamespace([&]() {
+                NetlinkExecutor executor;
+                executor.addLink("Bridge", "bridge");
+                executor.addLink("Ethernet0", "dummy");
+                executor.addVlanLink("Vlan10", "Bridge", 10);
+                executor.addBridgeVlan("Bridge", 10, false, false, true);
+
+                vector<NetlinkExecutor::Error> errors;
+                supported = executor.flush(errors);
+            });
+            if (!supported)
+            {
+                GTEST_SKIP() << "Kernel without bridge VLAN, vlan or dummy link support";
+            }
+
+            ::testing_db::reset();
+            m_app_db = make_shared<DBConnector>("APPL_DB", 0);
+            m_config_db = make_shared<DBConnector>("CONFIG_DB", 0);
+            m_state_db = make_shared<DBConnector>("STATE_DB", 0);
+
+            WarmStart::initialize("vlanmgrd", "swss");
+            gMacAddress = MacAddress("00:01:02:03:04:05");
+
+            Table state_port_table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+            state_port_table.set("Ethernet0", { { "state", "ok" } });
+        }
+
+        shared_ptr<VlanMgr> createVlanMgr()
+        {
+            vector<string> cfg_vlan_tables = {
+                CFG_VLAN_TABLE_NAME,
+                CFG_VLAN_MEMBER_TABLE_NAME,
+            };
+            vector<string> state_vlan_tables = {
+                STATE_OPER_PORT_TABLE_NAME,
+                STATE_OPER_FDB_TABLE_NAME,
+                STATE_OPER_VLAN_MEMBER_TABLE_NAME,
+            };
+            return make_shared<VlanMgr>(m_config_db.get(), m_app_db.get(), m_state_db.get(),
+                                        cfg_vlan_tables, state_vlan_tables);
+        }
+
+        static void addLink(const string &name, const string &kind)
+        {
+            NetlinkExecutor executor;
+            executor.addLink(name, kind, true);
+            executor.flushOrThrow();
+        }
+
+        static Consumer *getConsumer(VlanMgr &vlanMgr, const string &table)
+        {
+            return dynamic_cast<Consumer *>(vlanMgr.getExecutor(table));
+        }
+
+        static void doTask(VlanMgr &vlanMgr, const string &table, const deque<KeyOpFieldsValuesTuple> &entries)
+        {
+            getConsumer(vlanMgr, table)->addToSync(entries);
+            static_cast<Orch &>(vlanMgr).doTask();
+        }
+    };
+
+    TEST_F(VlanMgrTest, FailedMemberIsRetried)
+    {
+        ASSERT_TRUE(runInNetworkNamespace([&]() {
+            addLink("Bridge", "bridge");
+            auto vlanMgr = createVlanMgr();
+
+            doTask(*vlanMgr, CFG_VLAN_TABLE_NAME, { { "Vlan10", SET_COMMAND, { { "admin_status", "up" } } } });
+            EXPECT_NE(if_nametoindex("Vlan10"), 0u);
+            EXPECT_TRUE(getConsumer(*vlanMgr, CFG_VLAN_TABLE_NAME)->m_toSync.empty());
+            EXPECT_TRUE(vlanMgr->isVlanStateOk("Vlan10"));
+
+            // The port is ready in the state db but has no link yet, the member stays in m_toSync
+            doTask(*vlanMgr, CFG_VLAN_MEMBER_TABLE_NAME,
+                   { { "Vlan10|Ethernet0", SET_COMMAND, { { "tagging_mode", "untagged" } } } });
+            EXPECT_EQ(getConsumer(*vlanMgr, CFG_VLAN_MEMBER_TABLE_NAME)->m_toSync.size(), 1u);
+            EXPECT_FALSE(vlanMgr->isVlanMemberStateOk("Vlan10|Ethernet0"));
+            EXPECT_EQ(vlanMgr->m_PortVlanMember["Ethernet0"].count("Vlan10"), 0u);
+
+            // The retry applies it once the link exists
+            addLink("Ethernet0", "dummy");
+            static_cast<Orch &>(*vlanMgr).doTask();
+            EXPECT_TRUE(getConsumer(*vlanMgr, CFG_VLAN_MEMBER_TABLE_NAME)->m_toSync.empty());
+            EXPECT_TRUE(vlanMgr->isVlanMemberStateOk("Vlan10|Ethernet0"));
+            EXPECT_EQ(vlanMgr->m_PortVlanMember["Ethernet0"]["Vlan10"], "untagged");
+
+            vector<FieldValueTuple> values;
+            Table app_vlan_member_table(m_app_db.get(), APP_VLAN_MEMBER_TABLE_NAME);
+            EXPECT_TRUE(app_vlan_member_table.get("Vlan10:Ethernet0", values));
+        }));
+    }
+
+    TEST_F(VlanMgrTest, SameKeyDelAndSetAreAppliedInOrder)
+    {
+        ASSERT_TRUE(runInNetworkNamespace([&]() {
+            addLink("Bridge", "bridge");
+            auto vlanMgr = createVlanMgr();
+
+            doTask(*vlanMgr, CFG_VLAN_TABLE_NAME, { { "Vlan10", SET_COMMAND, { { "admin_status", "up" } } } });
+            unsigned int ifindex = if_nametoindex("Vlan10");
+            EXPECT_NE(ifindex, 0u);
+
+            // The DEL is applied before the SET, which creates the VLAN again
+            doTask(*vlanMgr, CFG_VLAN_TABLE_NAME, {
+                { "Vlan10", DEL_COMMAND, { } },
+                { "Vlan10", SET_COMMAND, { { "admin_status", "up" } } },
+            });
+            EXPECT_TRUE(getConsumer(*vlanMgr, CFG_VLAN_TABLE_NAME)->m_toSync.empty());
+            EXPECT_NE(if_nametoindex("Vlan10"), 0u);
+            EXPECT_NE(if_nametoindex("Vlan10"), ifindex);
+            EXPECT_EQ(vlanMgr->m_vlans.count("Vlan10"), 1u);
+            EXPECT_TRUE(vlanMgr->isVlanStateOk("Vlan10"));
+
+            vector<FieldValueTuple> values;
+            Table app_vlan_table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+            EXPECT_TRUE(app_vlan_table.get("Vlan10", values));
+        }));
+    }
+}
@@ -0,0 +1,206 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#define private public
+#include "vnetorch.h"
+#undef private
+#include "mock_orchagent_main.h"
+#include "mock_sai_api.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+EXTERN_MOCK_FNS
+
+namespace vnetorch_test
+{
+    DEFINE_SAI_API_MOCK_SPECIFY_ENTRY_WITH_SET(route, route);
+    DEFINE_SAI_GENERIC_API_OBJECT_BULK_MOCK(next_hop_group, next_hop_group_member);
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const string VNET_NAME = "Vnet1";
+    static const string TUNNEL_NAME = "tunnel_v4";
+    static const string ROUTE_PREFIX = "10.0.0.0/24";
+    static const string ENDPOINT1 = "1.1.1.1";
+    static const string ENDPOINT2 = "2.2.2.2";
+
+    class VNetRouteOrchTest : public MockOrchTest
+    {
+    protected:
+        VNetRouteOrch *m_vnetRouteOrch;
+
+        void ApplySaiMock() override
+        {
+            INIT_SAI_API_MOCK(route);
+            INIT_SAI_API_MOCK(next_hop_group);
+            MockSaiApis();
+        }
+
+        void PostSetUp() override
+        {
+            gTunneldecapOrch = m_TunnelDecapOrch;
+
+            TableConnector stateDbBfdSessionTable(m_state_db.get(), STATE_BFD_SESSION_TABLE_NAME);
+            gBfdOrch = new BfdOrch(m_app_db.get(), APP_BFD_SESSION_TABLE_NAME, stateDbBfdSessionTable);
+            ut_orch_list.push_back((Orch **)&gBfdOrch);
+            global_orch_list.insert((Orch **)&gBfdOrch);
+
+            vector<string> vnet_tables = {
+                APP_VNET_RT_TABLE_NAME,
+                APP_VNET_RT_TUNNEL_TABLE_NAME
+            };
+            m_vnetRouteOrch = new VNetRouteOrch(m_app_db.get(), vnet_tables, m_vnetOrch);
+            gDirectory.set(m_vnetRouteOrch);
+            ut_orch_list.push_back((Orch **)&m_vnetRouteOrch);
+
+            auto consumer = unique_ptr<Consumer>(new Consumer(
+                new swss::ConsumerStateTable(m_app_db.get(), APP_VXLAN_TUNNEL_TABLE_NAME, 1, 1),
+                                             m_VxlanTunnelOrch, APP_VXLAN_TUNNEL_TABLE_NAME));
+            consumer->addToSync({ { TUNNEL_NAME, SET_COMMAND, { { "src_ip", "10.10.10.10" } } } });
+            static_cast<Orch2 *>(m_VxlanTunnelOrch)->doTask(*consumer.get());
+
+            auto vnet_consumer = dynamic_cast<Consumer *>(m_vnetOrch->getExecutor(APP_VNET_TABLE_NAME));
+            vnet_consumer->addToSync({ { VNET_NAME, SET_COMMAND, { { "vxlan_tunnel", TUNNEL_NAME },
+                                                                   { "vni", "1000" } } } });
+            static_cast<Orch *>(m_vnetOrch)->doTask();
+            ASSERT_TRUE(m_vnetOrch->isVnetExists(VNET_NAME));
+        }
+
+        void PreTearDown() override
+        {
+            RestoreSaiApis();
+            DEINIT_SAI_API_MOCK(next_hop_group);
+            DEINIT_SAI_API_MOCK(route);
+            gTunneldecapOrch = nullptr;
+        }
+
+        void SetTunnelRoute(const vector<FieldValueTuple> &fvs)
+        {
+            auto consumer = dynamic_cast<Consumer *>(m_vnetRouteOrch->getExecutor(APP_VNET_RT_TUNNEL_TABLE_NAME));
+            consumer->addToSync({ { VNET_NAME + ":" + ROUTE_PREFIX, SET_COMMAND, fvs } });
+            static_cast<Orch *>(m_vnetRouteOrch)->doTask();
+            EXPECT_TRUE(consumer->m_toSync.empty());
+        }
+
+        void SetMonitoredTunnelRoute()
+        {
+            string endpoints = ENDPOINT1 + "," + ENDPOINT2;
+            SetTunnelRoute({ { "endpoint", endpoints }, { "endpoint_monitor", endpoints } });
+        }
+
+        void UpdateBfdState(const string &endpoint, sai_bfd_session_state_t state)
+        {
+            BfdUpdate update{ "default:default:" + endpoint, state };
+            m_vnetRouteOrch->update(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, &update);
+        }
+
+        // The group of both endpoints of the route
+        NextHopGroupInfo *GetNextHopGroup()
+        {
+            for (auto &nhg : m_vnetRouteOrch->syncd_nexthop_groups_[VNET_NAME])
+            {
+                if (nhg.first.getSize() == 2)
+                {
+                    return &nhg.second;
+                }
+            }
+            return nullptr;
+        }
+
+        bool HasTunnelRoute()
+        {
+            auto &routes = m_vnetRouteOrch->syncd_tunnel_routes_[VNET_NAME];
+            return routes.find(IpPrefix(ROUTE_PREFIX)) != routes.end();
+        }
+    };
+
+    TEST_F(VNetRouteOrchTest, BfdFlapIsCoalesced)
+    {
+        SetMonitoredTunnelRoute();
+        ASSERT_NE(GetNextHopGroup(), nullptr);
+        EXPECT_TRUE(GetNextHopGroup()->active_members.empty());
+
+        // The endpoint goes up and down again before the updates are applied
+        EXPECT_CALL(*mock_sai_next_hop_group_api, create_next_hop_group_members).Times(0);
+        EXPECT_CALL(*mock_sai_next_hop_group_api, remove_next_hop_group_members).Times(0);
+        EXPECT_CALL(*mock_sai_route_api, create_route_entries).Times(0);
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries).Times(0);
+        UpdateBfdState(ENDPOINT1, SAI_BFD_SESSION_STATE_UP);
+        UpdateBfdState(ENDPOINT1, SAI_BFD_SESSION_STATE_DOWN);
+        static_cast<Orch *>(m_vnetRouteOrch)->doTask();
+
+        EXPECT_TRUE(GetNextHopGroup()->active_members.empty());
+        EXPECT_TRUE(m_vnetRouteOrch->pending_bfd_updates_.empty());
+    }
+
+    TEST_F(VNetRouteOrchTest, FirstAndLastMemberProgramRoute)
+    {
+        SetMonitoredTunnelRoute();
+        ASSERT_NE(GetNextHopGroup(), nullptr);
+        EXPECT_TRUE(GetNextHopGroup()->active_members.empty());
+
+        // The first member creates the route
+        EXPECT_CALL(*mock_sai_next_hop_group_api, create_next_hop_group_members).Times(1);
+        EXPECT_CALL(*mock_sai_route_api, create_route_entries).Times(1);
+        UpdateBfdState(ENDPOINT1, SAI_BFD_SESSION_STATE_UP);
+        static_cast<Orch *>(m_vnetRouteOrch)->doTask();
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_next_hop_group_api);
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_route_api);
+        EXPECT_EQ(GetNextHopGroup()->active_members.size(), 1u);
+
+        // The second member is added to the group of the route
+        EXPECT_CALL(*mock_sai_next_hop_group_api, create_next_hop_group_members).Times(1);
+        EXPECT_CALL(*mock_sai_route_api, create_route_entries).Times(0);
+        EXPECT_CALL(*mock_sai_route_api, set_route_entries_attribute).Times(0);
+        UpdateBfdState(ENDPOINT2, SAI_BFD_SESSION_STATE_UP);
+        static_cast<Orch *>(m_vnetRouteOrch)->doTask();
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_next_hop_group_api);
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_route_api);
+        EXPECT_EQ(GetNextHopGroup()->active_members.size(), 2u);
+
+        // A member is removed from the group of the route
+        EXPECT_CALL(*mock_sai_next_hop_group_api, remove_next_hop_group_members).Times(1);
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries).Times(0);
+        UpdateBfdState(ENDPOINT1, SAI_BFD_SESSION_STATE_DOWN);
+        static_cast<Orch *>(m_vnetRouteOrch)->doTask();
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_next_hop_group_api);
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_route_api);
+        EXPECT_EQ(GetNextHopGroup()->active_members.size(), 1u);
+
+        // The last member removes the route
+        EXPECT_CALL(*mock_sai_next_hop_group_api, remove_next_hop_group_members).Times(1);
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries).Times(1);
+        UpdateBfdState(ENDPOINT2, SAI_BFD_SESSION_STATE_DOWN);
+        static_cast<Orch *>(m_vnetRouteOrch)->doTask();
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_next_hop_group_api);
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_route_api);
+        EXPECT_TRUE(GetNextHopGroup()->active_members.empty());
+    }
+
+    TEST_F(VNetRouteOrchTest, FailedBulkMemberCreateRemovesGroup)
+    {
+        // The last member of the bulk fails, the created one is removed with the group
+        EXPECT_CALL(*mock_sai_next_hop_group_api, create_next_hop_group_members)
+            .WillOnce([](sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count,
+                         const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+                         sai_object_id_t *object_id, sai_status_t *object_statuses) {
+                old_sai_next_hop_group_api->create_next_hop_group_members(switch_id, object_count - 1, attr_count,
+                                                                          attr_list, mode, object_id, object_statuses);
+                object_id[object_count - 1] = SAI_NULL_OBJECT_ID;
+                object_statuses[object_count - 1] = SAI_STATUS_FAILURE;
+                return SAI_STATUS_FAILURE;
+            });
+        EXPECT_CALL(*mock_sai_next_hop_group_api, remove_next_hop_group_members).Times(1);
+        EXPECT_CALL(*mock_sai_route_api, create_route_entries).Times(0);
+        SetTunnelRoute({ { "endpoint", ENDPOINT1 + "," + ENDPOINT2 } });
+
+        EXPECT_EQ(GetNextHopGroup(), nullptr);
+        EXPECT_EQ(m_vnetRouteOrch->endpoint_nexthop_groups_.count(VNET_NAME), 0u);
+        EXPECT_FALSE(HasTunnelRoute());
+    }
+}
@@ -42,6 +42,32 @@ namespace vxlanorch_test
     constexpr sai_object_id_t vxlan_tunnel_term_table_entry_oid = 0x1248;
     constexpr sai_object_id_t vxlan_tunnel_map_entry_oid = 0x1256;
 
+    uint32_t create_tunnels_calls = 0;
+    uint32_t create_tunnels_objects = 0;
+    std::vector<std::map<sai_attr_id_t, int32_t>> create_tunnels_attrs;
+
+    sai_status_t _ut_stub_create_tunnels(sai_object_id_t switch_id, uint32_t object_count,
+                                         const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                         sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id,
+                                         sai_status_t *object_statuses)
+    {
+        create_tunnels_calls++;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = vxlan_tunnel_oid + create_tunnels_objects++;
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+
+            std::map<sai_attr_id_t, int32_t> attrs;
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                const auto& attr = attr_list[i][j];
+                attrs[attr.id] = (attr.id == SAI_TUNNEL_ATTR_ENCAP_TTL_VAL) ? attr.value.u8 : attr.value.s32;
+            }
+            create_tunnels_attrs.push_back(attrs);
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
     class VxlanOrchTest : public ::testing::Test
     {
         public:
@@ -868,4 +894,57 @@ namespace vxlanorch_test
         EXPECT_FALSE(result);
     }
 
+    // Test bulk creation of the tunnels of a batch of remote VTEPs
+    TEST_F(VxlanOrchTest, DynamicDipTunnelBulkCreation)
+    {
+        initSwitchOrch();
+        initVxlanOrch();
+
+        string tunnel_name = "tunnel1";
+        CreateBasicVxlanTunnel(tunnel_name, "10.1.1.1");
+        VxlanTunnel* vtep = m_vxlan_tunnel_orch->getVxlanTunnel(tunnel_name);
+
+        auto saved_create_tunnels = sai_tunnel_api->create_tunnels;
+        sai_tunnel_api->create_tunnels = _ut_stub_create_tunnels;
+        create_tunnels_calls = 0;
+        create_tunnels_objects = 0;
+        create_tunnels_attrs.clear();
+
+        vtep->createDynamicDIPTunnels({ "10.1.1.2", "10.1.1.3", "10.1.1.2" });
+        EXPECT_EQ(create_tunnels_calls, 1u);
+        EXPECT_EQ(create_tunnels_objects, 2u);
+
+        // Same attributes as the single create path
+        ASSERT_EQ(create_tunnels_attrs.size(), 2u);
+        for (auto& attrs : create_tunnels_attrs)
+        {
+            EXPECT_EQ(attrs[SAI_TUNNEL_ATTR_TYPE], static_cast<int32_t>(SAI_TUNNEL_TYPE_VXLAN));
+            EXPECT_EQ(attrs[SAI_TUNNEL_ATTR_PEER_MODE], static_cast<int32_t>(SAI_TUNNEL_PEER_MODE_P2P));
+            EXPECT_EQ(attrs[SAI_TUNNEL_ATTR_ENCAP_TTL_MODE], static_cast<int32_t>(SAI_TUNNEL_TTL_MODE_PIPE_MODEL));
+            EXPECT_EQ(attrs[SAI_TUNNEL_ATTR_ENCAP_TTL_VAL], DEFAULT_TUNNEL_ENCAP_TTL);
+            EXPECT_TRUE(attrs.count(SAI_TUNNEL_ATTR_ENCAP_SRC_IP));
+            EXPECT_TRUE(attrs.count(SAI_TUNNEL_ATTR_ENCAP_DST_IP));
+        }
+
+        string dip_tunnel_name;
+        m_vxlan_tunnel_orch->getTunnelNameFromDIP("10.1.1.2", dip_tunnel_name);
+        ASSERT_TRUE(m_vxlan_tunnel_orch->isTunnelExists(dip_tunnel_name));
+        EXPECT_TRUE(m_vxlan_tunnel_orch->getVxlanTunnel(dip_tunnel_name)->isActive());
+
+        // The remote VTEP user takes the created tunnel, no other SAI call
+        EXPECT_TRUE(vtep->createDynamicDIPTunnel("10.1.1.2", TUNNEL_USER_IMR));
+        EXPECT_EQ(vtep->getRemoteEndPointIMRRefCnt("10.1.1.2"), 1);
+
+        // The tunnel without user is removed
+        EXPECT_CALL(mock_sai_tunnel_, remove_tunnel(_))
+            .WillOnce(Return(SAI_STATUS_SUCCESS));
+        vtep->removeUnusedDynamicDIPTunnels({ "10.1.1.2", "10.1.1.3" });
+        m_vxlan_tunnel_orch->getTunnelNameFromDIP("10.1.1.3", dip_tunnel_name);
+        EXPECT_FALSE(m_vxlan_tunnel_orch->isTunnelExists(dip_tunnel_name));
+        m_vxlan_tunnel_orch->getTunnelNameFromDIP("10.1.1.2", dip_tunnel_name);
+        EXPECT_TRUE(m_vxlan_tunnel_orch->isTunnelExists(dip_tunnel_name));
+
+        sai_tunnel_api->create_tunnels = saved_create_tunnels;
+    }
+
 } // namespace vxlanorch_test
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
@@ -2024,3 +2026,126 @@ TEST(request_parser, string_list_clear_test)
         FAIL() << "Got unexpected exception";
     }
 }
+
+TEST(request_parser, reused_request)
+{
+    // One request object parses a sequence of requests, as done by Orch2::doTask
+    KeyOpFieldsValuesTuple t1 {"key1|02:03:04:05:06:07|key2", "SET",
+                                 {
+                                     { "v4", "true" },
+                                     { "v6", "true" },
+                                     { "src_mac", "02:03:04:05:06:07" },
+                                     { "ttl_action", "copy" },
+                                     { "ip_opt_action", "drop" },
+                                     { "l3_mc_action", "log" },
+                                     { "just_string", "test_string" },
+                                     { "vlan", "Vlan50" },
+                                 }
+                              };
+    KeyOpFieldsValuesTuple t2 {"key3|f2:f3:f4:f5:f6:f7|key4", "SET",
+                                 {
+                                     { "v4", "false" },
+                                     { "src_mac", "f2:f3:f4:f5:f6:f7" },
+                                     { "just_string", "str" },
+                                 }
+                              };
+    KeyOpFieldsValuesTuple t3 {"key5|52:53:54:55:56:57|key6", "DEL", { } };
+
+    try
+    {
+        TestRequest2 request;
+
+        for (int i = 0; i < 2; i++)
+        {
+            EXPECT_NO_THROW(request.parse(t1));
+            EXPECT_STREQ(request.getFullKey().c_str(), "key1|02:03:04:05:06:07|key2");
+            EXPECT_STREQ(request.getKeyString(0).c_str(), "key1");
+            EXPECT_STREQ(request.getKeyMacAddress(1).to_string().c_str(), "02:03:04:05:06:07");
+            EXPECT_EQ(request.getAttrFieldNames().size(), 8u);
+            EXPECT_TRUE(request.getAttrBool("v6"));
+            EXPECT_EQ(request.getAttrPacketAction("ttl_action"), SAI_PACKET_ACTION_COPY);
+            EXPECT_STREQ(request.getAttrString("just_string").c_str(), "test_string");
+            EXPECT_EQ(request.getAttrVlan("vlan"), 50);
+            request.clear();
+
+            // The next request only sees its own key and attributes
+            EXPECT_NO_THROW(request.parse(t2));
+            EXPECT_STREQ(request.getFullKey().c_str(), "key3|f2:f3:f4:f5:f6:f7|key4");
+            EXPECT_STREQ(request.getKeyString(0).c_str(), "key3");
+            EXPECT_STREQ(request.getKeyMacAddress(1).to_string().c_str(), "f2:f3:f4:f5:f6:f7");
+            EXPECT_STREQ(request.getKeyString(2).c_str(), "key4");
+            EXPECT_TRUE(request.getAttrFieldNames() == (std::unordered_set<std::string>{"v4", "src_mac", "just_string"}));
+            EXPECT_FALSE(request.getAttrBool("v4"));
+            EXPECT_STREQ(request.getAttrMacAddress("src_mac").to_string().c_str(), "f2:f3:f4:f5:f6:f7");
+            EXPECT_STREQ(request.getAttrString("just_string").c_str(), "str");
+            EXPECT_THROW(request.getAttrBool("v6"), std::out_of_range);
+            EXPECT_THROW(request.getAttrPacketAction("ttl_action"), std::out_of_range);
+            EXPECT_THROW(request.getAttrVlan("vlan"), std::out_of_range);
+            request.clear();
+
+            EXPECT_NO_THROW(request.parse(t3));
+            EXPECT_STREQ(request.getOperation().c_str(), "DEL");
+            EXPECT_STREQ(request.getKeyString(0).c_str(), "key5");
+            EXPECT_TRUE(request.getAttrFieldNames().empty());
+            EXPECT_THROW(request.getAttrString("just_string"), std::out_of_range);
+            request.clear();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        FAIL() << "Got unexpected exception " << e.what();
+    }
+    catch (...)
+    {
+        FAIL() << "Got unexpected exception";
+    }
+}
+
+// Opt-in benchmark, run with --gtest_also_run_disabled_tests
+// --gtest_filter=request_parser.DISABLED_reused_request_benchmark
+TEST(request_parser, DISABLED_reused_request_benchmark)
+{
+    // Requests of the simpleKey and simpleKey_ipv6 cases, parsed by one
+    // reused request object as done by Orch2::doTask
+    const std::vector<KeyOpFieldsValuesTuple> requests = {
+        {"key1|02:03:04:05:06:07|key2", "SET",
+            {
+                { "v4", "true" },
+                { "v6", "true" },
+                { "src_mac", "02:03:04:05:06:07" },
+                { "ttl_action", "copy" },
+                { "ip_opt_action", "drop" },
+                { "l3_mc_action", "log" },
+                { "just_string", "123" },
+                { "vlan", "Vlan300" },
+            }
+        },
+        {"key1|f2:f3:f4:f5:f6:f7|key2", "SET",
+            {
+                { "src_mac", "f2:f3:f4:f5:f6:f7" },
+                { "just_string", "456" },
+            }
+        },
+        {"key1|52:53:54:55:56:57|key2", "DEL", { }},
+    };
+    const int rounds = 20000;
+
+    TestRequest2 request;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+    {
+        for (const auto& t: requests)
+        {
+            request.parse(t);
+            if (request.getOperation() == "SET")
+            {
+                EXPECT_EQ(request.getAttrString("just_string").size(), 3u);
+            }
+            request.clear();
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "Parsed " << rounds * requests.size() << " requests, "
+              << elapsed.count() / static_cast<long long>(rounds * requests.size()) << " ns per request" << std::endl;
+}